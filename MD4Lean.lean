@@ -60,6 +60,26 @@ def MD_FLAG_WIKILINKS : UInt32 := 0x2000
 def MD_FLAG_UNDERLINE : UInt32 := 0x4000
 /-- Force all soft breaks to act as hard breaks. -/
 def MD_FLAG_HARD_SOFT_BREAKS : UInt32 := 0x8000
+/-- With the flag `MD_FLAG_PARALLELBLOCKS`, the block structure of huge
+  documents is analyzed on multiple threads. The result is the same as without
+  the flag. (Only supported on non-Windows platforms; ignored elsewhere.) -/
+def MD_FLAG_PARALLELBLOCKS : UInt32 := 0x10000
+/-- With the flag `MD_FLAG_PARALLELINLINES`, the contents of leaf blocks
+  (paragraphs, headers, tables, ...) is processed on multiple threads. The result
+  is the same as without the flag. (Only supported on non-Windows platforms;
+  ignored elsewhere.) -/
+def MD_FLAG_PARALLELINLINES : UInt32 := 0x20000
+/-- With the flag `MD_FLAG_COALESCETEXT`, consecutive pieces of normal text (which md4c
+  delivers split at backslash escapes, rejected emphasis marks etc.) are merged into a single
+  `Text.normal` by `parse` and `parseSlices`. This is handled by md4lean, not md4c, and has no
+  effect on rendering. -/
+def MD_FLAG_COALESCETEXT : UInt32 := 0x80000000
+/-- With the flag `MD_FLAG_DECODEENTITIES`, `parse` and `parseSlices` decode known named
+  entities and numeric character references into the surrounding `Text.normal` and
+  `AttrText.normal` (so this implies `MD_FLAG_COALESCETEXT`); only unknown named entities are
+  left as `entity` nodes. Invalid numeric references decode to U+FFFD. This is handled by
+  md4lean, not md4c, and has no effect on rendering. -/
+def MD_FLAG_DECODEENTITIES : UInt32 := 0x40000000
 
 /-- Enable all auto-linking. -/
 def MD_FLAG_PERMISSIVEAUTOLINKS : UInt32 := MD_FLAG_PERMISSIVEEMAILAUTOLINKS |||
@@ -113,7 +133,8 @@ inductive AttrText where
   /--
   An HTML entity as a complete string, e.g. `"&nbsp;"`.
 
-  No validation is performed, anything that's syntactically an entity uses this constructor.
+  No validation is performed, anything that's syntactically an entity uses this constructor,
+  unless `MD_FLAG_DECODEENTITIES` is set.
   -/
   | entity : String → AttrText
   /-- A null character -/
@@ -135,7 +156,8 @@ inductive Text where
   /--
   An HTML entity as a complete string, e.g. `"&nbsp;"`.
 
-  No validation is performed, anything that's syntactically an entity uses this constructor.
+  No validation is performed, anything that's syntactically an entity uses this constructor,
+  unless `MD_FLAG_DECODEENTITIES` is set.
   -/
   | entity : String → Text
   /-- Emphasized text, typically italic -/
@@ -227,6 +249,163 @@ structure Document where
   blocks : Array Block
 deriving Inhabited, Repr, BEq
 
+/-! ## AST of slices
+
+An alternative AST made by `parseSlices`. It has the same shape as the one above, but its texts are
+`Slice`s of the input string instead of copies of them.
+-/
+
+/--
+A view of the byte range from `start` to `stop` of `source`.
+
+The slices made by `parseSlices` share one reference to the input string. Texts which don't occur
+verbatim in the input (such as link titles with escapes or entities resolved) are slices of a
+string of their own.
+-/
+structure Slice where
+  /-- The string the slice is a part of -/
+  source : String
+  /-- The byte position where the slice starts -/
+  start : Nat
+  /-- The byte position where the slice ends (exclusive) -/
+  stop : Nat
+deriving Inhabited
+
+/-- Copies the contents of the slice into a new string. -/
+@[extern "lean_md4c_slice_to_string"]
+opaque Slice.toString (s : @& Slice) : String
+
+instance : ToString Slice := ⟨Slice.toString⟩
+
+instance : Repr Slice := ⟨fun s _ => repr s.toString⟩
+
+/-- Slices are equal if their contents are. -/
+instance : BEq Slice := ⟨fun s t => s.toString == t.toString⟩
+
+namespace Slices
+
+/-- Like `MD4Lean.AttrText`, with `Slice`s of the input as texts. -/
+inductive AttrText where
+  /-- Normal text -/
+  | normal : Slice → AttrText
+  /-- An HTML entity as a complete string, e.g. `"&nbsp;"` -/
+  | entity : Slice → AttrText
+  /-- A null character -/
+  | nullchar : AttrText
+deriving Inhabited, Repr, BEq
+
+/-- Like `MD4Lean.Text`, with `Slice`s of the input as texts. -/
+inductive Text where
+  /-- Normal text -/
+  | normal : Slice → Text
+  /-- A null character -/
+  | nullchar
+  /-- A hard line break -/
+  | br : Slice → Text
+  /-- A soft line break -/
+  | softbr : Slice → Text
+  /-- An HTML entity as a complete string, e.g. `"&nbsp;"` -/
+  | entity : Slice → Text
+  /-- Emphasized text -/
+  | em : Array Text → Text
+  /-- Strong emphasis -/
+  | strong : Array Text → Text
+  /-- Underlined text -/
+  | u : Array Text → Text
+  /-- A link. See `MD4Lean.Text.a`. -/
+  | a (href title : Array AttrText) (isAuto : Bool) : Array Text → Text
+  /-- An image. See `MD4Lean.Text.img`. -/
+  | img (src title : Array AttrText) (alt : Array Text) : Text
+  /-- Code -/
+  | code : Array Slice → Text
+  /-- Deleted text -/
+  | del : Array Text → Text
+  /-- An inline LaTeX math element -/
+  | latexMath : Array Slice → Text
+  /-- A display LaTeX math element -/
+  | latexMathDisplay : Array Slice → Text
+  /-- A wiki-style link -/
+  | wikiLink (target : Array AttrText) : Array Text → Text
+deriving Inhabited, Repr, BEq
+
+/-- Like `MD4Lean.Block`, with `Slice`s of the input as texts. -/
+inductive Block where
+  /-- A paragraph -/
+  | p : Array Text → Block
+  /-- An unordered list -/
+  | ul (tight : Bool) (mark : Char) : Array (Li Block) → Block
+  /-- An ordered list -/
+  | ol (tight : Bool) (start : Nat) (mark : Char) : Array (Li Block) → Block
+  /-- A thematic break -/
+  | hr
+  /-- A header -/
+  | header : Nat → Array Text → Block
+  /-- A code block. See `MD4Lean.Block.code`. -/
+  | code (info lang : Array AttrText) (fenceChar : Option Char) : Array Slice → Block
+  /-- Inline HTML block -/
+  | html : Array Slice → Block
+  /-- A block quote -/
+  | blockquote : Array Block → Block
+  /-- A table. See `MD4Lean.Block.table`. -/
+  | table (head : Array (Array Text)) (body : Array (Array (Array Text))) : Block
+deriving Inhabited, Repr, BEq
+
+/-- Like `MD4Lean.Document`, with `Slice`s of the input as texts. -/
+structure Document where
+  /-- The block-level elements of the document -/
+  blocks : Array Block
+deriving Inhabited, Repr, BEq
+
+/-- Copies the texts into strings. -/
+def AttrText.toAttrText : AttrText → MD4Lean.AttrText
+  | .normal s => .normal s.toString
+  | .entity s => .entity s.toString
+  | .nullchar => .nullchar
+
+/-- Copies the texts into strings. -/
+partial def Text.toText : Text → MD4Lean.Text
+  | .normal s => .normal s.toString
+  | .nullchar => .nullchar
+  | .br s => .br s.toString
+  | .softbr s => .softbr s.toString
+  | .entity s => .entity s.toString
+  | .em xs => .em (xs.map Text.toText)
+  | .strong xs => .strong (xs.map Text.toText)
+  | .u xs => .u (xs.map Text.toText)
+  | .a href title isAuto xs =>
+    .a (href.map AttrText.toAttrText) (title.map AttrText.toAttrText) isAuto (xs.map Text.toText)
+  | .img src title alt =>
+    .img (src.map AttrText.toAttrText) (title.map AttrText.toAttrText) (alt.map Text.toText)
+  | .code ss => .code (ss.map Slice.toString)
+  | .del xs => .del (xs.map Text.toText)
+  | .latexMath ss => .latexMath (ss.map Slice.toString)
+  | .latexMathDisplay ss => .latexMathDisplay (ss.map Slice.toString)
+  | .wikiLink target xs => .wikiLink (target.map AttrText.toAttrText) (xs.map Text.toText)
+
+/-- Copies the texts into strings. -/
+partial def Block.toBlock : Block → MD4Lean.Block
+  | .p xs => .p (xs.map Text.toText)
+  | .ul tight mark items => .ul tight mark (items.map liToLi)
+  | .ol tight start mark items => .ol tight start mark (items.map liToLi)
+  | .hr => .hr
+  | .header level xs => .header level (xs.map Text.toText)
+  | .code info lang fenceChar ss =>
+    .code (info.map AttrText.toAttrText) (lang.map AttrText.toAttrText) fenceChar
+      (ss.map Slice.toString)
+  | .html ss => .html (ss.map Slice.toString)
+  | .blockquote bs => .blockquote (bs.map Block.toBlock)
+  | .table head body => .table (head.map (·.map Text.toText)) (body.map (·.map (·.map Text.toText)))
+where
+  liToLi (li : Li Block) : Li MD4Lean.Block :=
+    { isTask := li.isTask, taskChar := li.taskChar, taskMarkOffset := li.taskMarkOffset,
+      contents := li.contents.map Block.toBlock }
+
+/-- Copies the texts into strings, giving the same document as `parse` would. -/
+def Document.toDocument (doc : Document) : MD4Lean.Document :=
+  ⟨doc.blocks.map Block.toBlock⟩
+
+end Slices
+
 /-! ## Functions
 -/
 
@@ -249,6 +428,84 @@ opaque renderHtml (input : @& String)
       MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
     Option String
 
+/--
+Empties `buf`. Unlike `ByteArray.empty`, this keeps the allocated capacity of `buf` if it is not
+shared, which is useful for reusing one buffer with `renderHtmlInto`.
+-/
+@[extern "lean_md4c_clear_buffer"]
+def clearBuffer (buf : ByteArray) : ByteArray := buf.extract 0 0
+
+/--
+Render Markdown into HTML, appending the UTF-8 encoded output to `buf`.
+
+If `buf` is not shared, it is updated in place, so a single buffer can collect many renders (e.g.
+all the docstrings of a page), or be emptied with `clearBuffer` and reused for the next one,
+without allocating an intermediate `String` for each of them.
+
+- `buf` is the buffer to append to.
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+- `rendererFlags` is bitmask of `MD_HTML_FLAG_xxxx`.
+
+If render fails, `buf` is returned with its original contents.
+-/
+@[extern "lean_md4c_markdown_to_html_into"]
+opaque renderHtmlInto (buf : ByteArray) (input : @& String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    ByteArray
+
+/--
+Render Markdown into HTML, passing the output to `write` piece by piece as it is produced.
+
+The output is handed over in chunks of at most 64 KiB, so the HTML of the whole document is never
+held in memory at once. If `write` throws an error, rendering output stops and the error is
+rethrown.
+
+Returns `true` if rendering is successful. On `false`, the output written so far may be incomplete.
+-/
+@[extern "lean_md4c_markdown_to_html_write"]
+opaque renderHtmlWrite (write : @& (ByteArray → IO Unit)) (input : @& String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    IO Bool
+
+/--
+Render Markdown into HTML, writing it to the stream `h` as it is produced instead of building a
+`String`.
+
+- `h` is the output stream.
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+- `rendererFlags` is bitmask of `MD_HTML_FLAG_xxxx`.
+
+Return `true` if render is successful, otherwise return `false`; in that case, part of the output
+may already have been written to `h`.
+-/
+def renderHtmlTo (h : IO.FS.Stream) (input : String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    IO Bool :=
+  renderHtmlWrite h.write input parserFlags rendererFlags
+
+/--
+Render Markdown into HTML, writing it to the file handle `h` as it is produced.
+See `renderHtmlTo`.
+-/
+def renderHtmlToHandle (h : IO.FS.Handle) (input : String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    IO Bool :=
+  renderHtmlWrite h.write input parserFlags rendererFlags
+
 /--
 Parses Markdown into an AST.
 
@@ -260,4 +517,923 @@ Returns `some` if the underlying md4c parser succeeds, or `none` if it fails.
 @[extern "lean_md4c_markdown_parse"]
 opaque parse (input : @& String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) : Option Document
 
+/--
+Parses Markdown into an AST whose texts are `Slice`s of `input`.
+
+Unlike with `parse`, the texts are not copied, so the AST takes much less memory for large inputs.
+Use `Slices.Document.toDocument` to get the same result as `parse`.
+
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+
+Returns `some` if the underlying md4c parser succeeds, or `none` if it fails.
+-/
+@[extern "lean_md4c_markdown_parse_slices"]
+opaque parseSlices (input : @& String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) :
+    Option Slices.Document
+
+/--
+Render many Markdown documents into HTML, in parallel.
+
+The documents are distributed over a pool of native threads with work stealing, so that a few
+large documents do not hold up the rest of the batch. The result is the same as mapping
+`renderHtml` over `inputs`.
+
+- `inputs` are the input markdown strings.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+- `rendererFlags` is bitmask of `MD_HTML_FLAG_xxxx`.
+- `numThreads` is the number of threads to use, including the calling one. `0` means one thread
+  per available processor. (On Windows, the batch is always processed sequentially.)
+-/
+@[extern "lean_md4c_markdown_to_html_batch"]
+opaque renderHtmlBatch (inputs : @& Array String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR)
+    (numThreads : UInt32 := 0) :
+    Array (Option String)
+
+/--
+Parses many Markdown documents into ASTs, in parallel.
+
+The result is the same as mapping `parse` over `inputs`. See `renderHtmlBatch` for how the work is
+distributed.
+
+- `inputs` are the input markdown strings.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+- `numThreads` is the number of threads to use, including the calling one. `0` means one thread
+  per available processor.
+-/
+@[extern "lean_md4c_markdown_parse_batch"]
+opaque parseBatch (inputs : @& Array String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK)
+    (numThreads : UInt32 := 0) : Array (Option Document)
+
+/--
+Inputs of at least this many bytes are processed on a dedicated thread by default by
+`renderHtmlAsync` and `parseAsync`, so that large documents don't occupy the shared task pool.
+-/
+def asyncDedicatedThreshold : Nat := 1024 * 1024
+
+/--
+Render Markdown into HTML in a separate task. See `renderHtml`.
+
+- `prio` is the priority of the task.
+- `dedicatedThreshold` is the input size in bytes starting from which the task gets a dedicated
+  thread regardless of `prio`.
+-/
+def renderHtmlAsync (input : String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR)
+    (prio : Task.Priority := .default) (dedicatedThreshold : Nat := asyncDedicatedThreshold) :
+    Task (Option String) :=
+  let prio := if input.utf8ByteSize ≥ dedicatedThreshold then .dedicated else prio
+  Task.spawn (prio := prio) fun _ => renderHtml input parserFlags rendererFlags
+
+/--
+Parses Markdown into an AST in a separate task. See `parse`.
+
+- `prio` is the priority of the task.
+- `dedicatedThreshold` is the input size in bytes starting from which the task gets a dedicated
+  thread regardless of `prio`.
+-/
+def parseAsync (input : String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK)
+    (prio : Task.Priority := .default) (dedicatedThreshold : Nat := asyncDedicatedThreshold) :
+    Task (Option Document) :=
+  let prio := if input.utf8ByteSize ≥ dedicatedThreshold then .dedicated else prio
+  Task.spawn (prio := prio) fun _ => parse input parserFlags
+
+/-- The underlying type of `Parser`. -/
+opaque ParserPointed : NonemptyType
+
+/--
+A reusable parser. It keeps the internal buffers of md4c between documents, which saves
+allocating them anew for each one when parsing many (small) documents.
+
+A parser is meant to be used by one thread at a time, e.g. by creating one per thread. It is still
+safe to share it; the documents parsed while it is busy just don't benefit from it.
+-/
+def Parser : Type := ParserPointed.type
+
+instance : Nonempty Parser := ParserPointed.property
+
+namespace Parser
+
+/--
+Creates a parser.
+
+- `retainLimit` is the size in bytes up to which each buffer is kept after a document; larger
+  buffers (after an unusually large document) are released.
+-/
+@[extern "lean_md4c_parser_new"]
+opaque new (retainLimit : UInt32 := 1024 * 1024) : BaseIO Parser
+
+/-- Parses Markdown into an AST, the same as `MD4Lean.parse`. -/
+@[extern "lean_md4c_parser_parse"]
+opaque parse (parser : @& Parser) (input : @& String)
+    (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) : Option Document
+
+/-- Render Markdown into HTML, the same as `MD4Lean.renderHtml`. -/
+@[extern "lean_md4c_parser_render_html"]
+opaque renderHtml (parser : @& Parser) (input : @& String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    Option String
+
+end Parser
+
+/-- The underlying type of `RefDefTable`. -/
+opaque RefDefTablePointed : NonemptyType
+
+/--
+A precompiled set of link reference definitions (`[label]: /url "title"`), e.g. a glossary shared
+by many documents. With `parseWithRefDefs` and `renderHtmlWithRefDefs`, the labels which a document
+does not define itself are looked up in the table, as if the definitions were appended to the
+document, but without parsing them again for each document.
+
+The table is immutable, so it can be shared by any number of threads.
+-/
+def RefDefTable : Type := RefDefTablePointed.type
+
+instance : Nonempty RefDefTable := RefDefTablePointed.property
+
+namespace RefDefTable
+
+/--
+Compiles the reference definitions of a Markdown text into a table. Anything else in the text is
+ignored.
+
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`, which affects the block structure of the text.
+
+Returns `none` if the underlying md4c parser fails.
+-/
+@[extern "lean_md4c_ref_def_table_compile"]
+opaque compile (defs : @& String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) :
+    Option RefDefTable
+
+/-- The number of distinct labels defined by the table. -/
+@[extern "lean_md4c_ref_def_table_size"]
+opaque size (table : @& RefDefTable) : Nat
+
+end RefDefTable
+
+/-- Parses Markdown into an AST like `parse`, with `refDefs` as a fallback for the reference
+definitions of the document. -/
+@[extern "lean_md4c_markdown_parse_with_ref_defs"]
+opaque parseWithRefDefs (refDefs : @& RefDefTable) (input : @& String)
+    (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) : Option Document
+
+/-- Renders Markdown into HTML like `renderHtml`, with `refDefs` as a fallback for the reference
+definitions of the document. -/
+@[extern "lean_md4c_markdown_to_html_with_ref_defs"]
+opaque renderHtmlWithRefDefs (refDefs : @& RefDefTable) (input : @& String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    Option String
+
+/-- The underlying type of `StreamingParser`. -/
+opaque StreamingParserPointed : NonemptyType
+
+/--
+A parser for Markdown which arrives piece by piece (e.g. from a pipe, or as it is being
+generated). Each call to `feed` returns the top-level blocks which the input so far has shown to be
+complete, so the first blocks are available long before the end of a large document. Only the last
+top-level block, which may still continue, is held back until more input or `finish`.
+
+The blocks are the same as `parse` makes of the whole input, except that a link can only refer to
+a reference definition which precedes the top-level block of the link, or is within that block. This
+does not depend on how the input is split into pieces.
+
+A streaming parser parses one document at a time. The calls which find it busy in another thread
+return `none`.
+-/
+def StreamingParser : Type := StreamingParserPointed.type
+
+instance : Nonempty StreamingParser := StreamingParserPointed.property
+
+namespace StreamingParser
+
+/--
+Creates a streaming parser.
+
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`, as for `parse`.
+-/
+@[extern "lean_md4c_streaming_parser_new"]
+opaque new (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) : BaseIO StreamingParser
+
+/--
+Feeds the next piece of the document, which may end anywhere, even in the middle of a line.
+Returns the top-level blocks completed since the previous call.
+
+Returns `none` if the underlying md4c parser fails; the rest of the document is then ignored
+until `finish`.
+-/
+@[extern "lean_md4c_streaming_parser_feed"]
+opaque feed (parser : @& StreamingParser) (input : @& String) : BaseIO (Option (Array Block))
+
+/--
+Ends the document, returning its remaining blocks. The parser is then ready for the next document.
+-/
+@[extern "lean_md4c_streaming_parser_finish"]
+opaque finish (parser : @& StreamingParser) : BaseIO (Option (Array Block))
+
+end StreamingParser
+
+/--
+A point where a `ParsedDoc` can be split: the start of a line which begins a top-level block right
+after another one has ended (or after blank lines), outside of any list or block quote, or an ATX
+header (`# Title`) which ends a paragraph there. The text after it parses the same on its own as it
+does within the whole document. The end of the source is a boundary too if the text appended to it
+would parse on its own.
+-/
+structure ParsedDoc.Boundary where
+  /-- The byte position in the source -/
+  offset : Nat
+  /-- The number of top-level blocks before the boundary -/
+  blockCount : Nat
+  /-- The number of link reference definitions before the boundary -/
+  refDefCount : Nat
+deriving Inhabited, Repr, BEq
+
+/--
+A replacement of the bytes from `start` to `stop` (exclusive) of a source by `replacement`.
+-/
+structure ParsedDoc.Edit where
+  /-- The byte position where the replaced text starts -/
+  start : Nat
+  /-- The byte position where the replaced text ends (exclusive) -/
+  stop : Nat
+  /-- The new text -/
+  replacement : String
+deriving Inhabited, Repr, BEq
+
+/--
+A parsed document which remembers the boundaries between its top-level blocks, so that after an
+edit only the blocks around the edit need to be parsed again (see `ParsedDoc.reparse`).
+-/
+structure ParsedDoc where
+  /-- The Markdown source -/
+  source : String
+  /-- The bitmask of `MD_FLAG_xxxx` the source is parsed with -/
+  parserFlags : UInt32
+  /-- The document, the same as `parse source parserFlags` -/
+  document : Document
+  /-- The boundaries of the source, in increasing order -/
+  boundaries : Array ParsedDoc.Boundary
+  /-- The number of link reference definitions in the source -/
+  refDefCount : Nat
+  /-- The reference definitions of the source, if there are any -/
+  refDefs : Option RefDefTable
+
+namespace ParsedDoc
+
+/-- The result of `parseRange`. -/
+structure RangeResult where
+  /-- The top-level blocks of the range -/
+  blocks : Array Block
+  /-- The boundaries of the range, with the counts starting at the start of the range -/
+  boundaries : Array Boundary
+  /-- The number of link reference definitions in the range -/
+  refDefCount : Nat
+
+/--
+Parses the bytes from `start` to `stop` of `input` as a document, with `refDefs` as a fallback for
+its reference definitions. The offsets are offsets in `input`.
+-/
+@[extern "lean_md4c_parse_range"]
+opaque parseRange (refDefs : @& Option RefDefTable) (input : @& String) (start stop : @& Nat)
+    (parserFlags : UInt32) : Option RangeResult
+
+/--
+Parses Markdown into a `ParsedDoc`.
+
+Returns `none` if the underlying md4c parser fails.
+-/
+def parse (input : String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) : Option ParsedDoc := do
+  let r ← parseRange none input 0 input.utf8ByteSize parserFlags
+  let refDefs : Option RefDefTable ← if r.refDefCount == 0 then pure none else
+    (RefDefTable.compile input parserFlags).map some
+  return { source := input, parserFlags, document := ⟨r.blocks⟩, boundaries := r.boundaries,
+           refDefCount := r.refDefCount, refDefs }
+
+/-- Moves the task marks in the block by `delta` bytes. -/
+partial def shiftTaskMarks (delta : Int) : Block → Block
+  | .ul tight mark items => .ul tight mark (items.map shiftLi)
+  | .ol tight start mark items => .ol tight start mark (items.map shiftLi)
+  | .blockquote blocks => .blockquote (blocks.map (shiftTaskMarks delta))
+  | b => b
+where
+  shiftLi (li : Li Block) : Li Block :=
+    { li with
+      taskMarkOffset := li.taskMarkOffset.map fun off => ((off.toNat : Int) + delta).toNat.toUSize
+      contents := li.contents.map (shiftTaskMarks delta) }
+
+/-- The number of boundaries of the document at or before the byte position `pos`. -/
+def countBoundaries (doc : ParsedDoc) (pos : Nat) : Nat := Id.run do
+  let mut lo := 0
+  let mut hi := doc.boundaries.size
+  while lo < hi do
+    let mid := (lo + hi) / 2
+    if doc.boundaries[mid]!.offset ≤ pos then lo := mid + 1 else hi := mid
+  return lo
+
+/--
+Reparses `source`, the edited source of `doc`, from the boundary `start` up to the boundary `j` of
+`doc` (moved by `delta`), or up to the end if there is no such boundary. The range grows until it
+ends at a boundary of `source` too.
+-/
+private partial def reparseFrom (doc : ParsedDoc) (source : String) (delta : Int) (i : Nat)
+    (start : Boundary) (j : Nat) : Option ParsedDoc := do
+  let n := doc.boundaries.size
+  let stop := if j < n then ((doc.boundaries[j]!.offset : Int) + delta).toNat else source.utf8ByteSize
+  let refDefCount := if j < n then doc.boundaries[j]!.refDefCount else doc.refDefCount
+  -- A reference definition in the range may change the links anywhere
+  if refDefCount != start.refDefCount then
+    return (← ParsedDoc.parse source doc.parserFlags)
+  let r ← parseRange doc.refDefs source start.offset stop doc.parserFlags
+  if r.refDefCount != 0 then
+    return (← ParsedDoc.parse source doc.parserFlags)
+  let blockCount := start.blockCount + r.blocks.size
+  let boundaries := r.boundaries.map fun b =>
+    { b with blockCount := b.blockCount + start.blockCount, refDefCount := start.refDefCount }
+  let blocks := doc.document.blocks
+  if j < n then
+    if boundaries.back?.map (·.offset) != some stop then
+      -- The edit reaches past the boundary, e.g. by opening a code block
+      return (← reparseFrom doc source delta i start (j + max 1 (j - i)))
+    let next := doc.boundaries[j]!
+    let moveTaskMarks := delta != 0 && (doc.parserFlags &&& MD_FLAG_TASKLISTS) != 0
+    let rest := blocks.extract next.blockCount blocks.size
+    let rest := if moveTaskMarks then rest.map (shiftTaskMarks delta) else rest
+    let restBoundaries := (doc.boundaries.extract j n).map fun b =>
+      { b with offset := ((b.offset : Int) + delta).toNat,
+               blockCount := b.blockCount - next.blockCount + blockCount }
+    return { doc with
+      source, document := ⟨blocks.extract 0 start.blockCount ++ r.blocks ++ rest⟩,
+      boundaries := doc.boundaries.extract 0 (i - 1) ++ boundaries.pop ++ restBoundaries }
+  else
+    return { doc with
+      source, document := ⟨blocks.extract 0 start.blockCount ++ r.blocks⟩,
+      boundaries := doc.boundaries.extract 0 (i - 1) ++ boundaries }
+
+/--
+Applies `edit` to the source of `doc` and parses the result, the same as `ParsedDoc.parse` would.
+
+Only the text from the last boundary before the line of the edit to the first boundary after the
+edit is parsed again (more if the edit changes how the text after it parses, e.g. by opening a code
+block), and the blocks outside of it are shared with `doc`. If that text has a link reference
+definition, before or after the edit, the whole source is parsed again instead. (The result may
+still differ from `ParsedDoc.parse` for a source which exceeds md4c's limit on the output of links
+to reference definitions, a guard against pathological inputs.)
+
+Returns `none` if the edit is not within the source, if it splits a UTF-8 character, or if the
+underlying md4c parser fails.
+-/
+def reparse (doc : ParsedDoc) (edit : Edit) : Option ParsedDoc := do
+  let bytes := doc.source.toUTF8
+  guard (edit.start ≤ edit.stop ∧ edit.stop ≤ bytes.size)
+  let source ← String.fromUTF8? <|
+    bytes.extract 0 edit.start ++ edit.replacement.toUTF8 ++ bytes.extract edit.stop bytes.size
+  let delta : Int := (edit.replacement.utf8ByteSize : Int) - ((edit.stop - edit.start : Nat) : Int)
+  -- Start before the line of the edit, as the line at a boundary may be what makes it one (an ATX
+  -- header after a paragraph)
+  let lineStart := Id.run do
+    let mut pos := edit.start
+    while pos > 0 && bytes[pos - 1]! != '\n'.toUInt8 && bytes[pos - 1]! != '\r'.toUInt8 do
+      pos := pos - 1
+    return pos
+  let i := if lineStart = 0 then 0 else doc.countBoundaries (lineStart - 1)
+  let start : Boundary := if i = 0 then { offset := 0, blockCount := 0, refDefCount := 0 }
+    else doc.boundaries[i - 1]!
+  reparseFrom doc source delta i start (doc.countBoundaries edit.stop)
+
+end ParsedDoc
+
+/-- A top-level heading found by `SectionIndex.scan`. -/
+structure SectionIndex.Heading where
+  /-- The level of the heading, from 1 to 6 -/
+  level : Nat
+  /-- The text of the heading, without its inline markup -/
+  title : String
+  /-- The last boundary at or before the heading (see `ParsedDoc.Boundary`) -/
+  offset : Nat
+
+/-- The result of `SectionIndex.scan`. -/
+structure SectionIndex.ScanResult where
+  /-- The offsets of the boundaries of the document, in increasing order -/
+  boundaries : Array Nat
+  /-- The top-level headings of the document, in order -/
+  headings : Array SectionIndex.Heading
+  /-- The reference definitions of the document, if there are any -/
+  refDefs : Option RefDefTable
+
+/--
+A section of a document: a top-level heading together with everything up to the next heading of
+the same or a higher level (i.e. of the same or a lower `level`).
+-/
+structure SectionIndex.Section where
+  /-- The level of the heading, from 1 to 6 -/
+  level : Nat
+  /-- The text of the heading, without its inline markup -/
+  title : String
+  /-- The byte position where the section starts -/
+  start : Nat
+  /-- The byte position where the section ends (exclusive) -/
+  stop : Nat
+  /-- The sections of the headings of higher levels in the section -/
+  subsections : Array SectionIndex.Section
+deriving Inhabited, Repr, BEq
+
+/--
+A lightweight index of a Markdown document, for rendering parts of it without rendering all of it:
+the tree of its sections, the boundaries between its top-level blocks (see `ParsedDoc.Boundary`),
+and its reference definitions.
+
+Only the headings outside of any list or block quote start sections. A section starts at the
+boundary before its heading, which is the start of the heading's line unless the heading's lines
+begin another block (e.g. a setext heading right after reference definitions).
+-/
+structure SectionIndex where
+  /-- The bitmask of `MD_FLAG_xxxx` the document is indexed with -/
+  parserFlags : UInt32
+  /-- The size of the document in bytes -/
+  size : Nat
+  /-- The offsets of the boundaries of the document, in increasing order -/
+  boundaries : Array Nat
+  /-- The sections of the document -/
+  sections : Array SectionIndex.Section
+  /-- The reference definitions of the document, if there are any -/
+  refDefs : Option RefDefTable
+
+namespace SectionIndex
+
+/--
+Scans `input` for its top-level headings, its boundaries and its reference definitions, in one pass.
+-/
+@[extern "lean_md4c_section_index_scan"]
+opaque scan (input : @& String) (parserFlags : UInt32) : Option ScanResult
+
+/--
+Renders the bytes from `start` to `stop` of `input` into HTML like `renderHtmlWithRefDefs`, except
+that the labels are looked up in `refDefs`, the reference definitions of the whole `input`, first.
+-/
+@[extern "lean_md4c_markdown_to_html_range"]
+opaque renderRange (refDefs : @& Option RefDefTable) (input : @& String) (start stop : @& Nat)
+    (parserFlags rendererFlags : UInt32) : Option String
+
+/--
+The sections of the headings from `i` on which are of a higher level than `level`, up to the first
+one which is not. Returns them together with the index of that heading.
+-/
+private partial def sectionsFrom (headings : Array Heading) (size level i : Nat) :
+    Array Section × Nat := Id.run do
+  let mut sections := #[]
+  let mut i := i
+  while i < headings.size do
+    let heading := headings[i]!
+    if heading.level ≤ level then break
+    let (subsections, j) := sectionsFrom headings size heading.level (i + 1)
+    let stop := if j < headings.size then headings[j]!.offset else size
+    sections := sections.push
+      { level := heading.level, title := heading.title, start := heading.offset, stop, subsections }
+    i := j
+  return (sections, i)
+
+/--
+Builds the index of a Markdown document. The `parserFlags` should be the ones the document is
+rendered with.
+
+Returns `none` if the underlying md4c parser fails.
+-/
+def build (input : String)
+    (parserFlags : UInt32 := MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML) :
+    Option SectionIndex := do
+  let r ← scan input parserFlags
+  return { parserFlags, size := input.utf8ByteSize, boundaries := r.boundaries,
+           sections := (sectionsFrom r.headings input.utf8ByteSize 0 0).1, refDefs := r.refDefs }
+
+/-- The number of boundaries at or before the byte position `pos`. -/
+def countBoundaries (idx : SectionIndex) (pos : Nat) : Nat := Id.run do
+  let mut lo := 0
+  let mut hi := idx.boundaries.size
+  while lo < hi do
+    let mid := (lo + hi) / 2
+    if idx.boundaries[mid]! ≤ pos then lo := mid + 1 else hi := mid
+  return lo
+
+/--
+Renders the top-level blocks of `input`, the document of `idx`, which overlap the bytes from `start`
+to `stop`, the same as `renderHtml` renders them as a part of the whole document (the links to the
+reference definitions anywhere in the document included). Only those blocks are parsed.
+
+Returns `none` if the underlying md4c parser fails.
+-/
+def renderHtmlRange (idx : SectionIndex) (input : String) (start stop : Nat)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    Option String :=
+  let i := idx.countBoundaries start
+  let blockStart := if i = 0 then 0 else idx.boundaries[i - 1]!
+  let j := if stop = 0 then 0 else idx.countBoundaries (stop - 1)
+  let blockStop := if j < idx.boundaries.size then idx.boundaries[j]! else idx.size
+  renderRange idx.refDefs input blockStart blockStop idx.parserFlags rendererFlags
+
+/-- Renders the section `s` of `input`, the document of `idx`, like `renderHtmlRange`. -/
+def renderSection (idx : SectionIndex) (input : String) (s : Section)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    Option String :=
+  idx.renderHtmlRange input s.start s.stop rendererFlags
+
+end SectionIndex
+
+/-! ## AST of block skeletons
+
+An alternative AST made by `parseBlocks`, for uses which need only the block structure of a
+document (such as outlines, or extracting the code blocks). It has the same shape as the AST of
+slices, but the inline contents of paragraphs, headers and table cells are not parsed: they are
+kept as the lines of the input they consist of, and parsed on demand by `Blocks.Block.inlines` or
+`Blocks.Document.inlines`.
+-/
+
+namespace Blocks
+
+/--
+The unparsed inline contents of a paragraph, a header or a table cell: the lines of the input it
+consists of, without their indentation, the marks of the containers (such as `>`) and the marks of
+headers.
+-/
+structure Inlines where
+  /-- The lines, in order -/
+  lines : Array Slice
+deriving Inhabited, Repr, BEq
+
+/-- Like `MD4Lean.Block`, with `Inlines` as the contents of paragraphs, headers and table cells. -/
+inductive Block where
+  /-- A paragraph -/
+  | p : Inlines → Block
+  /-- An unordered list -/
+  | ul (tight : Bool) (mark : Char) : Array (Li Block) → Block
+  /-- An ordered list -/
+  | ol (tight : Bool) (start : Nat) (mark : Char) : Array (Li Block) → Block
+  /-- A thematic break -/
+  | hr
+  /-- A header -/
+  | header : Nat → Inlines → Block
+  /-- A code block. See `MD4Lean.Block.code`. -/
+  | code (info lang : Array Slices.AttrText) (fenceChar : Option Char) : Array Slice → Block
+  /-- Inline HTML block -/
+  | html : Array Slice → Block
+  /-- A block quote -/
+  | blockquote : Array Block → Block
+  /-- A table. See `MD4Lean.Block.table`. -/
+  | table (head : Array Inlines) (body : Array (Array Inlines)) : Block
+deriving Inhabited, Repr, BEq
+
+/-- A document made by `parseBlocks`. -/
+structure Document where
+  /-- The block-level elements of the document -/
+  blocks : Array Block
+  /-- The reference definitions of the document, if there are any -/
+  refDefs : Option RefDefTable
+  /-- The bitmask of `MD_FLAG_xxxx` the document has been parsed with -/
+  parserFlags : UInt32
+deriving Inhabited
+
+/--
+Parses the inline contents `x` of a block of a document, with `refDefs` as the reference
+definitions of the whole document.
+
+Returns `none` if the underlying md4c parser fails, or if the lines are not slices of one string
+in order.
+-/
+@[extern "lean_md4c_inlines_parse"]
+opaque Inlines.parseWith (x : @& Inlines) (refDefs : @& Option RefDefTable)
+    (parserFlags : UInt32) : Option (Array MD4Lean.Text)
+
+/--
+Parses the inline contents `x` of a block of the document, the same as `parse` parses them as a
+part of the whole document.
+
+Returns `none` if the underlying md4c parser fails.
+-/
+def Document.inlines (doc : Document) (x : Inlines) : Option (Array MD4Lean.Text) :=
+  x.parseWith doc.refDefs doc.parserFlags
+
+/--
+Parses the inline contents of a paragraph or a header of the document, like `Document.inlines`.
+
+Returns `none` for the other blocks, or if the underlying md4c parser fails.
+-/
+def Block.inlines (b : Block) (doc : Document) : Option (Array MD4Lean.Text) :=
+  match b with
+  | .p x | .header _ x => doc.inlines x
+  | _ => none
+
+/-- Parses all the inline contents and copies the texts into strings. -/
+partial def Block.toBlock (doc : Document) : Block → Option MD4Lean.Block
+  | .p x => do return .p (← doc.inlines x)
+  | .ul tight mark items => do return .ul tight mark (← items.mapM (liToLi doc))
+  | .ol tight start mark items => do return .ol tight start mark (← items.mapM (liToLi doc))
+  | .hr => some .hr
+  | .header level x => do return .header level (← doc.inlines x)
+  | .code info lang fenceChar ss =>
+    some <| .code (info.map Slices.AttrText.toAttrText) (lang.map Slices.AttrText.toAttrText)
+      fenceChar (ss.map Slice.toString)
+  | .html ss => some <| .html (ss.map Slice.toString)
+  | .blockquote bs => do return .blockquote (← bs.mapM (Block.toBlock doc))
+  | .table head body => do
+    return .table (← head.mapM doc.inlines) (← body.mapM (·.mapM doc.inlines))
+where
+  liToLi (doc : Document) (li : Li Block) : Option (Li MD4Lean.Block) := do
+    return { isTask := li.isTask, taskChar := li.taskChar, taskMarkOffset := li.taskMarkOffset,
+             contents := (← li.contents.mapM (Block.toBlock doc)) }
+
+/--
+Parses all the inline contents and copies the texts into strings, giving the same document as
+`parse` would.
+-/
+def Document.toDocument (doc : Document) : Option MD4Lean.Document := do
+  return ⟨(← doc.blocks.mapM (Block.toBlock doc))⟩
+
+end Blocks
+
+/--
+Parses the block structure of Markdown into an AST, leaving the inline contents of paragraphs,
+headers and table cells unparsed (see `Blocks.Block.inlines`). This saves most of the work of
+`parse` when only some of the inline contents are needed. The reference definitions are collected
+in the same pass, so that the links resolve as in the whole document when the contents are parsed.
+
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+
+Returns `some` if the underlying md4c parser succeeds, or `none` if it fails.
+-/
+@[extern "lean_md4c_markdown_parse_blocks"]
+opaque parseBlocks (input : @& String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) :
+    Option Blocks.Document
+
+/-- The underlying type of `Tape`. -/
+opaque TapePointed : NonemptyType
+
+/--
+A recorded parse of a Markdown document, made by `recordTape`.
+
+The tape stores the events of the parser in a compact binary form, so that the same document can
+be rendered or converted to an AST several times without parsing it again. Replaying a tape is
+much faster than parsing. The tape keeps a reference to the source string.
+-/
+def Tape : Type := TapePointed.type
+
+instance : Nonempty Tape := TapePointed.property
+
+/--
+Parses Markdown and records the result into a `Tape`.
+
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`.
+
+Returns `some` if the underlying md4c parser succeeds, or `none` if it fails.
+-/
+@[extern "lean_md4c_record_tape"]
+opaque recordTape (input : @& String)
+    (parserFlags : UInt32 :=
+      MD_DIALECT_GITHUB ||| MD_FLAG_LATEXMATHSPANS ||| MD_FLAG_NOHTML) :
+    Option Tape
+
+namespace Tape
+
+/-- The markdown string the tape has been recorded from. -/
+@[extern "lean_md4c_tape_source"]
+opaque source (tape : @& Tape) : String
+
+/--
+Render the recorded document into HTML. The result is the same as of `renderHtml` with the parser
+flags the tape has been recorded with.
+
+- `rendererFlags` is bitmask of `MD_HTML_FLAG_xxxx`. (`MD_HTML_FLAG_SKIP_UTF8_BOM` has no effect.)
+-/
+@[extern "lean_md4c_tape_to_html"]
+opaque renderHtml (tape : @& Tape)
+    (rendererFlags : UInt32 :=
+      MD_HTML_FLAG_XHTML ||| MD_HTML_FLAG_MATHJAX ||| MD_HTML_FLAG_MATHJAX_USE_DOLLAR) :
+    Option String
+
+/--
+Converts the recorded document into an AST. The result is the same as of `parse` with the parser
+flags the tape has been recorded with.
+-/
+@[extern "lean_md4c_tape_to_document"]
+opaque toDocument (tape : @& Tape) : Option Document
+
+end Tape
+
+/-! ## Flat documents
+-/
+
+/--
+The kind of a node of a `FlatDocument`. These follow the blocks, spans and texts of md4c.
+-/
+inductive NodeKind where
+  /-- The document, always node 0 -/
+  | doc
+  /-- A block quote -/
+  | blockquote
+  /-- An unordered list -/
+  | ul
+  /-- An ordered list -/
+  | ol
+  /-- A list item -/
+  | li
+  /-- A thematic break -/
+  | hr
+  /-- A header -/
+  | header
+  /-- A code block -/
+  | code
+  /-- Inline HTML block -/
+  | html
+  /-- A paragraph -/
+  | p
+  /-- A table -/
+  | table
+  /-- The head of a table -/
+  | thead
+  /-- The body of a table -/
+  | tbody
+  /-- A row of a table -/
+  | tr
+  /-- A header cell of a table -/
+  | th
+  /-- A cell of a table -/
+  | td
+  /-- Emphasized text -/
+  | em
+  /-- Strong emphasis -/
+  | strong
+  /-- A link -/
+  | a
+  /-- An image -/
+  | img
+  /-- Inline code -/
+  | codeSpan
+  /-- Deleted text -/
+  | del
+  /-- An inline LaTeX math element -/
+  | latexMath
+  /-- A display LaTeX math element -/
+  | latexMathDisplay
+  /-- A wiki-style link -/
+  | wikiLink
+  /-- Underlined text -/
+  | u
+  /-- Normal text -/
+  | text
+  /-- A null character -/
+  | nullchar
+  /-- A hard line break -/
+  | br
+  /-- A soft line break -/
+  | softbr
+  /-- An HTML entity as a complete string, e.g. `"&nbsp;"` -/
+  | entity
+  /-- Text in a code block or inline code -/
+  | codeText
+  /-- Raw HTML -/
+  | htmlText
+  /-- Text in a LaTeX math element -/
+  | latexMathText
+deriving Inhabited, Repr, BEq
+
+/--
+A document stored as a few columns, indexed by the node number, instead of a tree of objects.
+
+The nodes are numbered in document order (parents before their children, and siblings in order),
+and node `0` is the whole document. Unlike `Document`, the nodes follow md4c's structure exactly:
+tables have `thead`, `tbody`, and `tr` nodes, and the texts of tight list items are directly in
+`li` nodes. The columns of 32-bit numbers are in native byte order.
+
+Besides the links between the nodes, each node has two numbers `arg0` and `arg1`:
+
+- texts: the byte range of the text in `source` (or in `extra`, see `isExtra`)
+- `ul`, `ol`: `arg0` is the start of an ordered list, `arg1` the mark character, with the bit
+  `0x80000000` set if the list is tight
+- `li`: the task mark character and its offset in `source`, or zeros if the item is not a task
+- `header`: `arg0` is the level
+- `code`: `arg0` is the fence character (or `0` if the block is indented), `arg1` is the index in
+  `attrs` of the info string, followed by the language
+- `table`: the count of columns and of body rows
+- `th`, `td`: `arg0` is the alignment; `0` is default, `1` left, `2` center, `3` right
+- `a`: `arg0` is `1` for an autolink, `arg1` is the index in `attrs` of the destination, followed
+  by the title
+- `img`: `arg1` is the index in `attrs` of the source URL, followed by the title
+- `wikiLink`: `arg1` is the index in `attrs` of the target
+
+Other numbers are `0`.
+-/
+structure FlatDocument where
+  /-- The markdown string the document has been parsed from -/
+  source : String
+  /-- The kind of each node, one byte per node -/
+  kinds : ByteArray
+  /-- The parent of each node, 32 bits per node -/
+  parents : ByteArray
+  /-- The first child of each node, or `0` if it has none, 32 bits per node -/
+  firstChildren : ByteArray
+  /-- The next sibling of each node, or `0` if it has none, 32 bits per node -/
+  nextSiblings : ByteArray
+  /-- `arg0` and `arg1` of each node, 64 bits per node -/
+  args : ByteArray
+  /-- Texts which md4c has synthesized rather than taken from `source` (such as line breaks) -/
+  extra : String
+  /-- The attributes of code blocks, links, images and wiki-style links -/
+  attrs : Array (Array AttrText)
+deriving Inhabited
+
+/--
+Parses Markdown into a `FlatDocument`.
+
+- `input` is the input markdown string.
+- `parserFlags` is bitmask of `MD_FLAG_xxxx`. md4c's `MD_FLAG_SKIPINLINES` (`0x40000`) is ignored.
+
+Returns `some` if the underlying md4c parser succeeds, or `none` if it fails.
+-/
+@[extern "lean_md4c_markdown_parse_flat"]
+opaque parseFlat (input : @& String) (parserFlags : UInt32 := MD_DIALECT_COMMONMARK) :
+    Option FlatDocument
+
+namespace FlatDocument
+
+/-- The count of nodes. -/
+def size (doc : FlatDocument) : Nat := doc.kinds.size
+
+/-- The kind of `node`. Out of range nodes are `doc`. -/
+@[extern "lean_md4c_flat_kind"]
+opaque kind (doc : @& FlatDocument) (node : UInt32) : NodeKind
+
+/-- The parent of `node`, or `0` for the document itself. -/
+@[extern "lean_md4c_flat_parent"]
+opaque parent (doc : @& FlatDocument) (node : UInt32) : UInt32
+
+/-- The first child of `node`, or `0` if it has none. -/
+@[extern "lean_md4c_flat_first_child"]
+opaque firstChild (doc : @& FlatDocument) (node : UInt32) : UInt32
+
+/-- The next sibling of `node`, or `0` if it has none. -/
+@[extern "lean_md4c_flat_next_sibling"]
+opaque nextSibling (doc : @& FlatDocument) (node : UInt32) : UInt32
+
+/-- The first number of the details of `node`. See `FlatDocument`. -/
+@[extern "lean_md4c_flat_arg0"]
+opaque arg0 (doc : @& FlatDocument) (node : UInt32) : UInt32
+
+/-- The second number of the details of `node`. See `FlatDocument`. -/
+@[extern "lean_md4c_flat_arg1"]
+opaque arg1 (doc : @& FlatDocument) (node : UInt32) : UInt32
+
+/-- Is `node` a text stored in `extra` rather than in `source`? -/
+@[extern "lean_md4c_flat_is_extra"]
+opaque isExtra (doc : @& FlatDocument) (node : UInt32) : Bool
+
+/-- The text of a text node, as a slice of `source` or `extra`. -/
+def slice (doc : FlatDocument) (node : UInt32) : Slice :=
+  ⟨if doc.isExtra node then doc.extra else doc.source, (doc.arg0 node).toNat, (doc.arg1 node).toNat⟩
+
+/-- The text of a text node. -/
+def text (doc : FlatDocument) (node : UInt32) : String := (doc.slice node).toString
+
+/-- The `i`-th attribute of `node`. See `FlatDocument` for which nodes have attributes. -/
+def attr (doc : FlatDocument) (node : UInt32) (i : Nat := 0) : Array AttrText :=
+  doc.attrs.getD ((doc.arg1 node).toNat + i) #[]
+
+/-- The children of a node of a `FlatDocument`, for use with `for`. -/
+structure Children where
+  /-- The document -/
+  doc : FlatDocument
+  /-- The node -/
+  node : UInt32
+
+/-- The children of `node`, for use with `for`. -/
+def children (doc : FlatDocument) (node : UInt32) : Children := ⟨doc, node⟩
+
+instance : ForIn m Children UInt32 where
+  forIn c init f := do
+    let mut child := c.doc.firstChild c.node
+    let mut acc := init
+    while child != 0 do
+      match ← f child acc with
+      | .done a => return a
+      | .yield a =>
+        acc := a
+        child := c.doc.nextSibling child
+    return acc
+
+end FlatDocument
+
 end MD4Lean
@@ -0,0 +1,59 @@
+import MD4Lean
+
+/-!
+Benchmark for `MD4Lean.renderHtmlAsync`.
+
+While a number of large renders keep the task pool busy, small render requests are issued one
+after another and their latency is measured. This is done twice: once with all tasks in the shared
+pool, and once with the large inputs moved to dedicated threads.
+
+Usage: `lake exe bench [numLarge] [numSmall]`
+-/
+
+open MD4Lean
+
+/-- A generated document with `n` sections -/
+def mkDoc (n : Nat) : String := Id.run do
+  let mut s := ""
+  for i in [0:n] do
+    s := s ++ s!"## Section {i}\n\nSome *emphasized* text with `code`, a [link](https://example.com/{i}) and $x_{i}$.\n\n- item one\n- item **two**\n\n"
+  return s
+
+/-- The `p`-th percentile of the sorted array `xs` -/
+def percentile (xs : Array Nat) (p : Nat) : Nat :=
+  if xs.isEmpty then 0 else xs[min (xs.size - 1) (xs.size * p / 100)]!
+
+/--
+Starts `numLarge` renders of `large`, then renders `small` `numSmall` times in a row and reports
+the latencies of the latter.
+-/
+def measure (label : String) (large small : String) (numLarge numSmall threshold : Nat) : IO Unit := do
+  let start ← IO.monoNanosNow
+  let bigTasks := (Array.range numLarge).map fun _ =>
+    renderHtmlAsync large (dedicatedThreshold := threshold)
+  let mut latencies := #[]
+  for _ in [0:numSmall] do
+    let t0 ← IO.monoNanosNow
+    let _ ← IO.wait (renderHtmlAsync small (dedicatedThreshold := threshold))
+    let t1 ← IO.monoNanosNow
+    latencies := latencies.push ((t1 - t0) / 1000)
+  for t in bigTasks do
+    let _ ← IO.wait t
+  let stop ← IO.monoNanosNow
+  let latencies := latencies.qsort (· < ·)
+  IO.println s!"{label}: small render latency p50 {percentile latencies 50} µs, \
+    p99 {percentile latencies 99} µs, max {percentile latencies 100} µs; \
+    total {(stop - start) / 1000000} ms"
+
+/--
+Runs the benchmark.
+-/
+def main (args : List String) : IO Unit := do
+  let numLarge := (args[0]? >>= String.toNat?).getD 16
+  let numSmall := (args[1]? >>= String.toNat?).getD 200
+  let large := mkDoc 20000
+  let small := mkDoc 1
+  IO.println s!"{numLarge} large renders of {large.utf8ByteSize} bytes, \
+    {numSmall} small renders of {small.utf8ByteSize} bytes"
+  measure "shared pool" large small numLarge numSmall (large.utf8ByteSize + 1)
+  measure "dedicated threads" large small numLarge numSmall large.utf8ByteSize
@@ -13,6 +13,13 @@ open MD4Lean.Test.Parser
 
 -/
 
+/--
+Compares `actual` with `expected`. The result is empty if they are equal, and otherwise names the
+check and shows both values, so that a `#guard_msgs` test of several checks tells which one failed.
+-/
+def check {α : Type} [BEq α] [Repr α] (name : String) (expected actual : α) : List String :=
+  if expected == actual then [] else [s!"{name}: expected {repr expected}, got {repr actual}"]
+
 /-- info: some "<p>Hello <em>world</em></p>\n" -/
 #guard_msgs in
 #eval MD4Lean.renderHtml "Hello *world*"
@@ -21,6 +28,263 @@ open MD4Lean.Test.Parser
 #guard_msgs in
 #eval MD4Lean.renderHtml "- [ ] Is this valid XHTML?\n- [x] Is this valid XHTML?"
 
+/-- info: (true, "<p>Hello <em>world</em></p>\n") -/
+#guard_msgs in
+#eval show IO (Bool × String) from do
+  let out ← IO.mkRef ({} : IO.FS.Stream.Buffer)
+  let ok ← MD4Lean.renderHtmlTo (IO.FS.Stream.ofBuffer out) "Hello *world*"
+  return (ok, String.fromUTF8! (← out.get).data)
+
+/-- info: "<main><p>Hello <em>world</em></p>\n<p>Again</p>\n" -/
+#guard_msgs in
+#eval
+  let buf := MD4Lean.renderHtmlInto "<main>".toUTF8 "Hello *world*"
+  String.fromUTF8! (MD4Lean.renderHtmlInto buf "Again")
+
+/-- info: "<p>Again</p>\n" -/
+#guard_msgs in
+#eval
+  let buf := MD4Lean.renderHtmlInto .empty "Hello *world*"
+  String.fromUTF8! (MD4Lean.renderHtmlInto (MD4Lean.clearBuffer buf) "Again")
+
+/--
+info: #[some "<p>Hello <em>world</em></p>\n", some "", some "<h1>Title</h1>\n", some "<p>Hello <em>world</em></p>\n"]
+-/
+#guard_msgs in
+#eval MD4Lean.renderHtmlBatch #["Hello *world*", "", "# Title", "Hello *world*"] (numThreads := 3)
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let inputs := #["x", "# y", "* a\n* b", "> q", "", "[l](u)"]
+  check "parseBatch" (inputs.map (MD4Lean.parse ·)) (MD4Lean.parseBatch inputs (numThreads := 2))
+
+/-- info: (some "<p>Hello <em>world</em></p>\n", some "<h1>Title</h1>\n") -/
+#guard_msgs in
+#eval
+  let small := MD4Lean.renderHtmlAsync "Hello *world*" (prio := .max)
+  let large := MD4Lean.renderHtmlAsync "# Title" (dedicatedThreshold := 0)
+  (small.get, large.get)
+
+/-- info: [] -/
+#guard_msgs in
+#eval check "parseAsync" (MD4Lean.parse "* a\n* b") (MD4Lean.parseAsync "* a\n* b").get
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let doc := String.join <| List.replicate 20000
+    "Some *text* with [a link][r].\n\n> quote\n- item\n\n    code\n\n[r]: /url\n\n"
+  check "MD_FLAG_PARALLELBLOCKS" (MD4Lean.renderHtml doc)
+    (MD4Lean.renderHtml doc (parserFlags := MD4Lean.MD_FLAG_PARALLELBLOCKS))
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let doc := String.join <| List.replicate 2000
+    "# Header `code`\n\nSome *text* with [a link](/url \"title\") and &amp;.\n\n| a | b |\n|---|:-:|\n| 1 | 2 |\n\n"
+  check "MD_FLAG_PARALLELINLINES" (MD4Lean.parse doc MD4Lean.MD_DIALECT_GITHUB)
+    (MD4Lean.parse doc (MD4Lean.MD_DIALECT_GITHUB ||| MD4Lean.MD_FLAG_PARALLELINLINES))
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let doc := "# Title\n\nSome *text* with [a link](/url \"title\") and &amp; `code`.\n\n```lean\n#eval 1\n```\n"
+  match MD4Lean.recordTape doc MD4Lean.MD_DIALECT_GITHUB with
+  | some tape =>
+    check "renderHtml" (MD4Lean.renderHtml doc MD4Lean.MD_DIALECT_GITHUB) tape.renderHtml ++
+      check "toDocument" (MD4Lean.parse doc MD4Lean.MD_DIALECT_GITHUB) tape.toDocument ++
+      check "renderHtml 0" (MD4Lean.renderHtml doc MD4Lean.MD_DIALECT_GITHUB 0) (tape.renderHtml 0)
+  | none => ["recordTape failed"]
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let doc := "a\\*b* &amp; c_ d\ne"
+  check "toDocument" (MD4Lean.parse doc MD4Lean.MD_FLAG_DECODEENTITIES)
+    ((MD4Lean.recordTape doc MD4Lean.MD_FLAG_DECODEENTITIES).bind (·.toDocument))
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let doc := "# Title\n\n* Some *text* with [a link](/url \"ti\\\"tle\") &amp; `code`\n* $x$\n\n    indented\n    code\n"
+  check "parseSlices" (MD4Lean.parse doc MD4Lean.MD_DIALECT_GITHUB)
+    ((MD4Lean.parseSlices doc MD4Lean.MD_DIALECT_GITHUB).map (·.toDocument))
+
+/-- info: some #[(MD4Lean.NodeKind.p, #["Some ", "", " ", ""]), (MD4Lean.NodeKind.em, #["text"])] -/
+#guard_msgs in
+#eval
+  (MD4Lean.parseFlat "Some *text* [link](/url)").map fun doc => Id.run do
+    let mut result := #[]
+    for i in List.range doc.size do
+      let node := i.toUInt32
+      if doc.kind node == .p || doc.kind node == .em then
+        let mut texts := #[]
+        for child in doc.children node do
+          texts := texts.push (doc.text child)
+        result := result.push (doc.kind node, texts)
+    return result
+
+/-- info: some [MD4Lean.NodeKind.doc, MD4Lean.NodeKind.p, MD4Lean.NodeKind.em, MD4Lean.NodeKind.text] -/
+#guard_msgs in
+#eval
+  -- md4c's MD_FLAG_SKIPINLINES, which parseFlat ignores
+  (MD4Lean.parseFlat "*a*" 0x40000).map fun doc =>
+    (List.range doc.size).map fun i => doc.kind i.toUInt32
+
+/-- info: [] -/
+#guard_msgs in
+#eval check "MD_FLAG_COALESCETEXT"
+  (some ⟨#[.p #[.normal "a*b* c_ d", .softbr "\n", .normal "e"]]⟩ : Option MD4Lean.Document)
+  (MD4Lean.parse "a\\*b* c_ d\ne" MD4Lean.MD_FLAG_COALESCETEXT)
+
+/-- info: [] -/
+#guard_msgs in
+#eval check "MD_FLAG_DECODEENTITIES"
+  (some ⟨#[.p #[.normal "a & bA", .entity "&bogus;", .normal " ",
+    .a #[.normal "/u&rl"] #[.normal "ö"] false #[.normal "c"]]]⟩ : Option MD4Lean.Document)
+  (MD4Lean.parse "a &amp; b&#x41;&bogus; [c](/u&amp;rl \"&ouml;\")" MD4Lean.MD_FLAG_DECODEENTITIES)
+
+/-- info: [] -/
+#guard_msgs in
+#eval
+  let glossary := "[foo]: /foo \"Foo\"\n[Bar Baz]: /bar\n[local]: /ignored\n"
+  let doc := "[foo], [bar  baz][] and [local]\n\n[local]: /local\n"
+  match MD4Lean.RefDefTable.compile glossary with
+  | some table =>
+    check "size" 3 table.size ++
+      check "renderHtmlWithRefDefs" (MD4Lean.renderHtml (doc ++ "\n" ++ glossary))
+        (MD4Lean.renderHtmlWithRefDefs table doc) ++
+      check "parseWithRefDefs" (MD4Lean.parse (doc ++ "\n" ++ glossary))
+        (MD4Lean.parseWithRefDefs table doc)
+  | none => ["RefDefTable.compile failed"]
+
+/--
+info: some "<p><a href=\"/xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\">foo</a></p>\n"
+-/
+#guard_msgs in
+#eval
+  let glossary := "[foo]: /" ++ "".pushn 'x' 100 ++ "\n"
+  (MD4Lean.RefDefTable.compile glossary).bind (MD4Lean.renderHtmlWithRefDefs · "[foo]\n")
+
+/-- info: [] -/
+#guard_msgs in
+#eval show IO (List String) from do
+  let parser ← MD4Lean.Parser.new (retainLimit := 64)
+  let docs := ["# Title", "Some *text* [link][r]\n\n[r]: /url", "", "- a\n- b\n\n| a |\n|---|\n| b |"]
+  return docs.flatMap fun doc =>
+    check s!"parse {doc.quote}" (MD4Lean.parse doc) (parser.parse doc) ++
+      check s!"renderHtml {doc.quote}" (MD4Lean.renderHtml doc) (parser.renderHtml doc)
+
+/-- info: [] -/
+#guard_msgs in
+#eval show IO (List String) from do
+  let parser ← MD4Lean.StreamingParser.new
+  let doc := "[r]: /url\n\n# Title\n\nSome *text* [link][r]\nmore\n\n- a\n- b\n\n```\ncode\n```\n"
+  let chunks := ["[r]: /url\n\n# Ti", "tle\n\nSome *text* [li", "nk][r]\nmore\n\n- a\n- b\n",
+    "\n```\ncode\n", "```\n"]
+  let mut fed := #[]
+  for chunk in chunks do
+    let some blocks ← parser.feed chunk | return [s!"feed {chunk.quote} failed"]
+    fed := fed.push blocks
+  let some rest ← parser.finish | return ["finish failed"]
+  -- The heading comes out as soon as the blank line after it has arrived
+  return check "blocks of the 2nd piece" 1 fed[1]!.size ++
+    check "blocks" (MD4Lean.parse doc) (some ⟨fed.flatten ++ rest⟩)
+
+/-- info: [] -/
+#guard_msgs in
+#eval show IO (List String) from do
+  let doc := "Some [link][r]\n\n> [r]: /url\n\nA [link][r]\n"
+  let feedAll (chunks : List String) : IO (Option (Array MD4Lean.Block)) := do
+    let parser ← MD4Lean.StreamingParser.new
+    let mut fed := #[]
+    for chunk in chunks do
+      let some blocks ← parser.feed chunk | return none
+      fed := fed ++ blocks
+    let some rest ← parser.finish | return none
+    return some (fed ++ rest)
+  let some whole ← feedAll [doc] | return ["feeding the whole document failed"]
+  let some small ← feedAll (doc.toList.map String.singleton) | return ["feeding characters failed"]
+  -- Only the link after the definition refers to it, however the input is split
+  return check "characters" whole small ++
+    check "first block" (MD4Lean.parse "Some [link][r]\n") (some ⟨#[whole[0]!]⟩) ++
+    check "other blocks" (MD4Lean.parse "> [r]: /url\n\nA [link][r]\n")
+      (some ⟨whole.extract 1 whole.size⟩)
+
+/-- info: [] -/
+#guard_msgs in
+#eval Id.run do
+  let flags := MD4Lean.MD_DIALECT_GITHUB
+  let some doc := MD4Lean.ParsedDoc.parse "# Title\n\nSome *text*\nmore\n\n- a\n- [ ] b\n\nlast [link]\n" flags
+    | return ["ParsedDoc.parse failed"]
+  let edits : List MD4Lean.ParsedDoc.Edit := [
+    -- Within a paragraph, moving the task mark after it
+    { start := 14, stop := 20, replacement := "_words_" },
+    -- Opening a code block which runs to the end
+    { start := 9, stop := 9, replacement := "```\n" },
+    -- Adding a reference definition
+    { start := 0, stop := 0, replacement := "[link]: /url\n\n" }]
+  let mut doc := doc
+  let mut failures : List String := []
+  for edit in edits do
+    let some edited := doc.reparse edit | return failures ++ [s!"reparse {repr edit} failed"]
+    let some expected := MD4Lean.ParsedDoc.parse edited.source flags
+      | return failures ++ [s!"ParsedDoc.parse {edited.source.quote} failed"]
+    failures := failures ++
+      check s!"document after {repr edit}" expected.document edited.document ++
+      check s!"boundaries after {repr edit}" expected.boundaries edited.boundaries
+    doc := edited
+  return failures
+
+-- A list item which starts with two blank lines once its reference definition is taken out
+/-- info: some "<ol>\n<li></li>\n</ol>\n<pre><code>indented\n</code></pre>\n" -/
+#guard_msgs in
+#eval MD4Lean.renderHtml "1. [x]: /u\n\n\n    indented\n"
+
+/-- info: [] -/
+#guard_msgs in
+#eval Id.run do
+  let doc := "Intro [r]\n\n# A\n\ntext\n\n## A *one* &amp; two\n\nmore\n# B\n\n- # not a section\n\n[r]: /first\n[r]: /second\n"
+  let some idx := MD4Lean.SectionIndex.build doc | return ["SectionIndex.build failed"]
+  let #[a, b] := idx.sections | return [s!"sections: {repr idx.sections}"]
+  let some intro := idx.renderHtmlRange doc 0 a.start | return ["renderHtmlRange failed"]
+  let some htmlA := idx.renderSection doc a | return ["renderSection failed"]
+  let some htmlB := idx.renderSection doc b | return ["renderSection failed"]
+  return check "title" "A" a.title ++
+    check "subsections" #["A one & two"] (a.subsections.map (·.title)) ++
+    check "subsections of B" #[] (b.subsections.map (·.title)) ++
+    check "intro" "<p>Intro <a href=\"/first\">r</a></p>\n" intro ++
+    check "sections" (MD4Lean.renderHtml doc) (some (intro ++ htmlA ++ htmlB)) ++
+    check "renderHtmlRange" (MD4Lean.renderHtml doc) (idx.renderHtmlRange doc 0 doc.utf8ByteSize)
+
+-- Headings which end a list or an indented code block start their sections on their own lines
+/--
+info: [some (11, "<p>para</p>\n<ul>\n<li>a</li>\n</ul>\n", "<h1>H</h1>\n"),
+ some (9, "<pre><code>code\n</code></pre>\n", "<h1>H</h1>\n")]
+-/
+#guard_msgs in
+#eval ["para\n\n- a\n\n# H\n", "    code\n# H\n"].map fun doc => do
+  let idx ← MD4Lean.SectionIndex.build doc
+  let #[h] := idx.sections | none
+  return (h.start, ← idx.renderHtmlRange doc 0 h.start, ← idx.renderSection doc h)
+
+/-- info: [] -/
+#guard_msgs in
+#eval Id.run do
+  let flags := MD4Lean.MD_DIALECT_GITHUB
+  let doc := "# Title *one*\n\n> Some [link][r]\n> more\n\n- a\n- | x |\n  |---|\n  | `y` |\n- [x]\n  foo\n\n```\ncode\n```\n\n[r]: /url\n"
+  let some skeleton := MD4Lean.parseBlocks doc flags | return ["parseBlocks failed"]
+  let #[title, .blockquote #[.p quoted], .ul _ _ #[_, _, .li _ _ _ #[.p task]], _] := skeleton.blocks
+    | return ["unexpected blocks"]
+  -- The first line of the task is empty, but it still counts for the line break
+  return check "lines of the quote" #["Some [link][r]", "more"] (quoted.lines.map (·.toString)) ++
+    check "lines of the task" #["", "foo"] (task.lines.map (·.toString)) ++
+    check "inlines of the title"
+      (some #[.normal "Title ", .em #[.normal "one"]] : Option (Array MD4Lean.Text))
+      (title.inlines skeleton) ++
+    check "toDocument" (MD4Lean.parse doc flags) skeleton.toDocument
+
 /-!
 
 # Parsing tests
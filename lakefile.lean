@@ -51,9 +51,12 @@ extern_lib md4c (pkg) := do
 lean_exe «example» where
   root := `Main
 
+lean_exe bench where
+  root := `MD4LeanBench
+
 lean_lib MD4LeanTest where
   -- Not actually needed, but we want the test to verify it compiles
-  needs := #[«example»]
+  needs := #[«example», bench]
 
 lean_exe test where
   root := `MD4LeanTestDriver
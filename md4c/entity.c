@@ -27,2159 +27,2534 @@
 #include <string.h>
 
 
-/* Generated by scripts/build_enity_map.py. */
+/* Generated by scripts/build_entity_map.py. */
 static const ENTITY ENTITY_MAP[] = {
-    { "&AElig;", { 198, 0 } },
-    { "&AMP;", { 38, 0 } },
-    { "&Aacute;", { 193, 0 } },
-    { "&Abreve;", { 258, 0 } },
-    { "&Acirc;", { 194, 0 } },
-    { "&Acy;", { 1040, 0 } },
-    { "&Afr;", { 120068, 0 } },
-    { "&Agrave;", { 192, 0 } },
-    { "&Alpha;", { 913, 0 } },
-    { "&Amacr;", { 256, 0 } },
-    { "&And;", { 10835, 0 } },
-    { "&Aogon;", { 260, 0 } },
-    { "&Aopf;", { 120120, 0 } },
-    { "&ApplyFunction;", { 8289, 0 } },
-    { "&Aring;", { 197, 0 } },
-    { "&Ascr;", { 119964, 0 } },
-    { "&Assign;", { 8788, 0 } },
-    { "&Atilde;", { 195, 0 } },
-    { "&Auml;", { 196, 0 } },
-    { "&Backslash;", { 8726, 0 } },
-    { "&Barv;", { 10983, 0 } },
-    { "&Barwed;", { 8966, 0 } },
-    { "&Bcy;", { 1041, 0 } },
-    { "&Because;", { 8757, 0 } },
-    { "&Bernoullis;", { 8492, 0 } },
-    { "&Beta;", { 914, 0 } },
-    { "&Bfr;", { 120069, 0 } },
-    { "&Bopf;", { 120121, 0 } },
-    { "&Breve;", { 728, 0 } },
-    { "&Bscr;", { 8492, 0 } },
-    { "&Bumpeq;", { 8782, 0 } },
-    { "&CHcy;", { 1063, 0 } },
-    { "&COPY;", { 169, 0 } },
-    { "&Cacute;", { 262, 0 } },
-    { "&Cap;", { 8914, 0 } },
-    { "&CapitalDifferentialD;", { 8517, 0 } },
-    { "&Cayleys;", { 8493, 0 } },
-    { "&Ccaron;", { 268, 0 } },
-    { "&Ccedil;", { 199, 0 } },
-    { "&Ccirc;", { 264, 0 } },
-    { "&Cconint;", { 8752, 0 } },
-    { "&Cdot;", { 266, 0 } },
-    { "&Cedilla;", { 184, 0 } },
-    { "&CenterDot;", { 183, 0 } },
-    { "&Cfr;", { 8493, 0 } },
-    { "&Chi;", { 935, 0 } },
-    { "&CircleDot;", { 8857, 0 } },
-    { "&CircleMinus;", { 8854, 0 } },
-    { "&CirclePlus;", { 8853, 0 } },
-    { "&CircleTimes;", { 8855, 0 } },
-    { "&ClockwiseContourIntegral;", { 8754, 0 } },
-    { "&CloseCurlyDoubleQuote;", { 8221, 0 } },
-    { "&CloseCurlyQuote;", { 8217, 0 } },
-    { "&Colon;", { 8759, 0 } },
-    { "&Colone;", { 10868, 0 } },
-    { "&Congruent;", { 8801, 0 } },
-    { "&Conint;", { 8751, 0 } },
-    { "&ContourIntegral;", { 8750, 0 } },
-    { "&Copf;", { 8450, 0 } },
-    { "&Coproduct;", { 8720, 0 } },
-    { "&CounterClockwiseContourIntegral;", { 8755, 0 } },
-    { "&Cross;", { 10799, 0 } },
-    { "&Cscr;", { 119966, 0 } },
-    { "&Cup;", { 8915, 0 } },
-    { "&CupCap;", { 8781, 0 } },
-    { "&DD;", { 8517, 0 } },
-    { "&DDotrahd;", { 10513, 0 } },
-    { "&DJcy;", { 1026, 0 } },
-    { "&DScy;", { 1029, 0 } },
-    { "&DZcy;", { 1039, 0 } },
-    { "&Dagger;", { 8225, 0 } },
-    { "&Darr;", { 8609, 0 } },
-    { "&Dashv;", { 10980, 0 } },
-    { "&Dcaron;", { 270, 0 } },
-    { "&Dcy;", { 1044, 0 } },
-    { "&Del;", { 8711, 0 } },
-    { "&Delta;", { 916, 0 } },
-    { "&Dfr;", { 120071, 0 } },
-    { "&DiacriticalAcute;", { 180, 0 } },
-    { "&DiacriticalDot;", { 729, 0 } },
-    { "&DiacriticalDoubleAcute;", { 733, 0 } },
-    { "&DiacriticalGrave;", { 96, 0 } },
-    { "&DiacriticalTilde;", { 732, 0 } },
-    { "&Diamond;", { 8900, 0 } },
-    { "&DifferentialD;", { 8518, 0 } },
-    { "&Dopf;", { 120123, 0 } },
-    { "&Dot;", { 168, 0 } },
-    { "&DotDot;", { 8412, 0 } },
-    { "&DotEqual;", { 8784, 0 } },
-    { "&DoubleContourIntegral;", { 8751, 0 } },
-    { "&DoubleDot;", { 168, 0 } },
-    { "&DoubleDownArrow;", { 8659, 0 } },
-    { "&DoubleLeftArrow;", { 8656, 0 } },
-    { "&DoubleLeftRightArrow;", { 8660, 0 } },
-    { "&DoubleLeftTee;", { 10980, 0 } },
-    { "&DoubleLongLeftArrow;", { 10232, 0 } },
-    { "&DoubleLongLeftRightArrow;", { 10234, 0 } },
-    { "&DoubleLongRightArrow;", { 10233, 0 } },
-    { "&DoubleRightArrow;", { 8658, 0 } },
-    { "&DoubleRightTee;", { 8872, 0 } },
-    { "&DoubleUpArrow;", { 8657, 0 } },
-    { "&DoubleUpDownArrow;", { 8661, 0 } },
-    { "&DoubleVerticalBar;", { 8741, 0 } },
-    { "&DownArrow;", { 8595, 0 } },
-    { "&DownArrowBar;", { 10515, 0 } },
-    { "&DownArrowUpArrow;", { 8693, 0 } },
-    { "&DownBreve;", { 785, 0 } },
-    { "&DownLeftRightVector;", { 10576, 0 } },
-    { "&DownLeftTeeVector;", { 10590, 0 } },
-    { "&DownLeftVector;", { 8637, 0 } },
-    { "&DownLeftVectorBar;", { 10582, 0 } },
-    { "&DownRightTeeVector;", { 10591, 0 } },
-    { "&DownRightVector;", { 8641, 0 } },
-    { "&DownRightVectorBar;", { 10583, 0 } },
-    { "&DownTee;", { 8868, 0 } },
-    { "&DownTeeArrow;", { 8615, 0 } },
-    { "&Downarrow;", { 8659, 0 } },
-    { "&Dscr;", { 119967, 0 } },
-    { "&Dstrok;", { 272, 0 } },
-    { "&ENG;", { 330, 0 } },
-    { "&ETH;", { 208, 0 } },
-    { "&Eacute;", { 201, 0 } },
-    { "&Ecaron;", { 282, 0 } },
-    { "&Ecirc;", { 202, 0 } },
-    { "&Ecy;", { 1069, 0 } },
-    { "&Edot;", { 278, 0 } },
-    { "&Efr;", { 120072, 0 } },
-    { "&Egrave;", { 200, 0 } },
-    { "&Element;", { 8712, 0 } },
-    { "&Emacr;", { 274, 0 } },
-    { "&EmptySmallSquare;", { 9723, 0 } },
-    { "&EmptyVerySmallSquare;", { 9643, 0 } },
-    { "&Eogon;", { 280, 0 } },
-    { "&Eopf;", { 120124, 0 } },
-    { "&Epsilon;", { 917, 0 } },
-    { "&Equal;", { 10869, 0 } },
-    { "&EqualTilde;", { 8770, 0 } },
-    { "&Equilibrium;", { 8652, 0 } },
-    { "&Escr;", { 8496, 0 } },
-    { "&Esim;", { 10867, 0 } },
-    { "&Eta;", { 919, 0 } },
-    { "&Euml;", { 203, 0 } },
-    { "&Exists;", { 8707, 0 } },
-    { "&ExponentialE;", { 8519, 0 } },
-    { "&Fcy;", { 1060, 0 } },
-    { "&Ffr;", { 120073, 0 } },
-    { "&FilledSmallSquare;", { 9724, 0 } },
-    { "&FilledVerySmallSquare;", { 9642, 0 } },
-    { "&Fopf;", { 120125, 0 } },
-    { "&ForAll;", { 8704, 0 } },
-    { "&Fouriertrf;", { 8497, 0 } },
-    { "&Fscr;", { 8497, 0 } },
-    { "&GJcy;", { 1027, 0 } },
-    { "&GT;", { 62, 0 } },
-    { "&Gamma;", { 915, 0 } },
-    { "&Gammad;", { 988, 0 } },
-    { "&Gbreve;", { 286, 0 } },
-    { "&Gcedil;", { 290, 0 } },
-    { "&Gcirc;", { 284, 0 } },
-    { "&Gcy;", { 1043, 0 } },
-    { "&Gdot;", { 288, 0 } },
-    { "&Gfr;", { 120074, 0 } },
-    { "&Gg;", { 8921, 0 } },
-    { "&Gopf;", { 120126, 0 } },
-    { "&GreaterEqual;", { 8805, 0 } },
-    { "&GreaterEqualLess;", { 8923, 0 } },
-    { "&GreaterFullEqual;", { 8807, 0 } },
-    { "&GreaterGreater;", { 10914, 0 } },
-    { "&GreaterLess;", { 8823, 0 } },
-    { "&GreaterSlantEqual;", { 10878, 0 } },
-    { "&GreaterTilde;", { 8819, 0 } },
-    { "&Gscr;", { 119970, 0 } },
-    { "&Gt;", { 8811, 0 } },
-    { "&HARDcy;", { 1066, 0 } },
-    { "&Hacek;", { 711, 0 } },
-    { "&Hat;", { 94, 0 } },
-    { "&Hcirc;", { 292, 0 } },
-    { "&Hfr;", { 8460, 0 } },
-    { "&HilbertSpace;", { 8459, 0 } },
-    { "&Hopf;", { 8461, 0 } },
-    { "&HorizontalLine;", { 9472, 0 } },
-    { "&Hscr;", { 8459, 0 } },
-    { "&Hstrok;", { 294, 0 } },
-    { "&HumpDownHump;", { 8782, 0 } },
-    { "&HumpEqual;", { 8783, 0 } },
-    { "&IEcy;", { 1045, 0 } },
-    { "&IJlig;", { 306, 0 } },
-    { "&IOcy;", { 1025, 0 } },
-    { "&Iacute;", { 205, 0 } },
-    { "&Icirc;", { 206, 0 } },
-    { "&Icy;", { 1048, 0 } },
-    { "&Idot;", { 304, 0 } },
-    { "&Ifr;", { 8465, 0 } },
-    { "&Igrave;", { 204, 0 } },
-    { "&Im;", { 8465, 0 } },
-    { "&Imacr;", { 298, 0 } },
-    { "&ImaginaryI;", { 8520, 0 } },
-    { "&Implies;", { 8658, 0 } },
-    { "&Int;", { 8748, 0 } },
-    { "&Integral;", { 8747, 0 } },
-    { "&Intersection;", { 8898, 0 } },
-    { "&InvisibleComma;", { 8291, 0 } },
-    { "&InvisibleTimes;", { 8290, 0 } },
-    { "&Iogon;", { 302, 0 } },
-    { "&Iopf;", { 120128, 0 } },
-    { "&Iota;", { 921, 0 } },
-    { "&Iscr;", { 8464, 0 } },
-    { "&Itilde;", { 296, 0 } },
-    { "&Iukcy;", { 1030, 0 } },
-    { "&Iuml;", { 207, 0 } },
-    { "&Jcirc;", { 308, 0 } },
-    { "&Jcy;", { 1049, 0 } },
-    { "&Jfr;", { 120077, 0 } },
-    { "&Jopf;", { 120129, 0 } },
-    { "&Jscr;", { 119973, 0 } },
-    { "&Jsercy;", { 1032, 0 } },
-    { "&Jukcy;", { 1028, 0 } },
-    { "&KHcy;", { 1061, 0 } },
-    { "&KJcy;", { 1036, 0 } },
-    { "&Kappa;", { 922, 0 } },
-    { "&Kcedil;", { 310, 0 } },
-    { "&Kcy;", { 1050, 0 } },
-    { "&Kfr;", { 120078, 0 } },
-    { "&Kopf;", { 120130, 0 } },
-    { "&Kscr;", { 119974, 0 } },
-    { "&LJcy;", { 1033, 0 } },
-    { "&LT;", { 60, 0 } },
-    { "&Lacute;", { 313, 0 } },
-    { "&Lambda;", { 923, 0 } },
-    { "&Lang;", { 10218, 0 } },
-    { "&Laplacetrf;", { 8466, 0 } },
-    { "&Larr;", { 8606, 0 } },
-    { "&Lcaron;", { 317, 0 } },
-    { "&Lcedil;", { 315, 0 } },
-    { "&Lcy;", { 1051, 0 } },
-    { "&LeftAngleBracket;", { 10216, 0 } },
-    { "&LeftArrow;", { 8592, 0 } },
-    { "&LeftArrowBar;", { 8676, 0 } },
-    { "&LeftArrowRightArrow;", { 8646, 0 } },
-    { "&LeftCeiling;", { 8968, 0 } },
-    { "&LeftDoubleBracket;", { 10214, 0 } },
-    { "&LeftDownTeeVector;", { 10593, 0 } },
-    { "&LeftDownVector;", { 8643, 0 } },
-    { "&LeftDownVectorBar;", { 10585, 0 } },
-    { "&LeftFloor;", { 8970, 0 } },
-    { "&LeftRightArrow;", { 8596, 0 } },
-    { "&LeftRightVector;", { 10574, 0 } },
-    { "&LeftTee;", { 8867, 0 } },
-    { "&LeftTeeArrow;", { 8612, 0 } },
-    { "&LeftTeeVector;", { 10586, 0 } },
-    { "&LeftTriangle;", { 8882, 0 } },
-    { "&LeftTriangleBar;", { 10703, 0 } },
-    { "&LeftTriangleEqual;", { 8884, 0 } },
-    { "&LeftUpDownVector;", { 10577, 0 } },
-    { "&LeftUpTeeVector;", { 10592, 0 } },
-    { "&LeftUpVector;", { 8639, 0 } },
-    { "&LeftUpVectorBar;", { 10584, 0 } },
-    { "&LeftVector;", { 8636, 0 } },
-    { "&LeftVectorBar;", { 10578, 0 } },
-    { "&Leftarrow;", { 8656, 0 } },
-    { "&Leftrightarrow;", { 8660, 0 } },
-    { "&LessEqualGreater;", { 8922, 0 } },
-    { "&LessFullEqual;", { 8806, 0 } },
-    { "&LessGreater;", { 8822, 0 } },
-    { "&LessLess;", { 10913, 0 } },
-    { "&LessSlantEqual;", { 10877, 0 } },
-    { "&LessTilde;", { 8818, 0 } },
-    { "&Lfr;", { 120079, 0 } },
-    { "&Ll;", { 8920, 0 } },
-    { "&Lleftarrow;", { 8666, 0 } },
-    { "&Lmidot;", { 319, 0 } },
-    { "&LongLeftArrow;", { 10229, 0 } },
-    { "&LongLeftRightArrow;", { 10231, 0 } },
-    { "&LongRightArrow;", { 10230, 0 } },
-    { "&Longleftarrow;", { 10232, 0 } },
-    { "&Longleftrightarrow;", { 10234, 0 } },
-    { "&Longrightarrow;", { 10233, 0 } },
-    { "&Lopf;", { 120131, 0 } },
-    { "&LowerLeftArrow;", { 8601, 0 } },
-    { "&LowerRightArrow;", { 8600, 0 } },
-    { "&Lscr;", { 8466, 0 } },
-    { "&Lsh;", { 8624, 0 } },
-    { "&Lstrok;", { 321, 0 } },
-    { "&Lt;", { 8810, 0 } },
-    { "&Map;", { 10501, 0 } },
-    { "&Mcy;", { 1052, 0 } },
-    { "&MediumSpace;", { 8287, 0 } },
-    { "&Mellintrf;", { 8499, 0 } },
-    { "&Mfr;", { 120080, 0 } },
-    { "&MinusPlus;", { 8723, 0 } },
-    { "&Mopf;", { 120132, 0 } },
-    { "&Mscr;", { 8499, 0 } },
-    { "&Mu;", { 924, 0 } },
-    { "&NJcy;", { 1034, 0 } },
-    { "&Nacute;", { 323, 0 } },
-    { "&Ncaron;", { 327, 0 } },
-    { "&Ncedil;", { 325, 0 } },
-    { "&Ncy;", { 1053, 0 } },
-    { "&NegativeMediumSpace;", { 8203, 0 } },
-    { "&NegativeThickSpace;", { 8203, 0 } },
-    { "&NegativeThinSpace;", { 8203, 0 } },
-    { "&NegativeVeryThinSpace;", { 8203, 0 } },
-    { "&NestedGreaterGreater;", { 8811, 0 } },
-    { "&NestedLessLess;", { 8810, 0 } },
-    { "&NewLine;", { 10, 0 } },
-    { "&Nfr;", { 120081, 0 } },
-    { "&NoBreak;", { 8288, 0 } },
-    { "&NonBreakingSpace;", { 160, 0 } },
-    { "&Nopf;", { 8469, 0 } },
-    { "&Not;", { 10988, 0 } },
-    { "&NotCongruent;", { 8802, 0 } },
-    { "&NotCupCap;", { 8813, 0 } },
-    { "&NotDoubleVerticalBar;", { 8742, 0 } },
-    { "&NotElement;", { 8713, 0 } },
-    { "&NotEqual;", { 8800, 0 } },
-    { "&NotEqualTilde;", { 8770, 824 } },
-    { "&NotExists;", { 8708, 0 } },
-    { "&NotGreater;", { 8815, 0 } },
-    { "&NotGreaterEqual;", { 8817, 0 } },
-    { "&NotGreaterFullEqual;", { 8807, 824 } },
-    { "&NotGreaterGreater;", { 8811, 824 } },
-    { "&NotGreaterLess;", { 8825, 0 } },
-    { "&NotGreaterSlantEqual;", { 10878, 824 } },
-    { "&NotGreaterTilde;", { 8821, 0 } },
-    { "&NotHumpDownHump;", { 8782, 824 } },
-    { "&NotHumpEqual;", { 8783, 824 } },
-    { "&NotLeftTriangle;", { 8938, 0 } },
-    { "&NotLeftTriangleBar;", { 10703, 824 } },
-    { "&NotLeftTriangleEqual;", { 8940, 0 } },
-    { "&NotLess;", { 8814, 0 } },
-    { "&NotLessEqual;", { 8816, 0 } },
-    { "&NotLessGreater;", { 8824, 0 } },
-    { "&NotLessLess;", { 8810, 824 } },
-    { "&NotLessSlantEqual;", { 10877, 824 } },
-    { "&NotLessTilde;", { 8820, 0 } },
-    { "&NotNestedGreaterGreater;", { 10914, 824 } },
-    { "&NotNestedLessLess;", { 10913, 824 } },
-    { "&NotPrecedes;", { 8832, 0 } },
-    { "&NotPrecedesEqual;", { 10927, 824 } },
-    { "&NotPrecedesSlantEqual;", { 8928, 0 } },
-    { "&NotReverseElement;", { 8716, 0 } },
-    { "&NotRightTriangle;", { 8939, 0 } },
-    { "&NotRightTriangleBar;", { 10704, 824 } },
-    { "&NotRightTriangleEqual;", { 8941, 0 } },
-    { "&NotSquareSubset;", { 8847, 824 } },
-    { "&NotSquareSubsetEqual;", { 8930, 0 } },
-    { "&NotSquareSuperset;", { 8848, 824 } },
-    { "&NotSquareSupersetEqual;", { 8931, 0 } },
-    { "&NotSubset;", { 8834, 8402 } },
-    { "&NotSubsetEqual;", { 8840, 0 } },
-    { "&NotSucceeds;", { 8833, 0 } },
-    { "&NotSucceedsEqual;", { 10928, 824 } },
-    { "&NotSucceedsSlantEqual;", { 8929, 0 } },
-    { "&NotSucceedsTilde;", { 8831, 824 } },
-    { "&NotSuperset;", { 8835, 8402 } },
-    { "&NotSupersetEqual;", { 8841, 0 } },
-    { "&NotTilde;", { 8769, 0 } },
-    { "&NotTildeEqual;", { 8772, 0 } },
-    { "&NotTildeFullEqual;", { 8775, 0 } },
-    { "&NotTildeTilde;", { 8777, 0 } },
-    { "&NotVerticalBar;", { 8740, 0 } },
-    { "&Nscr;", { 119977, 0 } },
-    { "&Ntilde;", { 209, 0 } },
-    { "&Nu;", { 925, 0 } },
-    { "&OElig;", { 338, 0 } },
-    { "&Oacute;", { 211, 0 } },
-    { "&Ocirc;", { 212, 0 } },
-    { "&Ocy;", { 1054, 0 } },
-    { "&Odblac;", { 336, 0 } },
-    { "&Ofr;", { 120082, 0 } },
-    { "&Ograve;", { 210, 0 } },
-    { "&Omacr;", { 332, 0 } },
-    { "&Omega;", { 937, 0 } },
-    { "&Omicron;", { 927, 0 } },
-    { "&Oopf;", { 120134, 0 } },
-    { "&OpenCurlyDoubleQuote;", { 8220, 0 } },
-    { "&OpenCurlyQuote;", { 8216, 0 } },
-    { "&Or;", { 10836, 0 } },
-    { "&Oscr;", { 119978, 0 } },
-    { "&Oslash;", { 216, 0 } },
-    { "&Otilde;", { 213, 0 } },
-    { "&Otimes;", { 10807, 0 } },
-    { "&Ouml;", { 214, 0 } },
-    { "&OverBar;", { 8254, 0 } },
-    { "&OverBrace;", { 9182, 0 } },
-    { "&OverBracket;", { 9140, 0 } },
-    { "&OverParenthesis;", { 9180, 0 } },
-    { "&PartialD;", { 8706, 0 } },
-    { "&Pcy;", { 1055, 0 } },
-    { "&Pfr;", { 120083, 0 } },
-    { "&Phi;", { 934, 0 } },
-    { "&Pi;", { 928, 0 } },
-    { "&PlusMinus;", { 177, 0 } },
-    { "&Poincareplane;", { 8460, 0 } },
-    { "&Popf;", { 8473, 0 } },
-    { "&Pr;", { 10939, 0 } },
-    { "&Precedes;", { 8826, 0 } },
-    { "&PrecedesEqual;", { 10927, 0 } },
-    { "&PrecedesSlantEqual;", { 8828, 0 } },
-    { "&PrecedesTilde;", { 8830, 0 } },
-    { "&Prime;", { 8243, 0 } },
-    { "&Product;", { 8719, 0 } },
-    { "&Proportion;", { 8759, 0 } },
-    { "&Proportional;", { 8733, 0 } },
-    { "&Pscr;", { 119979, 0 } },
-    { "&Psi;", { 936, 0 } },
-    { "&QUOT;", { 34, 0 } },
-    { "&Qfr;", { 120084, 0 } },
-    { "&Qopf;", { 8474, 0 } },
-    { "&Qscr;", { 119980, 0 } },
-    { "&RBarr;", { 10512, 0 } },
-    { "&REG;", { 174, 0 } },
-    { "&Racute;", { 340, 0 } },
-    { "&Rang;", { 10219, 0 } },
-    { "&Rarr;", { 8608, 0 } },
-    { "&Rarrtl;", { 10518, 0 } },
-    { "&Rcaron;", { 344, 0 } },
-    { "&Rcedil;", { 342, 0 } },
-    { "&Rcy;", { 1056, 0 } },
-    { "&Re;", { 8476, 0 } },
-    { "&ReverseElement;", { 8715, 0 } },
-    { "&ReverseEquilibrium;", { 8651, 0 } },
-    { "&ReverseUpEquilibrium;", { 10607, 0 } },
-    { "&Rfr;", { 8476, 0 } },
-    { "&Rho;", { 929, 0 } },
-    { "&RightAngleBracket;", { 10217, 0 } },
-    { "&RightArrow;", { 8594, 0 } },
-    { "&RightArrowBar;", { 8677, 0 } },
-    { "&RightArrowLeftArrow;", { 8644, 0 } },
-    { "&RightCeiling;", { 8969, 0 } },
-    { "&RightDoubleBracket;", { 10215, 0 } },
-    { "&RightDownTeeVector;", { 10589, 0 } },
-    { "&RightDownVector;", { 8642, 0 } },
-    { "&RightDownVectorBar;", { 10581, 0 } },
-    { "&RightFloor;", { 8971, 0 } },
-    { "&RightTee;", { 8866, 0 } },
-    { "&RightTeeArrow;", { 8614, 0 } },
-    { "&RightTeeVector;", { 10587, 0 } },
-    { "&RightTriangle;", { 8883, 0 } },
-    { "&RightTriangleBar;", { 10704, 0 } },
-    { "&RightTriangleEqual;", { 8885, 0 } },
-    { "&RightUpDownVector;", { 10575, 0 } },
-    { "&RightUpTeeVector;", { 10588, 0 } },
-    { "&RightUpVector;", { 8638, 0 } },
-    { "&RightUpVectorBar;", { 10580, 0 } },
-    { "&RightVector;", { 8640, 0 } },
-    { "&RightVectorBar;", { 10579, 0 } },
-    { "&Rightarrow;", { 8658, 0 } },
-    { "&Ropf;", { 8477, 0 } },
-    { "&RoundImplies;", { 10608, 0 } },
-    { "&Rrightarrow;", { 8667, 0 } },
-    { "&Rscr;", { 8475, 0 } },
-    { "&Rsh;", { 8625, 0 } },
-    { "&RuleDelayed;", { 10740, 0 } },
-    { "&SHCHcy;", { 1065, 0 } },
-    { "&SHcy;", { 1064, 0 } },
-    { "&SOFTcy;", { 1068, 0 } },
-    { "&Sacute;", { 346, 0 } },
-    { "&Sc;", { 10940, 0 } },
-    { "&Scaron;", { 352, 0 } },
-    { "&Scedil;", { 350, 0 } },
-    { "&Scirc;", { 348, 0 } },
-    { "&Scy;", { 1057, 0 } },
-    { "&Sfr;", { 120086, 0 } },
-    { "&ShortDownArrow;", { 8595, 0 } },
-    { "&ShortLeftArrow;", { 8592, 0 } },
-    { "&ShortRightArrow;", { 8594, 0 } },
-    { "&ShortUpArrow;", { 8593, 0 } },
-    { "&Sigma;", { 931, 0 } },
-    { "&SmallCircle;", { 8728, 0 } },
-    { "&Sopf;", { 120138, 0 } },
-    { "&Sqrt;", { 8730, 0 } },
-    { "&Square;", { 9633, 0 } },
-    { "&SquareIntersection;", { 8851, 0 } },
-    { "&SquareSubset;", { 8847, 0 } },
-    { "&SquareSubsetEqual;", { 8849, 0 } },
-    { "&SquareSuperset;", { 8848, 0 } },
-    { "&SquareSupersetEqual;", { 8850, 0 } },
-    { "&SquareUnion;", { 8852, 0 } },
-    { "&Sscr;", { 119982, 0 } },
-    { "&Star;", { 8902, 0 } },
-    { "&Sub;", { 8912, 0 } },
-    { "&Subset;", { 8912, 0 } },
-    { "&SubsetEqual;", { 8838, 0 } },
-    { "&Succeeds;", { 8827, 0 } },
-    { "&SucceedsEqual;", { 10928, 0 } },
-    { "&SucceedsSlantEqual;", { 8829, 0 } },
-    { "&SucceedsTilde;", { 8831, 0 } },
-    { "&SuchThat;", { 8715, 0 } },
-    { "&Sum;", { 8721, 0 } },
-    { "&Sup;", { 8913, 0 } },
-    { "&Superset;", { 8835, 0 } },
-    { "&SupersetEqual;", { 8839, 0 } },
-    { "&Supset;", { 8913, 0 } },
-    { "&THORN;", { 222, 0 } },
-    { "&TRADE;", { 8482, 0 } },
-    { "&TSHcy;", { 1035, 0 } },
-    { "&TScy;", { 1062, 0 } },
-    { "&Tab;", { 9, 0 } },
-    { "&Tau;", { 932, 0 } },
-    { "&Tcaron;", { 356, 0 } },
-    { "&Tcedil;", { 354, 0 } },
-    { "&Tcy;", { 1058, 0 } },
-    { "&Tfr;", { 120087, 0 } },
-    { "&Therefore;", { 8756, 0 } },
-    { "&Theta;", { 920, 0 } },
-    { "&ThickSpace;", { 8287, 8202 } },
-    { "&ThinSpace;", { 8201, 0 } },
-    { "&Tilde;", { 8764, 0 } },
-    { "&TildeEqual;", { 8771, 0 } },
-    { "&TildeFullEqual;", { 8773, 0 } },
-    { "&TildeTilde;", { 8776, 0 } },
-    { "&Topf;", { 120139, 0 } },
-    { "&TripleDot;", { 8411, 0 } },
-    { "&Tscr;", { 119983, 0 } },
-    { "&Tstrok;", { 358, 0 } },
-    { "&Uacute;", { 218, 0 } },
-    { "&Uarr;", { 8607, 0 } },
-    { "&Uarrocir;", { 10569, 0 } },
-    { "&Ubrcy;", { 1038, 0 } },
-    { "&Ubreve;", { 364, 0 } },
-    { "&Ucirc;", { 219, 0 } },
-    { "&Ucy;", { 1059, 0 } },
-    { "&Udblac;", { 368, 0 } },
-    { "&Ufr;", { 120088, 0 } },
-    { "&Ugrave;", { 217, 0 } },
-    { "&Umacr;", { 362, 0 } },
-    { "&UnderBar;", { 95, 0 } },
-    { "&UnderBrace;", { 9183, 0 } },
-    { "&UnderBracket;", { 9141, 0 } },
-    { "&UnderParenthesis;", { 9181, 0 } },
-    { "&Union;", { 8899, 0 } },
-    { "&UnionPlus;", { 8846, 0 } },
-    { "&Uogon;", { 370, 0 } },
-    { "&Uopf;", { 120140, 0 } },
-    { "&UpArrow;", { 8593, 0 } },
-    { "&UpArrowBar;", { 10514, 0 } },
-    { "&UpArrowDownArrow;", { 8645, 0 } },
-    { "&UpDownArrow;", { 8597, 0 } },
-    { "&UpEquilibrium;", { 10606, 0 } },
-    { "&UpTee;", { 8869, 0 } },
-    { "&UpTeeArrow;", { 8613, 0 } },
-    { "&Uparrow;", { 8657, 0 } },
-    { "&Updownarrow;", { 8661, 0 } },
-    { "&UpperLeftArrow;", { 8598, 0 } },
-    { "&UpperRightArrow;", { 8599, 0 } },
-    { "&Upsi;", { 978, 0 } },
-    { "&Upsilon;", { 933, 0 } },
-    { "&Uring;", { 366, 0 } },
-    { "&Uscr;", { 119984, 0 } },
-    { "&Utilde;", { 360, 0 } },
-    { "&Uuml;", { 220, 0 } },
-    { "&VDash;", { 8875, 0 } },
-    { "&Vbar;", { 10987, 0 } },
-    { "&Vcy;", { 1042, 0 } },
-    { "&Vdash;", { 8873, 0 } },
-    { "&Vdashl;", { 10982, 0 } },
-    { "&Vee;", { 8897, 0 } },
-    { "&Verbar;", { 8214, 0 } },
-    { "&Vert;", { 8214, 0 } },
-    { "&VerticalBar;", { 8739, 0 } },
-    { "&VerticalLine;", { 124, 0 } },
-    { "&VerticalSeparator;", { 10072, 0 } },
-    { "&VerticalTilde;", { 8768, 0 } },
-    { "&VeryThinSpace;", { 8202, 0 } },
-    { "&Vfr;", { 120089, 0 } },
-    { "&Vopf;", { 120141, 0 } },
-    { "&Vscr;", { 119985, 0 } },
-    { "&Vvdash;", { 8874, 0 } },
-    { "&Wcirc;", { 372, 0 } },
-    { "&Wedge;", { 8896, 0 } },
-    { "&Wfr;", { 120090, 0 } },
-    { "&Wopf;", { 120142, 0 } },
-    { "&Wscr;", { 119986, 0 } },
-    { "&Xfr;", { 120091, 0 } },
-    { "&Xi;", { 926, 0 } },
-    { "&Xopf;", { 120143, 0 } },
-    { "&Xscr;", { 119987, 0 } },
-    { "&YAcy;", { 1071, 0 } },
-    { "&YIcy;", { 1031, 0 } },
-    { "&YUcy;", { 1070, 0 } },
-    { "&Yacute;", { 221, 0 } },
-    { "&Ycirc;", { 374, 0 } },
-    { "&Ycy;", { 1067, 0 } },
-    { "&Yfr;", { 120092, 0 } },
-    { "&Yopf;", { 120144, 0 } },
-    { "&Yscr;", { 119988, 0 } },
-    { "&Yuml;", { 376, 0 } },
-    { "&ZHcy;", { 1046, 0 } },
-    { "&Zacute;", { 377, 0 } },
-    { "&Zcaron;", { 381, 0 } },
-    { "&Zcy;", { 1047, 0 } },
-    { "&Zdot;", { 379, 0 } },
-    { "&ZeroWidthSpace;", { 8203, 0 } },
-    { "&Zeta;", { 918, 0 } },
-    { "&Zfr;", { 8488, 0 } },
-    { "&Zopf;", { 8484, 0 } },
-    { "&Zscr;", { 119989, 0 } },
-    { "&aacute;", { 225, 0 } },
-    { "&abreve;", { 259, 0 } },
-    { "&ac;", { 8766, 0 } },
-    { "&acE;", { 8766, 819 } },
-    { "&acd;", { 8767, 0 } },
-    { "&acirc;", { 226, 0 } },
-    { "&acute;", { 180, 0 } },
-    { "&acy;", { 1072, 0 } },
-    { "&aelig;", { 230, 0 } },
-    { "&af;", { 8289, 0 } },
-    { "&afr;", { 120094, 0 } },
-    { "&agrave;", { 224, 0 } },
-    { "&alefsym;", { 8501, 0 } },
-    { "&aleph;", { 8501, 0 } },
-    { "&alpha;", { 945, 0 } },
-    { "&amacr;", { 257, 0 } },
-    { "&amalg;", { 10815, 0 } },
-    { "&amp;", { 38, 0 } },
-    { "&and;", { 8743, 0 } },
-    { "&andand;", { 10837, 0 } },
-    { "&andd;", { 10844, 0 } },
-    { "&andslope;", { 10840, 0 } },
-    { "&andv;", { 10842, 0 } },
-    { "&ang;", { 8736, 0 } },
-    { "&ange;", { 10660, 0 } },
-    { "&angle;", { 8736, 0 } },
-    { "&angmsd;", { 8737, 0 } },
-    { "&angmsdaa;", { 10664, 0 } },
-    { "&angmsdab;", { 10665, 0 } },
-    { "&angmsdac;", { 10666, 0 } },
-    { "&angmsdad;", { 10667, 0 } },
-    { "&angmsdae;", { 10668, 0 } },
-    { "&angmsdaf;", { 10669, 0 } },
-    { "&angmsdag;", { 10670, 0 } },
-    { "&angmsdah;", { 10671, 0 } },
-    { "&angrt;", { 8735, 0 } },
-    { "&angrtvb;", { 8894, 0 } },
-    { "&angrtvbd;", { 10653, 0 } },
-    { "&angsph;", { 8738, 0 } },
-    { "&angst;", { 197, 0 } },
-    { "&angzarr;", { 9084, 0 } },
-    { "&aogon;", { 261, 0 } },
-    { "&aopf;", { 120146, 0 } },
-    { "&ap;", { 8776, 0 } },
-    { "&apE;", { 10864, 0 } },
-    { "&apacir;", { 10863, 0 } },
-    { "&ape;", { 8778, 0 } },
-    { "&apid;", { 8779, 0 } },
-    { "&apos;", { 39, 0 } },
-    { "&approx;", { 8776, 0 } },
-    { "&approxeq;", { 8778, 0 } },
-    { "&aring;", { 229, 0 } },
-    { "&ascr;", { 119990, 0 } },
-    { "&ast;", { 42, 0 } },
-    { "&asymp;", { 8776, 0 } },
-    { "&asympeq;", { 8781, 0 } },
-    { "&atilde;", { 227, 0 } },
-    { "&auml;", { 228, 0 } },
-    { "&awconint;", { 8755, 0 } },
-    { "&awint;", { 10769, 0 } },
-    { "&bNot;", { 10989, 0 } },
-    { "&backcong;", { 8780, 0 } },
-    { "&backepsilon;", { 1014, 0 } },
-    { "&backprime;", { 8245, 0 } },
-    { "&backsim;", { 8765, 0 } },
-    { "&backsimeq;", { 8909, 0 } },
-    { "&barvee;", { 8893, 0 } },
-    { "&barwed;", { 8965, 0 } },
-    { "&barwedge;", { 8965, 0 } },
-    { "&bbrk;", { 9141, 0 } },
-    { "&bbrktbrk;", { 9142, 0 } },
-    { "&bcong;", { 8780, 0 } },
-    { "&bcy;", { 1073, 0 } },
-    { "&bdquo;", { 8222, 0 } },
-    { "&becaus;", { 8757, 0 } },
-    { "&because;", { 8757, 0 } },
-    { "&bemptyv;", { 10672, 0 } },
-    { "&bepsi;", { 1014, 0 } },
-    { "&bernou;", { 8492, 0 } },
-    { "&beta;", { 946, 0 } },
-    { "&beth;", { 8502, 0 } },
-    { "&between;", { 8812, 0 } },
-    { "&bfr;", { 120095, 0 } },
-    { "&bigcap;", { 8898, 0 } },
-    { "&bigcirc;", { 9711, 0 } },
-    { "&bigcup;", { 8899, 0 } },
-    { "&bigodot;", { 10752, 0 } },
-    { "&bigoplus;", { 10753, 0 } },
-    { "&bigotimes;", { 10754, 0 } },
-    { "&bigsqcup;", { 10758, 0 } },
-    { "&bigstar;", { 9733, 0 } },
-    { "&bigtriangledown;", { 9661, 0 } },
-    { "&bigtriangleup;", { 9651, 0 } },
-    { "&biguplus;", { 10756, 0 } },
-    { "&bigvee;", { 8897, 0 } },
-    { "&bigwedge;", { 8896, 0 } },
-    { "&bkarow;", { 10509, 0 } },
-    { "&blacklozenge;", { 10731, 0 } },
-    { "&blacksquare;", { 9642, 0 } },
-    { "&blacktriangle;", { 9652, 0 } },
-    { "&blacktriangledown;", { 9662, 0 } },
-    { "&blacktriangleleft;", { 9666, 0 } },
-    { "&blacktriangleright;", { 9656, 0 } },
-    { "&blank;", { 9251, 0 } },
-    { "&blk12;", { 9618, 0 } },
-    { "&blk14;", { 9617, 0 } },
-    { "&blk34;", { 9619, 0 } },
-    { "&block;", { 9608, 0 } },
-    { "&bne;", { 61, 8421 } },
-    { "&bnequiv;", { 8801, 8421 } },
-    { "&bnot;", { 8976, 0 } },
-    { "&bopf;", { 120147, 0 } },
-    { "&bot;", { 8869, 0 } },
-    { "&bottom;", { 8869, 0 } },
-    { "&bowtie;", { 8904, 0 } },
-    { "&boxDL;", { 9559, 0 } },
-    { "&boxDR;", { 9556, 0 } },
-    { "&boxDl;", { 9558, 0 } },
-    { "&boxDr;", { 9555, 0 } },
-    { "&boxH;", { 9552, 0 } },
-    { "&boxHD;", { 9574, 0 } },
-    { "&boxHU;", { 9577, 0 } },
-    { "&boxHd;", { 9572, 0 } },
-    { "&boxHu;", { 9575, 0 } },
-    { "&boxUL;", { 9565, 0 } },
-    { "&boxUR;", { 9562, 0 } },
-    { "&boxUl;", { 9564, 0 } },
-    { "&boxUr;", { 9561, 0 } },
-    { "&boxV;", { 9553, 0 } },
-    { "&boxVH;", { 9580, 0 } },
-    { "&boxVL;", { 9571, 0 } },
-    { "&boxVR;", { 9568, 0 } },
-    { "&boxVh;", { 9579, 0 } },
-    { "&boxVl;", { 9570, 0 } },
-    { "&boxVr;", { 9567, 0 } },
-    { "&boxbox;", { 10697, 0 } },
-    { "&boxdL;", { 9557, 0 } },
-    { "&boxdR;", { 9554, 0 } },
-    { "&boxdl;", { 9488, 0 } },
-    { "&boxdr;", { 9484, 0 } },
-    { "&boxh;", { 9472, 0 } },
-    { "&boxhD;", { 9573, 0 } },
-    { "&boxhU;", { 9576, 0 } },
-    { "&boxhd;", { 9516, 0 } },
-    { "&boxhu;", { 9524, 0 } },
-    { "&boxminus;", { 8863, 0 } },
-    { "&boxplus;", { 8862, 0 } },
-    { "&boxtimes;", { 8864, 0 } },
-    { "&boxuL;", { 9563, 0 } },
-    { "&boxuR;", { 9560, 0 } },
-    { "&boxul;", { 9496, 0 } },
-    { "&boxur;", { 9492, 0 } },
-    { "&boxv;", { 9474, 0 } },
-    { "&boxvH;", { 9578, 0 } },
-    { "&boxvL;", { 9569, 0 } },
-    { "&boxvR;", { 9566, 0 } },
-    { "&boxvh;", { 9532, 0 } },
-    { "&boxvl;", { 9508, 0 } },
-    { "&boxvr;", { 9500, 0 } },
-    { "&bprime;", { 8245, 0 } },
-    { "&breve;", { 728, 0 } },
-    { "&brvbar;", { 166, 0 } },
-    { "&bscr;", { 119991, 0 } },
-    { "&bsemi;", { 8271, 0 } },
-    { "&bsim;", { 8765, 0 } },
-    { "&bsime;", { 8909, 0 } },
-    { "&bsol;", { 92, 0 } },
-    { "&bsolb;", { 10693, 0 } },
-    { "&bsolhsub;", { 10184, 0 } },
-    { "&bull;", { 8226, 0 } },
-    { "&bullet;", { 8226, 0 } },
-    { "&bump;", { 8782, 0 } },
-    { "&bumpE;", { 10926, 0 } },
-    { "&bumpe;", { 8783, 0 } },
-    { "&bumpeq;", { 8783, 0 } },
-    { "&cacute;", { 263, 0 } },
-    { "&cap;", { 8745, 0 } },
-    { "&capand;", { 10820, 0 } },
-    { "&capbrcup;", { 10825, 0 } },
-    { "&capcap;", { 10827, 0 } },
-    { "&capcup;", { 10823, 0 } },
-    { "&capdot;", { 10816, 0 } },
-    { "&caps;", { 8745, 65024 } },
-    { "&caret;", { 8257, 0 } },
-    { "&caron;", { 711, 0 } },
-    { "&ccaps;", { 10829, 0 } },
-    { "&ccaron;", { 269, 0 } },
-    { "&ccedil;", { 231, 0 } },
-    { "&ccirc;", { 265, 0 } },
-    { "&ccups;", { 10828, 0 } },
-    { "&ccupssm;", { 10832, 0 } },
-    { "&cdot;", { 267, 0 } },
-    { "&cedil;", { 184, 0 } },
-    { "&cemptyv;", { 10674, 0 } },
-    { "&cent;", { 162, 0 } },
-    { "&centerdot;", { 183, 0 } },
-    { "&cfr;", { 120096, 0 } },
-    { "&chcy;", { 1095, 0 } },
-    { "&check;", { 10003, 0 } },
-    { "&checkmark;", { 10003, 0 } },
-    { "&chi;", { 967, 0 } },
-    { "&cir;", { 9675, 0 } },
-    { "&cirE;", { 10691, 0 } },
-    { "&circ;", { 710, 0 } },
-    { "&circeq;", { 8791, 0 } },
-    { "&circlearrowleft;", { 8634, 0 } },
-    { "&circlearrowright;", { 8635, 0 } },
-    { "&circledR;", { 174, 0 } },
-    { "&circledS;", { 9416, 0 } },
-    { "&circledast;", { 8859, 0 } },
-    { "&circledcirc;", { 8858, 0 } },
-    { "&circleddash;", { 8861, 0 } },
-    { "&cire;", { 8791, 0 } },
-    { "&cirfnint;", { 10768, 0 } },
-    { "&cirmid;", { 10991, 0 } },
-    { "&cirscir;", { 10690, 0 } },
-    { "&clubs;", { 9827, 0 } },
-    { "&clubsuit;", { 9827, 0 } },
-    { "&colon;", { 58, 0 } },
-    { "&colone;", { 8788, 0 } },
-    { "&coloneq;", { 8788, 0 } },
-    { "&comma;", { 44, 0 } },
-    { "&commat;", { 64, 0 } },
-    { "&comp;", { 8705, 0 } },
-    { "&compfn;", { 8728, 0 } },
-    { "&complement;", { 8705, 0 } },
-    { "&complexes;", { 8450, 0 } },
-    { "&cong;", { 8773, 0 } },
-    { "&congdot;", { 10861, 0 } },
-    { "&conint;", { 8750, 0 } },
-    { "&copf;", { 120148, 0 } },
-    { "&coprod;", { 8720, 0 } },
-    { "&copy;", { 169, 0 } },
-    { "&copysr;", { 8471, 0 } },
-    { "&crarr;", { 8629, 0 } },
-    { "&cross;", { 10007, 0 } },
-    { "&cscr;", { 119992, 0 } },
-    { "&csub;", { 10959, 0 } },
-    { "&csube;", { 10961, 0 } },
-    { "&csup;", { 10960, 0 } },
-    { "&csupe;", { 10962, 0 } },
-    { "&ctdot;", { 8943, 0 } },
-    { "&cudarrl;", { 10552, 0 } },
-    { "&cudarrr;", { 10549, 0 } },
-    { "&cuepr;", { 8926, 0 } },
-    { "&cuesc;", { 8927, 0 } },
-    { "&cularr;", { 8630, 0 } },
-    { "&cularrp;", { 10557, 0 } },
-    { "&cup;", { 8746, 0 } },
-    { "&cupbrcap;", { 10824, 0 } },
-    { "&cupcap;", { 10822, 0 } },
-    { "&cupcup;", { 10826, 0 } },
-    { "&cupdot;", { 8845, 0 } },
-    { "&cupor;", { 10821, 0 } },
-    { "&cups;", { 8746, 65024 } },
-    { "&curarr;", { 8631, 0 } },
-    { "&curarrm;", { 10556, 0 } },
-    { "&curlyeqprec;", { 8926, 0 } },
-    { "&curlyeqsucc;", { 8927, 0 } },
-    { "&curlyvee;", { 8910, 0 } },
-    { "&curlywedge;", { 8911, 0 } },
-    { "&curren;", { 164, 0 } },
-    { "&curvearrowleft;", { 8630, 0 } },
-    { "&curvearrowright;", { 8631, 0 } },
-    { "&cuvee;", { 8910, 0 } },
-    { "&cuwed;", { 8911, 0 } },
-    { "&cwconint;", { 8754, 0 } },
-    { "&cwint;", { 8753, 0 } },
-    { "&cylcty;", { 9005, 0 } },
-    { "&dArr;", { 8659, 0 } },
-    { "&dHar;", { 10597, 0 } },
-    { "&dagger;", { 8224, 0 } },
-    { "&daleth;", { 8504, 0 } },
-    { "&darr;", { 8595, 0 } },
-    { "&dash;", { 8208, 0 } },
-    { "&dashv;", { 8867, 0 } },
-    { "&dbkarow;", { 10511, 0 } },
-    { "&dblac;", { 733, 0 } },
-    { "&dcaron;", { 271, 0 } },
-    { "&dcy;", { 1076, 0 } },
-    { "&dd;", { 8518, 0 } },
-    { "&ddagger;", { 8225, 0 } },
-    { "&ddarr;", { 8650, 0 } },
-    { "&ddotseq;", { 10871, 0 } },
-    { "&deg;", { 176, 0 } },
-    { "&delta;", { 948, 0 } },
-    { "&demptyv;", { 10673, 0 } },
-    { "&dfisht;", { 10623, 0 } },
-    { "&dfr;", { 120097, 0 } },
-    { "&dharl;", { 8643, 0 } },
-    { "&dharr;", { 8642, 0 } },
-    { "&diam;", { 8900, 0 } },
-    { "&diamond;", { 8900, 0 } },
-    { "&diamondsuit;", { 9830, 0 } },
-    { "&diams;", { 9830, 0 } },
-    { "&die;", { 168, 0 } },
-    { "&digamma;", { 989, 0 } },
-    { "&disin;", { 8946, 0 } },
-    { "&div;", { 247, 0 } },
-    { "&divide;", { 247, 0 } },
-    { "&divideontimes;", { 8903, 0 } },
-    { "&divonx;", { 8903, 0 } },
-    { "&djcy;", { 1106, 0 } },
-    { "&dlcorn;", { 8990, 0 } },
-    { "&dlcrop;", { 8973, 0 } },
-    { "&dollar;", { 36, 0 } },
-    { "&dopf;", { 120149, 0 } },
-    { "&dot;", { 729, 0 } },
-    { "&doteq;", { 8784, 0 } },
-    { "&doteqdot;", { 8785, 0 } },
-    { "&dotminus;", { 8760, 0 } },
-    { "&dotplus;", { 8724, 0 } },
-    { "&dotsquare;", { 8865, 0 } },
-    { "&doublebarwedge;", { 8966, 0 } },
-    { "&downarrow;", { 8595, 0 } },
-    { "&downdownarrows;", { 8650, 0 } },
-    { "&downharpoonleft;", { 8643, 0 } },
-    { "&downharpoonright;", { 8642, 0 } },
-    { "&drbkarow;", { 10512, 0 } },
-    { "&drcorn;", { 8991, 0 } },
-    { "&drcrop;", { 8972, 0 } },
-    { "&dscr;", { 119993, 0 } },
-    { "&dscy;", { 1109, 0 } },
-    { "&dsol;", { 10742, 0 } },
-    { "&dstrok;", { 273, 0 } },
-    { "&dtdot;", { 8945, 0 } },
-    { "&dtri;", { 9663, 0 } },
-    { "&dtrif;", { 9662, 0 } },
-    { "&duarr;", { 8693, 0 } },
-    { "&duhar;", { 10607, 0 } },
-    { "&dwangle;", { 10662, 0 } },
-    { "&dzcy;", { 1119, 0 } },
-    { "&dzigrarr;", { 10239, 0 } },
-    { "&eDDot;", { 10871, 0 } },
-    { "&eDot;", { 8785, 0 } },
-    { "&eacute;", { 233, 0 } },
-    { "&easter;", { 10862, 0 } },
-    { "&ecaron;", { 283, 0 } },
-    { "&ecir;", { 8790, 0 } },
-    { "&ecirc;", { 234, 0 } },
-    { "&ecolon;", { 8789, 0 } },
-    { "&ecy;", { 1101, 0 } },
-    { "&edot;", { 279, 0 } },
-    { "&ee;", { 8519, 0 } },
-    { "&efDot;", { 8786, 0 } },
-    { "&efr;", { 120098, 0 } },
-    { "&eg;", { 10906, 0 } },
-    { "&egrave;", { 232, 0 } },
-    { "&egs;", { 10902, 0 } },
-    { "&egsdot;", { 10904, 0 } },
-    { "&el;", { 10905, 0 } },
-    { "&elinters;", { 9191, 0 } },
-    { "&ell;", { 8467, 0 } },
-    { "&els;", { 10901, 0 } },
-    { "&elsdot;", { 10903, 0 } },
-    { "&emacr;", { 275, 0 } },
-    { "&empty;", { 8709, 0 } },
-    { "&emptyset;", { 8709, 0 } },
-    { "&emptyv;", { 8709, 0 } },
-    { "&emsp13;", { 8196, 0 } },
-    { "&emsp14;", { 8197, 0 } },
-    { "&emsp;", { 8195, 0 } },
-    { "&eng;", { 331, 0 } },
-    { "&ensp;", { 8194, 0 } },
-    { "&eogon;", { 281, 0 } },
-    { "&eopf;", { 120150, 0 } },
-    { "&epar;", { 8917, 0 } },
-    { "&eparsl;", { 10723, 0 } },
-    { "&eplus;", { 10865, 0 } },
-    { "&epsi;", { 949, 0 } },
-    { "&epsilon;", { 949, 0 } },
-    { "&epsiv;", { 1013, 0 } },
-    { "&eqcirc;", { 8790, 0 } },
-    { "&eqcolon;", { 8789, 0 } },
-    { "&eqsim;", { 8770, 0 } },
-    { "&eqslantgtr;", { 10902, 0 } },
-    { "&eqslantless;", { 10901, 0 } },
-    { "&equals;", { 61, 0 } },
-    { "&equest;", { 8799, 0 } },
-    { "&equiv;", { 8801, 0 } },
-    { "&equivDD;", { 10872, 0 } },
-    { "&eqvparsl;", { 10725, 0 } },
-    { "&erDot;", { 8787, 0 } },
-    { "&erarr;", { 10609, 0 } },
-    { "&escr;", { 8495, 0 } },
-    { "&esdot;", { 8784, 0 } },
-    { "&esim;", { 8770, 0 } },
-    { "&eta;", { 951, 0 } },
-    { "&eth;", { 240, 0 } },
-    { "&euml;", { 235, 0 } },
-    { "&euro;", { 8364, 0 } },
-    { "&excl;", { 33, 0 } },
-    { "&exist;", { 8707, 0 } },
-    { "&expectation;", { 8496, 0 } },
-    { "&exponentiale;", { 8519, 0 } },
-    { "&fallingdotseq;", { 8786, 0 } },
-    { "&fcy;", { 1092, 0 } },
-    { "&female;", { 9792, 0 } },
-    { "&ffilig;", { 64259, 0 } },
-    { "&fflig;", { 64256, 0 } },
-    { "&ffllig;", { 64260, 0 } },
-    { "&ffr;", { 120099, 0 } },
-    { "&filig;", { 64257, 0 } },
-    { "&fjlig;", { 102, 106 } },
-    { "&flat;", { 9837, 0 } },
-    { "&fllig;", { 64258, 0 } },
-    { "&fltns;", { 9649, 0 } },
-    { "&fnof;", { 402, 0 } },
-    { "&fopf;", { 120151, 0 } },
-    { "&forall;", { 8704, 0 } },
-    { "&fork;", { 8916, 0 } },
-    { "&forkv;", { 10969, 0 } },
-    { "&fpartint;", { 10765, 0 } },
-    { "&frac12;", { 189, 0 } },
-    { "&frac13;", { 8531, 0 } },
-    { "&frac14;", { 188, 0 } },
-    { "&frac15;", { 8533, 0 } },
-    { "&frac16;", { 8537, 0 } },
-    { "&frac18;", { 8539, 0 } },
-    { "&frac23;", { 8532, 0 } },
-    { "&frac25;", { 8534, 0 } },
-    { "&frac34;", { 190, 0 } },
-    { "&frac35;", { 8535, 0 } },
-    { "&frac38;", { 8540, 0 } },
-    { "&frac45;", { 8536, 0 } },
-    { "&frac56;", { 8538, 0 } },
-    { "&frac58;", { 8541, 0 } },
-    { "&frac78;", { 8542, 0 } },
-    { "&frasl;", { 8260, 0 } },
-    { "&frown;", { 8994, 0 } },
-    { "&fscr;", { 119995, 0 } },
-    { "&gE;", { 8807, 0 } },
-    { "&gEl;", { 10892, 0 } },
-    { "&gacute;", { 501, 0 } },
-    { "&gamma;", { 947, 0 } },
-    { "&gammad;", { 989, 0 } },
-    { "&gap;", { 10886, 0 } },
-    { "&gbreve;", { 287, 0 } },
-    { "&gcirc;", { 285, 0 } },
-    { "&gcy;", { 1075, 0 } },
-    { "&gdot;", { 289, 0 } },
-    { "&ge;", { 8805, 0 } },
-    { "&gel;", { 8923, 0 } },
-    { "&geq;", { 8805, 0 } },
-    { "&geqq;", { 8807, 0 } },
-    { "&geqslant;", { 10878, 0 } },
-    { "&ges;", { 10878, 0 } },
-    { "&gescc;", { 10921, 0 } },
-    { "&gesdot;", { 10880, 0 } },
-    { "&gesdoto;", { 10882, 0 } },
-    { "&gesdotol;", { 10884, 0 } },
-    { "&gesl;", { 8923, 65024 } },
-    { "&gesles;", { 10900, 0 } },
-    { "&gfr;", { 120100, 0 } },
-    { "&gg;", { 8811, 0 } },
-    { "&ggg;", { 8921, 0 } },
-    { "&gimel;", { 8503, 0 } },
-    { "&gjcy;", { 1107, 0 } },
-    { "&gl;", { 8823, 0 } },
-    { "&glE;", { 10898, 0 } },
-    { "&gla;", { 10917, 0 } },
-    { "&glj;", { 10916, 0 } },
-    { "&gnE;", { 8809, 0 } },
-    { "&gnap;", { 10890, 0 } },
-    { "&gnapprox;", { 10890, 0 } },
-    { "&gne;", { 10888, 0 } },
-    { "&gneq;", { 10888, 0 } },
-    { "&gneqq;", { 8809, 0 } },
-    { "&gnsim;", { 8935, 0 } },
-    { "&gopf;", { 120152, 0 } },
-    { "&grave;", { 96, 0 } },
-    { "&gscr;", { 8458, 0 } },
-    { "&gsim;", { 8819, 0 } },
-    { "&gsime;", { 10894, 0 } },
-    { "&gsiml;", { 10896, 0 } },
-    { "&gt;", { 62, 0 } },
-    { "&gtcc;", { 10919, 0 } },
-    { "&gtcir;", { 10874, 0 } },
-    { "&gtdot;", { 8919, 0 } },
-    { "&gtlPar;", { 10645, 0 } },
-    { "&gtquest;", { 10876, 0 } },
-    { "&gtrapprox;", { 10886, 0 } },
-    { "&gtrarr;", { 10616, 0 } },
-    { "&gtrdot;", { 8919, 0 } },
-    { "&gtreqless;", { 8923, 0 } },
-    { "&gtreqqless;", { 10892, 0 } },
-    { "&gtrless;", { 8823, 0 } },
-    { "&gtrsim;", { 8819, 0 } },
-    { "&gvertneqq;", { 8809, 65024 } },
-    { "&gvnE;", { 8809, 65024 } },
-    { "&hArr;", { 8660, 0 } },
-    { "&hairsp;", { 8202, 0 } },
-    { "&half;", { 189, 0 } },
-    { "&hamilt;", { 8459, 0 } },
-    { "&hardcy;", { 1098, 0 } },
-    { "&harr;", { 8596, 0 } },
-    { "&harrcir;", { 10568, 0 } },
-    { "&harrw;", { 8621, 0 } },
-    { "&hbar;", { 8463, 0 } },
-    { "&hcirc;", { 293, 0 } },
-    { "&hearts;", { 9829, 0 } },
-    { "&heartsuit;", { 9829, 0 } },
-    { "&hellip;", { 8230, 0 } },
-    { "&hercon;", { 8889, 0 } },
-    { "&hfr;", { 120101, 0 } },
-    { "&hksearow;", { 10533, 0 } },
-    { "&hkswarow;", { 10534, 0 } },
-    { "&hoarr;", { 8703, 0 } },
-    { "&homtht;", { 8763, 0 } },
-    { "&hookleftarrow;", { 8617, 0 } },
-    { "&hookrightarrow;", { 8618, 0 } },
-    { "&hopf;", { 120153, 0 } },
-    { "&horbar;", { 8213, 0 } },
-    { "&hscr;", { 119997, 0 } },
-    { "&hslash;", { 8463, 0 } },
-    { "&hstrok;", { 295, 0 } },
-    { "&hybull;", { 8259, 0 } },
-    { "&hyphen;", { 8208, 0 } },
-    { "&iacute;", { 237, 0 } },
-    { "&ic;", { 8291, 0 } },
-    { "&icirc;", { 238, 0 } },
-    { "&icy;", { 1080, 0 } },
-    { "&iecy;", { 1077, 0 } },
-    { "&iexcl;", { 161, 0 } },
-    { "&iff;", { 8660, 0 } },
-    { "&ifr;", { 120102, 0 } },
-    { "&igrave;", { 236, 0 } },
-    { "&ii;", { 8520, 0 } },
-    { "&iiiint;", { 10764, 0 } },
-    { "&iiint;", { 8749, 0 } },
-    { "&iinfin;", { 10716, 0 } },
-    { "&iiota;", { 8489, 0 } },
-    { "&ijlig;", { 307, 0 } },
-    { "&imacr;", { 299, 0 } },
-    { "&image;", { 8465, 0 } },
-    { "&imagline;", { 8464, 0 } },
-    { "&imagpart;", { 8465, 0 } },
-    { "&imath;", { 305, 0 } },
-    { "&imof;", { 8887, 0 } },
-    { "&imped;", { 437, 0 } },
-    { "&in;", { 8712, 0 } },
-    { "&incare;", { 8453, 0 } },
-    { "&infin;", { 8734, 0 } },
-    { "&infintie;", { 10717, 0 } },
-    { "&inodot;", { 305, 0 } },
-    { "&int;", { 8747, 0 } },
-    { "&intcal;", { 8890, 0 } },
-    { "&integers;", { 8484, 0 } },
-    { "&intercal;", { 8890, 0 } },
-    { "&intlarhk;", { 10775, 0 } },
-    { "&intprod;", { 10812, 0 } },
-    { "&iocy;", { 1105, 0 } },
-    { "&iogon;", { 303, 0 } },
-    { "&iopf;", { 120154, 0 } },
-    { "&iota;", { 953, 0 } },
-    { "&iprod;", { 10812, 0 } },
-    { "&iquest;", { 191, 0 } },
-    { "&iscr;", { 119998, 0 } },
-    { "&isin;", { 8712, 0 } },
-    { "&isinE;", { 8953, 0 } },
-    { "&isindot;", { 8949, 0 } },
-    { "&isins;", { 8948, 0 } },
-    { "&isinsv;", { 8947, 0 } },
-    { "&isinv;", { 8712, 0 } },
-    { "&it;", { 8290, 0 } },
-    { "&itilde;", { 297, 0 } },
-    { "&iukcy;", { 1110, 0 } },
-    { "&iuml;", { 239, 0 } },
-    { "&jcirc;", { 309, 0 } },
-    { "&jcy;", { 1081, 0 } },
-    { "&jfr;", { 120103, 0 } },
-    { "&jmath;", { 567, 0 } },
-    { "&jopf;", { 120155, 0 } },
-    { "&jscr;", { 119999, 0 } },
-    { "&jsercy;", { 1112, 0 } },
-    { "&jukcy;", { 1108, 0 } },
-    { "&kappa;", { 954, 0 } },
-    { "&kappav;", { 1008, 0 } },
-    { "&kcedil;", { 311, 0 } },
-    { "&kcy;", { 1082, 0 } },
-    { "&kfr;", { 120104, 0 } },
-    { "&kgreen;", { 312, 0 } },
-    { "&khcy;", { 1093, 0 } },
-    { "&kjcy;", { 1116, 0 } },
-    { "&kopf;", { 120156, 0 } },
-    { "&kscr;", { 120000, 0 } },
-    { "&lAarr;", { 8666, 0 } },
-    { "&lArr;", { 8656, 0 } },
-    { "&lAtail;", { 10523, 0 } },
-    { "&lBarr;", { 10510, 0 } },
-    { "&lE;", { 8806, 0 } },
-    { "&lEg;", { 10891, 0 } },
-    { "&lHar;", { 10594, 0 } },
-    { "&lacute;", { 314, 0 } },
-    { "&laemptyv;", { 10676, 0 } },
-    { "&lagran;", { 8466, 0 } },
-    { "&lambda;", { 955, 0 } },
-    { "&lang;", { 10216, 0 } },
-    { "&langd;", { 10641, 0 } },
-    { "&langle;", { 10216, 0 } },
-    { "&lap;", { 10885, 0 } },
-    { "&laquo;", { 171, 0 } },
-    { "&larr;", { 8592, 0 } },
-    { "&larrb;", { 8676, 0 } },
-    { "&larrbfs;", { 10527, 0 } },
-    { "&larrfs;", { 10525, 0 } },
-    { "&larrhk;", { 8617, 0 } },
-    { "&larrlp;", { 8619, 0 } },
-    { "&larrpl;", { 10553, 0 } },
-    { "&larrsim;", { 10611, 0 } },
-    { "&larrtl;", { 8610, 0 } },
-    { "&lat;", { 10923, 0 } },
-    { "&latail;", { 10521, 0 } },
-    { "&late;", { 10925, 0 } },
-    { "&lates;", { 10925, 65024 } },
-    { "&lbarr;", { 10508, 0 } },
-    { "&lbbrk;", { 10098, 0 } },
-    { "&lbrace;", { 123, 0 } },
-    { "&lbrack;", { 91, 0 } },
-    { "&lbrke;", { 10635, 0 } },
-    { "&lbrksld;", { 10639, 0 } },
-    { "&lbrkslu;", { 10637, 0 } },
-    { "&lcaron;", { 318, 0 } },
-    { "&lcedil;", { 316, 0 } },
-    { "&lceil;", { 8968, 0 } },
-    { "&lcub;", { 123, 0 } },
-    { "&lcy;", { 1083, 0 } },
-    { "&ldca;", { 10550, 0 } },
-    { "&ldquo;", { 8220, 0 } },
-    { "&ldquor;", { 8222, 0 } },
-    { "&ldrdhar;", { 10599, 0 } },
-    { "&ldrushar;", { 10571, 0 } },
-    { "&ldsh;", { 8626, 0 } },
-    { "&le;", { 8804, 0 } },
-    { "&leftarrow;", { 8592, 0 } },
-    { "&leftarrowtail;", { 8610, 0 } },
-    { "&leftharpoondown;", { 8637, 0 } },
-    { "&leftharpoonup;", { 8636, 0 } },
-    { "&leftleftarrows;", { 8647, 0 } },
-    { "&leftrightarrow;", { 8596, 0 } },
-    { "&leftrightarrows;", { 8646, 0 } },
-    { "&leftrightharpoons;", { 8651, 0 } },
-    { "&leftrightsquigarrow;", { 8621, 0 } },
-    { "&leftthreetimes;", { 8907, 0 } },
-    { "&leg;", { 8922, 0 } },
-    { "&leq;", { 8804, 0 } },
-    { "&leqq;", { 8806, 0 } },
-    { "&leqslant;", { 10877, 0 } },
-    { "&les;", { 10877, 0 } },
-    { "&lescc;", { 10920, 0 } },
-    { "&lesdot;", { 10879, 0 } },
-    { "&lesdoto;", { 10881, 0 } },
-    { "&lesdotor;", { 10883, 0 } },
-    { "&lesg;", { 8922, 65024 } },
-    { "&lesges;", { 10899, 0 } },
-    { "&lessapprox;", { 10885, 0 } },
-    { "&lessdot;", { 8918, 0 } },
-    { "&lesseqgtr;", { 8922, 0 } },
-    { "&lesseqqgtr;", { 10891, 0 } },
-    { "&lessgtr;", { 8822, 0 } },
-    { "&lesssim;", { 8818, 0 } },
-    { "&lfisht;", { 10620, 0 } },
-    { "&lfloor;", { 8970, 0 } },
-    { "&lfr;", { 120105, 0 } },
-    { "&lg;", { 8822, 0 } },
-    { "&lgE;", { 10897, 0 } },
-    { "&lhard;", { 8637, 0 } },
-    { "&lharu;", { 8636, 0 } },
-    { "&lharul;", { 10602, 0 } },
-    { "&lhblk;", { 9604, 0 } },
-    { "&ljcy;", { 1113, 0 } },
-    { "&ll;", { 8810, 0 } },
-    { "&llarr;", { 8647, 0 } },
-    { "&llcorner;", { 8990, 0 } },
-    { "&llhard;", { 10603, 0 } },
-    { "&lltri;", { 9722, 0 } },
-    { "&lmidot;", { 320, 0 } },
-    { "&lmoust;", { 9136, 0 } },
-    { "&lmoustache;", { 9136, 0 } },
-    { "&lnE;", { 8808, 0 } },
-    { "&lnap;", { 10889, 0 } },
-    { "&lnapprox;", { 10889, 0 } },
-    { "&lne;", { 10887, 0 } },
-    { "&lneq;", { 10887, 0 } },
-    { "&lneqq;", { 8808, 0 } },
-    { "&lnsim;", { 8934, 0 } },
-    { "&loang;", { 10220, 0 } },
-    { "&loarr;", { 8701, 0 } },
-    { "&lobrk;", { 10214, 0 } },
-    { "&longleftarrow;", { 10229, 0 } },
-    { "&longleftrightarrow;", { 10231, 0 } },
-    { "&longmapsto;", { 10236, 0 } },
-    { "&longrightarrow;", { 10230, 0 } },
-    { "&looparrowleft;", { 8619, 0 } },
-    { "&looparrowright;", { 8620, 0 } },
-    { "&lopar;", { 10629, 0 } },
-    { "&lopf;", { 120157, 0 } },
-    { "&loplus;", { 10797, 0 } },
-    { "&lotimes;", { 10804, 0 } },
-    { "&lowast;", { 8727, 0 } },
-    { "&lowbar;", { 95, 0 } },
-    { "&loz;", { 9674, 0 } },
-    { "&lozenge;", { 9674, 0 } },
-    { "&lozf;", { 10731, 0 } },
-    { "&lpar;", { 40, 0 } },
-    { "&lparlt;", { 10643, 0 } },
-    { "&lrarr;", { 8646, 0 } },
-    { "&lrcorner;", { 8991, 0 } },
-    { "&lrhar;", { 8651, 0 } },
-    { "&lrhard;", { 10605, 0 } },
-    { "&lrm;", { 8206, 0 } },
-    { "&lrtri;", { 8895, 0 } },
-    { "&lsaquo;", { 8249, 0 } },
-    { "&lscr;", { 120001, 0 } },
-    { "&lsh;", { 8624, 0 } },
-    { "&lsim;", { 8818, 0 } },
-    { "&lsime;", { 10893, 0 } },
-    { "&lsimg;", { 10895, 0 } },
-    { "&lsqb;", { 91, 0 } },
-    { "&lsquo;", { 8216, 0 } },
-    { "&lsquor;", { 8218, 0 } },
-    { "&lstrok;", { 322, 0 } },
-    { "&lt;", { 60, 0 } },
-    { "&ltcc;", { 10918, 0 } },
-    { "&ltcir;", { 10873, 0 } },
-    { "&ltdot;", { 8918, 0 } },
-    { "&lthree;", { 8907, 0 } },
-    { "&ltimes;", { 8905, 0 } },
-    { "&ltlarr;", { 10614, 0 } },
-    { "&ltquest;", { 10875, 0 } },
-    { "&ltrPar;", { 10646, 0 } },
-    { "&ltri;", { 9667, 0 } },
-    { "&ltrie;", { 8884, 0 } },
-    { "&ltrif;", { 9666, 0 } },
-    { "&lurdshar;", { 10570, 0 } },
-    { "&luruhar;", { 10598, 0 } },
-    { "&lvertneqq;", { 8808, 65024 } },
-    { "&lvnE;", { 8808, 65024 } },
-    { "&mDDot;", { 8762, 0 } },
-    { "&macr;", { 175, 0 } },
-    { "&male;", { 9794, 0 } },
-    { "&malt;", { 10016, 0 } },
-    { "&maltese;", { 10016, 0 } },
-    { "&map;", { 8614, 0 } },
-    { "&mapsto;", { 8614, 0 } },
-    { "&mapstodown;", { 8615, 0 } },
-    { "&mapstoleft;", { 8612, 0 } },
-    { "&mapstoup;", { 8613, 0 } },
-    { "&marker;", { 9646, 0 } },
-    { "&mcomma;", { 10793, 0 } },
-    { "&mcy;", { 1084, 0 } },
-    { "&mdash;", { 8212, 0 } },
-    { "&measuredangle;", { 8737, 0 } },
-    { "&mfr;", { 120106, 0 } },
-    { "&mho;", { 8487, 0 } },
-    { "&micro;", { 181, 0 } },
-    { "&mid;", { 8739, 0 } },
-    { "&midast;", { 42, 0 } },
-    { "&midcir;", { 10992, 0 } },
-    { "&middot;", { 183, 0 } },
-    { "&minus;", { 8722, 0 } },
-    { "&minusb;", { 8863, 0 } },
-    { "&minusd;", { 8760, 0 } },
-    { "&minusdu;", { 10794, 0 } },
-    { "&mlcp;", { 10971, 0 } },
-    { "&mldr;", { 8230, 0 } },
-    { "&mnplus;", { 8723, 0 } },
-    { "&models;", { 8871, 0 } },
-    { "&mopf;", { 120158, 0 } },
-    { "&mp;", { 8723, 0 } },
-    { "&mscr;", { 120002, 0 } },
-    { "&mstpos;", { 8766, 0 } },
-    { "&mu;", { 956, 0 } },
-    { "&multimap;", { 8888, 0 } },
-    { "&mumap;", { 8888, 0 } },
-    { "&nGg;", { 8921, 824 } },
-    { "&nGt;", { 8811, 8402 } },
-    { "&nGtv;", { 8811, 824 } },
-    { "&nLeftarrow;", { 8653, 0 } },
-    { "&nLeftrightarrow;", { 8654, 0 } },
-    { "&nLl;", { 8920, 824 } },
-    { "&nLt;", { 8810, 8402 } },
-    { "&nLtv;", { 8810, 824 } },
-    { "&nRightarrow;", { 8655, 0 } },
-    { "&nVDash;", { 8879, 0 } },
-    { "&nVdash;", { 8878, 0 } },
-    { "&nabla;", { 8711, 0 } },
-    { "&nacute;", { 324, 0 } },
-    { "&nang;", { 8736, 8402 } },
-    { "&nap;", { 8777, 0 } },
-    { "&napE;", { 10864, 824 } },
-    { "&napid;", { 8779, 824 } },
-    { "&napos;", { 329, 0 } },
-    { "&napprox;", { 8777, 0 } },
-    { "&natur;", { 9838, 0 } },
-    { "&natural;", { 9838, 0 } },
-    { "&naturals;", { 8469, 0 } },
-    { "&nbsp;", { 160, 0 } },
-    { "&nbump;", { 8782, 824 } },
-    { "&nbumpe;", { 8783, 824 } },
-    { "&ncap;", { 10819, 0 } },
-    { "&ncaron;", { 328, 0 } },
-    { "&ncedil;", { 326, 0 } },
-    { "&ncong;", { 8775, 0 } },
-    { "&ncongdot;", { 10861, 824 } },
-    { "&ncup;", { 10818, 0 } },
-    { "&ncy;", { 1085, 0 } },
-    { "&ndash;", { 8211, 0 } },
-    { "&ne;", { 8800, 0 } },
-    { "&neArr;", { 8663, 0 } },
-    { "&nearhk;", { 10532, 0 } },
-    { "&nearr;", { 8599, 0 } },
-    { "&nearrow;", { 8599, 0 } },
-    { "&nedot;", { 8784, 824 } },
-    { "&nequiv;", { 8802, 0 } },
-    { "&nesear;", { 10536, 0 } },
-    { "&nesim;", { 8770, 824 } },
-    { "&nexist;", { 8708, 0 } },
-    { "&nexists;", { 8708, 0 } },
-    { "&nfr;", { 120107, 0 } },
-    { "&ngE;", { 8807, 824 } },
-    { "&nge;", { 8817, 0 } },
-    { "&ngeq;", { 8817, 0 } },
-    { "&ngeqq;", { 8807, 824 } },
-    { "&ngeqslant;", { 10878, 824 } },
-    { "&nges;", { 10878, 824 } },
-    { "&ngsim;", { 8821, 0 } },
-    { "&ngt;", { 8815, 0 } },
-    { "&ngtr;", { 8815, 0 } },
-    { "&nhArr;", { 8654, 0 } },
-    { "&nharr;", { 8622, 0 } },
-    { "&nhpar;", { 10994, 0 } },
-    { "&ni;", { 8715, 0 } },
-    { "&nis;", { 8956, 0 } },
-    { "&nisd;", { 8954, 0 } },
-    { "&niv;", { 8715, 0 } },
-    { "&njcy;", { 1114, 0 } },
-    { "&nlArr;", { 8653, 0 } },
-    { "&nlE;", { 8806, 824 } },
-    { "&nlarr;", { 8602, 0 } },
-    { "&nldr;", { 8229, 0 } },
-    { "&nle;", { 8816, 0 } },
-    { "&nleftarrow;", { 8602, 0 } },
-    { "&nleftrightarrow;", { 8622, 0 } },
-    { "&nleq;", { 8816, 0 } },
-    { "&nleqq;", { 8806, 824 } },
-    { "&nleqslant;", { 10877, 824 } },
-    { "&nles;", { 10877, 824 } },
-    { "&nless;", { 8814, 0 } },
-    { "&nlsim;", { 8820, 0 } },
-    { "&nlt;", { 8814, 0 } },
-    { "&nltri;", { 8938, 0 } },
-    { "&nltrie;", { 8940, 0 } },
-    { "&nmid;", { 8740, 0 } },
-    { "&nopf;", { 120159, 0 } },
-    { "&not;", { 172, 0 } },
-    { "&notin;", { 8713, 0 } },
-    { "&notinE;", { 8953, 824 } },
-    { "&notindot;", { 8949, 824 } },
-    { "&notinva;", { 8713, 0 } },
-    { "&notinvb;", { 8951, 0 } },
-    { "&notinvc;", { 8950, 0 } },
-    { "&notni;", { 8716, 0 } },
-    { "&notniva;", { 8716, 0 } },
-    { "&notnivb;", { 8958, 0 } },
-    { "&notnivc;", { 8957, 0 } },
-    { "&npar;", { 8742, 0 } },
-    { "&nparallel;", { 8742, 0 } },
-    { "&nparsl;", { 11005, 8421 } },
-    { "&npart;", { 8706, 824 } },
-    { "&npolint;", { 10772, 0 } },
-    { "&npr;", { 8832, 0 } },
-    { "&nprcue;", { 8928, 0 } },
-    { "&npre;", { 10927, 824 } },
-    { "&nprec;", { 8832, 0 } },
-    { "&npreceq;", { 10927, 824 } },
-    { "&nrArr;", { 8655, 0 } },
-    { "&nrarr;", { 8603, 0 } },
-    { "&nrarrc;", { 10547, 824 } },
-    { "&nrarrw;", { 8605, 824 } },
-    { "&nrightarrow;", { 8603, 0 } },
-    { "&nrtri;", { 8939, 0 } },
-    { "&nrtrie;", { 8941, 0 } },
-    { "&nsc;", { 8833, 0 } },
-    { "&nsccue;", { 8929, 0 } },
-    { "&nsce;", { 10928, 824 } },
-    { "&nscr;", { 120003, 0 } },
-    { "&nshortmid;", { 8740, 0 } },
-    { "&nshortparallel;", { 8742, 0 } },
-    { "&nsim;", { 8769, 0 } },
-    { "&nsime;", { 8772, 0 } },
-    { "&nsimeq;", { 8772, 0 } },
-    { "&nsmid;", { 8740, 0 } },
-    { "&nspar;", { 8742, 0 } },
-    { "&nsqsube;", { 8930, 0 } },
-    { "&nsqsupe;", { 8931, 0 } },
-    { "&nsub;", { 8836, 0 } },
-    { "&nsubE;", { 10949, 824 } },
-    { "&nsube;", { 8840, 0 } },
-    { "&nsubset;", { 8834, 8402 } },
-    { "&nsubseteq;", { 8840, 0 } },
-    { "&nsubseteqq;", { 10949, 824 } },
-    { "&nsucc;", { 8833, 0 } },
-    { "&nsucceq;", { 10928, 824 } },
-    { "&nsup;", { 8837, 0 } },
-    { "&nsupE;", { 10950, 824 } },
-    { "&nsupe;", { 8841, 0 } },
-    { "&nsupset;", { 8835, 8402 } },
-    { "&nsupseteq;", { 8841, 0 } },
-    { "&nsupseteqq;", { 10950, 824 } },
-    { "&ntgl;", { 8825, 0 } },
-    { "&ntilde;", { 241, 0 } },
-    { "&ntlg;", { 8824, 0 } },
-    { "&ntriangleleft;", { 8938, 0 } },
-    { "&ntrianglelefteq;", { 8940, 0 } },
-    { "&ntriangleright;", { 8939, 0 } },
-    { "&ntrianglerighteq;", { 8941, 0 } },
-    { "&nu;", { 957, 0 } },
-    { "&num;", { 35, 0 } },
-    { "&numero;", { 8470, 0 } },
-    { "&numsp;", { 8199, 0 } },
-    { "&nvDash;", { 8877, 0 } },
-    { "&nvHarr;", { 10500, 0 } },
-    { "&nvap;", { 8781, 8402 } },
-    { "&nvdash;", { 8876, 0 } },
-    { "&nvge;", { 8805, 8402 } },
-    { "&nvgt;", { 62, 8402 } },
-    { "&nvinfin;", { 10718, 0 } },
-    { "&nvlArr;", { 10498, 0 } },
-    { "&nvle;", { 8804, 8402 } },
-    { "&nvlt;", { 60, 8402 } },
-    { "&nvltrie;", { 8884, 8402 } },
-    { "&nvrArr;", { 10499, 0 } },
-    { "&nvrtrie;", { 8885, 8402 } },
-    { "&nvsim;", { 8764, 8402 } },
-    { "&nwArr;", { 8662, 0 } },
-    { "&nwarhk;", { 10531, 0 } },
-    { "&nwarr;", { 8598, 0 } },
-    { "&nwarrow;", { 8598, 0 } },
-    { "&nwnear;", { 10535, 0 } },
-    { "&oS;", { 9416, 0 } },
-    { "&oacute;", { 243, 0 } },
-    { "&oast;", { 8859, 0 } },
-    { "&ocir;", { 8858, 0 } },
-    { "&ocirc;", { 244, 0 } },
-    { "&ocy;", { 1086, 0 } },
-    { "&odash;", { 8861, 0 } },
-    { "&odblac;", { 337, 0 } },
-    { "&odiv;", { 10808, 0 } },
-    { "&odot;", { 8857, 0 } },
-    { "&odsold;", { 10684, 0 } },
-    { "&oelig;", { 339, 0 } },
-    { "&ofcir;", { 10687, 0 } },
-    { "&ofr;", { 120108, 0 } },
-    { "&ogon;", { 731, 0 } },
-    { "&ograve;", { 242, 0 } },
-    { "&ogt;", { 10689, 0 } },
-    { "&ohbar;", { 10677, 0 } },
-    { "&ohm;", { 937, 0 } },
-    { "&oint;", { 8750, 0 } },
-    { "&olarr;", { 8634, 0 } },
-    { "&olcir;", { 10686, 0 } },
-    { "&olcross;", { 10683, 0 } },
-    { "&oline;", { 8254, 0 } },
-    { "&olt;", { 10688, 0 } },
-    { "&omacr;", { 333, 0 } },
-    { "&omega;", { 969, 0 } },
-    { "&omicron;", { 959, 0 } },
-    { "&omid;", { 10678, 0 } },
-    { "&ominus;", { 8854, 0 } },
-    { "&oopf;", { 120160, 0 } },
-    { "&opar;", { 10679, 0 } },
-    { "&operp;", { 10681, 0 } },
-    { "&oplus;", { 8853, 0 } },
-    { "&or;", { 8744, 0 } },
-    { "&orarr;", { 8635, 0 } },
-    { "&ord;", { 10845, 0 } },
-    { "&order;", { 8500, 0 } },
-    { "&orderof;", { 8500, 0 } },
-    { "&ordf;", { 170, 0 } },
-    { "&ordm;", { 186, 0 } },
-    { "&origof;", { 8886, 0 } },
-    { "&oror;", { 10838, 0 } },
-    { "&orslope;", { 10839, 0 } },
-    { "&orv;", { 10843, 0 } },
-    { "&oscr;", { 8500, 0 } },
-    { "&oslash;", { 248, 0 } },
-    { "&osol;", { 8856, 0 } },
-    { "&otilde;", { 245, 0 } },
-    { "&otimes;", { 8855, 0 } },
-    { "&otimesas;", { 10806, 0 } },
-    { "&ouml;", { 246, 0 } },
-    { "&ovbar;", { 9021, 0 } },
-    { "&par;", { 8741, 0 } },
-    { "&para;", { 182, 0 } },
-    { "&parallel;", { 8741, 0 } },
-    { "&parsim;", { 10995, 0 } },
-    { "&parsl;", { 11005, 0 } },
-    { "&part;", { 8706, 0 } },
-    { "&pcy;", { 1087, 0 } },
-    { "&percnt;", { 37, 0 } },
-    { "&period;", { 46, 0 } },
-    { "&permil;", { 8240, 0 } },
-    { "&perp;", { 8869, 0 } },
-    { "&pertenk;", { 8241, 0 } },
-    { "&pfr;", { 120109, 0 } },
-    { "&phi;", { 966, 0 } },
-    { "&phiv;", { 981, 0 } },
-    { "&phmmat;", { 8499, 0 } },
-    { "&phone;", { 9742, 0 } },
-    { "&pi;", { 960, 0 } },
-    { "&pitchfork;", { 8916, 0 } },
-    { "&piv;", { 982, 0 } },
-    { "&planck;", { 8463, 0 } },
-    { "&planckh;", { 8462, 0 } },
-    { "&plankv;", { 8463, 0 } },
-    { "&plus;", { 43, 0 } },
-    { "&plusacir;", { 10787, 0 } },
-    { "&plusb;", { 8862, 0 } },
-    { "&pluscir;", { 10786, 0 } },
-    { "&plusdo;", { 8724, 0 } },
-    { "&plusdu;", { 10789, 0 } },
-    { "&pluse;", { 10866, 0 } },
-    { "&plusmn;", { 177, 0 } },
-    { "&plussim;", { 10790, 0 } },
-    { "&plustwo;", { 10791, 0 } },
-    { "&pm;", { 177, 0 } },
-    { "&pointint;", { 10773, 0 } },
-    { "&popf;", { 120161, 0 } },
-    { "&pound;", { 163, 0 } },
-    { "&pr;", { 8826, 0 } },
-    { "&prE;", { 10931, 0 } },
-    { "&prap;", { 10935, 0 } },
-    { "&prcue;", { 8828, 0 } },
-    { "&pre;", { 10927, 0 } },
-    { "&prec;", { 8826, 0 } },
-    { "&precapprox;", { 10935, 0 } },
-    { "&preccurlyeq;", { 8828, 0 } },
-    { "&preceq;", { 10927, 0 } },
-    { "&precnapprox;", { 10937, 0 } },
-    { "&precneqq;", { 10933, 0 } },
-    { "&precnsim;", { 8936, 0 } },
-    { "&precsim;", { 8830, 0 } },
-    { "&prime;", { 8242, 0 } },
-    { "&primes;", { 8473, 0 } },
-    { "&prnE;", { 10933, 0 } },
-    { "&prnap;", { 10937, 0 } },
-    { "&prnsim;", { 8936, 0 } },
-    { "&prod;", { 8719, 0 } },
-    { "&profalar;", { 9006, 0 } },
-    { "&profline;", { 8978, 0 } },
-    { "&profsurf;", { 8979, 0 } },
-    { "&prop;", { 8733, 0 } },
-    { "&propto;", { 8733, 0 } },
-    { "&prsim;", { 8830, 0 } },
-    { "&prurel;", { 8880, 0 } },
-    { "&pscr;", { 120005, 0 } },
-    { "&psi;", { 968, 0 } },
-    { "&puncsp;", { 8200, 0 } },
-    { "&qfr;", { 120110, 0 } },
-    { "&qint;", { 10764, 0 } },
-    { "&qopf;", { 120162, 0 } },
-    { "&qprime;", { 8279, 0 } },
-    { "&qscr;", { 120006, 0 } },
-    { "&quaternions;", { 8461, 0 } },
-    { "&quatint;", { 10774, 0 } },
-    { "&quest;", { 63, 0 } },
-    { "&questeq;", { 8799, 0 } },
-    { "&quot;", { 34, 0 } },
-    { "&rAarr;", { 8667, 0 } },
-    { "&rArr;", { 8658, 0 } },
-    { "&rAtail;", { 10524, 0 } },
-    { "&rBarr;", { 10511, 0 } },
-    { "&rHar;", { 10596, 0 } },
-    { "&race;", { 8765, 817 } },
-    { "&racute;", { 341, 0 } },
-    { "&radic;", { 8730, 0 } },
-    { "&raemptyv;", { 10675, 0 } },
-    { "&rang;", { 10217, 0 } },
-    { "&rangd;", { 10642, 0 } },
-    { "&range;", { 10661, 0 } },
-    { "&rangle;", { 10217, 0 } },
-    { "&raquo;", { 187, 0 } },
-    { "&rarr;", { 8594, 0 } },
-    { "&rarrap;", { 10613, 0 } },
-    { "&rarrb;", { 8677, 0 } },
-    { "&rarrbfs;", { 10528, 0 } },
-    { "&rarrc;", { 10547, 0 } },
-    { "&rarrfs;", { 10526, 0 } },
-    { "&rarrhk;", { 8618, 0 } },
-    { "&rarrlp;", { 8620, 0 } },
-    { "&rarrpl;", { 10565, 0 } },
-    { "&rarrsim;", { 10612, 0 } },
-    { "&rarrtl;", { 8611, 0 } },
-    { "&rarrw;", { 8605, 0 } },
-    { "&ratail;", { 10522, 0 } },
-    { "&ratio;", { 8758, 0 } },
-    { "&rationals;", { 8474, 0 } },
-    { "&rbarr;", { 10509, 0 } },
-    { "&rbbrk;", { 10099, 0 } },
-    { "&rbrace;", { 125, 0 } },
-    { "&rbrack;", { 93, 0 } },
-    { "&rbrke;", { 10636, 0 } },
-    { "&rbrksld;", { 10638, 0 } },
-    { "&rbrkslu;", { 10640, 0 } },
-    { "&rcaron;", { 345, 0 } },
-    { "&rcedil;", { 343, 0 } },
-    { "&rceil;", { 8969, 0 } },
-    { "&rcub;", { 125, 0 } },
-    { "&rcy;", { 1088, 0 } },
-    { "&rdca;", { 10551, 0 } },
-    { "&rdldhar;", { 10601, 0 } },
-    { "&rdquo;", { 8221, 0 } },
-    { "&rdquor;", { 8221, 0 } },
-    { "&rdsh;", { 8627, 0 } },
-    { "&real;", { 8476, 0 } },
-    { "&realine;", { 8475, 0 } },
-    { "&realpart;", { 8476, 0 } },
-    { "&reals;", { 8477, 0 } },
-    { "&rect;", { 9645, 0 } },
-    { "&reg;", { 174, 0 } },
-    { "&rfisht;", { 10621, 0 } },
-    { "&rfloor;", { 8971, 0 } },
-    { "&rfr;", { 120111, 0 } },
-    { "&rhard;", { 8641, 0 } },
-    { "&rharu;", { 8640, 0 } },
-    { "&rharul;", { 10604, 0 } },
-    { "&rho;", { 961, 0 } },
-    { "&rhov;", { 1009, 0 } },
-    { "&rightarrow;", { 8594, 0 } },
-    { "&rightarrowtail;", { 8611, 0 } },
-    { "&rightharpoondown;", { 8641, 0 } },
-    { "&rightharpoonup;", { 8640, 0 } },
-    { "&rightleftarrows;", { 8644, 0 } },
-    { "&rightleftharpoons;", { 8652, 0 } },
-    { "&rightrightarrows;", { 8649, 0 } },
-    { "&rightsquigarrow;", { 8605, 0 } },
-    { "&rightthreetimes;", { 8908, 0 } },
-    { "&ring;", { 730, 0 } },
-    { "&risingdotseq;", { 8787, 0 } },
-    { "&rlarr;", { 8644, 0 } },
-    { "&rlhar;", { 8652, 0 } },
-    { "&rlm;", { 8207, 0 } },
-    { "&rmoust;", { 9137, 0 } },
-    { "&rmoustache;", { 9137, 0 } },
-    { "&rnmid;", { 10990, 0 } },
-    { "&roang;", { 10221, 0 } },
-    { "&roarr;", { 8702, 0 } },
-    { "&robrk;", { 10215, 0 } },
-    { "&ropar;", { 10630, 0 } },
-    { "&ropf;", { 120163, 0 } },
-    { "&roplus;", { 10798, 0 } },
-    { "&rotimes;", { 10805, 0 } },
-    { "&rpar;", { 41, 0 } },
-    { "&rpargt;", { 10644, 0 } },
-    { "&rppolint;", { 10770, 0 } },
-    { "&rrarr;", { 8649, 0 } },
-    { "&rsaquo;", { 8250, 0 } },
-    { "&rscr;", { 120007, 0 } },
-    { "&rsh;", { 8625, 0 } },
-    { "&rsqb;", { 93, 0 } },
-    { "&rsquo;", { 8217, 0 } },
-    { "&rsquor;", { 8217, 0 } },
-    { "&rthree;", { 8908, 0 } },
-    { "&rtimes;", { 8906, 0 } },
-    { "&rtri;", { 9657, 0 } },
-    { "&rtrie;", { 8885, 0 } },
-    { "&rtrif;", { 9656, 0 } },
-    { "&rtriltri;", { 10702, 0 } },
-    { "&ruluhar;", { 10600, 0 } },
-    { "&rx;", { 8478, 0 } },
-    { "&sacute;", { 347, 0 } },
-    { "&sbquo;", { 8218, 0 } },
-    { "&sc;", { 8827, 0 } },
-    { "&scE;", { 10932, 0 } },
-    { "&scap;", { 10936, 0 } },
-    { "&scaron;", { 353, 0 } },
-    { "&sccue;", { 8829, 0 } },
-    { "&sce;", { 10928, 0 } },
-    { "&scedil;", { 351, 0 } },
-    { "&scirc;", { 349, 0 } },
-    { "&scnE;", { 10934, 0 } },
-    { "&scnap;", { 10938, 0 } },
-    { "&scnsim;", { 8937, 0 } },
-    { "&scpolint;", { 10771, 0 } },
-    { "&scsim;", { 8831, 0 } },
-    { "&scy;", { 1089, 0 } },
-    { "&sdot;", { 8901, 0 } },
-    { "&sdotb;", { 8865, 0 } },
-    { "&sdote;", { 10854, 0 } },
-    { "&seArr;", { 8664, 0 } },
-    { "&searhk;", { 10533, 0 } },
-    { "&searr;", { 8600, 0 } },
-    { "&searrow;", { 8600, 0 } },
-    { "&sect;", { 167, 0 } },
-    { "&semi;", { 59, 0 } },
-    { "&seswar;", { 10537, 0 } },
-    { "&setminus;", { 8726, 0 } },
-    { "&setmn;", { 8726, 0 } },
-    { "&sext;", { 10038, 0 } },
-    { "&sfr;", { 120112, 0 } },
-    { "&sfrown;", { 8994, 0 } },
-    { "&sharp;", { 9839, 0 } },
-    { "&shchcy;", { 1097, 0 } },
-    { "&shcy;", { 1096, 0 } },
-    { "&shortmid;", { 8739, 0 } },
-    { "&shortparallel;", { 8741, 0 } },
-    { "&shy;", { 173, 0 } },
-    { "&sigma;", { 963, 0 } },
-    { "&sigmaf;", { 962, 0 } },
-    { "&sigmav;", { 962, 0 } },
-    { "&sim;", { 8764, 0 } },
-    { "&simdot;", { 10858, 0 } },
-    { "&sime;", { 8771, 0 } },
-    { "&simeq;", { 8771, 0 } },
-    { "&simg;", { 10910, 0 } },
-    { "&simgE;", { 10912, 0 } },
-    { "&siml;", { 10909, 0 } },
-    { "&simlE;", { 10911, 0 } },
-    { "&simne;", { 8774, 0 } },
-    { "&simplus;", { 10788, 0 } },
-    { "&simrarr;", { 10610, 0 } },
-    { "&slarr;", { 8592, 0 } },
-    { "&smallsetminus;", { 8726, 0 } },
-    { "&smashp;", { 10803, 0 } },
-    { "&smeparsl;", { 10724, 0 } },
-    { "&smid;", { 8739, 0 } },
-    { "&smile;", { 8995, 0 } },
-    { "&smt;", { 10922, 0 } },
-    { "&smte;", { 10924, 0 } },
-    { "&smtes;", { 10924, 65024 } },
-    { "&softcy;", { 1100, 0 } },
-    { "&sol;", { 47, 0 } },
-    { "&solb;", { 10692, 0 } },
-    { "&solbar;", { 9023, 0 } },
-    { "&sopf;", { 120164, 0 } },
-    { "&spades;", { 9824, 0 } },
-    { "&spadesuit;", { 9824, 0 } },
-    { "&spar;", { 8741, 0 } },
-    { "&sqcap;", { 8851, 0 } },
-    { "&sqcaps;", { 8851, 65024 } },
-    { "&sqcup;", { 8852, 0 } },
-    { "&sqcups;", { 8852, 65024 } },
-    { "&sqsub;", { 8847, 0 } },
-    { "&sqsube;", { 8849, 0 } },
-    { "&sqsubset;", { 8847, 0 } },
-    { "&sqsubseteq;", { 8849, 0 } },
-    { "&sqsup;", { 8848, 0 } },
-    { "&sqsupe;", { 8850, 0 } },
-    { "&sqsupset;", { 8848, 0 } },
-    { "&sqsupseteq;", { 8850, 0 } },
-    { "&squ;", { 9633, 0 } },
-    { "&square;", { 9633, 0 } },
-    { "&squarf;", { 9642, 0 } },
-    { "&squf;", { 9642, 0 } },
-    { "&srarr;", { 8594, 0 } },
-    { "&sscr;", { 120008, 0 } },
-    { "&ssetmn;", { 8726, 0 } },
-    { "&ssmile;", { 8995, 0 } },
-    { "&sstarf;", { 8902, 0 } },
-    { "&star;", { 9734, 0 } },
-    { "&starf;", { 9733, 0 } },
-    { "&straightepsilon;", { 1013, 0 } },
-    { "&straightphi;", { 981, 0 } },
-    { "&strns;", { 175, 0 } },
-    { "&sub;", { 8834, 0 } },
-    { "&subE;", { 10949, 0 } },
-    { "&subdot;", { 10941, 0 } },
-    { "&sube;", { 8838, 0 } },
-    { "&subedot;", { 10947, 0 } },
-    { "&submult;", { 10945, 0 } },
-    { "&subnE;", { 10955, 0 } },
-    { "&subne;", { 8842, 0 } },
-    { "&subplus;", { 10943, 0 } },
-    { "&subrarr;", { 10617, 0 } },
-    { "&subset;", { 8834, 0 } },
-    { "&subseteq;", { 8838, 0 } },
-    { "&subseteqq;", { 10949, 0 } },
-    { "&subsetneq;", { 8842, 0 } },
-    { "&subsetneqq;", { 10955, 0 } },
-    { "&subsim;", { 10951, 0 } },
-    { "&subsub;", { 10965, 0 } },
-    { "&subsup;", { 10963, 0 } },
-    { "&succ;", { 8827, 0 } },
-    { "&succapprox;", { 10936, 0 } },
-    { "&succcurlyeq;", { 8829, 0 } },
-    { "&succeq;", { 10928, 0 } },
-    { "&succnapprox;", { 10938, 0 } },
-    { "&succneqq;", { 10934, 0 } },
-    { "&succnsim;", { 8937, 0 } },
-    { "&succsim;", { 8831, 0 } },
-    { "&sum;", { 8721, 0 } },
-    { "&sung;", { 9834, 0 } },
-    { "&sup1;", { 185, 0 } },
-    { "&sup2;", { 178, 0 } },
-    { "&sup3;", { 179, 0 } },
-    { "&sup;", { 8835, 0 } },
-    { "&supE;", { 10950, 0 } },
-    { "&supdot;", { 10942, 0 } },
-    { "&supdsub;", { 10968, 0 } },
-    { "&supe;", { 8839, 0 } },
-    { "&supedot;", { 10948, 0 } },
-    { "&suphsol;", { 10185, 0 } },
-    { "&suphsub;", { 10967, 0 } },
-    { "&suplarr;", { 10619, 0 } },
-    { "&supmult;", { 10946, 0 } },
-    { "&supnE;", { 10956, 0 } },
-    { "&supne;", { 8843, 0 } },
-    { "&supplus;", { 10944, 0 } },
-    { "&supset;", { 8835, 0 } },
-    { "&supseteq;", { 8839, 0 } },
-    { "&supseteqq;", { 10950, 0 } },
-    { "&supsetneq;", { 8843, 0 } },
-    { "&supsetneqq;", { 10956, 0 } },
-    { "&supsim;", { 10952, 0 } },
-    { "&supsub;", { 10964, 0 } },
-    { "&supsup;", { 10966, 0 } },
-    { "&swArr;", { 8665, 0 } },
-    { "&swarhk;", { 10534, 0 } },
-    { "&swarr;", { 8601, 0 } },
-    { "&swarrow;", { 8601, 0 } },
-    { "&swnwar;", { 10538, 0 } },
-    { "&szlig;", { 223, 0 } },
-    { "&target;", { 8982, 0 } },
-    { "&tau;", { 964, 0 } },
-    { "&tbrk;", { 9140, 0 } },
-    { "&tcaron;", { 357, 0 } },
-    { "&tcedil;", { 355, 0 } },
-    { "&tcy;", { 1090, 0 } },
-    { "&tdot;", { 8411, 0 } },
-    { "&telrec;", { 8981, 0 } },
-    { "&tfr;", { 120113, 0 } },
-    { "&there4;", { 8756, 0 } },
-    { "&therefore;", { 8756, 0 } },
-    { "&theta;", { 952, 0 } },
-    { "&thetasym;", { 977, 0 } },
-    { "&thetav;", { 977, 0 } },
-    { "&thickapprox;", { 8776, 0 } },
-    { "&thicksim;", { 8764, 0 } },
-    { "&thinsp;", { 8201, 0 } },
-    { "&thkap;", { 8776, 0 } },
-    { "&thksim;", { 8764, 0 } },
-    { "&thorn;", { 254, 0 } },
-    { "&tilde;", { 732, 0 } },
-    { "&times;", { 215, 0 } },
-    { "&timesb;", { 8864, 0 } },
-    { "&timesbar;", { 10801, 0 } },
-    { "&timesd;", { 10800, 0 } },
-    { "&tint;", { 8749, 0 } },
-    { "&toea;", { 10536, 0 } },
-    { "&top;", { 8868, 0 } },
-    { "&topbot;", { 9014, 0 } },
-    { "&topcir;", { 10993, 0 } },
-    { "&topf;", { 120165, 0 } },
-    { "&topfork;", { 10970, 0 } },
-    { "&tosa;", { 10537, 0 } },
-    { "&tprime;", { 8244, 0 } },
-    { "&trade;", { 8482, 0 } },
-    { "&triangle;", { 9653, 0 } },
-    { "&triangledown;", { 9663, 0 } },
-    { "&triangleleft;", { 9667, 0 } },
-    { "&trianglelefteq;", { 8884, 0 } },
-    { "&triangleq;", { 8796, 0 } },
-    { "&triangleright;", { 9657, 0 } },
-    { "&trianglerighteq;", { 8885, 0 } },
-    { "&tridot;", { 9708, 0 } },
-    { "&trie;", { 8796, 0 } },
-    { "&triminus;", { 10810, 0 } },
-    { "&triplus;", { 10809, 0 } },
-    { "&trisb;", { 10701, 0 } },
-    { "&tritime;", { 10811, 0 } },
-    { "&trpezium;", { 9186, 0 } },
-    { "&tscr;", { 120009, 0 } },
-    { "&tscy;", { 1094, 0 } },
-    { "&tshcy;", { 1115, 0 } },
-    { "&tstrok;", { 359, 0 } },
-    { "&twixt;", { 8812, 0 } },
-    { "&twoheadleftarrow;", { 8606, 0 } },
-    { "&twoheadrightarrow;", { 8608, 0 } },
-    { "&uArr;", { 8657, 0 } },
-    { "&uHar;", { 10595, 0 } },
-    { "&uacute;", { 250, 0 } },
-    { "&uarr;", { 8593, 0 } },
-    { "&ubrcy;", { 1118, 0 } },
-    { "&ubreve;", { 365, 0 } },
-    { "&ucirc;", { 251, 0 } },
-    { "&ucy;", { 1091, 0 } },
-    { "&udarr;", { 8645, 0 } },
-    { "&udblac;", { 369, 0 } },
-    { "&udhar;", { 10606, 0 } },
-    { "&ufisht;", { 10622, 0 } },
-    { "&ufr;", { 120114, 0 } },
-    { "&ugrave;", { 249, 0 } },
-    { "&uharl;", { 8639, 0 } },
-    { "&uharr;", { 8638, 0 } },
-    { "&uhblk;", { 9600, 0 } },
-    { "&ulcorn;", { 8988, 0 } },
-    { "&ulcorner;", { 8988, 0 } },
-    { "&ulcrop;", { 8975, 0 } },
-    { "&ultri;", { 9720, 0 } },
-    { "&umacr;", { 363, 0 } },
-    { "&uml;", { 168, 0 } },
-    { "&uogon;", { 371, 0 } },
-    { "&uopf;", { 120166, 0 } },
-    { "&uparrow;", { 8593, 0 } },
-    { "&updownarrow;", { 8597, 0 } },
-    { "&upharpoonleft;", { 8639, 0 } },
-    { "&upharpoonright;", { 8638, 0 } },
-    { "&uplus;", { 8846, 0 } },
-    { "&upsi;", { 965, 0 } },
-    { "&upsih;", { 978, 0 } },
-    { "&upsilon;", { 965, 0 } },
-    { "&upuparrows;", { 8648, 0 } },
-    { "&urcorn;", { 8989, 0 } },
-    { "&urcorner;", { 8989, 0 } },
-    { "&urcrop;", { 8974, 0 } },
-    { "&uring;", { 367, 0 } },
-    { "&urtri;", { 9721, 0 } },
-    { "&uscr;", { 120010, 0 } },
-    { "&utdot;", { 8944, 0 } },
-    { "&utilde;", { 361, 0 } },
-    { "&utri;", { 9653, 0 } },
-    { "&utrif;", { 9652, 0 } },
-    { "&uuarr;", { 8648, 0 } },
-    { "&uuml;", { 252, 0 } },
-    { "&uwangle;", { 10663, 0 } },
-    { "&vArr;", { 8661, 0 } },
-    { "&vBar;", { 10984, 0 } },
-    { "&vBarv;", { 10985, 0 } },
-    { "&vDash;", { 8872, 0 } },
-    { "&vangrt;", { 10652, 0 } },
-    { "&varepsilon;", { 1013, 0 } },
-    { "&varkappa;", { 1008, 0 } },
-    { "&varnothing;", { 8709, 0 } },
-    { "&varphi;", { 981, 0 } },
-    { "&varpi;", { 982, 0 } },
-    { "&varpropto;", { 8733, 0 } },
-    { "&varr;", { 8597, 0 } },
-    { "&varrho;", { 1009, 0 } },
-    { "&varsigma;", { 962, 0 } },
-    { "&varsubsetneq;", { 8842, 65024 } },
-    { "&varsubsetneqq;", { 10955, 65024 } },
-    { "&varsupsetneq;", { 8843, 65024 } },
-    { "&varsupsetneqq;", { 10956, 65024 } },
-    { "&vartheta;", { 977, 0 } },
-    { "&vartriangleleft;", { 8882, 0 } },
-    { "&vartriangleright;", { 8883, 0 } },
-    { "&vcy;", { 1074, 0 } },
-    { "&vdash;", { 8866, 0 } },
-    { "&vee;", { 8744, 0 } },
-    { "&veebar;", { 8891, 0 } },
-    { "&veeeq;", { 8794, 0 } },
-    { "&vellip;", { 8942, 0 } },
-    { "&verbar;", { 124, 0 } },
-    { "&vert;", { 124, 0 } },
-    { "&vfr;", { 120115, 0 } },
-    { "&vltri;", { 8882, 0 } },
-    { "&vnsub;", { 8834, 8402 } },
-    { "&vnsup;", { 8835, 8402 } },
-    { "&vopf;", { 120167, 0 } },
-    { "&vprop;", { 8733, 0 } },
-    { "&vrtri;", { 8883, 0 } },
-    { "&vscr;", { 120011, 0 } },
-    { "&vsubnE;", { 10955, 65024 } },
-    { "&vsubne;", { 8842, 65024 } },
-    { "&vsupnE;", { 10956, 65024 } },
-    { "&vsupne;", { 8843, 65024 } },
-    { "&vzigzag;", { 10650, 0 } },
-    { "&wcirc;", { 373, 0 } },
-    { "&wedbar;", { 10847, 0 } },
-    { "&wedge;", { 8743, 0 } },
-    { "&wedgeq;", { 8793, 0 } },
-    { "&weierp;", { 8472, 0 } },
-    { "&wfr;", { 120116, 0 } },
-    { "&wopf;", { 120168, 0 } },
-    { "&wp;", { 8472, 0 } },
-    { "&wr;", { 8768, 0 } },
-    { "&wreath;", { 8768, 0 } },
-    { "&wscr;", { 120012, 0 } },
-    { "&xcap;", { 8898, 0 } },
-    { "&xcirc;", { 9711, 0 } },
-    { "&xcup;", { 8899, 0 } },
-    { "&xdtri;", { 9661, 0 } },
-    { "&xfr;", { 120117, 0 } },
-    { "&xhArr;", { 10234, 0 } },
-    { "&xharr;", { 10231, 0 } },
-    { "&xi;", { 958, 0 } },
-    { "&xlArr;", { 10232, 0 } },
-    { "&xlarr;", { 10229, 0 } },
-    { "&xmap;", { 10236, 0 } },
-    { "&xnis;", { 8955, 0 } },
-    { "&xodot;", { 10752, 0 } },
-    { "&xopf;", { 120169, 0 } },
-    { "&xoplus;", { 10753, 0 } },
-    { "&xotime;", { 10754, 0 } },
-    { "&xrArr;", { 10233, 0 } },
-    { "&xrarr;", { 10230, 0 } },
-    { "&xscr;", { 120013, 0 } },
-    { "&xsqcup;", { 10758, 0 } },
-    { "&xuplus;", { 10756, 0 } },
-    { "&xutri;", { 9651, 0 } },
-    { "&xvee;", { 8897, 0 } },
-    { "&xwedge;", { 8896, 0 } },
-    { "&yacute;", { 253, 0 } },
-    { "&yacy;", { 1103, 0 } },
-    { "&ycirc;", { 375, 0 } },
-    { "&ycy;", { 1099, 0 } },
-    { "&yen;", { 165, 0 } },
-    { "&yfr;", { 120118, 0 } },
-    { "&yicy;", { 1111, 0 } },
-    { "&yopf;", { 120170, 0 } },
-    { "&yscr;", { 120014, 0 } },
-    { "&yucy;", { 1102, 0 } },
-    { "&yuml;", { 255, 0 } },
-    { "&zacute;", { 378, 0 } },
-    { "&zcaron;", { 382, 0 } },
-    { "&zcy;", { 1079, 0 } },
-    { "&zdot;", { 380, 0 } },
-    { "&zeetrf;", { 8488, 0 } },
-    { "&zeta;", { 950, 0 } },
-    { "&zfr;", { 120119, 0 } },
-    { "&zhcy;", { 1078, 0 } },
-    { "&zigrarr;", { 8669, 0 } },
-    { "&zopf;", { 120171, 0 } },
-    { "&zscr;", { 120015, 0 } },
-    { "&zwj;", { 8205, 0 } },
-    { "&zwnj;", { 8204, 0 } }
+    { "&AElig;", 7, { 198, 0 }, 2, "\xc3\x86" },
+    { "&AMP;", 5, { 38, 0 }, 1, "\x26" },
+    { "&Aacute;", 8, { 193, 0 }, 2, "\xc3\x81" },
+    { "&Abreve;", 8, { 258, 0 }, 2, "\xc4\x82" },
+    { "&Acirc;", 7, { 194, 0 }, 2, "\xc3\x82" },
+    { "&Acy;", 5, { 1040, 0 }, 2, "\xd0\x90" },
+    { "&Afr;", 5, { 120068, 0 }, 4, "\xf0\x9d\x94\x84" },
+    { "&Agrave;", 8, { 192, 0 }, 2, "\xc3\x80" },
+    { "&Alpha;", 7, { 913, 0 }, 2, "\xce\x91" },
+    { "&Amacr;", 7, { 256, 0 }, 2, "\xc4\x80" },
+    { "&And;", 5, { 10835, 0 }, 3, "\xe2\xa9\x93" },
+    { "&Aogon;", 7, { 260, 0 }, 2, "\xc4\x84" },
+    { "&Aopf;", 6, { 120120, 0 }, 4, "\xf0\x9d\x94\xb8" },
+    { "&ApplyFunction;", 15, { 8289, 0 }, 3, "\xe2\x81\xa1" },
+    { "&Aring;", 7, { 197, 0 }, 2, "\xc3\x85" },
+    { "&Ascr;", 6, { 119964, 0 }, 4, "\xf0\x9d\x92\x9c" },
+    { "&Assign;", 8, { 8788, 0 }, 3, "\xe2\x89\x94" },
+    { "&Atilde;", 8, { 195, 0 }, 2, "\xc3\x83" },
+    { "&Auml;", 6, { 196, 0 }, 2, "\xc3\x84" },
+    { "&Backslash;", 11, { 8726, 0 }, 3, "\xe2\x88\x96" },
+    { "&Barv;", 6, { 10983, 0 }, 3, "\xe2\xab\xa7" },
+    { "&Barwed;", 8, { 8966, 0 }, 3, "\xe2\x8c\x86" },
+    { "&Bcy;", 5, { 1041, 0 }, 2, "\xd0\x91" },
+    { "&Because;", 9, { 8757, 0 }, 3, "\xe2\x88\xb5" },
+    { "&Bernoullis;", 12, { 8492, 0 }, 3, "\xe2\x84\xac" },
+    { "&Beta;", 6, { 914, 0 }, 2, "\xce\x92" },
+    { "&Bfr;", 5, { 120069, 0 }, 4, "\xf0\x9d\x94\x85" },
+    { "&Bopf;", 6, { 120121, 0 }, 4, "\xf0\x9d\x94\xb9" },
+    { "&Breve;", 7, { 728, 0 }, 2, "\xcb\x98" },
+    { "&Bscr;", 6, { 8492, 0 }, 3, "\xe2\x84\xac" },
+    { "&Bumpeq;", 8, { 8782, 0 }, 3, "\xe2\x89\x8e" },
+    { "&CHcy;", 6, { 1063, 0 }, 2, "\xd0\xa7" },
+    { "&COPY;", 6, { 169, 0 }, 2, "\xc2\xa9" },
+    { "&Cacute;", 8, { 262, 0 }, 2, "\xc4\x86" },
+    { "&Cap;", 5, { 8914, 0 }, 3, "\xe2\x8b\x92" },
+    { "&CapitalDifferentialD;", 22, { 8517, 0 }, 3, "\xe2\x85\x85" },
+    { "&Cayleys;", 9, { 8493, 0 }, 3, "\xe2\x84\xad" },
+    { "&Ccaron;", 8, { 268, 0 }, 2, "\xc4\x8c" },
+    { "&Ccedil;", 8, { 199, 0 }, 2, "\xc3\x87" },
+    { "&Ccirc;", 7, { 264, 0 }, 2, "\xc4\x88" },
+    { "&Cconint;", 9, { 8752, 0 }, 3, "\xe2\x88\xb0" },
+    { "&Cdot;", 6, { 266, 0 }, 2, "\xc4\x8a" },
+    { "&Cedilla;", 9, { 184, 0 }, 2, "\xc2\xb8" },
+    { "&CenterDot;", 11, { 183, 0 }, 2, "\xc2\xb7" },
+    { "&Cfr;", 5, { 8493, 0 }, 3, "\xe2\x84\xad" },
+    { "&Chi;", 5, { 935, 0 }, 2, "\xce\xa7" },
+    { "&CircleDot;", 11, { 8857, 0 }, 3, "\xe2\x8a\x99" },
+    { "&CircleMinus;", 13, { 8854, 0 }, 3, "\xe2\x8a\x96" },
+    { "&CirclePlus;", 12, { 8853, 0 }, 3, "\xe2\x8a\x95" },
+    { "&CircleTimes;", 13, { 8855, 0 }, 3, "\xe2\x8a\x97" },
+    { "&ClockwiseContourIntegral;", 26, { 8754, 0 }, 3, "\xe2\x88\xb2" },
+    { "&CloseCurlyDoubleQuote;", 23, { 8221, 0 }, 3, "\xe2\x80\x9d" },
+    { "&CloseCurlyQuote;", 17, { 8217, 0 }, 3, "\xe2\x80\x99" },
+    { "&Colon;", 7, { 8759, 0 }, 3, "\xe2\x88\xb7" },
+    { "&Colone;", 8, { 10868, 0 }, 3, "\xe2\xa9\xb4" },
+    { "&Congruent;", 11, { 8801, 0 }, 3, "\xe2\x89\xa1" },
+    { "&Conint;", 8, { 8751, 0 }, 3, "\xe2\x88\xaf" },
+    { "&ContourIntegral;", 17, { 8750, 0 }, 3, "\xe2\x88\xae" },
+    { "&Copf;", 6, { 8450, 0 }, 3, "\xe2\x84\x82" },
+    { "&Coproduct;", 11, { 8720, 0 }, 3, "\xe2\x88\x90" },
+    { "&CounterClockwiseContourIntegral;", 33, { 8755, 0 }, 3, "\xe2\x88\xb3" },
+    { "&Cross;", 7, { 10799, 0 }, 3, "\xe2\xa8\xaf" },
+    { "&Cscr;", 6, { 119966, 0 }, 4, "\xf0\x9d\x92\x9e" },
+    { "&Cup;", 5, { 8915, 0 }, 3, "\xe2\x8b\x93" },
+    { "&CupCap;", 8, { 8781, 0 }, 3, "\xe2\x89\x8d" },
+    { "&DD;", 4, { 8517, 0 }, 3, "\xe2\x85\x85" },
+    { "&DDotrahd;", 10, { 10513, 0 }, 3, "\xe2\xa4\x91" },
+    { "&DJcy;", 6, { 1026, 0 }, 2, "\xd0\x82" },
+    { "&DScy;", 6, { 1029, 0 }, 2, "\xd0\x85" },
+    { "&DZcy;", 6, { 1039, 0 }, 2, "\xd0\x8f" },
+    { "&Dagger;", 8, { 8225, 0 }, 3, "\xe2\x80\xa1" },
+    { "&Darr;", 6, { 8609, 0 }, 3, "\xe2\x86\xa1" },
+    { "&Dashv;", 7, { 10980, 0 }, 3, "\xe2\xab\xa4" },
+    { "&Dcaron;", 8, { 270, 0 }, 2, "\xc4\x8e" },
+    { "&Dcy;", 5, { 1044, 0 }, 2, "\xd0\x94" },
+    { "&Del;", 5, { 8711, 0 }, 3, "\xe2\x88\x87" },
+    { "&Delta;", 7, { 916, 0 }, 2, "\xce\x94" },
+    { "&Dfr;", 5, { 120071, 0 }, 4, "\xf0\x9d\x94\x87" },
+    { "&DiacriticalAcute;", 18, { 180, 0 }, 2, "\xc2\xb4" },
+    { "&DiacriticalDot;", 16, { 729, 0 }, 2, "\xcb\x99" },
+    { "&DiacriticalDoubleAcute;", 24, { 733, 0 }, 2, "\xcb\x9d" },
+    { "&DiacriticalGrave;", 18, { 96, 0 }, 1, "\x60" },
+    { "&DiacriticalTilde;", 18, { 732, 0 }, 2, "\xcb\x9c" },
+    { "&Diamond;", 9, { 8900, 0 }, 3, "\xe2\x8b\x84" },
+    { "&DifferentialD;", 15, { 8518, 0 }, 3, "\xe2\x85\x86" },
+    { "&Dopf;", 6, { 120123, 0 }, 4, "\xf0\x9d\x94\xbb" },
+    { "&Dot;", 5, { 168, 0 }, 2, "\xc2\xa8" },
+    { "&DotDot;", 8, { 8412, 0 }, 3, "\xe2\x83\x9c" },
+    { "&DotEqual;", 10, { 8784, 0 }, 3, "\xe2\x89\x90" },
+    { "&DoubleContourIntegral;", 23, { 8751, 0 }, 3, "\xe2\x88\xaf" },
+    { "&DoubleDot;", 11, { 168, 0 }, 2, "\xc2\xa8" },
+    { "&DoubleDownArrow;", 17, { 8659, 0 }, 3, "\xe2\x87\x93" },
+    { "&DoubleLeftArrow;", 17, { 8656, 0 }, 3, "\xe2\x87\x90" },
+    { "&DoubleLeftRightArrow;", 22, { 8660, 0 }, 3, "\xe2\x87\x94" },
+    { "&DoubleLeftTee;", 15, { 10980, 0 }, 3, "\xe2\xab\xa4" },
+    { "&DoubleLongLeftArrow;", 21, { 10232, 0 }, 3, "\xe2\x9f\xb8" },
+    { "&DoubleLongLeftRightArrow;", 26, { 10234, 0 }, 3, "\xe2\x9f\xba" },
+    { "&DoubleLongRightArrow;", 22, { 10233, 0 }, 3, "\xe2\x9f\xb9" },
+    { "&DoubleRightArrow;", 18, { 8658, 0 }, 3, "\xe2\x87\x92" },
+    { "&DoubleRightTee;", 16, { 8872, 0 }, 3, "\xe2\x8a\xa8" },
+    { "&DoubleUpArrow;", 15, { 8657, 0 }, 3, "\xe2\x87\x91" },
+    { "&DoubleUpDownArrow;", 19, { 8661, 0 }, 3, "\xe2\x87\x95" },
+    { "&DoubleVerticalBar;", 19, { 8741, 0 }, 3, "\xe2\x88\xa5" },
+    { "&DownArrow;", 11, { 8595, 0 }, 3, "\xe2\x86\x93" },
+    { "&DownArrowBar;", 14, { 10515, 0 }, 3, "\xe2\xa4\x93" },
+    { "&DownArrowUpArrow;", 18, { 8693, 0 }, 3, "\xe2\x87\xb5" },
+    { "&DownBreve;", 11, { 785, 0 }, 2, "\xcc\x91" },
+    { "&DownLeftRightVector;", 21, { 10576, 0 }, 3, "\xe2\xa5\x90" },
+    { "&DownLeftTeeVector;", 19, { 10590, 0 }, 3, "\xe2\xa5\x9e" },
+    { "&DownLeftVector;", 16, { 8637, 0 }, 3, "\xe2\x86\xbd" },
+    { "&DownLeftVectorBar;", 19, { 10582, 0 }, 3, "\xe2\xa5\x96" },
+    { "&DownRightTeeVector;", 20, { 10591, 0 }, 3, "\xe2\xa5\x9f" },
+    { "&DownRightVector;", 17, { 8641, 0 }, 3, "\xe2\x87\x81" },
+    { "&DownRightVectorBar;", 20, { 10583, 0 }, 3, "\xe2\xa5\x97" },
+    { "&DownTee;", 9, { 8868, 0 }, 3, "\xe2\x8a\xa4" },
+    { "&DownTeeArrow;", 14, { 8615, 0 }, 3, "\xe2\x86\xa7" },
+    { "&Downarrow;", 11, { 8659, 0 }, 3, "\xe2\x87\x93" },
+    { "&Dscr;", 6, { 119967, 0 }, 4, "\xf0\x9d\x92\x9f" },
+    { "&Dstrok;", 8, { 272, 0 }, 2, "\xc4\x90" },
+    { "&ENG;", 5, { 330, 0 }, 2, "\xc5\x8a" },
+    { "&ETH;", 5, { 208, 0 }, 2, "\xc3\x90" },
+    { "&Eacute;", 8, { 201, 0 }, 2, "\xc3\x89" },
+    { "&Ecaron;", 8, { 282, 0 }, 2, "\xc4\x9a" },
+    { "&Ecirc;", 7, { 202, 0 }, 2, "\xc3\x8a" },
+    { "&Ecy;", 5, { 1069, 0 }, 2, "\xd0\xad" },
+    { "&Edot;", 6, { 278, 0 }, 2, "\xc4\x96" },
+    { "&Efr;", 5, { 120072, 0 }, 4, "\xf0\x9d\x94\x88" },
+    { "&Egrave;", 8, { 200, 0 }, 2, "\xc3\x88" },
+    { "&Element;", 9, { 8712, 0 }, 3, "\xe2\x88\x88" },
+    { "&Emacr;", 7, { 274, 0 }, 2, "\xc4\x92" },
+    { "&EmptySmallSquare;", 18, { 9723, 0 }, 3, "\xe2\x97\xbb" },
+    { "&EmptyVerySmallSquare;", 22, { 9643, 0 }, 3, "\xe2\x96\xab" },
+    { "&Eogon;", 7, { 280, 0 }, 2, "\xc4\x98" },
+    { "&Eopf;", 6, { 120124, 0 }, 4, "\xf0\x9d\x94\xbc" },
+    { "&Epsilon;", 9, { 917, 0 }, 2, "\xce\x95" },
+    { "&Equal;", 7, { 10869, 0 }, 3, "\xe2\xa9\xb5" },
+    { "&EqualTilde;", 12, { 8770, 0 }, 3, "\xe2\x89\x82" },
+    { "&Equilibrium;", 13, { 8652, 0 }, 3, "\xe2\x87\x8c" },
+    { "&Escr;", 6, { 8496, 0 }, 3, "\xe2\x84\xb0" },
+    { "&Esim;", 6, { 10867, 0 }, 3, "\xe2\xa9\xb3" },
+    { "&Eta;", 5, { 919, 0 }, 2, "\xce\x97" },
+    { "&Euml;", 6, { 203, 0 }, 2, "\xc3\x8b" },
+    { "&Exists;", 8, { 8707, 0 }, 3, "\xe2\x88\x83" },
+    { "&ExponentialE;", 14, { 8519, 0 }, 3, "\xe2\x85\x87" },
+    { "&Fcy;", 5, { 1060, 0 }, 2, "\xd0\xa4" },
+    { "&Ffr;", 5, { 120073, 0 }, 4, "\xf0\x9d\x94\x89" },
+    { "&FilledSmallSquare;", 19, { 9724, 0 }, 3, "\xe2\x97\xbc" },
+    { "&FilledVerySmallSquare;", 23, { 9642, 0 }, 3, "\xe2\x96\xaa" },
+    { "&Fopf;", 6, { 120125, 0 }, 4, "\xf0\x9d\x94\xbd" },
+    { "&ForAll;", 8, { 8704, 0 }, 3, "\xe2\x88\x80" },
+    { "&Fouriertrf;", 12, { 8497, 0 }, 3, "\xe2\x84\xb1" },
+    { "&Fscr;", 6, { 8497, 0 }, 3, "\xe2\x84\xb1" },
+    { "&GJcy;", 6, { 1027, 0 }, 2, "\xd0\x83" },
+    { "&GT;", 4, { 62, 0 }, 1, "\x3e" },
+    { "&Gamma;", 7, { 915, 0 }, 2, "\xce\x93" },
+    { "&Gammad;", 8, { 988, 0 }, 2, "\xcf\x9c" },
+    { "&Gbreve;", 8, { 286, 0 }, 2, "\xc4\x9e" },
+    { "&Gcedil;", 8, { 290, 0 }, 2, "\xc4\xa2" },
+    { "&Gcirc;", 7, { 284, 0 }, 2, "\xc4\x9c" },
+    { "&Gcy;", 5, { 1043, 0 }, 2, "\xd0\x93" },
+    { "&Gdot;", 6, { 288, 0 }, 2, "\xc4\xa0" },
+    { "&Gfr;", 5, { 120074, 0 }, 4, "\xf0\x9d\x94\x8a" },
+    { "&Gg;", 4, { 8921, 0 }, 3, "\xe2\x8b\x99" },
+    { "&Gopf;", 6, { 120126, 0 }, 4, "\xf0\x9d\x94\xbe" },
+    { "&GreaterEqual;", 14, { 8805, 0 }, 3, "\xe2\x89\xa5" },
+    { "&GreaterEqualLess;", 18, { 8923, 0 }, 3, "\xe2\x8b\x9b" },
+    { "&GreaterFullEqual;", 18, { 8807, 0 }, 3, "\xe2\x89\xa7" },
+    { "&GreaterGreater;", 16, { 10914, 0 }, 3, "\xe2\xaa\xa2" },
+    { "&GreaterLess;", 13, { 8823, 0 }, 3, "\xe2\x89\xb7" },
+    { "&GreaterSlantEqual;", 19, { 10878, 0 }, 3, "\xe2\xa9\xbe" },
+    { "&GreaterTilde;", 14, { 8819, 0 }, 3, "\xe2\x89\xb3" },
+    { "&Gscr;", 6, { 119970, 0 }, 4, "\xf0\x9d\x92\xa2" },
+    { "&Gt;", 4, { 8811, 0 }, 3, "\xe2\x89\xab" },
+    { "&HARDcy;", 8, { 1066, 0 }, 2, "\xd0\xaa" },
+    { "&Hacek;", 7, { 711, 0 }, 2, "\xcb\x87" },
+    { "&Hat;", 5, { 94, 0 }, 1, "\x5e" },
+    { "&Hcirc;", 7, { 292, 0 }, 2, "\xc4\xa4" },
+    { "&Hfr;", 5, { 8460, 0 }, 3, "\xe2\x84\x8c" },
+    { "&HilbertSpace;", 14, { 8459, 0 }, 3, "\xe2\x84\x8b" },
+    { "&Hopf;", 6, { 8461, 0 }, 3, "\xe2\x84\x8d" },
+    { "&HorizontalLine;", 16, { 9472, 0 }, 3, "\xe2\x94\x80" },
+    { "&Hscr;", 6, { 8459, 0 }, 3, "\xe2\x84\x8b" },
+    { "&Hstrok;", 8, { 294, 0 }, 2, "\xc4\xa6" },
+    { "&HumpDownHump;", 14, { 8782, 0 }, 3, "\xe2\x89\x8e" },
+    { "&HumpEqual;", 11, { 8783, 0 }, 3, "\xe2\x89\x8f" },
+    { "&IEcy;", 6, { 1045, 0 }, 2, "\xd0\x95" },
+    { "&IJlig;", 7, { 306, 0 }, 2, "\xc4\xb2" },
+    { "&IOcy;", 6, { 1025, 0 }, 2, "\xd0\x81" },
+    { "&Iacute;", 8, { 205, 0 }, 2, "\xc3\x8d" },
+    { "&Icirc;", 7, { 206, 0 }, 2, "\xc3\x8e" },
+    { "&Icy;", 5, { 1048, 0 }, 2, "\xd0\x98" },
+    { "&Idot;", 6, { 304, 0 }, 2, "\xc4\xb0" },
+    { "&Ifr;", 5, { 8465, 0 }, 3, "\xe2\x84\x91" },
+    { "&Igrave;", 8, { 204, 0 }, 2, "\xc3\x8c" },
+    { "&Im;", 4, { 8465, 0 }, 3, "\xe2\x84\x91" },
+    { "&Imacr;", 7, { 298, 0 }, 2, "\xc4\xaa" },
+    { "&ImaginaryI;", 12, { 8520, 0 }, 3, "\xe2\x85\x88" },
+    { "&Implies;", 9, { 8658, 0 }, 3, "\xe2\x87\x92" },
+    { "&Int;", 5, { 8748, 0 }, 3, "\xe2\x88\xac" },
+    { "&Integral;", 10, { 8747, 0 }, 3, "\xe2\x88\xab" },
+    { "&Intersection;", 14, { 8898, 0 }, 3, "\xe2\x8b\x82" },
+    { "&InvisibleComma;", 16, { 8291, 0 }, 3, "\xe2\x81\xa3" },
+    { "&InvisibleTimes;", 16, { 8290, 0 }, 3, "\xe2\x81\xa2" },
+    { "&Iogon;", 7, { 302, 0 }, 2, "\xc4\xae" },
+    { "&Iopf;", 6, { 120128, 0 }, 4, "\xf0\x9d\x95\x80" },
+    { "&Iota;", 6, { 921, 0 }, 2, "\xce\x99" },
+    { "&Iscr;", 6, { 8464, 0 }, 3, "\xe2\x84\x90" },
+    { "&Itilde;", 8, { 296, 0 }, 2, "\xc4\xa8" },
+    { "&Iukcy;", 7, { 1030, 0 }, 2, "\xd0\x86" },
+    { "&Iuml;", 6, { 207, 0 }, 2, "\xc3\x8f" },
+    { "&Jcirc;", 7, { 308, 0 }, 2, "\xc4\xb4" },
+    { "&Jcy;", 5, { 1049, 0 }, 2, "\xd0\x99" },
+    { "&Jfr;", 5, { 120077, 0 }, 4, "\xf0\x9d\x94\x8d" },
+    { "&Jopf;", 6, { 120129, 0 }, 4, "\xf0\x9d\x95\x81" },
+    { "&Jscr;", 6, { 119973, 0 }, 4, "\xf0\x9d\x92\xa5" },
+    { "&Jsercy;", 8, { 1032, 0 }, 2, "\xd0\x88" },
+    { "&Jukcy;", 7, { 1028, 0 }, 2, "\xd0\x84" },
+    { "&KHcy;", 6, { 1061, 0 }, 2, "\xd0\xa5" },
+    { "&KJcy;", 6, { 1036, 0 }, 2, "\xd0\x8c" },
+    { "&Kappa;", 7, { 922, 0 }, 2, "\xce\x9a" },
+    { "&Kcedil;", 8, { 310, 0 }, 2, "\xc4\xb6" },
+    { "&Kcy;", 5, { 1050, 0 }, 2, "\xd0\x9a" },
+    { "&Kfr;", 5, { 120078, 0 }, 4, "\xf0\x9d\x94\x8e" },
+    { "&Kopf;", 6, { 120130, 0 }, 4, "\xf0\x9d\x95\x82" },
+    { "&Kscr;", 6, { 119974, 0 }, 4, "\xf0\x9d\x92\xa6" },
+    { "&LJcy;", 6, { 1033, 0 }, 2, "\xd0\x89" },
+    { "&LT;", 4, { 60, 0 }, 1, "\x3c" },
+    { "&Lacute;", 8, { 313, 0 }, 2, "\xc4\xb9" },
+    { "&Lambda;", 8, { 923, 0 }, 2, "\xce\x9b" },
+    { "&Lang;", 6, { 10218, 0 }, 3, "\xe2\x9f\xaa" },
+    { "&Laplacetrf;", 12, { 8466, 0 }, 3, "\xe2\x84\x92" },
+    { "&Larr;", 6, { 8606, 0 }, 3, "\xe2\x86\x9e" },
+    { "&Lcaron;", 8, { 317, 0 }, 2, "\xc4\xbd" },
+    { "&Lcedil;", 8, { 315, 0 }, 2, "\xc4\xbb" },
+    { "&Lcy;", 5, { 1051, 0 }, 2, "\xd0\x9b" },
+    { "&LeftAngleBracket;", 18, { 10216, 0 }, 3, "\xe2\x9f\xa8" },
+    { "&LeftArrow;", 11, { 8592, 0 }, 3, "\xe2\x86\x90" },
+    { "&LeftArrowBar;", 14, { 8676, 0 }, 3, "\xe2\x87\xa4" },
+    { "&LeftArrowRightArrow;", 21, { 8646, 0 }, 3, "\xe2\x87\x86" },
+    { "&LeftCeiling;", 13, { 8968, 0 }, 3, "\xe2\x8c\x88" },
+    { "&LeftDoubleBracket;", 19, { 10214, 0 }, 3, "\xe2\x9f\xa6" },
+    { "&LeftDownTeeVector;", 19, { 10593, 0 }, 3, "\xe2\xa5\xa1" },
+    { "&LeftDownVector;", 16, { 8643, 0 }, 3, "\xe2\x87\x83" },
+    { "&LeftDownVectorBar;", 19, { 10585, 0 }, 3, "\xe2\xa5\x99" },
+    { "&LeftFloor;", 11, { 8970, 0 }, 3, "\xe2\x8c\x8a" },
+    { "&LeftRightArrow;", 16, { 8596, 0 }, 3, "\xe2\x86\x94" },
+    { "&LeftRightVector;", 17, { 10574, 0 }, 3, "\xe2\xa5\x8e" },
+    { "&LeftTee;", 9, { 8867, 0 }, 3, "\xe2\x8a\xa3" },
+    { "&LeftTeeArrow;", 14, { 8612, 0 }, 3, "\xe2\x86\xa4" },
+    { "&LeftTeeVector;", 15, { 10586, 0 }, 3, "\xe2\xa5\x9a" },
+    { "&LeftTriangle;", 14, { 8882, 0 }, 3, "\xe2\x8a\xb2" },
+    { "&LeftTriangleBar;", 17, { 10703, 0 }, 3, "\xe2\xa7\x8f" },
+    { "&LeftTriangleEqual;", 19, { 8884, 0 }, 3, "\xe2\x8a\xb4" },
+    { "&LeftUpDownVector;", 18, { 10577, 0 }, 3, "\xe2\xa5\x91" },
+    { "&LeftUpTeeVector;", 17, { 10592, 0 }, 3, "\xe2\xa5\xa0" },
+    { "&LeftUpVector;", 14, { 8639, 0 }, 3, "\xe2\x86\xbf" },
+    { "&LeftUpVectorBar;", 17, { 10584, 0 }, 3, "\xe2\xa5\x98" },
+    { "&LeftVector;", 12, { 8636, 0 }, 3, "\xe2\x86\xbc" },
+    { "&LeftVectorBar;", 15, { 10578, 0 }, 3, "\xe2\xa5\x92" },
+    { "&Leftarrow;", 11, { 8656, 0 }, 3, "\xe2\x87\x90" },
+    { "&Leftrightarrow;", 16, { 8660, 0 }, 3, "\xe2\x87\x94" },
+    { "&LessEqualGreater;", 18, { 8922, 0 }, 3, "\xe2\x8b\x9a" },
+    { "&LessFullEqual;", 15, { 8806, 0 }, 3, "\xe2\x89\xa6" },
+    { "&LessGreater;", 13, { 8822, 0 }, 3, "\xe2\x89\xb6" },
+    { "&LessLess;", 10, { 10913, 0 }, 3, "\xe2\xaa\xa1" },
+    { "&LessSlantEqual;", 16, { 10877, 0 }, 3, "\xe2\xa9\xbd" },
+    { "&LessTilde;", 11, { 8818, 0 }, 3, "\xe2\x89\xb2" },
+    { "&Lfr;", 5, { 120079, 0 }, 4, "\xf0\x9d\x94\x8f" },
+    { "&Ll;", 4, { 8920, 0 }, 3, "\xe2\x8b\x98" },
+    { "&Lleftarrow;", 12, { 8666, 0 }, 3, "\xe2\x87\x9a" },
+    { "&Lmidot;", 8, { 319, 0 }, 2, "\xc4\xbf" },
+    { "&LongLeftArrow;", 15, { 10229, 0 }, 3, "\xe2\x9f\xb5" },
+    { "&LongLeftRightArrow;", 20, { 10231, 0 }, 3, "\xe2\x9f\xb7" },
+    { "&LongRightArrow;", 16, { 10230, 0 }, 3, "\xe2\x9f\xb6" },
+    { "&Longleftarrow;", 15, { 10232, 0 }, 3, "\xe2\x9f\xb8" },
+    { "&Longleftrightarrow;", 20, { 10234, 0 }, 3, "\xe2\x9f\xba" },
+    { "&Longrightarrow;", 16, { 10233, 0 }, 3, "\xe2\x9f\xb9" },
+    { "&Lopf;", 6, { 120131, 0 }, 4, "\xf0\x9d\x95\x83" },
+    { "&LowerLeftArrow;", 16, { 8601, 0 }, 3, "\xe2\x86\x99" },
+    { "&LowerRightArrow;", 17, { 8600, 0 }, 3, "\xe2\x86\x98" },
+    { "&Lscr;", 6, { 8466, 0 }, 3, "\xe2\x84\x92" },
+    { "&Lsh;", 5, { 8624, 0 }, 3, "\xe2\x86\xb0" },
+    { "&Lstrok;", 8, { 321, 0 }, 2, "\xc5\x81" },
+    { "&Lt;", 4, { 8810, 0 }, 3, "\xe2\x89\xaa" },
+    { "&Map;", 5, { 10501, 0 }, 3, "\xe2\xa4\x85" },
+    { "&Mcy;", 5, { 1052, 0 }, 2, "\xd0\x9c" },
+    { "&MediumSpace;", 13, { 8287, 0 }, 3, "\xe2\x81\x9f" },
+    { "&Mellintrf;", 11, { 8499, 0 }, 3, "\xe2\x84\xb3" },
+    { "&Mfr;", 5, { 120080, 0 }, 4, "\xf0\x9d\x94\x90" },
+    { "&MinusPlus;", 11, { 8723, 0 }, 3, "\xe2\x88\x93" },
+    { "&Mopf;", 6, { 120132, 0 }, 4, "\xf0\x9d\x95\x84" },
+    { "&Mscr;", 6, { 8499, 0 }, 3, "\xe2\x84\xb3" },
+    { "&Mu;", 4, { 924, 0 }, 2, "\xce\x9c" },
+    { "&NJcy;", 6, { 1034, 0 }, 2, "\xd0\x8a" },
+    { "&Nacute;", 8, { 323, 0 }, 2, "\xc5\x83" },
+    { "&Ncaron;", 8, { 327, 0 }, 2, "\xc5\x87" },
+    { "&Ncedil;", 8, { 325, 0 }, 2, "\xc5\x85" },
+    { "&Ncy;", 5, { 1053, 0 }, 2, "\xd0\x9d" },
+    { "&NegativeMediumSpace;", 21, { 8203, 0 }, 3, "\xe2\x80\x8b" },
+    { "&NegativeThickSpace;", 20, { 8203, 0 }, 3, "\xe2\x80\x8b" },
+    { "&NegativeThinSpace;", 19, { 8203, 0 }, 3, "\xe2\x80\x8b" },
+    { "&NegativeVeryThinSpace;", 23, { 8203, 0 }, 3, "\xe2\x80\x8b" },
+    { "&NestedGreaterGreater;", 22, { 8811, 0 }, 3, "\xe2\x89\xab" },
+    { "&NestedLessLess;", 16, { 8810, 0 }, 3, "\xe2\x89\xaa" },
+    { "&NewLine;", 9, { 10, 0 }, 1, "\x0a" },
+    { "&Nfr;", 5, { 120081, 0 }, 4, "\xf0\x9d\x94\x91" },
+    { "&NoBreak;", 9, { 8288, 0 }, 3, "\xe2\x81\xa0" },
+    { "&NonBreakingSpace;", 18, { 160, 0 }, 2, "\xc2\xa0" },
+    { "&Nopf;", 6, { 8469, 0 }, 3, "\xe2\x84\x95" },
+    { "&Not;", 5, { 10988, 0 }, 3, "\xe2\xab\xac" },
+    { "&NotCongruent;", 14, { 8802, 0 }, 3, "\xe2\x89\xa2" },
+    { "&NotCupCap;", 11, { 8813, 0 }, 3, "\xe2\x89\xad" },
+    { "&NotDoubleVerticalBar;", 22, { 8742, 0 }, 3, "\xe2\x88\xa6" },
+    { "&NotElement;", 12, { 8713, 0 }, 3, "\xe2\x88\x89" },
+    { "&NotEqual;", 10, { 8800, 0 }, 3, "\xe2\x89\xa0" },
+    { "&NotEqualTilde;", 15, { 8770, 824 }, 5, "\xe2\x89\x82\xcc\xb8" },
+    { "&NotExists;", 11, { 8708, 0 }, 3, "\xe2\x88\x84" },
+    { "&NotGreater;", 12, { 8815, 0 }, 3, "\xe2\x89\xaf" },
+    { "&NotGreaterEqual;", 17, { 8817, 0 }, 3, "\xe2\x89\xb1" },
+    { "&NotGreaterFullEqual;", 21, { 8807, 824 }, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&NotGreaterGreater;", 19, { 8811, 824 }, 5, "\xe2\x89\xab\xcc\xb8" },
+    { "&NotGreaterLess;", 16, { 8825, 0 }, 3, "\xe2\x89\xb9" },
+    { "&NotGreaterSlantEqual;", 22, { 10878, 824 }, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&NotGreaterTilde;", 17, { 8821, 0 }, 3, "\xe2\x89\xb5" },
+    { "&NotHumpDownHump;", 17, { 8782, 824 }, 5, "\xe2\x89\x8e\xcc\xb8" },
+    { "&NotHumpEqual;", 14, { 8783, 824 }, 5, "\xe2\x89\x8f\xcc\xb8" },
+    { "&NotLeftTriangle;", 17, { 8938, 0 }, 3, "\xe2\x8b\xaa" },
+    { "&NotLeftTriangleBar;", 20, { 10703, 824 }, 5, "\xe2\xa7\x8f\xcc\xb8" },
+    { "&NotLeftTriangleEqual;", 22, { 8940, 0 }, 3, "\xe2\x8b\xac" },
+    { "&NotLess;", 9, { 8814, 0 }, 3, "\xe2\x89\xae" },
+    { "&NotLessEqual;", 14, { 8816, 0 }, 3, "\xe2\x89\xb0" },
+    { "&NotLessGreater;", 16, { 8824, 0 }, 3, "\xe2\x89\xb8" },
+    { "&NotLessLess;", 13, { 8810, 824 }, 5, "\xe2\x89\xaa\xcc\xb8" },
+    { "&NotLessSlantEqual;", 19, { 10877, 824 }, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&NotLessTilde;", 14, { 8820, 0 }, 3, "\xe2\x89\xb4" },
+    { "&NotNestedGreaterGreater;", 25, { 10914, 824 }, 5, "\xe2\xaa\xa2\xcc\xb8" },
+    { "&NotNestedLessLess;", 19, { 10913, 824 }, 5, "\xe2\xaa\xa1\xcc\xb8" },
+    { "&NotPrecedes;", 13, { 8832, 0 }, 3, "\xe2\x8a\x80" },
+    { "&NotPrecedesEqual;", 18, { 10927, 824 }, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&NotPrecedesSlantEqual;", 23, { 8928, 0 }, 3, "\xe2\x8b\xa0" },
+    { "&NotReverseElement;", 19, { 8716, 0 }, 3, "\xe2\x88\x8c" },
+    { "&NotRightTriangle;", 18, { 8939, 0 }, 3, "\xe2\x8b\xab" },
+    { "&NotRightTriangleBar;", 21, { 10704, 824 }, 5, "\xe2\xa7\x90\xcc\xb8" },
+    { "&NotRightTriangleEqual;", 23, { 8941, 0 }, 3, "\xe2\x8b\xad" },
+    { "&NotSquareSubset;", 17, { 8847, 824 }, 5, "\xe2\x8a\x8f\xcc\xb8" },
+    { "&NotSquareSubsetEqual;", 22, { 8930, 0 }, 3, "\xe2\x8b\xa2" },
+    { "&NotSquareSuperset;", 19, { 8848, 824 }, 5, "\xe2\x8a\x90\xcc\xb8" },
+    { "&NotSquareSupersetEqual;", 24, { 8931, 0 }, 3, "\xe2\x8b\xa3" },
+    { "&NotSubset;", 11, { 8834, 8402 }, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&NotSubsetEqual;", 16, { 8840, 0 }, 3, "\xe2\x8a\x88" },
+    { "&NotSucceeds;", 13, { 8833, 0 }, 3, "\xe2\x8a\x81" },
+    { "&NotSucceedsEqual;", 18, { 10928, 824 }, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&NotSucceedsSlantEqual;", 23, { 8929, 0 }, 3, "\xe2\x8b\xa1" },
+    { "&NotSucceedsTilde;", 18, { 8831, 824 }, 5, "\xe2\x89\xbf\xcc\xb8" },
+    { "&NotSuperset;", 13, { 8835, 8402 }, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&NotSupersetEqual;", 18, { 8841, 0 }, 3, "\xe2\x8a\x89" },
+    { "&NotTilde;", 10, { 8769, 0 }, 3, "\xe2\x89\x81" },
+    { "&NotTildeEqual;", 15, { 8772, 0 }, 3, "\xe2\x89\x84" },
+    { "&NotTildeFullEqual;", 19, { 8775, 0 }, 3, "\xe2\x89\x87" },
+    { "&NotTildeTilde;", 15, { 8777, 0 }, 3, "\xe2\x89\x89" },
+    { "&NotVerticalBar;", 16, { 8740, 0 }, 3, "\xe2\x88\xa4" },
+    { "&Nscr;", 6, { 119977, 0 }, 4, "\xf0\x9d\x92\xa9" },
+    { "&Ntilde;", 8, { 209, 0 }, 2, "\xc3\x91" },
+    { "&Nu;", 4, { 925, 0 }, 2, "\xce\x9d" },
+    { "&OElig;", 7, { 338, 0 }, 2, "\xc5\x92" },
+    { "&Oacute;", 8, { 211, 0 }, 2, "\xc3\x93" },
+    { "&Ocirc;", 7, { 212, 0 }, 2, "\xc3\x94" },
+    { "&Ocy;", 5, { 1054, 0 }, 2, "\xd0\x9e" },
+    { "&Odblac;", 8, { 336, 0 }, 2, "\xc5\x90" },
+    { "&Ofr;", 5, { 120082, 0 }, 4, "\xf0\x9d\x94\x92" },
+    { "&Ograve;", 8, { 210, 0 }, 2, "\xc3\x92" },
+    { "&Omacr;", 7, { 332, 0 }, 2, "\xc5\x8c" },
+    { "&Omega;", 7, { 937, 0 }, 2, "\xce\xa9" },
+    { "&Omicron;", 9, { 927, 0 }, 2, "\xce\x9f" },
+    { "&Oopf;", 6, { 120134, 0 }, 4, "\xf0\x9d\x95\x86" },
+    { "&OpenCurlyDoubleQuote;", 22, { 8220, 0 }, 3, "\xe2\x80\x9c" },
+    { "&OpenCurlyQuote;", 16, { 8216, 0 }, 3, "\xe2\x80\x98" },
+    { "&Or;", 4, { 10836, 0 }, 3, "\xe2\xa9\x94" },
+    { "&Oscr;", 6, { 119978, 0 }, 4, "\xf0\x9d\x92\xaa" },
+    { "&Oslash;", 8, { 216, 0 }, 2, "\xc3\x98" },
+    { "&Otilde;", 8, { 213, 0 }, 2, "\xc3\x95" },
+    { "&Otimes;", 8, { 10807, 0 }, 3, "\xe2\xa8\xb7" },
+    { "&Ouml;", 6, { 214, 0 }, 2, "\xc3\x96" },
+    { "&OverBar;", 9, { 8254, 0 }, 3, "\xe2\x80\xbe" },
+    { "&OverBrace;", 11, { 9182, 0 }, 3, "\xe2\x8f\x9e" },
+    { "&OverBracket;", 13, { 9140, 0 }, 3, "\xe2\x8e\xb4" },
+    { "&OverParenthesis;", 17, { 9180, 0 }, 3, "\xe2\x8f\x9c" },
+    { "&PartialD;", 10, { 8706, 0 }, 3, "\xe2\x88\x82" },
+    { "&Pcy;", 5, { 1055, 0 }, 2, "\xd0\x9f" },
+    { "&Pfr;", 5, { 120083, 0 }, 4, "\xf0\x9d\x94\x93" },
+    { "&Phi;", 5, { 934, 0 }, 2, "\xce\xa6" },
+    { "&Pi;", 4, { 928, 0 }, 2, "\xce\xa0" },
+    { "&PlusMinus;", 11, { 177, 0 }, 2, "\xc2\xb1" },
+    { "&Poincareplane;", 15, { 8460, 0 }, 3, "\xe2\x84\x8c" },
+    { "&Popf;", 6, { 8473, 0 }, 3, "\xe2\x84\x99" },
+    { "&Pr;", 4, { 10939, 0 }, 3, "\xe2\xaa\xbb" },
+    { "&Precedes;", 10, { 8826, 0 }, 3, "\xe2\x89\xba" },
+    { "&PrecedesEqual;", 15, { 10927, 0 }, 3, "\xe2\xaa\xaf" },
+    { "&PrecedesSlantEqual;", 20, { 8828, 0 }, 3, "\xe2\x89\xbc" },
+    { "&PrecedesTilde;", 15, { 8830, 0 }, 3, "\xe2\x89\xbe" },
+    { "&Prime;", 7, { 8243, 0 }, 3, "\xe2\x80\xb3" },
+    { "&Product;", 9, { 8719, 0 }, 3, "\xe2\x88\x8f" },
+    { "&Proportion;", 12, { 8759, 0 }, 3, "\xe2\x88\xb7" },
+    { "&Proportional;", 14, { 8733, 0 }, 3, "\xe2\x88\x9d" },
+    { "&Pscr;", 6, { 119979, 0 }, 4, "\xf0\x9d\x92\xab" },
+    { "&Psi;", 5, { 936, 0 }, 2, "\xce\xa8" },
+    { "&QUOT;", 6, { 34, 0 }, 1, "\x22" },
+    { "&Qfr;", 5, { 120084, 0 }, 4, "\xf0\x9d\x94\x94" },
+    { "&Qopf;", 6, { 8474, 0 }, 3, "\xe2\x84\x9a" },
+    { "&Qscr;", 6, { 119980, 0 }, 4, "\xf0\x9d\x92\xac" },
+    { "&RBarr;", 7, { 10512, 0 }, 3, "\xe2\xa4\x90" },
+    { "&REG;", 5, { 174, 0 }, 2, "\xc2\xae" },
+    { "&Racute;", 8, { 340, 0 }, 2, "\xc5\x94" },
+    { "&Rang;", 6, { 10219, 0 }, 3, "\xe2\x9f\xab" },
+    { "&Rarr;", 6, { 8608, 0 }, 3, "\xe2\x86\xa0" },
+    { "&Rarrtl;", 8, { 10518, 0 }, 3, "\xe2\xa4\x96" },
+    { "&Rcaron;", 8, { 344, 0 }, 2, "\xc5\x98" },
+    { "&Rcedil;", 8, { 342, 0 }, 2, "\xc5\x96" },
+    { "&Rcy;", 5, { 1056, 0 }, 2, "\xd0\xa0" },
+    { "&Re;", 4, { 8476, 0 }, 3, "\xe2\x84\x9c" },
+    { "&ReverseElement;", 16, { 8715, 0 }, 3, "\xe2\x88\x8b" },
+    { "&ReverseEquilibrium;", 20, { 8651, 0 }, 3, "\xe2\x87\x8b" },
+    { "&ReverseUpEquilibrium;", 22, { 10607, 0 }, 3, "\xe2\xa5\xaf" },
+    { "&Rfr;", 5, { 8476, 0 }, 3, "\xe2\x84\x9c" },
+    { "&Rho;", 5, { 929, 0 }, 2, "\xce\xa1" },
+    { "&RightAngleBracket;", 19, { 10217, 0 }, 3, "\xe2\x9f\xa9" },
+    { "&RightArrow;", 12, { 8594, 0 }, 3, "\xe2\x86\x92" },
+    { "&RightArrowBar;", 15, { 8677, 0 }, 3, "\xe2\x87\xa5" },
+    { "&RightArrowLeftArrow;", 21, { 8644, 0 }, 3, "\xe2\x87\x84" },
+    { "&RightCeiling;", 14, { 8969, 0 }, 3, "\xe2\x8c\x89" },
+    { "&RightDoubleBracket;", 20, { 10215, 0 }, 3, "\xe2\x9f\xa7" },
+    { "&RightDownTeeVector;", 20, { 10589, 0 }, 3, "\xe2\xa5\x9d" },
+    { "&RightDownVector;", 17, { 8642, 0 }, 3, "\xe2\x87\x82" },
+    { "&RightDownVectorBar;", 20, { 10581, 0 }, 3, "\xe2\xa5\x95" },
+    { "&RightFloor;", 12, { 8971, 0 }, 3, "\xe2\x8c\x8b" },
+    { "&RightTee;", 10, { 8866, 0 }, 3, "\xe2\x8a\xa2" },
+    { "&RightTeeArrow;", 15, { 8614, 0 }, 3, "\xe2\x86\xa6" },
+    { "&RightTeeVector;", 16, { 10587, 0 }, 3, "\xe2\xa5\x9b" },
+    { "&RightTriangle;", 15, { 8883, 0 }, 3, "\xe2\x8a\xb3" },
+    { "&RightTriangleBar;", 18, { 10704, 0 }, 3, "\xe2\xa7\x90" },
+    { "&RightTriangleEqual;", 20, { 8885, 0 }, 3, "\xe2\x8a\xb5" },
+    { "&RightUpDownVector;", 19, { 10575, 0 }, 3, "\xe2\xa5\x8f" },
+    { "&RightUpTeeVector;", 18, { 10588, 0 }, 3, "\xe2\xa5\x9c" },
+    { "&RightUpVector;", 15, { 8638, 0 }, 3, "\xe2\x86\xbe" },
+    { "&RightUpVectorBar;", 18, { 10580, 0 }, 3, "\xe2\xa5\x94" },
+    { "&RightVector;", 13, { 8640, 0 }, 3, "\xe2\x87\x80" },
+    { "&RightVectorBar;", 16, { 10579, 0 }, 3, "\xe2\xa5\x93" },
+    { "&Rightarrow;", 12, { 8658, 0 }, 3, "\xe2\x87\x92" },
+    { "&Ropf;", 6, { 8477, 0 }, 3, "\xe2\x84\x9d" },
+    { "&RoundImplies;", 14, { 10608, 0 }, 3, "\xe2\xa5\xb0" },
+    { "&Rrightarrow;", 13, { 8667, 0 }, 3, "\xe2\x87\x9b" },
+    { "&Rscr;", 6, { 8475, 0 }, 3, "\xe2\x84\x9b" },
+    { "&Rsh;", 5, { 8625, 0 }, 3, "\xe2\x86\xb1" },
+    { "&RuleDelayed;", 13, { 10740, 0 }, 3, "\xe2\xa7\xb4" },
+    { "&SHCHcy;", 8, { 1065, 0 }, 2, "\xd0\xa9" },
+    { "&SHcy;", 6, { 1064, 0 }, 2, "\xd0\xa8" },
+    { "&SOFTcy;", 8, { 1068, 0 }, 2, "\xd0\xac" },
+    { "&Sacute;", 8, { 346, 0 }, 2, "\xc5\x9a" },
+    { "&Sc;", 4, { 10940, 0 }, 3, "\xe2\xaa\xbc" },
+    { "&Scaron;", 8, { 352, 0 }, 2, "\xc5\xa0" },
+    { "&Scedil;", 8, { 350, 0 }, 2, "\xc5\x9e" },
+    { "&Scirc;", 7, { 348, 0 }, 2, "\xc5\x9c" },
+    { "&Scy;", 5, { 1057, 0 }, 2, "\xd0\xa1" },
+    { "&Sfr;", 5, { 120086, 0 }, 4, "\xf0\x9d\x94\x96" },
+    { "&ShortDownArrow;", 16, { 8595, 0 }, 3, "\xe2\x86\x93" },
+    { "&ShortLeftArrow;", 16, { 8592, 0 }, 3, "\xe2\x86\x90" },
+    { "&ShortRightArrow;", 17, { 8594, 0 }, 3, "\xe2\x86\x92" },
+    { "&ShortUpArrow;", 14, { 8593, 0 }, 3, "\xe2\x86\x91" },
+    { "&Sigma;", 7, { 931, 0 }, 2, "\xce\xa3" },
+    { "&SmallCircle;", 13, { 8728, 0 }, 3, "\xe2\x88\x98" },
+    { "&Sopf;", 6, { 120138, 0 }, 4, "\xf0\x9d\x95\x8a" },
+    { "&Sqrt;", 6, { 8730, 0 }, 3, "\xe2\x88\x9a" },
+    { "&Square;", 8, { 9633, 0 }, 3, "\xe2\x96\xa1" },
+    { "&SquareIntersection;", 20, { 8851, 0 }, 3, "\xe2\x8a\x93" },
+    { "&SquareSubset;", 14, { 8847, 0 }, 3, "\xe2\x8a\x8f" },
+    { "&SquareSubsetEqual;", 19, { 8849, 0 }, 3, "\xe2\x8a\x91" },
+    { "&SquareSuperset;", 16, { 8848, 0 }, 3, "\xe2\x8a\x90" },
+    { "&SquareSupersetEqual;", 21, { 8850, 0 }, 3, "\xe2\x8a\x92" },
+    { "&SquareUnion;", 13, { 8852, 0 }, 3, "\xe2\x8a\x94" },
+    { "&Sscr;", 6, { 119982, 0 }, 4, "\xf0\x9d\x92\xae" },
+    { "&Star;", 6, { 8902, 0 }, 3, "\xe2\x8b\x86" },
+    { "&Sub;", 5, { 8912, 0 }, 3, "\xe2\x8b\x90" },
+    { "&Subset;", 8, { 8912, 0 }, 3, "\xe2\x8b\x90" },
+    { "&SubsetEqual;", 13, { 8838, 0 }, 3, "\xe2\x8a\x86" },
+    { "&Succeeds;", 10, { 8827, 0 }, 3, "\xe2\x89\xbb" },
+    { "&SucceedsEqual;", 15, { 10928, 0 }, 3, "\xe2\xaa\xb0" },
+    { "&SucceedsSlantEqual;", 20, { 8829, 0 }, 3, "\xe2\x89\xbd" },
+    { "&SucceedsTilde;", 15, { 8831, 0 }, 3, "\xe2\x89\xbf" },
+    { "&SuchThat;", 10, { 8715, 0 }, 3, "\xe2\x88\x8b" },
+    { "&Sum;", 5, { 8721, 0 }, 3, "\xe2\x88\x91" },
+    { "&Sup;", 5, { 8913, 0 }, 3, "\xe2\x8b\x91" },
+    { "&Superset;", 10, { 8835, 0 }, 3, "\xe2\x8a\x83" },
+    { "&SupersetEqual;", 15, { 8839, 0 }, 3, "\xe2\x8a\x87" },
+    { "&Supset;", 8, { 8913, 0 }, 3, "\xe2\x8b\x91" },
+    { "&THORN;", 7, { 222, 0 }, 2, "\xc3\x9e" },
+    { "&TRADE;", 7, { 8482, 0 }, 3, "\xe2\x84\xa2" },
+    { "&TSHcy;", 7, { 1035, 0 }, 2, "\xd0\x8b" },
+    { "&TScy;", 6, { 1062, 0 }, 2, "\xd0\xa6" },
+    { "&Tab;", 5, { 9, 0 }, 1, "\x09" },
+    { "&Tau;", 5, { 932, 0 }, 2, "\xce\xa4" },
+    { "&Tcaron;", 8, { 356, 0 }, 2, "\xc5\xa4" },
+    { "&Tcedil;", 8, { 354, 0 }, 2, "\xc5\xa2" },
+    { "&Tcy;", 5, { 1058, 0 }, 2, "\xd0\xa2" },
+    { "&Tfr;", 5, { 120087, 0 }, 4, "\xf0\x9d\x94\x97" },
+    { "&Therefore;", 11, { 8756, 0 }, 3, "\xe2\x88\xb4" },
+    { "&Theta;", 7, { 920, 0 }, 2, "\xce\x98" },
+    { "&ThickSpace;", 12, { 8287, 8202 }, 6, "\xe2\x81\x9f\xe2\x80\x8a" },
+    { "&ThinSpace;", 11, { 8201, 0 }, 3, "\xe2\x80\x89" },
+    { "&Tilde;", 7, { 8764, 0 }, 3, "\xe2\x88\xbc" },
+    { "&TildeEqual;", 12, { 8771, 0 }, 3, "\xe2\x89\x83" },
+    { "&TildeFullEqual;", 16, { 8773, 0 }, 3, "\xe2\x89\x85" },
+    { "&TildeTilde;", 12, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&Topf;", 6, { 120139, 0 }, 4, "\xf0\x9d\x95\x8b" },
+    { "&TripleDot;", 11, { 8411, 0 }, 3, "\xe2\x83\x9b" },
+    { "&Tscr;", 6, { 119983, 0 }, 4, "\xf0\x9d\x92\xaf" },
+    { "&Tstrok;", 8, { 358, 0 }, 2, "\xc5\xa6" },
+    { "&Uacute;", 8, { 218, 0 }, 2, "\xc3\x9a" },
+    { "&Uarr;", 6, { 8607, 0 }, 3, "\xe2\x86\x9f" },
+    { "&Uarrocir;", 10, { 10569, 0 }, 3, "\xe2\xa5\x89" },
+    { "&Ubrcy;", 7, { 1038, 0 }, 2, "\xd0\x8e" },
+    { "&Ubreve;", 8, { 364, 0 }, 2, "\xc5\xac" },
+    { "&Ucirc;", 7, { 219, 0 }, 2, "\xc3\x9b" },
+    { "&Ucy;", 5, { 1059, 0 }, 2, "\xd0\xa3" },
+    { "&Udblac;", 8, { 368, 0 }, 2, "\xc5\xb0" },
+    { "&Ufr;", 5, { 120088, 0 }, 4, "\xf0\x9d\x94\x98" },
+    { "&Ugrave;", 8, { 217, 0 }, 2, "\xc3\x99" },
+    { "&Umacr;", 7, { 362, 0 }, 2, "\xc5\xaa" },
+    { "&UnderBar;", 10, { 95, 0 }, 1, "\x5f" },
+    { "&UnderBrace;", 12, { 9183, 0 }, 3, "\xe2\x8f\x9f" },
+    { "&UnderBracket;", 14, { 9141, 0 }, 3, "\xe2\x8e\xb5" },
+    { "&UnderParenthesis;", 18, { 9181, 0 }, 3, "\xe2\x8f\x9d" },
+    { "&Union;", 7, { 8899, 0 }, 3, "\xe2\x8b\x83" },
+    { "&UnionPlus;", 11, { 8846, 0 }, 3, "\xe2\x8a\x8e" },
+    { "&Uogon;", 7, { 370, 0 }, 2, "\xc5\xb2" },
+    { "&Uopf;", 6, { 120140, 0 }, 4, "\xf0\x9d\x95\x8c" },
+    { "&UpArrow;", 9, { 8593, 0 }, 3, "\xe2\x86\x91" },
+    { "&UpArrowBar;", 12, { 10514, 0 }, 3, "\xe2\xa4\x92" },
+    { "&UpArrowDownArrow;", 18, { 8645, 0 }, 3, "\xe2\x87\x85" },
+    { "&UpDownArrow;", 13, { 8597, 0 }, 3, "\xe2\x86\x95" },
+    { "&UpEquilibrium;", 15, { 10606, 0 }, 3, "\xe2\xa5\xae" },
+    { "&UpTee;", 7, { 8869, 0 }, 3, "\xe2\x8a\xa5" },
+    { "&UpTeeArrow;", 12, { 8613, 0 }, 3, "\xe2\x86\xa5" },
+    { "&Uparrow;", 9, { 8657, 0 }, 3, "\xe2\x87\x91" },
+    { "&Updownarrow;", 13, { 8661, 0 }, 3, "\xe2\x87\x95" },
+    { "&UpperLeftArrow;", 16, { 8598, 0 }, 3, "\xe2\x86\x96" },
+    { "&UpperRightArrow;", 17, { 8599, 0 }, 3, "\xe2\x86\x97" },
+    { "&Upsi;", 6, { 978, 0 }, 2, "\xcf\x92" },
+    { "&Upsilon;", 9, { 933, 0 }, 2, "\xce\xa5" },
+    { "&Uring;", 7, { 366, 0 }, 2, "\xc5\xae" },
+    { "&Uscr;", 6, { 119984, 0 }, 4, "\xf0\x9d\x92\xb0" },
+    { "&Utilde;", 8, { 360, 0 }, 2, "\xc5\xa8" },
+    { "&Uuml;", 6, { 220, 0 }, 2, "\xc3\x9c" },
+    { "&VDash;", 7, { 8875, 0 }, 3, "\xe2\x8a\xab" },
+    { "&Vbar;", 6, { 10987, 0 }, 3, "\xe2\xab\xab" },
+    { "&Vcy;", 5, { 1042, 0 }, 2, "\xd0\x92" },
+    { "&Vdash;", 7, { 8873, 0 }, 3, "\xe2\x8a\xa9" },
+    { "&Vdashl;", 8, { 10982, 0 }, 3, "\xe2\xab\xa6" },
+    { "&Vee;", 5, { 8897, 0 }, 3, "\xe2\x8b\x81" },
+    { "&Verbar;", 8, { 8214, 0 }, 3, "\xe2\x80\x96" },
+    { "&Vert;", 6, { 8214, 0 }, 3, "\xe2\x80\x96" },
+    { "&VerticalBar;", 13, { 8739, 0 }, 3, "\xe2\x88\xa3" },
+    { "&VerticalLine;", 14, { 124, 0 }, 1, "\x7c" },
+    { "&VerticalSeparator;", 19, { 10072, 0 }, 3, "\xe2\x9d\x98" },
+    { "&VerticalTilde;", 15, { 8768, 0 }, 3, "\xe2\x89\x80" },
+    { "&VeryThinSpace;", 15, { 8202, 0 }, 3, "\xe2\x80\x8a" },
+    { "&Vfr;", 5, { 120089, 0 }, 4, "\xf0\x9d\x94\x99" },
+    { "&Vopf;", 6, { 120141, 0 }, 4, "\xf0\x9d\x95\x8d" },
+    { "&Vscr;", 6, { 119985, 0 }, 4, "\xf0\x9d\x92\xb1" },
+    { "&Vvdash;", 8, { 8874, 0 }, 3, "\xe2\x8a\xaa" },
+    { "&Wcirc;", 7, { 372, 0 }, 2, "\xc5\xb4" },
+    { "&Wedge;", 7, { 8896, 0 }, 3, "\xe2\x8b\x80" },
+    { "&Wfr;", 5, { 120090, 0 }, 4, "\xf0\x9d\x94\x9a" },
+    { "&Wopf;", 6, { 120142, 0 }, 4, "\xf0\x9d\x95\x8e" },
+    { "&Wscr;", 6, { 119986, 0 }, 4, "\xf0\x9d\x92\xb2" },
+    { "&Xfr;", 5, { 120091, 0 }, 4, "\xf0\x9d\x94\x9b" },
+    { "&Xi;", 4, { 926, 0 }, 2, "\xce\x9e" },
+    { "&Xopf;", 6, { 120143, 0 }, 4, "\xf0\x9d\x95\x8f" },
+    { "&Xscr;", 6, { 119987, 0 }, 4, "\xf0\x9d\x92\xb3" },
+    { "&YAcy;", 6, { 1071, 0 }, 2, "\xd0\xaf" },
+    { "&YIcy;", 6, { 1031, 0 }, 2, "\xd0\x87" },
+    { "&YUcy;", 6, { 1070, 0 }, 2, "\xd0\xae" },
+    { "&Yacute;", 8, { 221, 0 }, 2, "\xc3\x9d" },
+    { "&Ycirc;", 7, { 374, 0 }, 2, "\xc5\xb6" },
+    { "&Ycy;", 5, { 1067, 0 }, 2, "\xd0\xab" },
+    { "&Yfr;", 5, { 120092, 0 }, 4, "\xf0\x9d\x94\x9c" },
+    { "&Yopf;", 6, { 120144, 0 }, 4, "\xf0\x9d\x95\x90" },
+    { "&Yscr;", 6, { 119988, 0 }, 4, "\xf0\x9d\x92\xb4" },
+    { "&Yuml;", 6, { 376, 0 }, 2, "\xc5\xb8" },
+    { "&ZHcy;", 6, { 1046, 0 }, 2, "\xd0\x96" },
+    { "&Zacute;", 8, { 377, 0 }, 2, "\xc5\xb9" },
+    { "&Zcaron;", 8, { 381, 0 }, 2, "\xc5\xbd" },
+    { "&Zcy;", 5, { 1047, 0 }, 2, "\xd0\x97" },
+    { "&Zdot;", 6, { 379, 0 }, 2, "\xc5\xbb" },
+    { "&ZeroWidthSpace;", 16, { 8203, 0 }, 3, "\xe2\x80\x8b" },
+    { "&Zeta;", 6, { 918, 0 }, 2, "\xce\x96" },
+    { "&Zfr;", 5, { 8488, 0 }, 3, "\xe2\x84\xa8" },
+    { "&Zopf;", 6, { 8484, 0 }, 3, "\xe2\x84\xa4" },
+    { "&Zscr;", 6, { 119989, 0 }, 4, "\xf0\x9d\x92\xb5" },
+    { "&aacute;", 8, { 225, 0 }, 2, "\xc3\xa1" },
+    { "&abreve;", 8, { 259, 0 }, 2, "\xc4\x83" },
+    { "&ac;", 4, { 8766, 0 }, 3, "\xe2\x88\xbe" },
+    { "&acE;", 5, { 8766, 819 }, 5, "\xe2\x88\xbe\xcc\xb3" },
+    { "&acd;", 5, { 8767, 0 }, 3, "\xe2\x88\xbf" },
+    { "&acirc;", 7, { 226, 0 }, 2, "\xc3\xa2" },
+    { "&acute;", 7, { 180, 0 }, 2, "\xc2\xb4" },
+    { "&acy;", 5, { 1072, 0 }, 2, "\xd0\xb0" },
+    { "&aelig;", 7, { 230, 0 }, 2, "\xc3\xa6" },
+    { "&af;", 4, { 8289, 0 }, 3, "\xe2\x81\xa1" },
+    { "&afr;", 5, { 120094, 0 }, 4, "\xf0\x9d\x94\x9e" },
+    { "&agrave;", 8, { 224, 0 }, 2, "\xc3\xa0" },
+    { "&alefsym;", 9, { 8501, 0 }, 3, "\xe2\x84\xb5" },
+    { "&aleph;", 7, { 8501, 0 }, 3, "\xe2\x84\xb5" },
+    { "&alpha;", 7, { 945, 0 }, 2, "\xce\xb1" },
+    { "&amacr;", 7, { 257, 0 }, 2, "\xc4\x81" },
+    { "&amalg;", 7, { 10815, 0 }, 3, "\xe2\xa8\xbf" },
+    { "&amp;", 5, { 38, 0 }, 1, "\x26" },
+    { "&and;", 5, { 8743, 0 }, 3, "\xe2\x88\xa7" },
+    { "&andand;", 8, { 10837, 0 }, 3, "\xe2\xa9\x95" },
+    { "&andd;", 6, { 10844, 0 }, 3, "\xe2\xa9\x9c" },
+    { "&andslope;", 10, { 10840, 0 }, 3, "\xe2\xa9\x98" },
+    { "&andv;", 6, { 10842, 0 }, 3, "\xe2\xa9\x9a" },
+    { "&ang;", 5, { 8736, 0 }, 3, "\xe2\x88\xa0" },
+    { "&ange;", 6, { 10660, 0 }, 3, "\xe2\xa6\xa4" },
+    { "&angle;", 7, { 8736, 0 }, 3, "\xe2\x88\xa0" },
+    { "&angmsd;", 8, { 8737, 0 }, 3, "\xe2\x88\xa1" },
+    { "&angmsdaa;", 10, { 10664, 0 }, 3, "\xe2\xa6\xa8" },
+    { "&angmsdab;", 10, { 10665, 0 }, 3, "\xe2\xa6\xa9" },
+    { "&angmsdac;", 10, { 10666, 0 }, 3, "\xe2\xa6\xaa" },
+    { "&angmsdad;", 10, { 10667, 0 }, 3, "\xe2\xa6\xab" },
+    { "&angmsdae;", 10, { 10668, 0 }, 3, "\xe2\xa6\xac" },
+    { "&angmsdaf;", 10, { 10669, 0 }, 3, "\xe2\xa6\xad" },
+    { "&angmsdag;", 10, { 10670, 0 }, 3, "\xe2\xa6\xae" },
+    { "&angmsdah;", 10, { 10671, 0 }, 3, "\xe2\xa6\xaf" },
+    { "&angrt;", 7, { 8735, 0 }, 3, "\xe2\x88\x9f" },
+    { "&angrtvb;", 9, { 8894, 0 }, 3, "\xe2\x8a\xbe" },
+    { "&angrtvbd;", 10, { 10653, 0 }, 3, "\xe2\xa6\x9d" },
+    { "&angsph;", 8, { 8738, 0 }, 3, "\xe2\x88\xa2" },
+    { "&angst;", 7, { 197, 0 }, 2, "\xc3\x85" },
+    { "&angzarr;", 9, { 9084, 0 }, 3, "\xe2\x8d\xbc" },
+    { "&aogon;", 7, { 261, 0 }, 2, "\xc4\x85" },
+    { "&aopf;", 6, { 120146, 0 }, 4, "\xf0\x9d\x95\x92" },
+    { "&ap;", 4, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&apE;", 5, { 10864, 0 }, 3, "\xe2\xa9\xb0" },
+    { "&apacir;", 8, { 10863, 0 }, 3, "\xe2\xa9\xaf" },
+    { "&ape;", 5, { 8778, 0 }, 3, "\xe2\x89\x8a" },
+    { "&apid;", 6, { 8779, 0 }, 3, "\xe2\x89\x8b" },
+    { "&apos;", 6, { 39, 0 }, 1, "\x27" },
+    { "&approx;", 8, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&approxeq;", 10, { 8778, 0 }, 3, "\xe2\x89\x8a" },
+    { "&aring;", 7, { 229, 0 }, 2, "\xc3\xa5" },
+    { "&ascr;", 6, { 119990, 0 }, 4, "\xf0\x9d\x92\xb6" },
+    { "&ast;", 5, { 42, 0 }, 1, "\x2a" },
+    { "&asymp;", 7, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&asympeq;", 9, { 8781, 0 }, 3, "\xe2\x89\x8d" },
+    { "&atilde;", 8, { 227, 0 }, 2, "\xc3\xa3" },
+    { "&auml;", 6, { 228, 0 }, 2, "\xc3\xa4" },
+    { "&awconint;", 10, { 8755, 0 }, 3, "\xe2\x88\xb3" },
+    { "&awint;", 7, { 10769, 0 }, 3, "\xe2\xa8\x91" },
+    { "&bNot;", 6, { 10989, 0 }, 3, "\xe2\xab\xad" },
+    { "&backcong;", 10, { 8780, 0 }, 3, "\xe2\x89\x8c" },
+    { "&backepsilon;", 13, { 1014, 0 }, 2, "\xcf\xb6" },
+    { "&backprime;", 11, { 8245, 0 }, 3, "\xe2\x80\xb5" },
+    { "&backsim;", 9, { 8765, 0 }, 3, "\xe2\x88\xbd" },
+    { "&backsimeq;", 11, { 8909, 0 }, 3, "\xe2\x8b\x8d" },
+    { "&barvee;", 8, { 8893, 0 }, 3, "\xe2\x8a\xbd" },
+    { "&barwed;", 8, { 8965, 0 }, 3, "\xe2\x8c\x85" },
+    { "&barwedge;", 10, { 8965, 0 }, 3, "\xe2\x8c\x85" },
+    { "&bbrk;", 6, { 9141, 0 }, 3, "\xe2\x8e\xb5" },
+    { "&bbrktbrk;", 10, { 9142, 0 }, 3, "\xe2\x8e\xb6" },
+    { "&bcong;", 7, { 8780, 0 }, 3, "\xe2\x89\x8c" },
+    { "&bcy;", 5, { 1073, 0 }, 2, "\xd0\xb1" },
+    { "&bdquo;", 7, { 8222, 0 }, 3, "\xe2\x80\x9e" },
+    { "&becaus;", 8, { 8757, 0 }, 3, "\xe2\x88\xb5" },
+    { "&because;", 9, { 8757, 0 }, 3, "\xe2\x88\xb5" },
+    { "&bemptyv;", 9, { 10672, 0 }, 3, "\xe2\xa6\xb0" },
+    { "&bepsi;", 7, { 1014, 0 }, 2, "\xcf\xb6" },
+    { "&bernou;", 8, { 8492, 0 }, 3, "\xe2\x84\xac" },
+    { "&beta;", 6, { 946, 0 }, 2, "\xce\xb2" },
+    { "&beth;", 6, { 8502, 0 }, 3, "\xe2\x84\xb6" },
+    { "&between;", 9, { 8812, 0 }, 3, "\xe2\x89\xac" },
+    { "&bfr;", 5, { 120095, 0 }, 4, "\xf0\x9d\x94\x9f" },
+    { "&bigcap;", 8, { 8898, 0 }, 3, "\xe2\x8b\x82" },
+    { "&bigcirc;", 9, { 9711, 0 }, 3, "\xe2\x97\xaf" },
+    { "&bigcup;", 8, { 8899, 0 }, 3, "\xe2\x8b\x83" },
+    { "&bigodot;", 9, { 10752, 0 }, 3, "\xe2\xa8\x80" },
+    { "&bigoplus;", 10, { 10753, 0 }, 3, "\xe2\xa8\x81" },
+    { "&bigotimes;", 11, { 10754, 0 }, 3, "\xe2\xa8\x82" },
+    { "&bigsqcup;", 10, { 10758, 0 }, 3, "\xe2\xa8\x86" },
+    { "&bigstar;", 9, { 9733, 0 }, 3, "\xe2\x98\x85" },
+    { "&bigtriangledown;", 17, { 9661, 0 }, 3, "\xe2\x96\xbd" },
+    { "&bigtriangleup;", 15, { 9651, 0 }, 3, "\xe2\x96\xb3" },
+    { "&biguplus;", 10, { 10756, 0 }, 3, "\xe2\xa8\x84" },
+    { "&bigvee;", 8, { 8897, 0 }, 3, "\xe2\x8b\x81" },
+    { "&bigwedge;", 10, { 8896, 0 }, 3, "\xe2\x8b\x80" },
+    { "&bkarow;", 8, { 10509, 0 }, 3, "\xe2\xa4\x8d" },
+    { "&blacklozenge;", 14, { 10731, 0 }, 3, "\xe2\xa7\xab" },
+    { "&blacksquare;", 13, { 9642, 0 }, 3, "\xe2\x96\xaa" },
+    { "&blacktriangle;", 15, { 9652, 0 }, 3, "\xe2\x96\xb4" },
+    { "&blacktriangledown;", 19, { 9662, 0 }, 3, "\xe2\x96\xbe" },
+    { "&blacktriangleleft;", 19, { 9666, 0 }, 3, "\xe2\x97\x82" },
+    { "&blacktriangleright;", 20, { 9656, 0 }, 3, "\xe2\x96\xb8" },
+    { "&blank;", 7, { 9251, 0 }, 3, "\xe2\x90\xa3" },
+    { "&blk12;", 7, { 9618, 0 }, 3, "\xe2\x96\x92" },
+    { "&blk14;", 7, { 9617, 0 }, 3, "\xe2\x96\x91" },
+    { "&blk34;", 7, { 9619, 0 }, 3, "\xe2\x96\x93" },
+    { "&block;", 7, { 9608, 0 }, 3, "\xe2\x96\x88" },
+    { "&bne;", 5, { 61, 8421 }, 4, "\x3d\xe2\x83\xa5" },
+    { "&bnequiv;", 9, { 8801, 8421 }, 6, "\xe2\x89\xa1\xe2\x83\xa5" },
+    { "&bnot;", 6, { 8976, 0 }, 3, "\xe2\x8c\x90" },
+    { "&bopf;", 6, { 120147, 0 }, 4, "\xf0\x9d\x95\x93" },
+    { "&bot;", 5, { 8869, 0 }, 3, "\xe2\x8a\xa5" },
+    { "&bottom;", 8, { 8869, 0 }, 3, "\xe2\x8a\xa5" },
+    { "&bowtie;", 8, { 8904, 0 }, 3, "\xe2\x8b\x88" },
+    { "&boxDL;", 7, { 9559, 0 }, 3, "\xe2\x95\x97" },
+    { "&boxDR;", 7, { 9556, 0 }, 3, "\xe2\x95\x94" },
+    { "&boxDl;", 7, { 9558, 0 }, 3, "\xe2\x95\x96" },
+    { "&boxDr;", 7, { 9555, 0 }, 3, "\xe2\x95\x93" },
+    { "&boxH;", 6, { 9552, 0 }, 3, "\xe2\x95\x90" },
+    { "&boxHD;", 7, { 9574, 0 }, 3, "\xe2\x95\xa6" },
+    { "&boxHU;", 7, { 9577, 0 }, 3, "\xe2\x95\xa9" },
+    { "&boxHd;", 7, { 9572, 0 }, 3, "\xe2\x95\xa4" },
+    { "&boxHu;", 7, { 9575, 0 }, 3, "\xe2\x95\xa7" },
+    { "&boxUL;", 7, { 9565, 0 }, 3, "\xe2\x95\x9d" },
+    { "&boxUR;", 7, { 9562, 0 }, 3, "\xe2\x95\x9a" },
+    { "&boxUl;", 7, { 9564, 0 }, 3, "\xe2\x95\x9c" },
+    { "&boxUr;", 7, { 9561, 0 }, 3, "\xe2\x95\x99" },
+    { "&boxV;", 6, { 9553, 0 }, 3, "\xe2\x95\x91" },
+    { "&boxVH;", 7, { 9580, 0 }, 3, "\xe2\x95\xac" },
+    { "&boxVL;", 7, { 9571, 0 }, 3, "\xe2\x95\xa3" },
+    { "&boxVR;", 7, { 9568, 0 }, 3, "\xe2\x95\xa0" },
+    { "&boxVh;", 7, { 9579, 0 }, 3, "\xe2\x95\xab" },
+    { "&boxVl;", 7, { 9570, 0 }, 3, "\xe2\x95\xa2" },
+    { "&boxVr;", 7, { 9567, 0 }, 3, "\xe2\x95\x9f" },
+    { "&boxbox;", 8, { 10697, 0 }, 3, "\xe2\xa7\x89" },
+    { "&boxdL;", 7, { 9557, 0 }, 3, "\xe2\x95\x95" },
+    { "&boxdR;", 7, { 9554, 0 }, 3, "\xe2\x95\x92" },
+    { "&boxdl;", 7, { 9488, 0 }, 3, "\xe2\x94\x90" },
+    { "&boxdr;", 7, { 9484, 0 }, 3, "\xe2\x94\x8c" },
+    { "&boxh;", 6, { 9472, 0 }, 3, "\xe2\x94\x80" },
+    { "&boxhD;", 7, { 9573, 0 }, 3, "\xe2\x95\xa5" },
+    { "&boxhU;", 7, { 9576, 0 }, 3, "\xe2\x95\xa8" },
+    { "&boxhd;", 7, { 9516, 0 }, 3, "\xe2\x94\xac" },
+    { "&boxhu;", 7, { 9524, 0 }, 3, "\xe2\x94\xb4" },
+    { "&boxminus;", 10, { 8863, 0 }, 3, "\xe2\x8a\x9f" },
+    { "&boxplus;", 9, { 8862, 0 }, 3, "\xe2\x8a\x9e" },
+    { "&boxtimes;", 10, { 8864, 0 }, 3, "\xe2\x8a\xa0" },
+    { "&boxuL;", 7, { 9563, 0 }, 3, "\xe2\x95\x9b" },
+    { "&boxuR;", 7, { 9560, 0 }, 3, "\xe2\x95\x98" },
+    { "&boxul;", 7, { 9496, 0 }, 3, "\xe2\x94\x98" },
+    { "&boxur;", 7, { 9492, 0 }, 3, "\xe2\x94\x94" },
+    { "&boxv;", 6, { 9474, 0 }, 3, "\xe2\x94\x82" },
+    { "&boxvH;", 7, { 9578, 0 }, 3, "\xe2\x95\xaa" },
+    { "&boxvL;", 7, { 9569, 0 }, 3, "\xe2\x95\xa1" },
+    { "&boxvR;", 7, { 9566, 0 }, 3, "\xe2\x95\x9e" },
+    { "&boxvh;", 7, { 9532, 0 }, 3, "\xe2\x94\xbc" },
+    { "&boxvl;", 7, { 9508, 0 }, 3, "\xe2\x94\xa4" },
+    { "&boxvr;", 7, { 9500, 0 }, 3, "\xe2\x94\x9c" },
+    { "&bprime;", 8, { 8245, 0 }, 3, "\xe2\x80\xb5" },
+    { "&breve;", 7, { 728, 0 }, 2, "\xcb\x98" },
+    { "&brvbar;", 8, { 166, 0 }, 2, "\xc2\xa6" },
+    { "&bscr;", 6, { 119991, 0 }, 4, "\xf0\x9d\x92\xb7" },
+    { "&bsemi;", 7, { 8271, 0 }, 3, "\xe2\x81\x8f" },
+    { "&bsim;", 6, { 8765, 0 }, 3, "\xe2\x88\xbd" },
+    { "&bsime;", 7, { 8909, 0 }, 3, "\xe2\x8b\x8d" },
+    { "&bsol;", 6, { 92, 0 }, 1, "\x5c" },
+    { "&bsolb;", 7, { 10693, 0 }, 3, "\xe2\xa7\x85" },
+    { "&bsolhsub;", 10, { 10184, 0 }, 3, "\xe2\x9f\x88" },
+    { "&bull;", 6, { 8226, 0 }, 3, "\xe2\x80\xa2" },
+    { "&bullet;", 8, { 8226, 0 }, 3, "\xe2\x80\xa2" },
+    { "&bump;", 6, { 8782, 0 }, 3, "\xe2\x89\x8e" },
+    { "&bumpE;", 7, { 10926, 0 }, 3, "\xe2\xaa\xae" },
+    { "&bumpe;", 7, { 8783, 0 }, 3, "\xe2\x89\x8f" },
+    { "&bumpeq;", 8, { 8783, 0 }, 3, "\xe2\x89\x8f" },
+    { "&cacute;", 8, { 263, 0 }, 2, "\xc4\x87" },
+    { "&cap;", 5, { 8745, 0 }, 3, "\xe2\x88\xa9" },
+    { "&capand;", 8, { 10820, 0 }, 3, "\xe2\xa9\x84" },
+    { "&capbrcup;", 10, { 10825, 0 }, 3, "\xe2\xa9\x89" },
+    { "&capcap;", 8, { 10827, 0 }, 3, "\xe2\xa9\x8b" },
+    { "&capcup;", 8, { 10823, 0 }, 3, "\xe2\xa9\x87" },
+    { "&capdot;", 8, { 10816, 0 }, 3, "\xe2\xa9\x80" },
+    { "&caps;", 6, { 8745, 65024 }, 6, "\xe2\x88\xa9\xef\xb8\x80" },
+    { "&caret;", 7, { 8257, 0 }, 3, "\xe2\x81\x81" },
+    { "&caron;", 7, { 711, 0 }, 2, "\xcb\x87" },
+    { "&ccaps;", 7, { 10829, 0 }, 3, "\xe2\xa9\x8d" },
+    { "&ccaron;", 8, { 269, 0 }, 2, "\xc4\x8d" },
+    { "&ccedil;", 8, { 231, 0 }, 2, "\xc3\xa7" },
+    { "&ccirc;", 7, { 265, 0 }, 2, "\xc4\x89" },
+    { "&ccups;", 7, { 10828, 0 }, 3, "\xe2\xa9\x8c" },
+    { "&ccupssm;", 9, { 10832, 0 }, 3, "\xe2\xa9\x90" },
+    { "&cdot;", 6, { 267, 0 }, 2, "\xc4\x8b" },
+    { "&cedil;", 7, { 184, 0 }, 2, "\xc2\xb8" },
+    { "&cemptyv;", 9, { 10674, 0 }, 3, "\xe2\xa6\xb2" },
+    { "&cent;", 6, { 162, 0 }, 2, "\xc2\xa2" },
+    { "&centerdot;", 11, { 183, 0 }, 2, "\xc2\xb7" },
+    { "&cfr;", 5, { 120096, 0 }, 4, "\xf0\x9d\x94\xa0" },
+    { "&chcy;", 6, { 1095, 0 }, 2, "\xd1\x87" },
+    { "&check;", 7, { 10003, 0 }, 3, "\xe2\x9c\x93" },
+    { "&checkmark;", 11, { 10003, 0 }, 3, "\xe2\x9c\x93" },
+    { "&chi;", 5, { 967, 0 }, 2, "\xcf\x87" },
+    { "&cir;", 5, { 9675, 0 }, 3, "\xe2\x97\x8b" },
+    { "&cirE;", 6, { 10691, 0 }, 3, "\xe2\xa7\x83" },
+    { "&circ;", 6, { 710, 0 }, 2, "\xcb\x86" },
+    { "&circeq;", 8, { 8791, 0 }, 3, "\xe2\x89\x97" },
+    { "&circlearrowleft;", 17, { 8634, 0 }, 3, "\xe2\x86\xba" },
+    { "&circlearrowright;", 18, { 8635, 0 }, 3, "\xe2\x86\xbb" },
+    { "&circledR;", 10, { 174, 0 }, 2, "\xc2\xae" },
+    { "&circledS;", 10, { 9416, 0 }, 3, "\xe2\x93\x88" },
+    { "&circledast;", 12, { 8859, 0 }, 3, "\xe2\x8a\x9b" },
+    { "&circledcirc;", 13, { 8858, 0 }, 3, "\xe2\x8a\x9a" },
+    { "&circleddash;", 13, { 8861, 0 }, 3, "\xe2\x8a\x9d" },
+    { "&cire;", 6, { 8791, 0 }, 3, "\xe2\x89\x97" },
+    { "&cirfnint;", 10, { 10768, 0 }, 3, "\xe2\xa8\x90" },
+    { "&cirmid;", 8, { 10991, 0 }, 3, "\xe2\xab\xaf" },
+    { "&cirscir;", 9, { 10690, 0 }, 3, "\xe2\xa7\x82" },
+    { "&clubs;", 7, { 9827, 0 }, 3, "\xe2\x99\xa3" },
+    { "&clubsuit;", 10, { 9827, 0 }, 3, "\xe2\x99\xa3" },
+    { "&colon;", 7, { 58, 0 }, 1, "\x3a" },
+    { "&colone;", 8, { 8788, 0 }, 3, "\xe2\x89\x94" },
+    { "&coloneq;", 9, { 8788, 0 }, 3, "\xe2\x89\x94" },
+    { "&comma;", 7, { 44, 0 }, 1, "\x2c" },
+    { "&commat;", 8, { 64, 0 }, 1, "\x40" },
+    { "&comp;", 6, { 8705, 0 }, 3, "\xe2\x88\x81" },
+    { "&compfn;", 8, { 8728, 0 }, 3, "\xe2\x88\x98" },
+    { "&complement;", 12, { 8705, 0 }, 3, "\xe2\x88\x81" },
+    { "&complexes;", 11, { 8450, 0 }, 3, "\xe2\x84\x82" },
+    { "&cong;", 6, { 8773, 0 }, 3, "\xe2\x89\x85" },
+    { "&congdot;", 9, { 10861, 0 }, 3, "\xe2\xa9\xad" },
+    { "&conint;", 8, { 8750, 0 }, 3, "\xe2\x88\xae" },
+    { "&copf;", 6, { 120148, 0 }, 4, "\xf0\x9d\x95\x94" },
+    { "&coprod;", 8, { 8720, 0 }, 3, "\xe2\x88\x90" },
+    { "&copy;", 6, { 169, 0 }, 2, "\xc2\xa9" },
+    { "&copysr;", 8, { 8471, 0 }, 3, "\xe2\x84\x97" },
+    { "&crarr;", 7, { 8629, 0 }, 3, "\xe2\x86\xb5" },
+    { "&cross;", 7, { 10007, 0 }, 3, "\xe2\x9c\x97" },
+    { "&cscr;", 6, { 119992, 0 }, 4, "\xf0\x9d\x92\xb8" },
+    { "&csub;", 6, { 10959, 0 }, 3, "\xe2\xab\x8f" },
+    { "&csube;", 7, { 10961, 0 }, 3, "\xe2\xab\x91" },
+    { "&csup;", 6, { 10960, 0 }, 3, "\xe2\xab\x90" },
+    { "&csupe;", 7, { 10962, 0 }, 3, "\xe2\xab\x92" },
+    { "&ctdot;", 7, { 8943, 0 }, 3, "\xe2\x8b\xaf" },
+    { "&cudarrl;", 9, { 10552, 0 }, 3, "\xe2\xa4\xb8" },
+    { "&cudarrr;", 9, { 10549, 0 }, 3, "\xe2\xa4\xb5" },
+    { "&cuepr;", 7, { 8926, 0 }, 3, "\xe2\x8b\x9e" },
+    { "&cuesc;", 7, { 8927, 0 }, 3, "\xe2\x8b\x9f" },
+    { "&cularr;", 8, { 8630, 0 }, 3, "\xe2\x86\xb6" },
+    { "&cularrp;", 9, { 10557, 0 }, 3, "\xe2\xa4\xbd" },
+    { "&cup;", 5, { 8746, 0 }, 3, "\xe2\x88\xaa" },
+    { "&cupbrcap;", 10, { 10824, 0 }, 3, "\xe2\xa9\x88" },
+    { "&cupcap;", 8, { 10822, 0 }, 3, "\xe2\xa9\x86" },
+    { "&cupcup;", 8, { 10826, 0 }, 3, "\xe2\xa9\x8a" },
+    { "&cupdot;", 8, { 8845, 0 }, 3, "\xe2\x8a\x8d" },
+    { "&cupor;", 7, { 10821, 0 }, 3, "\xe2\xa9\x85" },
+    { "&cups;", 6, { 8746, 65024 }, 6, "\xe2\x88\xaa\xef\xb8\x80" },
+    { "&curarr;", 8, { 8631, 0 }, 3, "\xe2\x86\xb7" },
+    { "&curarrm;", 9, { 10556, 0 }, 3, "\xe2\xa4\xbc" },
+    { "&curlyeqprec;", 13, { 8926, 0 }, 3, "\xe2\x8b\x9e" },
+    { "&curlyeqsucc;", 13, { 8927, 0 }, 3, "\xe2\x8b\x9f" },
+    { "&curlyvee;", 10, { 8910, 0 }, 3, "\xe2\x8b\x8e" },
+    { "&curlywedge;", 12, { 8911, 0 }, 3, "\xe2\x8b\x8f" },
+    { "&curren;", 8, { 164, 0 }, 2, "\xc2\xa4" },
+    { "&curvearrowleft;", 16, { 8630, 0 }, 3, "\xe2\x86\xb6" },
+    { "&curvearrowright;", 17, { 8631, 0 }, 3, "\xe2\x86\xb7" },
+    { "&cuvee;", 7, { 8910, 0 }, 3, "\xe2\x8b\x8e" },
+    { "&cuwed;", 7, { 8911, 0 }, 3, "\xe2\x8b\x8f" },
+    { "&cwconint;", 10, { 8754, 0 }, 3, "\xe2\x88\xb2" },
+    { "&cwint;", 7, { 8753, 0 }, 3, "\xe2\x88\xb1" },
+    { "&cylcty;", 8, { 9005, 0 }, 3, "\xe2\x8c\xad" },
+    { "&dArr;", 6, { 8659, 0 }, 3, "\xe2\x87\x93" },
+    { "&dHar;", 6, { 10597, 0 }, 3, "\xe2\xa5\xa5" },
+    { "&dagger;", 8, { 8224, 0 }, 3, "\xe2\x80\xa0" },
+    { "&daleth;", 8, { 8504, 0 }, 3, "\xe2\x84\xb8" },
+    { "&darr;", 6, { 8595, 0 }, 3, "\xe2\x86\x93" },
+    { "&dash;", 6, { 8208, 0 }, 3, "\xe2\x80\x90" },
+    { "&dashv;", 7, { 8867, 0 }, 3, "\xe2\x8a\xa3" },
+    { "&dbkarow;", 9, { 10511, 0 }, 3, "\xe2\xa4\x8f" },
+    { "&dblac;", 7, { 733, 0 }, 2, "\xcb\x9d" },
+    { "&dcaron;", 8, { 271, 0 }, 2, "\xc4\x8f" },
+    { "&dcy;", 5, { 1076, 0 }, 2, "\xd0\xb4" },
+    { "&dd;", 4, { 8518, 0 }, 3, "\xe2\x85\x86" },
+    { "&ddagger;", 9, { 8225, 0 }, 3, "\xe2\x80\xa1" },
+    { "&ddarr;", 7, { 8650, 0 }, 3, "\xe2\x87\x8a" },
+    { "&ddotseq;", 9, { 10871, 0 }, 3, "\xe2\xa9\xb7" },
+    { "&deg;", 5, { 176, 0 }, 2, "\xc2\xb0" },
+    { "&delta;", 7, { 948, 0 }, 2, "\xce\xb4" },
+    { "&demptyv;", 9, { 10673, 0 }, 3, "\xe2\xa6\xb1" },
+    { "&dfisht;", 8, { 10623, 0 }, 3, "\xe2\xa5\xbf" },
+    { "&dfr;", 5, { 120097, 0 }, 4, "\xf0\x9d\x94\xa1" },
+    { "&dharl;", 7, { 8643, 0 }, 3, "\xe2\x87\x83" },
+    { "&dharr;", 7, { 8642, 0 }, 3, "\xe2\x87\x82" },
+    { "&diam;", 6, { 8900, 0 }, 3, "\xe2\x8b\x84" },
+    { "&diamond;", 9, { 8900, 0 }, 3, "\xe2\x8b\x84" },
+    { "&diamondsuit;", 13, { 9830, 0 }, 3, "\xe2\x99\xa6" },
+    { "&diams;", 7, { 9830, 0 }, 3, "\xe2\x99\xa6" },
+    { "&die;", 5, { 168, 0 }, 2, "\xc2\xa8" },
+    { "&digamma;", 9, { 989, 0 }, 2, "\xcf\x9d" },
+    { "&disin;", 7, { 8946, 0 }, 3, "\xe2\x8b\xb2" },
+    { "&div;", 5, { 247, 0 }, 2, "\xc3\xb7" },
+    { "&divide;", 8, { 247, 0 }, 2, "\xc3\xb7" },
+    { "&divideontimes;", 15, { 8903, 0 }, 3, "\xe2\x8b\x87" },
+    { "&divonx;", 8, { 8903, 0 }, 3, "\xe2\x8b\x87" },
+    { "&djcy;", 6, { 1106, 0 }, 2, "\xd1\x92" },
+    { "&dlcorn;", 8, { 8990, 0 }, 3, "\xe2\x8c\x9e" },
+    { "&dlcrop;", 8, { 8973, 0 }, 3, "\xe2\x8c\x8d" },
+    { "&dollar;", 8, { 36, 0 }, 1, "\x24" },
+    { "&dopf;", 6, { 120149, 0 }, 4, "\xf0\x9d\x95\x95" },
+    { "&dot;", 5, { 729, 0 }, 2, "\xcb\x99" },
+    { "&doteq;", 7, { 8784, 0 }, 3, "\xe2\x89\x90" },
+    { "&doteqdot;", 10, { 8785, 0 }, 3, "\xe2\x89\x91" },
+    { "&dotminus;", 10, { 8760, 0 }, 3, "\xe2\x88\xb8" },
+    { "&dotplus;", 9, { 8724, 0 }, 3, "\xe2\x88\x94" },
+    { "&dotsquare;", 11, { 8865, 0 }, 3, "\xe2\x8a\xa1" },
+    { "&doublebarwedge;", 16, { 8966, 0 }, 3, "\xe2\x8c\x86" },
+    { "&downarrow;", 11, { 8595, 0 }, 3, "\xe2\x86\x93" },
+    { "&downdownarrows;", 16, { 8650, 0 }, 3, "\xe2\x87\x8a" },
+    { "&downharpoonleft;", 17, { 8643, 0 }, 3, "\xe2\x87\x83" },
+    { "&downharpoonright;", 18, { 8642, 0 }, 3, "\xe2\x87\x82" },
+    { "&drbkarow;", 10, { 10512, 0 }, 3, "\xe2\xa4\x90" },
+    { "&drcorn;", 8, { 8991, 0 }, 3, "\xe2\x8c\x9f" },
+    { "&drcrop;", 8, { 8972, 0 }, 3, "\xe2\x8c\x8c" },
+    { "&dscr;", 6, { 119993, 0 }, 4, "\xf0\x9d\x92\xb9" },
+    { "&dscy;", 6, { 1109, 0 }, 2, "\xd1\x95" },
+    { "&dsol;", 6, { 10742, 0 }, 3, "\xe2\xa7\xb6" },
+    { "&dstrok;", 8, { 273, 0 }, 2, "\xc4\x91" },
+    { "&dtdot;", 7, { 8945, 0 }, 3, "\xe2\x8b\xb1" },
+    { "&dtri;", 6, { 9663, 0 }, 3, "\xe2\x96\xbf" },
+    { "&dtrif;", 7, { 9662, 0 }, 3, "\xe2\x96\xbe" },
+    { "&duarr;", 7, { 8693, 0 }, 3, "\xe2\x87\xb5" },
+    { "&duhar;", 7, { 10607, 0 }, 3, "\xe2\xa5\xaf" },
+    { "&dwangle;", 9, { 10662, 0 }, 3, "\xe2\xa6\xa6" },
+    { "&dzcy;", 6, { 1119, 0 }, 2, "\xd1\x9f" },
+    { "&dzigrarr;", 10, { 10239, 0 }, 3, "\xe2\x9f\xbf" },
+    { "&eDDot;", 7, { 10871, 0 }, 3, "\xe2\xa9\xb7" },
+    { "&eDot;", 6, { 8785, 0 }, 3, "\xe2\x89\x91" },
+    { "&eacute;", 8, { 233, 0 }, 2, "\xc3\xa9" },
+    { "&easter;", 8, { 10862, 0 }, 3, "\xe2\xa9\xae" },
+    { "&ecaron;", 8, { 283, 0 }, 2, "\xc4\x9b" },
+    { "&ecir;", 6, { 8790, 0 }, 3, "\xe2\x89\x96" },
+    { "&ecirc;", 7, { 234, 0 }, 2, "\xc3\xaa" },
+    { "&ecolon;", 8, { 8789, 0 }, 3, "\xe2\x89\x95" },
+    { "&ecy;", 5, { 1101, 0 }, 2, "\xd1\x8d" },
+    { "&edot;", 6, { 279, 0 }, 2, "\xc4\x97" },
+    { "&ee;", 4, { 8519, 0 }, 3, "\xe2\x85\x87" },
+    { "&efDot;", 7, { 8786, 0 }, 3, "\xe2\x89\x92" },
+    { "&efr;", 5, { 120098, 0 }, 4, "\xf0\x9d\x94\xa2" },
+    { "&eg;", 4, { 10906, 0 }, 3, "\xe2\xaa\x9a" },
+    { "&egrave;", 8, { 232, 0 }, 2, "\xc3\xa8" },
+    { "&egs;", 5, { 10902, 0 }, 3, "\xe2\xaa\x96" },
+    { "&egsdot;", 8, { 10904, 0 }, 3, "\xe2\xaa\x98" },
+    { "&el;", 4, { 10905, 0 }, 3, "\xe2\xaa\x99" },
+    { "&elinters;", 10, { 9191, 0 }, 3, "\xe2\x8f\xa7" },
+    { "&ell;", 5, { 8467, 0 }, 3, "\xe2\x84\x93" },
+    { "&els;", 5, { 10901, 0 }, 3, "\xe2\xaa\x95" },
+    { "&elsdot;", 8, { 10903, 0 }, 3, "\xe2\xaa\x97" },
+    { "&emacr;", 7, { 275, 0 }, 2, "\xc4\x93" },
+    { "&empty;", 7, { 8709, 0 }, 3, "\xe2\x88\x85" },
+    { "&emptyset;", 10, { 8709, 0 }, 3, "\xe2\x88\x85" },
+    { "&emptyv;", 8, { 8709, 0 }, 3, "\xe2\x88\x85" },
+    { "&emsp13;", 8, { 8196, 0 }, 3, "\xe2\x80\x84" },
+    { "&emsp14;", 8, { 8197, 0 }, 3, "\xe2\x80\x85" },
+    { "&emsp;", 6, { 8195, 0 }, 3, "\xe2\x80\x83" },
+    { "&eng;", 5, { 331, 0 }, 2, "\xc5\x8b" },
+    { "&ensp;", 6, { 8194, 0 }, 3, "\xe2\x80\x82" },
+    { "&eogon;", 7, { 281, 0 }, 2, "\xc4\x99" },
+    { "&eopf;", 6, { 120150, 0 }, 4, "\xf0\x9d\x95\x96" },
+    { "&epar;", 6, { 8917, 0 }, 3, "\xe2\x8b\x95" },
+    { "&eparsl;", 8, { 10723, 0 }, 3, "\xe2\xa7\xa3" },
+    { "&eplus;", 7, { 10865, 0 }, 3, "\xe2\xa9\xb1" },
+    { "&epsi;", 6, { 949, 0 }, 2, "\xce\xb5" },
+    { "&epsilon;", 9, { 949, 0 }, 2, "\xce\xb5" },
+    { "&epsiv;", 7, { 1013, 0 }, 2, "\xcf\xb5" },
+    { "&eqcirc;", 8, { 8790, 0 }, 3, "\xe2\x89\x96" },
+    { "&eqcolon;", 9, { 8789, 0 }, 3, "\xe2\x89\x95" },
+    { "&eqsim;", 7, { 8770, 0 }, 3, "\xe2\x89\x82" },
+    { "&eqslantgtr;", 12, { 10902, 0 }, 3, "\xe2\xaa\x96" },
+    { "&eqslantless;", 13, { 10901, 0 }, 3, "\xe2\xaa\x95" },
+    { "&equals;", 8, { 61, 0 }, 1, "\x3d" },
+    { "&equest;", 8, { 8799, 0 }, 3, "\xe2\x89\x9f" },
+    { "&equiv;", 7, { 8801, 0 }, 3, "\xe2\x89\xa1" },
+    { "&equivDD;", 9, { 10872, 0 }, 3, "\xe2\xa9\xb8" },
+    { "&eqvparsl;", 10, { 10725, 0 }, 3, "\xe2\xa7\xa5" },
+    { "&erDot;", 7, { 8787, 0 }, 3, "\xe2\x89\x93" },
+    { "&erarr;", 7, { 10609, 0 }, 3, "\xe2\xa5\xb1" },
+    { "&escr;", 6, { 8495, 0 }, 3, "\xe2\x84\xaf" },
+    { "&esdot;", 7, { 8784, 0 }, 3, "\xe2\x89\x90" },
+    { "&esim;", 6, { 8770, 0 }, 3, "\xe2\x89\x82" },
+    { "&eta;", 5, { 951, 0 }, 2, "\xce\xb7" },
+    { "&eth;", 5, { 240, 0 }, 2, "\xc3\xb0" },
+    { "&euml;", 6, { 235, 0 }, 2, "\xc3\xab" },
+    { "&euro;", 6, { 8364, 0 }, 3, "\xe2\x82\xac" },
+    { "&excl;", 6, { 33, 0 }, 1, "\x21" },
+    { "&exist;", 7, { 8707, 0 }, 3, "\xe2\x88\x83" },
+    { "&expectation;", 13, { 8496, 0 }, 3, "\xe2\x84\xb0" },
+    { "&exponentiale;", 14, { 8519, 0 }, 3, "\xe2\x85\x87" },
+    { "&fallingdotseq;", 15, { 8786, 0 }, 3, "\xe2\x89\x92" },
+    { "&fcy;", 5, { 1092, 0 }, 2, "\xd1\x84" },
+    { "&female;", 8, { 9792, 0 }, 3, "\xe2\x99\x80" },
+    { "&ffilig;", 8, { 64259, 0 }, 3, "\xef\xac\x83" },
+    { "&fflig;", 7, { 64256, 0 }, 3, "\xef\xac\x80" },
+    { "&ffllig;", 8, { 64260, 0 }, 3, "\xef\xac\x84" },
+    { "&ffr;", 5, { 120099, 0 }, 4, "\xf0\x9d\x94\xa3" },
+    { "&filig;", 7, { 64257, 0 }, 3, "\xef\xac\x81" },
+    { "&fjlig;", 7, { 102, 106 }, 2, "\x66\x6a" },
+    { "&flat;", 6, { 9837, 0 }, 3, "\xe2\x99\xad" },
+    { "&fllig;", 7, { 64258, 0 }, 3, "\xef\xac\x82" },
+    { "&fltns;", 7, { 9649, 0 }, 3, "\xe2\x96\xb1" },
+    { "&fnof;", 6, { 402, 0 }, 2, "\xc6\x92" },
+    { "&fopf;", 6, { 120151, 0 }, 4, "\xf0\x9d\x95\x97" },
+    { "&forall;", 8, { 8704, 0 }, 3, "\xe2\x88\x80" },
+    { "&fork;", 6, { 8916, 0 }, 3, "\xe2\x8b\x94" },
+    { "&forkv;", 7, { 10969, 0 }, 3, "\xe2\xab\x99" },
+    { "&fpartint;", 10, { 10765, 0 }, 3, "\xe2\xa8\x8d" },
+    { "&frac12;", 8, { 189, 0 }, 2, "\xc2\xbd" },
+    { "&frac13;", 8, { 8531, 0 }, 3, "\xe2\x85\x93" },
+    { "&frac14;", 8, { 188, 0 }, 2, "\xc2\xbc" },
+    { "&frac15;", 8, { 8533, 0 }, 3, "\xe2\x85\x95" },
+    { "&frac16;", 8, { 8537, 0 }, 3, "\xe2\x85\x99" },
+    { "&frac18;", 8, { 8539, 0 }, 3, "\xe2\x85\x9b" },
+    { "&frac23;", 8, { 8532, 0 }, 3, "\xe2\x85\x94" },
+    { "&frac25;", 8, { 8534, 0 }, 3, "\xe2\x85\x96" },
+    { "&frac34;", 8, { 190, 0 }, 2, "\xc2\xbe" },
+    { "&frac35;", 8, { 8535, 0 }, 3, "\xe2\x85\x97" },
+    { "&frac38;", 8, { 8540, 0 }, 3, "\xe2\x85\x9c" },
+    { "&frac45;", 8, { 8536, 0 }, 3, "\xe2\x85\x98" },
+    { "&frac56;", 8, { 8538, 0 }, 3, "\xe2\x85\x9a" },
+    { "&frac58;", 8, { 8541, 0 }, 3, "\xe2\x85\x9d" },
+    { "&frac78;", 8, { 8542, 0 }, 3, "\xe2\x85\x9e" },
+    { "&frasl;", 7, { 8260, 0 }, 3, "\xe2\x81\x84" },
+    { "&frown;", 7, { 8994, 0 }, 3, "\xe2\x8c\xa2" },
+    { "&fscr;", 6, { 119995, 0 }, 4, "\xf0\x9d\x92\xbb" },
+    { "&gE;", 4, { 8807, 0 }, 3, "\xe2\x89\xa7" },
+    { "&gEl;", 5, { 10892, 0 }, 3, "\xe2\xaa\x8c" },
+    { "&gacute;", 8, { 501, 0 }, 2, "\xc7\xb5" },
+    { "&gamma;", 7, { 947, 0 }, 2, "\xce\xb3" },
+    { "&gammad;", 8, { 989, 0 }, 2, "\xcf\x9d" },
+    { "&gap;", 5, { 10886, 0 }, 3, "\xe2\xaa\x86" },
+    { "&gbreve;", 8, { 287, 0 }, 2, "\xc4\x9f" },
+    { "&gcirc;", 7, { 285, 0 }, 2, "\xc4\x9d" },
+    { "&gcy;", 5, { 1075, 0 }, 2, "\xd0\xb3" },
+    { "&gdot;", 6, { 289, 0 }, 2, "\xc4\xa1" },
+    { "&ge;", 4, { 8805, 0 }, 3, "\xe2\x89\xa5" },
+    { "&gel;", 5, { 8923, 0 }, 3, "\xe2\x8b\x9b" },
+    { "&geq;", 5, { 8805, 0 }, 3, "\xe2\x89\xa5" },
+    { "&geqq;", 6, { 8807, 0 }, 3, "\xe2\x89\xa7" },
+    { "&geqslant;", 10, { 10878, 0 }, 3, "\xe2\xa9\xbe" },
+    { "&ges;", 5, { 10878, 0 }, 3, "\xe2\xa9\xbe" },
+    { "&gescc;", 7, { 10921, 0 }, 3, "\xe2\xaa\xa9" },
+    { "&gesdot;", 8, { 10880, 0 }, 3, "\xe2\xaa\x80" },
+    { "&gesdoto;", 9, { 10882, 0 }, 3, "\xe2\xaa\x82" },
+    { "&gesdotol;", 10, { 10884, 0 }, 3, "\xe2\xaa\x84" },
+    { "&gesl;", 6, { 8923, 65024 }, 6, "\xe2\x8b\x9b\xef\xb8\x80" },
+    { "&gesles;", 8, { 10900, 0 }, 3, "\xe2\xaa\x94" },
+    { "&gfr;", 5, { 120100, 0 }, 4, "\xf0\x9d\x94\xa4" },
+    { "&gg;", 4, { 8811, 0 }, 3, "\xe2\x89\xab" },
+    { "&ggg;", 5, { 8921, 0 }, 3, "\xe2\x8b\x99" },
+    { "&gimel;", 7, { 8503, 0 }, 3, "\xe2\x84\xb7" },
+    { "&gjcy;", 6, { 1107, 0 }, 2, "\xd1\x93" },
+    { "&gl;", 4, { 8823, 0 }, 3, "\xe2\x89\xb7" },
+    { "&glE;", 5, { 10898, 0 }, 3, "\xe2\xaa\x92" },
+    { "&gla;", 5, { 10917, 0 }, 3, "\xe2\xaa\xa5" },
+    { "&glj;", 5, { 10916, 0 }, 3, "\xe2\xaa\xa4" },
+    { "&gnE;", 5, { 8809, 0 }, 3, "\xe2\x89\xa9" },
+    { "&gnap;", 6, { 10890, 0 }, 3, "\xe2\xaa\x8a" },
+    { "&gnapprox;", 10, { 10890, 0 }, 3, "\xe2\xaa\x8a" },
+    { "&gne;", 5, { 10888, 0 }, 3, "\xe2\xaa\x88" },
+    { "&gneq;", 6, { 10888, 0 }, 3, "\xe2\xaa\x88" },
+    { "&gneqq;", 7, { 8809, 0 }, 3, "\xe2\x89\xa9" },
+    { "&gnsim;", 7, { 8935, 0 }, 3, "\xe2\x8b\xa7" },
+    { "&gopf;", 6, { 120152, 0 }, 4, "\xf0\x9d\x95\x98" },
+    { "&grave;", 7, { 96, 0 }, 1, "\x60" },
+    { "&gscr;", 6, { 8458, 0 }, 3, "\xe2\x84\x8a" },
+    { "&gsim;", 6, { 8819, 0 }, 3, "\xe2\x89\xb3" },
+    { "&gsime;", 7, { 10894, 0 }, 3, "\xe2\xaa\x8e" },
+    { "&gsiml;", 7, { 10896, 0 }, 3, "\xe2\xaa\x90" },
+    { "&gt;", 4, { 62, 0 }, 1, "\x3e" },
+    { "&gtcc;", 6, { 10919, 0 }, 3, "\xe2\xaa\xa7" },
+    { "&gtcir;", 7, { 10874, 0 }, 3, "\xe2\xa9\xba" },
+    { "&gtdot;", 7, { 8919, 0 }, 3, "\xe2\x8b\x97" },
+    { "&gtlPar;", 8, { 10645, 0 }, 3, "\xe2\xa6\x95" },
+    { "&gtquest;", 9, { 10876, 0 }, 3, "\xe2\xa9\xbc" },
+    { "&gtrapprox;", 11, { 10886, 0 }, 3, "\xe2\xaa\x86" },
+    { "&gtrarr;", 8, { 10616, 0 }, 3, "\xe2\xa5\xb8" },
+    { "&gtrdot;", 8, { 8919, 0 }, 3, "\xe2\x8b\x97" },
+    { "&gtreqless;", 11, { 8923, 0 }, 3, "\xe2\x8b\x9b" },
+    { "&gtreqqless;", 12, { 10892, 0 }, 3, "\xe2\xaa\x8c" },
+    { "&gtrless;", 9, { 8823, 0 }, 3, "\xe2\x89\xb7" },
+    { "&gtrsim;", 8, { 8819, 0 }, 3, "\xe2\x89\xb3" },
+    { "&gvertneqq;", 11, { 8809, 65024 }, 6, "\xe2\x89\xa9\xef\xb8\x80" },
+    { "&gvnE;", 6, { 8809, 65024 }, 6, "\xe2\x89\xa9\xef\xb8\x80" },
+    { "&hArr;", 6, { 8660, 0 }, 3, "\xe2\x87\x94" },
+    { "&hairsp;", 8, { 8202, 0 }, 3, "\xe2\x80\x8a" },
+    { "&half;", 6, { 189, 0 }, 2, "\xc2\xbd" },
+    { "&hamilt;", 8, { 8459, 0 }, 3, "\xe2\x84\x8b" },
+    { "&hardcy;", 8, { 1098, 0 }, 2, "\xd1\x8a" },
+    { "&harr;", 6, { 8596, 0 }, 3, "\xe2\x86\x94" },
+    { "&harrcir;", 9, { 10568, 0 }, 3, "\xe2\xa5\x88" },
+    { "&harrw;", 7, { 8621, 0 }, 3, "\xe2\x86\xad" },
+    { "&hbar;", 6, { 8463, 0 }, 3, "\xe2\x84\x8f" },
+    { "&hcirc;", 7, { 293, 0 }, 2, "\xc4\xa5" },
+    { "&hearts;", 8, { 9829, 0 }, 3, "\xe2\x99\xa5" },
+    { "&heartsuit;", 11, { 9829, 0 }, 3, "\xe2\x99\xa5" },
+    { "&hellip;", 8, { 8230, 0 }, 3, "\xe2\x80\xa6" },
+    { "&hercon;", 8, { 8889, 0 }, 3, "\xe2\x8a\xb9" },
+    { "&hfr;", 5, { 120101, 0 }, 4, "\xf0\x9d\x94\xa5" },
+    { "&hksearow;", 10, { 10533, 0 }, 3, "\xe2\xa4\xa5" },
+    { "&hkswarow;", 10, { 10534, 0 }, 3, "\xe2\xa4\xa6" },
+    { "&hoarr;", 7, { 8703, 0 }, 3, "\xe2\x87\xbf" },
+    { "&homtht;", 8, { 8763, 0 }, 3, "\xe2\x88\xbb" },
+    { "&hookleftarrow;", 15, { 8617, 0 }, 3, "\xe2\x86\xa9" },
+    { "&hookrightarrow;", 16, { 8618, 0 }, 3, "\xe2\x86\xaa" },
+    { "&hopf;", 6, { 120153, 0 }, 4, "\xf0\x9d\x95\x99" },
+    { "&horbar;", 8, { 8213, 0 }, 3, "\xe2\x80\x95" },
+    { "&hscr;", 6, { 119997, 0 }, 4, "\xf0\x9d\x92\xbd" },
+    { "&hslash;", 8, { 8463, 0 }, 3, "\xe2\x84\x8f" },
+    { "&hstrok;", 8, { 295, 0 }, 2, "\xc4\xa7" },
+    { "&hybull;", 8, { 8259, 0 }, 3, "\xe2\x81\x83" },
+    { "&hyphen;", 8, { 8208, 0 }, 3, "\xe2\x80\x90" },
+    { "&iacute;", 8, { 237, 0 }, 2, "\xc3\xad" },
+    { "&ic;", 4, { 8291, 0 }, 3, "\xe2\x81\xa3" },
+    { "&icirc;", 7, { 238, 0 }, 2, "\xc3\xae" },
+    { "&icy;", 5, { 1080, 0 }, 2, "\xd0\xb8" },
+    { "&iecy;", 6, { 1077, 0 }, 2, "\xd0\xb5" },
+    { "&iexcl;", 7, { 161, 0 }, 2, "\xc2\xa1" },
+    { "&iff;", 5, { 8660, 0 }, 3, "\xe2\x87\x94" },
+    { "&ifr;", 5, { 120102, 0 }, 4, "\xf0\x9d\x94\xa6" },
+    { "&igrave;", 8, { 236, 0 }, 2, "\xc3\xac" },
+    { "&ii;", 4, { 8520, 0 }, 3, "\xe2\x85\x88" },
+    { "&iiiint;", 8, { 10764, 0 }, 3, "\xe2\xa8\x8c" },
+    { "&iiint;", 7, { 8749, 0 }, 3, "\xe2\x88\xad" },
+    { "&iinfin;", 8, { 10716, 0 }, 3, "\xe2\xa7\x9c" },
+    { "&iiota;", 7, { 8489, 0 }, 3, "\xe2\x84\xa9" },
+    { "&ijlig;", 7, { 307, 0 }, 2, "\xc4\xb3" },
+    { "&imacr;", 7, { 299, 0 }, 2, "\xc4\xab" },
+    { "&image;", 7, { 8465, 0 }, 3, "\xe2\x84\x91" },
+    { "&imagline;", 10, { 8464, 0 }, 3, "\xe2\x84\x90" },
+    { "&imagpart;", 10, { 8465, 0 }, 3, "\xe2\x84\x91" },
+    { "&imath;", 7, { 305, 0 }, 2, "\xc4\xb1" },
+    { "&imof;", 6, { 8887, 0 }, 3, "\xe2\x8a\xb7" },
+    { "&imped;", 7, { 437, 0 }, 2, "\xc6\xb5" },
+    { "&in;", 4, { 8712, 0 }, 3, "\xe2\x88\x88" },
+    { "&incare;", 8, { 8453, 0 }, 3, "\xe2\x84\x85" },
+    { "&infin;", 7, { 8734, 0 }, 3, "\xe2\x88\x9e" },
+    { "&infintie;", 10, { 10717, 0 }, 3, "\xe2\xa7\x9d" },
+    { "&inodot;", 8, { 305, 0 }, 2, "\xc4\xb1" },
+    { "&int;", 5, { 8747, 0 }, 3, "\xe2\x88\xab" },
+    { "&intcal;", 8, { 8890, 0 }, 3, "\xe2\x8a\xba" },
+    { "&integers;", 10, { 8484, 0 }, 3, "\xe2\x84\xa4" },
+    { "&intercal;", 10, { 8890, 0 }, 3, "\xe2\x8a\xba" },
+    { "&intlarhk;", 10, { 10775, 0 }, 3, "\xe2\xa8\x97" },
+    { "&intprod;", 9, { 10812, 0 }, 3, "\xe2\xa8\xbc" },
+    { "&iocy;", 6, { 1105, 0 }, 2, "\xd1\x91" },
+    { "&iogon;", 7, { 303, 0 }, 2, "\xc4\xaf" },
+    { "&iopf;", 6, { 120154, 0 }, 4, "\xf0\x9d\x95\x9a" },
+    { "&iota;", 6, { 953, 0 }, 2, "\xce\xb9" },
+    { "&iprod;", 7, { 10812, 0 }, 3, "\xe2\xa8\xbc" },
+    { "&iquest;", 8, { 191, 0 }, 2, "\xc2\xbf" },
+    { "&iscr;", 6, { 119998, 0 }, 4, "\xf0\x9d\x92\xbe" },
+    { "&isin;", 6, { 8712, 0 }, 3, "\xe2\x88\x88" },
+    { "&isinE;", 7, { 8953, 0 }, 3, "\xe2\x8b\xb9" },
+    { "&isindot;", 9, { 8949, 0 }, 3, "\xe2\x8b\xb5" },
+    { "&isins;", 7, { 8948, 0 }, 3, "\xe2\x8b\xb4" },
+    { "&isinsv;", 8, { 8947, 0 }, 3, "\xe2\x8b\xb3" },
+    { "&isinv;", 7, { 8712, 0 }, 3, "\xe2\x88\x88" },
+    { "&it;", 4, { 8290, 0 }, 3, "\xe2\x81\xa2" },
+    { "&itilde;", 8, { 297, 0 }, 2, "\xc4\xa9" },
+    { "&iukcy;", 7, { 1110, 0 }, 2, "\xd1\x96" },
+    { "&iuml;", 6, { 239, 0 }, 2, "\xc3\xaf" },
+    { "&jcirc;", 7, { 309, 0 }, 2, "\xc4\xb5" },
+    { "&jcy;", 5, { 1081, 0 }, 2, "\xd0\xb9" },
+    { "&jfr;", 5, { 120103, 0 }, 4, "\xf0\x9d\x94\xa7" },
+    { "&jmath;", 7, { 567, 0 }, 2, "\xc8\xb7" },
+    { "&jopf;", 6, { 120155, 0 }, 4, "\xf0\x9d\x95\x9b" },
+    { "&jscr;", 6, { 119999, 0 }, 4, "\xf0\x9d\x92\xbf" },
+    { "&jsercy;", 8, { 1112, 0 }, 2, "\xd1\x98" },
+    { "&jukcy;", 7, { 1108, 0 }, 2, "\xd1\x94" },
+    { "&kappa;", 7, { 954, 0 }, 2, "\xce\xba" },
+    { "&kappav;", 8, { 1008, 0 }, 2, "\xcf\xb0" },
+    { "&kcedil;", 8, { 311, 0 }, 2, "\xc4\xb7" },
+    { "&kcy;", 5, { 1082, 0 }, 2, "\xd0\xba" },
+    { "&kfr;", 5, { 120104, 0 }, 4, "\xf0\x9d\x94\xa8" },
+    { "&kgreen;", 8, { 312, 0 }, 2, "\xc4\xb8" },
+    { "&khcy;", 6, { 1093, 0 }, 2, "\xd1\x85" },
+    { "&kjcy;", 6, { 1116, 0 }, 2, "\xd1\x9c" },
+    { "&kopf;", 6, { 120156, 0 }, 4, "\xf0\x9d\x95\x9c" },
+    { "&kscr;", 6, { 120000, 0 }, 4, "\xf0\x9d\x93\x80" },
+    { "&lAarr;", 7, { 8666, 0 }, 3, "\xe2\x87\x9a" },
+    { "&lArr;", 6, { 8656, 0 }, 3, "\xe2\x87\x90" },
+    { "&lAtail;", 8, { 10523, 0 }, 3, "\xe2\xa4\x9b" },
+    { "&lBarr;", 7, { 10510, 0 }, 3, "\xe2\xa4\x8e" },
+    { "&lE;", 4, { 8806, 0 }, 3, "\xe2\x89\xa6" },
+    { "&lEg;", 5, { 10891, 0 }, 3, "\xe2\xaa\x8b" },
+    { "&lHar;", 6, { 10594, 0 }, 3, "\xe2\xa5\xa2" },
+    { "&lacute;", 8, { 314, 0 }, 2, "\xc4\xba" },
+    { "&laemptyv;", 10, { 10676, 0 }, 3, "\xe2\xa6\xb4" },
+    { "&lagran;", 8, { 8466, 0 }, 3, "\xe2\x84\x92" },
+    { "&lambda;", 8, { 955, 0 }, 2, "\xce\xbb" },
+    { "&lang;", 6, { 10216, 0 }, 3, "\xe2\x9f\xa8" },
+    { "&langd;", 7, { 10641, 0 }, 3, "\xe2\xa6\x91" },
+    { "&langle;", 8, { 10216, 0 }, 3, "\xe2\x9f\xa8" },
+    { "&lap;", 5, { 10885, 0 }, 3, "\xe2\xaa\x85" },
+    { "&laquo;", 7, { 171, 0 }, 2, "\xc2\xab" },
+    { "&larr;", 6, { 8592, 0 }, 3, "\xe2\x86\x90" },
+    { "&larrb;", 7, { 8676, 0 }, 3, "\xe2\x87\xa4" },
+    { "&larrbfs;", 9, { 10527, 0 }, 3, "\xe2\xa4\x9f" },
+    { "&larrfs;", 8, { 10525, 0 }, 3, "\xe2\xa4\x9d" },
+    { "&larrhk;", 8, { 8617, 0 }, 3, "\xe2\x86\xa9" },
+    { "&larrlp;", 8, { 8619, 0 }, 3, "\xe2\x86\xab" },
+    { "&larrpl;", 8, { 10553, 0 }, 3, "\xe2\xa4\xb9" },
+    { "&larrsim;", 9, { 10611, 0 }, 3, "\xe2\xa5\xb3" },
+    { "&larrtl;", 8, { 8610, 0 }, 3, "\xe2\x86\xa2" },
+    { "&lat;", 5, { 10923, 0 }, 3, "\xe2\xaa\xab" },
+    { "&latail;", 8, { 10521, 0 }, 3, "\xe2\xa4\x99" },
+    { "&late;", 6, { 10925, 0 }, 3, "\xe2\xaa\xad" },
+    { "&lates;", 7, { 10925, 65024 }, 6, "\xe2\xaa\xad\xef\xb8\x80" },
+    { "&lbarr;", 7, { 10508, 0 }, 3, "\xe2\xa4\x8c" },
+    { "&lbbrk;", 7, { 10098, 0 }, 3, "\xe2\x9d\xb2" },
+    { "&lbrace;", 8, { 123, 0 }, 1, "\x7b" },
+    { "&lbrack;", 8, { 91, 0 }, 1, "\x5b" },
+    { "&lbrke;", 7, { 10635, 0 }, 3, "\xe2\xa6\x8b" },
+    { "&lbrksld;", 9, { 10639, 0 }, 3, "\xe2\xa6\x8f" },
+    { "&lbrkslu;", 9, { 10637, 0 }, 3, "\xe2\xa6\x8d" },
+    { "&lcaron;", 8, { 318, 0 }, 2, "\xc4\xbe" },
+    { "&lcedil;", 8, { 316, 0 }, 2, "\xc4\xbc" },
+    { "&lceil;", 7, { 8968, 0 }, 3, "\xe2\x8c\x88" },
+    { "&lcub;", 6, { 123, 0 }, 1, "\x7b" },
+    { "&lcy;", 5, { 1083, 0 }, 2, "\xd0\xbb" },
+    { "&ldca;", 6, { 10550, 0 }, 3, "\xe2\xa4\xb6" },
+    { "&ldquo;", 7, { 8220, 0 }, 3, "\xe2\x80\x9c" },
+    { "&ldquor;", 8, { 8222, 0 }, 3, "\xe2\x80\x9e" },
+    { "&ldrdhar;", 9, { 10599, 0 }, 3, "\xe2\xa5\xa7" },
+    { "&ldrushar;", 10, { 10571, 0 }, 3, "\xe2\xa5\x8b" },
+    { "&ldsh;", 6, { 8626, 0 }, 3, "\xe2\x86\xb2" },
+    { "&le;", 4, { 8804, 0 }, 3, "\xe2\x89\xa4" },
+    { "&leftarrow;", 11, { 8592, 0 }, 3, "\xe2\x86\x90" },
+    { "&leftarrowtail;", 15, { 8610, 0 }, 3, "\xe2\x86\xa2" },
+    { "&leftharpoondown;", 17, { 8637, 0 }, 3, "\xe2\x86\xbd" },
+    { "&leftharpoonup;", 15, { 8636, 0 }, 3, "\xe2\x86\xbc" },
+    { "&leftleftarrows;", 16, { 8647, 0 }, 3, "\xe2\x87\x87" },
+    { "&leftrightarrow;", 16, { 8596, 0 }, 3, "\xe2\x86\x94" },
+    { "&leftrightarrows;", 17, { 8646, 0 }, 3, "\xe2\x87\x86" },
+    { "&leftrightharpoons;", 19, { 8651, 0 }, 3, "\xe2\x87\x8b" },
+    { "&leftrightsquigarrow;", 21, { 8621, 0 }, 3, "\xe2\x86\xad" },
+    { "&leftthreetimes;", 16, { 8907, 0 }, 3, "\xe2\x8b\x8b" },
+    { "&leg;", 5, { 8922, 0 }, 3, "\xe2\x8b\x9a" },
+    { "&leq;", 5, { 8804, 0 }, 3, "\xe2\x89\xa4" },
+    { "&leqq;", 6, { 8806, 0 }, 3, "\xe2\x89\xa6" },
+    { "&leqslant;", 10, { 10877, 0 }, 3, "\xe2\xa9\xbd" },
+    { "&les;", 5, { 10877, 0 }, 3, "\xe2\xa9\xbd" },
+    { "&lescc;", 7, { 10920, 0 }, 3, "\xe2\xaa\xa8" },
+    { "&lesdot;", 8, { 10879, 0 }, 3, "\xe2\xa9\xbf" },
+    { "&lesdoto;", 9, { 10881, 0 }, 3, "\xe2\xaa\x81" },
+    { "&lesdotor;", 10, { 10883, 0 }, 3, "\xe2\xaa\x83" },
+    { "&lesg;", 6, { 8922, 65024 }, 6, "\xe2\x8b\x9a\xef\xb8\x80" },
+    { "&lesges;", 8, { 10899, 0 }, 3, "\xe2\xaa\x93" },
+    { "&lessapprox;", 12, { 10885, 0 }, 3, "\xe2\xaa\x85" },
+    { "&lessdot;", 9, { 8918, 0 }, 3, "\xe2\x8b\x96" },
+    { "&lesseqgtr;", 11, { 8922, 0 }, 3, "\xe2\x8b\x9a" },
+    { "&lesseqqgtr;", 12, { 10891, 0 }, 3, "\xe2\xaa\x8b" },
+    { "&lessgtr;", 9, { 8822, 0 }, 3, "\xe2\x89\xb6" },
+    { "&lesssim;", 9, { 8818, 0 }, 3, "\xe2\x89\xb2" },
+    { "&lfisht;", 8, { 10620, 0 }, 3, "\xe2\xa5\xbc" },
+    { "&lfloor;", 8, { 8970, 0 }, 3, "\xe2\x8c\x8a" },
+    { "&lfr;", 5, { 120105, 0 }, 4, "\xf0\x9d\x94\xa9" },
+    { "&lg;", 4, { 8822, 0 }, 3, "\xe2\x89\xb6" },
+    { "&lgE;", 5, { 10897, 0 }, 3, "\xe2\xaa\x91" },
+    { "&lhard;", 7, { 8637, 0 }, 3, "\xe2\x86\xbd" },
+    { "&lharu;", 7, { 8636, 0 }, 3, "\xe2\x86\xbc" },
+    { "&lharul;", 8, { 10602, 0 }, 3, "\xe2\xa5\xaa" },
+    { "&lhblk;", 7, { 9604, 0 }, 3, "\xe2\x96\x84" },
+    { "&ljcy;", 6, { 1113, 0 }, 2, "\xd1\x99" },
+    { "&ll;", 4, { 8810, 0 }, 3, "\xe2\x89\xaa" },
+    { "&llarr;", 7, { 8647, 0 }, 3, "\xe2\x87\x87" },
+    { "&llcorner;", 10, { 8990, 0 }, 3, "\xe2\x8c\x9e" },
+    { "&llhard;", 8, { 10603, 0 }, 3, "\xe2\xa5\xab" },
+    { "&lltri;", 7, { 9722, 0 }, 3, "\xe2\x97\xba" },
+    { "&lmidot;", 8, { 320, 0 }, 2, "\xc5\x80" },
+    { "&lmoust;", 8, { 9136, 0 }, 3, "\xe2\x8e\xb0" },
+    { "&lmoustache;", 12, { 9136, 0 }, 3, "\xe2\x8e\xb0" },
+    { "&lnE;", 5, { 8808, 0 }, 3, "\xe2\x89\xa8" },
+    { "&lnap;", 6, { 10889, 0 }, 3, "\xe2\xaa\x89" },
+    { "&lnapprox;", 10, { 10889, 0 }, 3, "\xe2\xaa\x89" },
+    { "&lne;", 5, { 10887, 0 }, 3, "\xe2\xaa\x87" },
+    { "&lneq;", 6, { 10887, 0 }, 3, "\xe2\xaa\x87" },
+    { "&lneqq;", 7, { 8808, 0 }, 3, "\xe2\x89\xa8" },
+    { "&lnsim;", 7, { 8934, 0 }, 3, "\xe2\x8b\xa6" },
+    { "&loang;", 7, { 10220, 0 }, 3, "\xe2\x9f\xac" },
+    { "&loarr;", 7, { 8701, 0 }, 3, "\xe2\x87\xbd" },
+    { "&lobrk;", 7, { 10214, 0 }, 3, "\xe2\x9f\xa6" },
+    { "&longleftarrow;", 15, { 10229, 0 }, 3, "\xe2\x9f\xb5" },
+    { "&longleftrightarrow;", 20, { 10231, 0 }, 3, "\xe2\x9f\xb7" },
+    { "&longmapsto;", 12, { 10236, 0 }, 3, "\xe2\x9f\xbc" },
+    { "&longrightarrow;", 16, { 10230, 0 }, 3, "\xe2\x9f\xb6" },
+    { "&looparrowleft;", 15, { 8619, 0 }, 3, "\xe2\x86\xab" },
+    { "&looparrowright;", 16, { 8620, 0 }, 3, "\xe2\x86\xac" },
+    { "&lopar;", 7, { 10629, 0 }, 3, "\xe2\xa6\x85" },
+    { "&lopf;", 6, { 120157, 0 }, 4, "\xf0\x9d\x95\x9d" },
+    { "&loplus;", 8, { 10797, 0 }, 3, "\xe2\xa8\xad" },
+    { "&lotimes;", 9, { 10804, 0 }, 3, "\xe2\xa8\xb4" },
+    { "&lowast;", 8, { 8727, 0 }, 3, "\xe2\x88\x97" },
+    { "&lowbar;", 8, { 95, 0 }, 1, "\x5f" },
+    { "&loz;", 5, { 9674, 0 }, 3, "\xe2\x97\x8a" },
+    { "&lozenge;", 9, { 9674, 0 }, 3, "\xe2\x97\x8a" },
+    { "&lozf;", 6, { 10731, 0 }, 3, "\xe2\xa7\xab" },
+    { "&lpar;", 6, { 40, 0 }, 1, "\x28" },
+    { "&lparlt;", 8, { 10643, 0 }, 3, "\xe2\xa6\x93" },
+    { "&lrarr;", 7, { 8646, 0 }, 3, "\xe2\x87\x86" },
+    { "&lrcorner;", 10, { 8991, 0 }, 3, "\xe2\x8c\x9f" },
+    { "&lrhar;", 7, { 8651, 0 }, 3, "\xe2\x87\x8b" },
+    { "&lrhard;", 8, { 10605, 0 }, 3, "\xe2\xa5\xad" },
+    { "&lrm;", 5, { 8206, 0 }, 3, "\xe2\x80\x8e" },
+    { "&lrtri;", 7, { 8895, 0 }, 3, "\xe2\x8a\xbf" },
+    { "&lsaquo;", 8, { 8249, 0 }, 3, "\xe2\x80\xb9" },
+    { "&lscr;", 6, { 120001, 0 }, 4, "\xf0\x9d\x93\x81" },
+    { "&lsh;", 5, { 8624, 0 }, 3, "\xe2\x86\xb0" },
+    { "&lsim;", 6, { 8818, 0 }, 3, "\xe2\x89\xb2" },
+    { "&lsime;", 7, { 10893, 0 }, 3, "\xe2\xaa\x8d" },
+    { "&lsimg;", 7, { 10895, 0 }, 3, "\xe2\xaa\x8f" },
+    { "&lsqb;", 6, { 91, 0 }, 1, "\x5b" },
+    { "&lsquo;", 7, { 8216, 0 }, 3, "\xe2\x80\x98" },
+    { "&lsquor;", 8, { 8218, 0 }, 3, "\xe2\x80\x9a" },
+    { "&lstrok;", 8, { 322, 0 }, 2, "\xc5\x82" },
+    { "&lt;", 4, { 60, 0 }, 1, "\x3c" },
+    { "&ltcc;", 6, { 10918, 0 }, 3, "\xe2\xaa\xa6" },
+    { "&ltcir;", 7, { 10873, 0 }, 3, "\xe2\xa9\xb9" },
+    { "&ltdot;", 7, { 8918, 0 }, 3, "\xe2\x8b\x96" },
+    { "&lthree;", 8, { 8907, 0 }, 3, "\xe2\x8b\x8b" },
+    { "&ltimes;", 8, { 8905, 0 }, 3, "\xe2\x8b\x89" },
+    { "&ltlarr;", 8, { 10614, 0 }, 3, "\xe2\xa5\xb6" },
+    { "&ltquest;", 9, { 10875, 0 }, 3, "\xe2\xa9\xbb" },
+    { "&ltrPar;", 8, { 10646, 0 }, 3, "\xe2\xa6\x96" },
+    { "&ltri;", 6, { 9667, 0 }, 3, "\xe2\x97\x83" },
+    { "&ltrie;", 7, { 8884, 0 }, 3, "\xe2\x8a\xb4" },
+    { "&ltrif;", 7, { 9666, 0 }, 3, "\xe2\x97\x82" },
+    { "&lurdshar;", 10, { 10570, 0 }, 3, "\xe2\xa5\x8a" },
+    { "&luruhar;", 9, { 10598, 0 }, 3, "\xe2\xa5\xa6" },
+    { "&lvertneqq;", 11, { 8808, 65024 }, 6, "\xe2\x89\xa8\xef\xb8\x80" },
+    { "&lvnE;", 6, { 8808, 65024 }, 6, "\xe2\x89\xa8\xef\xb8\x80" },
+    { "&mDDot;", 7, { 8762, 0 }, 3, "\xe2\x88\xba" },
+    { "&macr;", 6, { 175, 0 }, 2, "\xc2\xaf" },
+    { "&male;", 6, { 9794, 0 }, 3, "\xe2\x99\x82" },
+    { "&malt;", 6, { 10016, 0 }, 3, "\xe2\x9c\xa0" },
+    { "&maltese;", 9, { 10016, 0 }, 3, "\xe2\x9c\xa0" },
+    { "&map;", 5, { 8614, 0 }, 3, "\xe2\x86\xa6" },
+    { "&mapsto;", 8, { 8614, 0 }, 3, "\xe2\x86\xa6" },
+    { "&mapstodown;", 12, { 8615, 0 }, 3, "\xe2\x86\xa7" },
+    { "&mapstoleft;", 12, { 8612, 0 }, 3, "\xe2\x86\xa4" },
+    { "&mapstoup;", 10, { 8613, 0 }, 3, "\xe2\x86\xa5" },
+    { "&marker;", 8, { 9646, 0 }, 3, "\xe2\x96\xae" },
+    { "&mcomma;", 8, { 10793, 0 }, 3, "\xe2\xa8\xa9" },
+    { "&mcy;", 5, { 1084, 0 }, 2, "\xd0\xbc" },
+    { "&mdash;", 7, { 8212, 0 }, 3, "\xe2\x80\x94" },
+    { "&measuredangle;", 15, { 8737, 0 }, 3, "\xe2\x88\xa1" },
+    { "&mfr;", 5, { 120106, 0 }, 4, "\xf0\x9d\x94\xaa" },
+    { "&mho;", 5, { 8487, 0 }, 3, "\xe2\x84\xa7" },
+    { "&micro;", 7, { 181, 0 }, 2, "\xc2\xb5" },
+    { "&mid;", 5, { 8739, 0 }, 3, "\xe2\x88\xa3" },
+    { "&midast;", 8, { 42, 0 }, 1, "\x2a" },
+    { "&midcir;", 8, { 10992, 0 }, 3, "\xe2\xab\xb0" },
+    { "&middot;", 8, { 183, 0 }, 2, "\xc2\xb7" },
+    { "&minus;", 7, { 8722, 0 }, 3, "\xe2\x88\x92" },
+    { "&minusb;", 8, { 8863, 0 }, 3, "\xe2\x8a\x9f" },
+    { "&minusd;", 8, { 8760, 0 }, 3, "\xe2\x88\xb8" },
+    { "&minusdu;", 9, { 10794, 0 }, 3, "\xe2\xa8\xaa" },
+    { "&mlcp;", 6, { 10971, 0 }, 3, "\xe2\xab\x9b" },
+    { "&mldr;", 6, { 8230, 0 }, 3, "\xe2\x80\xa6" },
+    { "&mnplus;", 8, { 8723, 0 }, 3, "\xe2\x88\x93" },
+    { "&models;", 8, { 8871, 0 }, 3, "\xe2\x8a\xa7" },
+    { "&mopf;", 6, { 120158, 0 }, 4, "\xf0\x9d\x95\x9e" },
+    { "&mp;", 4, { 8723, 0 }, 3, "\xe2\x88\x93" },
+    { "&mscr;", 6, { 120002, 0 }, 4, "\xf0\x9d\x93\x82" },
+    { "&mstpos;", 8, { 8766, 0 }, 3, "\xe2\x88\xbe" },
+    { "&mu;", 4, { 956, 0 }, 2, "\xce\xbc" },
+    { "&multimap;", 10, { 8888, 0 }, 3, "\xe2\x8a\xb8" },
+    { "&mumap;", 7, { 8888, 0 }, 3, "\xe2\x8a\xb8" },
+    { "&nGg;", 5, { 8921, 824 }, 5, "\xe2\x8b\x99\xcc\xb8" },
+    { "&nGt;", 5, { 8811, 8402 }, 6, "\xe2\x89\xab\xe2\x83\x92" },
+    { "&nGtv;", 6, { 8811, 824 }, 5, "\xe2\x89\xab\xcc\xb8" },
+    { "&nLeftarrow;", 12, { 8653, 0 }, 3, "\xe2\x87\x8d" },
+    { "&nLeftrightarrow;", 17, { 8654, 0 }, 3, "\xe2\x87\x8e" },
+    { "&nLl;", 5, { 8920, 824 }, 5, "\xe2\x8b\x98\xcc\xb8" },
+    { "&nLt;", 5, { 8810, 8402 }, 6, "\xe2\x89\xaa\xe2\x83\x92" },
+    { "&nLtv;", 6, { 8810, 824 }, 5, "\xe2\x89\xaa\xcc\xb8" },
+    { "&nRightarrow;", 13, { 8655, 0 }, 3, "\xe2\x87\x8f" },
+    { "&nVDash;", 8, { 8879, 0 }, 3, "\xe2\x8a\xaf" },
+    { "&nVdash;", 8, { 8878, 0 }, 3, "\xe2\x8a\xae" },
+    { "&nabla;", 7, { 8711, 0 }, 3, "\xe2\x88\x87" },
+    { "&nacute;", 8, { 324, 0 }, 2, "\xc5\x84" },
+    { "&nang;", 6, { 8736, 8402 }, 6, "\xe2\x88\xa0\xe2\x83\x92" },
+    { "&nap;", 5, { 8777, 0 }, 3, "\xe2\x89\x89" },
+    { "&napE;", 6, { 10864, 824 }, 5, "\xe2\xa9\xb0\xcc\xb8" },
+    { "&napid;", 7, { 8779, 824 }, 5, "\xe2\x89\x8b\xcc\xb8" },
+    { "&napos;", 7, { 329, 0 }, 2, "\xc5\x89" },
+    { "&napprox;", 9, { 8777, 0 }, 3, "\xe2\x89\x89" },
+    { "&natur;", 7, { 9838, 0 }, 3, "\xe2\x99\xae" },
+    { "&natural;", 9, { 9838, 0 }, 3, "\xe2\x99\xae" },
+    { "&naturals;", 10, { 8469, 0 }, 3, "\xe2\x84\x95" },
+    { "&nbsp;", 6, { 160, 0 }, 2, "\xc2\xa0" },
+    { "&nbump;", 7, { 8782, 824 }, 5, "\xe2\x89\x8e\xcc\xb8" },
+    { "&nbumpe;", 8, { 8783, 824 }, 5, "\xe2\x89\x8f\xcc\xb8" },
+    { "&ncap;", 6, { 10819, 0 }, 3, "\xe2\xa9\x83" },
+    { "&ncaron;", 8, { 328, 0 }, 2, "\xc5\x88" },
+    { "&ncedil;", 8, { 326, 0 }, 2, "\xc5\x86" },
+    { "&ncong;", 7, { 8775, 0 }, 3, "\xe2\x89\x87" },
+    { "&ncongdot;", 10, { 10861, 824 }, 5, "\xe2\xa9\xad\xcc\xb8" },
+    { "&ncup;", 6, { 10818, 0 }, 3, "\xe2\xa9\x82" },
+    { "&ncy;", 5, { 1085, 0 }, 2, "\xd0\xbd" },
+    { "&ndash;", 7, { 8211, 0 }, 3, "\xe2\x80\x93" },
+    { "&ne;", 4, { 8800, 0 }, 3, "\xe2\x89\xa0" },
+    { "&neArr;", 7, { 8663, 0 }, 3, "\xe2\x87\x97" },
+    { "&nearhk;", 8, { 10532, 0 }, 3, "\xe2\xa4\xa4" },
+    { "&nearr;", 7, { 8599, 0 }, 3, "\xe2\x86\x97" },
+    { "&nearrow;", 9, { 8599, 0 }, 3, "\xe2\x86\x97" },
+    { "&nedot;", 7, { 8784, 824 }, 5, "\xe2\x89\x90\xcc\xb8" },
+    { "&nequiv;", 8, { 8802, 0 }, 3, "\xe2\x89\xa2" },
+    { "&nesear;", 8, { 10536, 0 }, 3, "\xe2\xa4\xa8" },
+    { "&nesim;", 7, { 8770, 824 }, 5, "\xe2\x89\x82\xcc\xb8" },
+    { "&nexist;", 8, { 8708, 0 }, 3, "\xe2\x88\x84" },
+    { "&nexists;", 9, { 8708, 0 }, 3, "\xe2\x88\x84" },
+    { "&nfr;", 5, { 120107, 0 }, 4, "\xf0\x9d\x94\xab" },
+    { "&ngE;", 5, { 8807, 824 }, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&nge;", 5, { 8817, 0 }, 3, "\xe2\x89\xb1" },
+    { "&ngeq;", 6, { 8817, 0 }, 3, "\xe2\x89\xb1" },
+    { "&ngeqq;", 7, { 8807, 824 }, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&ngeqslant;", 11, { 10878, 824 }, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&nges;", 6, { 10878, 824 }, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&ngsim;", 7, { 8821, 0 }, 3, "\xe2\x89\xb5" },
+    { "&ngt;", 5, { 8815, 0 }, 3, "\xe2\x89\xaf" },
+    { "&ngtr;", 6, { 8815, 0 }, 3, "\xe2\x89\xaf" },
+    { "&nhArr;", 7, { 8654, 0 }, 3, "\xe2\x87\x8e" },
+    { "&nharr;", 7, { 8622, 0 }, 3, "\xe2\x86\xae" },
+    { "&nhpar;", 7, { 10994, 0 }, 3, "\xe2\xab\xb2" },
+    { "&ni;", 4, { 8715, 0 }, 3, "\xe2\x88\x8b" },
+    { "&nis;", 5, { 8956, 0 }, 3, "\xe2\x8b\xbc" },
+    { "&nisd;", 6, { 8954, 0 }, 3, "\xe2\x8b\xba" },
+    { "&niv;", 5, { 8715, 0 }, 3, "\xe2\x88\x8b" },
+    { "&njcy;", 6, { 1114, 0 }, 2, "\xd1\x9a" },
+    { "&nlArr;", 7, { 8653, 0 }, 3, "\xe2\x87\x8d" },
+    { "&nlE;", 5, { 8806, 824 }, 5, "\xe2\x89\xa6\xcc\xb8" },
+    { "&nlarr;", 7, { 8602, 0 }, 3, "\xe2\x86\x9a" },
+    { "&nldr;", 6, { 8229, 0 }, 3, "\xe2\x80\xa5" },
+    { "&nle;", 5, { 8816, 0 }, 3, "\xe2\x89\xb0" },
+    { "&nleftarrow;", 12, { 8602, 0 }, 3, "\xe2\x86\x9a" },
+    { "&nleftrightarrow;", 17, { 8622, 0 }, 3, "\xe2\x86\xae" },
+    { "&nleq;", 6, { 8816, 0 }, 3, "\xe2\x89\xb0" },
+    { "&nleqq;", 7, { 8806, 824 }, 5, "\xe2\x89\xa6\xcc\xb8" },
+    { "&nleqslant;", 11, { 10877, 824 }, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&nles;", 6, { 10877, 824 }, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&nless;", 7, { 8814, 0 }, 3, "\xe2\x89\xae" },
+    { "&nlsim;", 7, { 8820, 0 }, 3, "\xe2\x89\xb4" },
+    { "&nlt;", 5, { 8814, 0 }, 3, "\xe2\x89\xae" },
+    { "&nltri;", 7, { 8938, 0 }, 3, "\xe2\x8b\xaa" },
+    { "&nltrie;", 8, { 8940, 0 }, 3, "\xe2\x8b\xac" },
+    { "&nmid;", 6, { 8740, 0 }, 3, "\xe2\x88\xa4" },
+    { "&nopf;", 6, { 120159, 0 }, 4, "\xf0\x9d\x95\x9f" },
+    { "&not;", 5, { 172, 0 }, 2, "\xc2\xac" },
+    { "&notin;", 7, { 8713, 0 }, 3, "\xe2\x88\x89" },
+    { "&notinE;", 8, { 8953, 824 }, 5, "\xe2\x8b\xb9\xcc\xb8" },
+    { "&notindot;", 10, { 8949, 824 }, 5, "\xe2\x8b\xb5\xcc\xb8" },
+    { "&notinva;", 9, { 8713, 0 }, 3, "\xe2\x88\x89" },
+    { "&notinvb;", 9, { 8951, 0 }, 3, "\xe2\x8b\xb7" },
+    { "&notinvc;", 9, { 8950, 0 }, 3, "\xe2\x8b\xb6" },
+    { "&notni;", 7, { 8716, 0 }, 3, "\xe2\x88\x8c" },
+    { "&notniva;", 9, { 8716, 0 }, 3, "\xe2\x88\x8c" },
+    { "&notnivb;", 9, { 8958, 0 }, 3, "\xe2\x8b\xbe" },
+    { "&notnivc;", 9, { 8957, 0 }, 3, "\xe2\x8b\xbd" },
+    { "&npar;", 6, { 8742, 0 }, 3, "\xe2\x88\xa6" },
+    { "&nparallel;", 11, { 8742, 0 }, 3, "\xe2\x88\xa6" },
+    { "&nparsl;", 8, { 11005, 8421 }, 6, "\xe2\xab\xbd\xe2\x83\xa5" },
+    { "&npart;", 7, { 8706, 824 }, 5, "\xe2\x88\x82\xcc\xb8" },
+    { "&npolint;", 9, { 10772, 0 }, 3, "\xe2\xa8\x94" },
+    { "&npr;", 5, { 8832, 0 }, 3, "\xe2\x8a\x80" },
+    { "&nprcue;", 8, { 8928, 0 }, 3, "\xe2\x8b\xa0" },
+    { "&npre;", 6, { 10927, 824 }, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&nprec;", 7, { 8832, 0 }, 3, "\xe2\x8a\x80" },
+    { "&npreceq;", 9, { 10927, 824 }, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&nrArr;", 7, { 8655, 0 }, 3, "\xe2\x87\x8f" },
+    { "&nrarr;", 7, { 8603, 0 }, 3, "\xe2\x86\x9b" },
+    { "&nrarrc;", 8, { 10547, 824 }, 5, "\xe2\xa4\xb3\xcc\xb8" },
+    { "&nrarrw;", 8, { 8605, 824 }, 5, "\xe2\x86\x9d\xcc\xb8" },
+    { "&nrightarrow;", 13, { 8603, 0 }, 3, "\xe2\x86\x9b" },
+    { "&nrtri;", 7, { 8939, 0 }, 3, "\xe2\x8b\xab" },
+    { "&nrtrie;", 8, { 8941, 0 }, 3, "\xe2\x8b\xad" },
+    { "&nsc;", 5, { 8833, 0 }, 3, "\xe2\x8a\x81" },
+    { "&nsccue;", 8, { 8929, 0 }, 3, "\xe2\x8b\xa1" },
+    { "&nsce;", 6, { 10928, 824 }, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&nscr;", 6, { 120003, 0 }, 4, "\xf0\x9d\x93\x83" },
+    { "&nshortmid;", 11, { 8740, 0 }, 3, "\xe2\x88\xa4" },
+    { "&nshortparallel;", 16, { 8742, 0 }, 3, "\xe2\x88\xa6" },
+    { "&nsim;", 6, { 8769, 0 }, 3, "\xe2\x89\x81" },
+    { "&nsime;", 7, { 8772, 0 }, 3, "\xe2\x89\x84" },
+    { "&nsimeq;", 8, { 8772, 0 }, 3, "\xe2\x89\x84" },
+    { "&nsmid;", 7, { 8740, 0 }, 3, "\xe2\x88\xa4" },
+    { "&nspar;", 7, { 8742, 0 }, 3, "\xe2\x88\xa6" },
+    { "&nsqsube;", 9, { 8930, 0 }, 3, "\xe2\x8b\xa2" },
+    { "&nsqsupe;", 9, { 8931, 0 }, 3, "\xe2\x8b\xa3" },
+    { "&nsub;", 6, { 8836, 0 }, 3, "\xe2\x8a\x84" },
+    { "&nsubE;", 7, { 10949, 824 }, 5, "\xe2\xab\x85\xcc\xb8" },
+    { "&nsube;", 7, { 8840, 0 }, 3, "\xe2\x8a\x88" },
+    { "&nsubset;", 9, { 8834, 8402 }, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&nsubseteq;", 11, { 8840, 0 }, 3, "\xe2\x8a\x88" },
+    { "&nsubseteqq;", 12, { 10949, 824 }, 5, "\xe2\xab\x85\xcc\xb8" },
+    { "&nsucc;", 7, { 8833, 0 }, 3, "\xe2\x8a\x81" },
+    { "&nsucceq;", 9, { 10928, 824 }, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&nsup;", 6, { 8837, 0 }, 3, "\xe2\x8a\x85" },
+    { "&nsupE;", 7, { 10950, 824 }, 5, "\xe2\xab\x86\xcc\xb8" },
+    { "&nsupe;", 7, { 8841, 0 }, 3, "\xe2\x8a\x89" },
+    { "&nsupset;", 9, { 8835, 8402 }, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&nsupseteq;", 11, { 8841, 0 }, 3, "\xe2\x8a\x89" },
+    { "&nsupseteqq;", 12, { 10950, 824 }, 5, "\xe2\xab\x86\xcc\xb8" },
+    { "&ntgl;", 6, { 8825, 0 }, 3, "\xe2\x89\xb9" },
+    { "&ntilde;", 8, { 241, 0 }, 2, "\xc3\xb1" },
+    { "&ntlg;", 6, { 8824, 0 }, 3, "\xe2\x89\xb8" },
+    { "&ntriangleleft;", 15, { 8938, 0 }, 3, "\xe2\x8b\xaa" },
+    { "&ntrianglelefteq;", 17, { 8940, 0 }, 3, "\xe2\x8b\xac" },
+    { "&ntriangleright;", 16, { 8939, 0 }, 3, "\xe2\x8b\xab" },
+    { "&ntrianglerighteq;", 18, { 8941, 0 }, 3, "\xe2\x8b\xad" },
+    { "&nu;", 4, { 957, 0 }, 2, "\xce\xbd" },
+    { "&num;", 5, { 35, 0 }, 1, "\x23" },
+    { "&numero;", 8, { 8470, 0 }, 3, "\xe2\x84\x96" },
+    { "&numsp;", 7, { 8199, 0 }, 3, "\xe2\x80\x87" },
+    { "&nvDash;", 8, { 8877, 0 }, 3, "\xe2\x8a\xad" },
+    { "&nvHarr;", 8, { 10500, 0 }, 3, "\xe2\xa4\x84" },
+    { "&nvap;", 6, { 8781, 8402 }, 6, "\xe2\x89\x8d\xe2\x83\x92" },
+    { "&nvdash;", 8, { 8876, 0 }, 3, "\xe2\x8a\xac" },
+    { "&nvge;", 6, { 8805, 8402 }, 6, "\xe2\x89\xa5\xe2\x83\x92" },
+    { "&nvgt;", 6, { 62, 8402 }, 4, "\x3e\xe2\x83\x92" },
+    { "&nvinfin;", 9, { 10718, 0 }, 3, "\xe2\xa7\x9e" },
+    { "&nvlArr;", 8, { 10498, 0 }, 3, "\xe2\xa4\x82" },
+    { "&nvle;", 6, { 8804, 8402 }, 6, "\xe2\x89\xa4\xe2\x83\x92" },
+    { "&nvlt;", 6, { 60, 8402 }, 4, "\x3c\xe2\x83\x92" },
+    { "&nvltrie;", 9, { 8884, 8402 }, 6, "\xe2\x8a\xb4\xe2\x83\x92" },
+    { "&nvrArr;", 8, { 10499, 0 }, 3, "\xe2\xa4\x83" },
+    { "&nvrtrie;", 9, { 8885, 8402 }, 6, "\xe2\x8a\xb5\xe2\x83\x92" },
+    { "&nvsim;", 7, { 8764, 8402 }, 6, "\xe2\x88\xbc\xe2\x83\x92" },
+    { "&nwArr;", 7, { 8662, 0 }, 3, "\xe2\x87\x96" },
+    { "&nwarhk;", 8, { 10531, 0 }, 3, "\xe2\xa4\xa3" },
+    { "&nwarr;", 7, { 8598, 0 }, 3, "\xe2\x86\x96" },
+    { "&nwarrow;", 9, { 8598, 0 }, 3, "\xe2\x86\x96" },
+    { "&nwnear;", 8, { 10535, 0 }, 3, "\xe2\xa4\xa7" },
+    { "&oS;", 4, { 9416, 0 }, 3, "\xe2\x93\x88" },
+    { "&oacute;", 8, { 243, 0 }, 2, "\xc3\xb3" },
+    { "&oast;", 6, { 8859, 0 }, 3, "\xe2\x8a\x9b" },
+    { "&ocir;", 6, { 8858, 0 }, 3, "\xe2\x8a\x9a" },
+    { "&ocirc;", 7, { 244, 0 }, 2, "\xc3\xb4" },
+    { "&ocy;", 5, { 1086, 0 }, 2, "\xd0\xbe" },
+    { "&odash;", 7, { 8861, 0 }, 3, "\xe2\x8a\x9d" },
+    { "&odblac;", 8, { 337, 0 }, 2, "\xc5\x91" },
+    { "&odiv;", 6, { 10808, 0 }, 3, "\xe2\xa8\xb8" },
+    { "&odot;", 6, { 8857, 0 }, 3, "\xe2\x8a\x99" },
+    { "&odsold;", 8, { 10684, 0 }, 3, "\xe2\xa6\xbc" },
+    { "&oelig;", 7, { 339, 0 }, 2, "\xc5\x93" },
+    { "&ofcir;", 7, { 10687, 0 }, 3, "\xe2\xa6\xbf" },
+    { "&ofr;", 5, { 120108, 0 }, 4, "\xf0\x9d\x94\xac" },
+    { "&ogon;", 6, { 731, 0 }, 2, "\xcb\x9b" },
+    { "&ograve;", 8, { 242, 0 }, 2, "\xc3\xb2" },
+    { "&ogt;", 5, { 10689, 0 }, 3, "\xe2\xa7\x81" },
+    { "&ohbar;", 7, { 10677, 0 }, 3, "\xe2\xa6\xb5" },
+    { "&ohm;", 5, { 937, 0 }, 2, "\xce\xa9" },
+    { "&oint;", 6, { 8750, 0 }, 3, "\xe2\x88\xae" },
+    { "&olarr;", 7, { 8634, 0 }, 3, "\xe2\x86\xba" },
+    { "&olcir;", 7, { 10686, 0 }, 3, "\xe2\xa6\xbe" },
+    { "&olcross;", 9, { 10683, 0 }, 3, "\xe2\xa6\xbb" },
+    { "&oline;", 7, { 8254, 0 }, 3, "\xe2\x80\xbe" },
+    { "&olt;", 5, { 10688, 0 }, 3, "\xe2\xa7\x80" },
+    { "&omacr;", 7, { 333, 0 }, 2, "\xc5\x8d" },
+    { "&omega;", 7, { 969, 0 }, 2, "\xcf\x89" },
+    { "&omicron;", 9, { 959, 0 }, 2, "\xce\xbf" },
+    { "&omid;", 6, { 10678, 0 }, 3, "\xe2\xa6\xb6" },
+    { "&ominus;", 8, { 8854, 0 }, 3, "\xe2\x8a\x96" },
+    { "&oopf;", 6, { 120160, 0 }, 4, "\xf0\x9d\x95\xa0" },
+    { "&opar;", 6, { 10679, 0 }, 3, "\xe2\xa6\xb7" },
+    { "&operp;", 7, { 10681, 0 }, 3, "\xe2\xa6\xb9" },
+    { "&oplus;", 7, { 8853, 0 }, 3, "\xe2\x8a\x95" },
+    { "&or;", 4, { 8744, 0 }, 3, "\xe2\x88\xa8" },
+    { "&orarr;", 7, { 8635, 0 }, 3, "\xe2\x86\xbb" },
+    { "&ord;", 5, { 10845, 0 }, 3, "\xe2\xa9\x9d" },
+    { "&order;", 7, { 8500, 0 }, 3, "\xe2\x84\xb4" },
+    { "&orderof;", 9, { 8500, 0 }, 3, "\xe2\x84\xb4" },
+    { "&ordf;", 6, { 170, 0 }, 2, "\xc2\xaa" },
+    { "&ordm;", 6, { 186, 0 }, 2, "\xc2\xba" },
+    { "&origof;", 8, { 8886, 0 }, 3, "\xe2\x8a\xb6" },
+    { "&oror;", 6, { 10838, 0 }, 3, "\xe2\xa9\x96" },
+    { "&orslope;", 9, { 10839, 0 }, 3, "\xe2\xa9\x97" },
+    { "&orv;", 5, { 10843, 0 }, 3, "\xe2\xa9\x9b" },
+    { "&oscr;", 6, { 8500, 0 }, 3, "\xe2\x84\xb4" },
+    { "&oslash;", 8, { 248, 0 }, 2, "\xc3\xb8" },
+    { "&osol;", 6, { 8856, 0 }, 3, "\xe2\x8a\x98" },
+    { "&otilde;", 8, { 245, 0 }, 2, "\xc3\xb5" },
+    { "&otimes;", 8, { 8855, 0 }, 3, "\xe2\x8a\x97" },
+    { "&otimesas;", 10, { 10806, 0 }, 3, "\xe2\xa8\xb6" },
+    { "&ouml;", 6, { 246, 0 }, 2, "\xc3\xb6" },
+    { "&ovbar;", 7, { 9021, 0 }, 3, "\xe2\x8c\xbd" },
+    { "&par;", 5, { 8741, 0 }, 3, "\xe2\x88\xa5" },
+    { "&para;", 6, { 182, 0 }, 2, "\xc2\xb6" },
+    { "&parallel;", 10, { 8741, 0 }, 3, "\xe2\x88\xa5" },
+    { "&parsim;", 8, { 10995, 0 }, 3, "\xe2\xab\xb3" },
+    { "&parsl;", 7, { 11005, 0 }, 3, "\xe2\xab\xbd" },
+    { "&part;", 6, { 8706, 0 }, 3, "\xe2\x88\x82" },
+    { "&pcy;", 5, { 1087, 0 }, 2, "\xd0\xbf" },
+    { "&percnt;", 8, { 37, 0 }, 1, "\x25" },
+    { "&period;", 8, { 46, 0 }, 1, "\x2e" },
+    { "&permil;", 8, { 8240, 0 }, 3, "\xe2\x80\xb0" },
+    { "&perp;", 6, { 8869, 0 }, 3, "\xe2\x8a\xa5" },
+    { "&pertenk;", 9, { 8241, 0 }, 3, "\xe2\x80\xb1" },
+    { "&pfr;", 5, { 120109, 0 }, 4, "\xf0\x9d\x94\xad" },
+    { "&phi;", 5, { 966, 0 }, 2, "\xcf\x86" },
+    { "&phiv;", 6, { 981, 0 }, 2, "\xcf\x95" },
+    { "&phmmat;", 8, { 8499, 0 }, 3, "\xe2\x84\xb3" },
+    { "&phone;", 7, { 9742, 0 }, 3, "\xe2\x98\x8e" },
+    { "&pi;", 4, { 960, 0 }, 2, "\xcf\x80" },
+    { "&pitchfork;", 11, { 8916, 0 }, 3, "\xe2\x8b\x94" },
+    { "&piv;", 5, { 982, 0 }, 2, "\xcf\x96" },
+    { "&planck;", 8, { 8463, 0 }, 3, "\xe2\x84\x8f" },
+    { "&planckh;", 9, { 8462, 0 }, 3, "\xe2\x84\x8e" },
+    { "&plankv;", 8, { 8463, 0 }, 3, "\xe2\x84\x8f" },
+    { "&plus;", 6, { 43, 0 }, 1, "\x2b" },
+    { "&plusacir;", 10, { 10787, 0 }, 3, "\xe2\xa8\xa3" },
+    { "&plusb;", 7, { 8862, 0 }, 3, "\xe2\x8a\x9e" },
+    { "&pluscir;", 9, { 10786, 0 }, 3, "\xe2\xa8\xa2" },
+    { "&plusdo;", 8, { 8724, 0 }, 3, "\xe2\x88\x94" },
+    { "&plusdu;", 8, { 10789, 0 }, 3, "\xe2\xa8\xa5" },
+    { "&pluse;", 7, { 10866, 0 }, 3, "\xe2\xa9\xb2" },
+    { "&plusmn;", 8, { 177, 0 }, 2, "\xc2\xb1" },
+    { "&plussim;", 9, { 10790, 0 }, 3, "\xe2\xa8\xa6" },
+    { "&plustwo;", 9, { 10791, 0 }, 3, "\xe2\xa8\xa7" },
+    { "&pm;", 4, { 177, 0 }, 2, "\xc2\xb1" },
+    { "&pointint;", 10, { 10773, 0 }, 3, "\xe2\xa8\x95" },
+    { "&popf;", 6, { 120161, 0 }, 4, "\xf0\x9d\x95\xa1" },
+    { "&pound;", 7, { 163, 0 }, 2, "\xc2\xa3" },
+    { "&pr;", 4, { 8826, 0 }, 3, "\xe2\x89\xba" },
+    { "&prE;", 5, { 10931, 0 }, 3, "\xe2\xaa\xb3" },
+    { "&prap;", 6, { 10935, 0 }, 3, "\xe2\xaa\xb7" },
+    { "&prcue;", 7, { 8828, 0 }, 3, "\xe2\x89\xbc" },
+    { "&pre;", 5, { 10927, 0 }, 3, "\xe2\xaa\xaf" },
+    { "&prec;", 6, { 8826, 0 }, 3, "\xe2\x89\xba" },
+    { "&precapprox;", 12, { 10935, 0 }, 3, "\xe2\xaa\xb7" },
+    { "&preccurlyeq;", 13, { 8828, 0 }, 3, "\xe2\x89\xbc" },
+    { "&preceq;", 8, { 10927, 0 }, 3, "\xe2\xaa\xaf" },
+    { "&precnapprox;", 13, { 10937, 0 }, 3, "\xe2\xaa\xb9" },
+    { "&precneqq;", 10, { 10933, 0 }, 3, "\xe2\xaa\xb5" },
+    { "&precnsim;", 10, { 8936, 0 }, 3, "\xe2\x8b\xa8" },
+    { "&precsim;", 9, { 8830, 0 }, 3, "\xe2\x89\xbe" },
+    { "&prime;", 7, { 8242, 0 }, 3, "\xe2\x80\xb2" },
+    { "&primes;", 8, { 8473, 0 }, 3, "\xe2\x84\x99" },
+    { "&prnE;", 6, { 10933, 0 }, 3, "\xe2\xaa\xb5" },
+    { "&prnap;", 7, { 10937, 0 }, 3, "\xe2\xaa\xb9" },
+    { "&prnsim;", 8, { 8936, 0 }, 3, "\xe2\x8b\xa8" },
+    { "&prod;", 6, { 8719, 0 }, 3, "\xe2\x88\x8f" },
+    { "&profalar;", 10, { 9006, 0 }, 3, "\xe2\x8c\xae" },
+    { "&profline;", 10, { 8978, 0 }, 3, "\xe2\x8c\x92" },
+    { "&profsurf;", 10, { 8979, 0 }, 3, "\xe2\x8c\x93" },
+    { "&prop;", 6, { 8733, 0 }, 3, "\xe2\x88\x9d" },
+    { "&propto;", 8, { 8733, 0 }, 3, "\xe2\x88\x9d" },
+    { "&prsim;", 7, { 8830, 0 }, 3, "\xe2\x89\xbe" },
+    { "&prurel;", 8, { 8880, 0 }, 3, "\xe2\x8a\xb0" },
+    { "&pscr;", 6, { 120005, 0 }, 4, "\xf0\x9d\x93\x85" },
+    { "&psi;", 5, { 968, 0 }, 2, "\xcf\x88" },
+    { "&puncsp;", 8, { 8200, 0 }, 3, "\xe2\x80\x88" },
+    { "&qfr;", 5, { 120110, 0 }, 4, "\xf0\x9d\x94\xae" },
+    { "&qint;", 6, { 10764, 0 }, 3, "\xe2\xa8\x8c" },
+    { "&qopf;", 6, { 120162, 0 }, 4, "\xf0\x9d\x95\xa2" },
+    { "&qprime;", 8, { 8279, 0 }, 3, "\xe2\x81\x97" },
+    { "&qscr;", 6, { 120006, 0 }, 4, "\xf0\x9d\x93\x86" },
+    { "&quaternions;", 13, { 8461, 0 }, 3, "\xe2\x84\x8d" },
+    { "&quatint;", 9, { 10774, 0 }, 3, "\xe2\xa8\x96" },
+    { "&quest;", 7, { 63, 0 }, 1, "\x3f" },
+    { "&questeq;", 9, { 8799, 0 }, 3, "\xe2\x89\x9f" },
+    { "&quot;", 6, { 34, 0 }, 1, "\x22" },
+    { "&rAarr;", 7, { 8667, 0 }, 3, "\xe2\x87\x9b" },
+    { "&rArr;", 6, { 8658, 0 }, 3, "\xe2\x87\x92" },
+    { "&rAtail;", 8, { 10524, 0 }, 3, "\xe2\xa4\x9c" },
+    { "&rBarr;", 7, { 10511, 0 }, 3, "\xe2\xa4\x8f" },
+    { "&rHar;", 6, { 10596, 0 }, 3, "\xe2\xa5\xa4" },
+    { "&race;", 6, { 8765, 817 }, 5, "\xe2\x88\xbd\xcc\xb1" },
+    { "&racute;", 8, { 341, 0 }, 2, "\xc5\x95" },
+    { "&radic;", 7, { 8730, 0 }, 3, "\xe2\x88\x9a" },
+    { "&raemptyv;", 10, { 10675, 0 }, 3, "\xe2\xa6\xb3" },
+    { "&rang;", 6, { 10217, 0 }, 3, "\xe2\x9f\xa9" },
+    { "&rangd;", 7, { 10642, 0 }, 3, "\xe2\xa6\x92" },
+    { "&range;", 7, { 10661, 0 }, 3, "\xe2\xa6\xa5" },
+    { "&rangle;", 8, { 10217, 0 }, 3, "\xe2\x9f\xa9" },
+    { "&raquo;", 7, { 187, 0 }, 2, "\xc2\xbb" },
+    { "&rarr;", 6, { 8594, 0 }, 3, "\xe2\x86\x92" },
+    { "&rarrap;", 8, { 10613, 0 }, 3, "\xe2\xa5\xb5" },
+    { "&rarrb;", 7, { 8677, 0 }, 3, "\xe2\x87\xa5" },
+    { "&rarrbfs;", 9, { 10528, 0 }, 3, "\xe2\xa4\xa0" },
+    { "&rarrc;", 7, { 10547, 0 }, 3, "\xe2\xa4\xb3" },
+    { "&rarrfs;", 8, { 10526, 0 }, 3, "\xe2\xa4\x9e" },
+    { "&rarrhk;", 8, { 8618, 0 }, 3, "\xe2\x86\xaa" },
+    { "&rarrlp;", 8, { 8620, 0 }, 3, "\xe2\x86\xac" },
+    { "&rarrpl;", 8, { 10565, 0 }, 3, "\xe2\xa5\x85" },
+    { "&rarrsim;", 9, { 10612, 0 }, 3, "\xe2\xa5\xb4" },
+    { "&rarrtl;", 8, { 8611, 0 }, 3, "\xe2\x86\xa3" },
+    { "&rarrw;", 7, { 8605, 0 }, 3, "\xe2\x86\x9d" },
+    { "&ratail;", 8, { 10522, 0 }, 3, "\xe2\xa4\x9a" },
+    { "&ratio;", 7, { 8758, 0 }, 3, "\xe2\x88\xb6" },
+    { "&rationals;", 11, { 8474, 0 }, 3, "\xe2\x84\x9a" },
+    { "&rbarr;", 7, { 10509, 0 }, 3, "\xe2\xa4\x8d" },
+    { "&rbbrk;", 7, { 10099, 0 }, 3, "\xe2\x9d\xb3" },
+    { "&rbrace;", 8, { 125, 0 }, 1, "\x7d" },
+    { "&rbrack;", 8, { 93, 0 }, 1, "\x5d" },
+    { "&rbrke;", 7, { 10636, 0 }, 3, "\xe2\xa6\x8c" },
+    { "&rbrksld;", 9, { 10638, 0 }, 3, "\xe2\xa6\x8e" },
+    { "&rbrkslu;", 9, { 10640, 0 }, 3, "\xe2\xa6\x90" },
+    { "&rcaron;", 8, { 345, 0 }, 2, "\xc5\x99" },
+    { "&rcedil;", 8, { 343, 0 }, 2, "\xc5\x97" },
+    { "&rceil;", 7, { 8969, 0 }, 3, "\xe2\x8c\x89" },
+    { "&rcub;", 6, { 125, 0 }, 1, "\x7d" },
+    { "&rcy;", 5, { 1088, 0 }, 2, "\xd1\x80" },
+    { "&rdca;", 6, { 10551, 0 }, 3, "\xe2\xa4\xb7" },
+    { "&rdldhar;", 9, { 10601, 0 }, 3, "\xe2\xa5\xa9" },
+    { "&rdquo;", 7, { 8221, 0 }, 3, "\xe2\x80\x9d" },
+    { "&rdquor;", 8, { 8221, 0 }, 3, "\xe2\x80\x9d" },
+    { "&rdsh;", 6, { 8627, 0 }, 3, "\xe2\x86\xb3" },
+    { "&real;", 6, { 8476, 0 }, 3, "\xe2\x84\x9c" },
+    { "&realine;", 9, { 8475, 0 }, 3, "\xe2\x84\x9b" },
+    { "&realpart;", 10, { 8476, 0 }, 3, "\xe2\x84\x9c" },
+    { "&reals;", 7, { 8477, 0 }, 3, "\xe2\x84\x9d" },
+    { "&rect;", 6, { 9645, 0 }, 3, "\xe2\x96\xad" },
+    { "&reg;", 5, { 174, 0 }, 2, "\xc2\xae" },
+    { "&rfisht;", 8, { 10621, 0 }, 3, "\xe2\xa5\xbd" },
+    { "&rfloor;", 8, { 8971, 0 }, 3, "\xe2\x8c\x8b" },
+    { "&rfr;", 5, { 120111, 0 }, 4, "\xf0\x9d\x94\xaf" },
+    { "&rhard;", 7, { 8641, 0 }, 3, "\xe2\x87\x81" },
+    { "&rharu;", 7, { 8640, 0 }, 3, "\xe2\x87\x80" },
+    { "&rharul;", 8, { 10604, 0 }, 3, "\xe2\xa5\xac" },
+    { "&rho;", 5, { 961, 0 }, 2, "\xcf\x81" },
+    { "&rhov;", 6, { 1009, 0 }, 2, "\xcf\xb1" },
+    { "&rightarrow;", 12, { 8594, 0 }, 3, "\xe2\x86\x92" },
+    { "&rightarrowtail;", 16, { 8611, 0 }, 3, "\xe2\x86\xa3" },
+    { "&rightharpoondown;", 18, { 8641, 0 }, 3, "\xe2\x87\x81" },
+    { "&rightharpoonup;", 16, { 8640, 0 }, 3, "\xe2\x87\x80" },
+    { "&rightleftarrows;", 17, { 8644, 0 }, 3, "\xe2\x87\x84" },
+    { "&rightleftharpoons;", 19, { 8652, 0 }, 3, "\xe2\x87\x8c" },
+    { "&rightrightarrows;", 18, { 8649, 0 }, 3, "\xe2\x87\x89" },
+    { "&rightsquigarrow;", 17, { 8605, 0 }, 3, "\xe2\x86\x9d" },
+    { "&rightthreetimes;", 17, { 8908, 0 }, 3, "\xe2\x8b\x8c" },
+    { "&ring;", 6, { 730, 0 }, 2, "\xcb\x9a" },
+    { "&risingdotseq;", 14, { 8787, 0 }, 3, "\xe2\x89\x93" },
+    { "&rlarr;", 7, { 8644, 0 }, 3, "\xe2\x87\x84" },
+    { "&rlhar;", 7, { 8652, 0 }, 3, "\xe2\x87\x8c" },
+    { "&rlm;", 5, { 8207, 0 }, 3, "\xe2\x80\x8f" },
+    { "&rmoust;", 8, { 9137, 0 }, 3, "\xe2\x8e\xb1" },
+    { "&rmoustache;", 12, { 9137, 0 }, 3, "\xe2\x8e\xb1" },
+    { "&rnmid;", 7, { 10990, 0 }, 3, "\xe2\xab\xae" },
+    { "&roang;", 7, { 10221, 0 }, 3, "\xe2\x9f\xad" },
+    { "&roarr;", 7, { 8702, 0 }, 3, "\xe2\x87\xbe" },
+    { "&robrk;", 7, { 10215, 0 }, 3, "\xe2\x9f\xa7" },
+    { "&ropar;", 7, { 10630, 0 }, 3, "\xe2\xa6\x86" },
+    { "&ropf;", 6, { 120163, 0 }, 4, "\xf0\x9d\x95\xa3" },
+    { "&roplus;", 8, { 10798, 0 }, 3, "\xe2\xa8\xae" },
+    { "&rotimes;", 9, { 10805, 0 }, 3, "\xe2\xa8\xb5" },
+    { "&rpar;", 6, { 41, 0 }, 1, "\x29" },
+    { "&rpargt;", 8, { 10644, 0 }, 3, "\xe2\xa6\x94" },
+    { "&rppolint;", 10, { 10770, 0 }, 3, "\xe2\xa8\x92" },
+    { "&rrarr;", 7, { 8649, 0 }, 3, "\xe2\x87\x89" },
+    { "&rsaquo;", 8, { 8250, 0 }, 3, "\xe2\x80\xba" },
+    { "&rscr;", 6, { 120007, 0 }, 4, "\xf0\x9d\x93\x87" },
+    { "&rsh;", 5, { 8625, 0 }, 3, "\xe2\x86\xb1" },
+    { "&rsqb;", 6, { 93, 0 }, 1, "\x5d" },
+    { "&rsquo;", 7, { 8217, 0 }, 3, "\xe2\x80\x99" },
+    { "&rsquor;", 8, { 8217, 0 }, 3, "\xe2\x80\x99" },
+    { "&rthree;", 8, { 8908, 0 }, 3, "\xe2\x8b\x8c" },
+    { "&rtimes;", 8, { 8906, 0 }, 3, "\xe2\x8b\x8a" },
+    { "&rtri;", 6, { 9657, 0 }, 3, "\xe2\x96\xb9" },
+    { "&rtrie;", 7, { 8885, 0 }, 3, "\xe2\x8a\xb5" },
+    { "&rtrif;", 7, { 9656, 0 }, 3, "\xe2\x96\xb8" },
+    { "&rtriltri;", 10, { 10702, 0 }, 3, "\xe2\xa7\x8e" },
+    { "&ruluhar;", 9, { 10600, 0 }, 3, "\xe2\xa5\xa8" },
+    { "&rx;", 4, { 8478, 0 }, 3, "\xe2\x84\x9e" },
+    { "&sacute;", 8, { 347, 0 }, 2, "\xc5\x9b" },
+    { "&sbquo;", 7, { 8218, 0 }, 3, "\xe2\x80\x9a" },
+    { "&sc;", 4, { 8827, 0 }, 3, "\xe2\x89\xbb" },
+    { "&scE;", 5, { 10932, 0 }, 3, "\xe2\xaa\xb4" },
+    { "&scap;", 6, { 10936, 0 }, 3, "\xe2\xaa\xb8" },
+    { "&scaron;", 8, { 353, 0 }, 2, "\xc5\xa1" },
+    { "&sccue;", 7, { 8829, 0 }, 3, "\xe2\x89\xbd" },
+    { "&sce;", 5, { 10928, 0 }, 3, "\xe2\xaa\xb0" },
+    { "&scedil;", 8, { 351, 0 }, 2, "\xc5\x9f" },
+    { "&scirc;", 7, { 349, 0 }, 2, "\xc5\x9d" },
+    { "&scnE;", 6, { 10934, 0 }, 3, "\xe2\xaa\xb6" },
+    { "&scnap;", 7, { 10938, 0 }, 3, "\xe2\xaa\xba" },
+    { "&scnsim;", 8, { 8937, 0 }, 3, "\xe2\x8b\xa9" },
+    { "&scpolint;", 10, { 10771, 0 }, 3, "\xe2\xa8\x93" },
+    { "&scsim;", 7, { 8831, 0 }, 3, "\xe2\x89\xbf" },
+    { "&scy;", 5, { 1089, 0 }, 2, "\xd1\x81" },
+    { "&sdot;", 6, { 8901, 0 }, 3, "\xe2\x8b\x85" },
+    { "&sdotb;", 7, { 8865, 0 }, 3, "\xe2\x8a\xa1" },
+    { "&sdote;", 7, { 10854, 0 }, 3, "\xe2\xa9\xa6" },
+    { "&seArr;", 7, { 8664, 0 }, 3, "\xe2\x87\x98" },
+    { "&searhk;", 8, { 10533, 0 }, 3, "\xe2\xa4\xa5" },
+    { "&searr;", 7, { 8600, 0 }, 3, "\xe2\x86\x98" },
+    { "&searrow;", 9, { 8600, 0 }, 3, "\xe2\x86\x98" },
+    { "&sect;", 6, { 167, 0 }, 2, "\xc2\xa7" },
+    { "&semi;", 6, { 59, 0 }, 1, "\x3b" },
+    { "&seswar;", 8, { 10537, 0 }, 3, "\xe2\xa4\xa9" },
+    { "&setminus;", 10, { 8726, 0 }, 3, "\xe2\x88\x96" },
+    { "&setmn;", 7, { 8726, 0 }, 3, "\xe2\x88\x96" },
+    { "&sext;", 6, { 10038, 0 }, 3, "\xe2\x9c\xb6" },
+    { "&sfr;", 5, { 120112, 0 }, 4, "\xf0\x9d\x94\xb0" },
+    { "&sfrown;", 8, { 8994, 0 }, 3, "\xe2\x8c\xa2" },
+    { "&sharp;", 7, { 9839, 0 }, 3, "\xe2\x99\xaf" },
+    { "&shchcy;", 8, { 1097, 0 }, 2, "\xd1\x89" },
+    { "&shcy;", 6, { 1096, 0 }, 2, "\xd1\x88" },
+    { "&shortmid;", 10, { 8739, 0 }, 3, "\xe2\x88\xa3" },
+    { "&shortparallel;", 15, { 8741, 0 }, 3, "\xe2\x88\xa5" },
+    { "&shy;", 5, { 173, 0 }, 2, "\xc2\xad" },
+    { "&sigma;", 7, { 963, 0 }, 2, "\xcf\x83" },
+    { "&sigmaf;", 8, { 962, 0 }, 2, "\xcf\x82" },
+    { "&sigmav;", 8, { 962, 0 }, 2, "\xcf\x82" },
+    { "&sim;", 5, { 8764, 0 }, 3, "\xe2\x88\xbc" },
+    { "&simdot;", 8, { 10858, 0 }, 3, "\xe2\xa9\xaa" },
+    { "&sime;", 6, { 8771, 0 }, 3, "\xe2\x89\x83" },
+    { "&simeq;", 7, { 8771, 0 }, 3, "\xe2\x89\x83" },
+    { "&simg;", 6, { 10910, 0 }, 3, "\xe2\xaa\x9e" },
+    { "&simgE;", 7, { 10912, 0 }, 3, "\xe2\xaa\xa0" },
+    { "&siml;", 6, { 10909, 0 }, 3, "\xe2\xaa\x9d" },
+    { "&simlE;", 7, { 10911, 0 }, 3, "\xe2\xaa\x9f" },
+    { "&simne;", 7, { 8774, 0 }, 3, "\xe2\x89\x86" },
+    { "&simplus;", 9, { 10788, 0 }, 3, "\xe2\xa8\xa4" },
+    { "&simrarr;", 9, { 10610, 0 }, 3, "\xe2\xa5\xb2" },
+    { "&slarr;", 7, { 8592, 0 }, 3, "\xe2\x86\x90" },
+    { "&smallsetminus;", 15, { 8726, 0 }, 3, "\xe2\x88\x96" },
+    { "&smashp;", 8, { 10803, 0 }, 3, "\xe2\xa8\xb3" },
+    { "&smeparsl;", 10, { 10724, 0 }, 3, "\xe2\xa7\xa4" },
+    { "&smid;", 6, { 8739, 0 }, 3, "\xe2\x88\xa3" },
+    { "&smile;", 7, { 8995, 0 }, 3, "\xe2\x8c\xa3" },
+    { "&smt;", 5, { 10922, 0 }, 3, "\xe2\xaa\xaa" },
+    { "&smte;", 6, { 10924, 0 }, 3, "\xe2\xaa\xac" },
+    { "&smtes;", 7, { 10924, 65024 }, 6, "\xe2\xaa\xac\xef\xb8\x80" },
+    { "&softcy;", 8, { 1100, 0 }, 2, "\xd1\x8c" },
+    { "&sol;", 5, { 47, 0 }, 1, "\x2f" },
+    { "&solb;", 6, { 10692, 0 }, 3, "\xe2\xa7\x84" },
+    { "&solbar;", 8, { 9023, 0 }, 3, "\xe2\x8c\xbf" },
+    { "&sopf;", 6, { 120164, 0 }, 4, "\xf0\x9d\x95\xa4" },
+    { "&spades;", 8, { 9824, 0 }, 3, "\xe2\x99\xa0" },
+    { "&spadesuit;", 11, { 9824, 0 }, 3, "\xe2\x99\xa0" },
+    { "&spar;", 6, { 8741, 0 }, 3, "\xe2\x88\xa5" },
+    { "&sqcap;", 7, { 8851, 0 }, 3, "\xe2\x8a\x93" },
+    { "&sqcaps;", 8, { 8851, 65024 }, 6, "\xe2\x8a\x93\xef\xb8\x80" },
+    { "&sqcup;", 7, { 8852, 0 }, 3, "\xe2\x8a\x94" },
+    { "&sqcups;", 8, { 8852, 65024 }, 6, "\xe2\x8a\x94\xef\xb8\x80" },
+    { "&sqsub;", 7, { 8847, 0 }, 3, "\xe2\x8a\x8f" },
+    { "&sqsube;", 8, { 8849, 0 }, 3, "\xe2\x8a\x91" },
+    { "&sqsubset;", 10, { 8847, 0 }, 3, "\xe2\x8a\x8f" },
+    { "&sqsubseteq;", 12, { 8849, 0 }, 3, "\xe2\x8a\x91" },
+    { "&sqsup;", 7, { 8848, 0 }, 3, "\xe2\x8a\x90" },
+    { "&sqsupe;", 8, { 8850, 0 }, 3, "\xe2\x8a\x92" },
+    { "&sqsupset;", 10, { 8848, 0 }, 3, "\xe2\x8a\x90" },
+    { "&sqsupseteq;", 12, { 8850, 0 }, 3, "\xe2\x8a\x92" },
+    { "&squ;", 5, { 9633, 0 }, 3, "\xe2\x96\xa1" },
+    { "&square;", 8, { 9633, 0 }, 3, "\xe2\x96\xa1" },
+    { "&squarf;", 8, { 9642, 0 }, 3, "\xe2\x96\xaa" },
+    { "&squf;", 6, { 9642, 0 }, 3, "\xe2\x96\xaa" },
+    { "&srarr;", 7, { 8594, 0 }, 3, "\xe2\x86\x92" },
+    { "&sscr;", 6, { 120008, 0 }, 4, "\xf0\x9d\x93\x88" },
+    { "&ssetmn;", 8, { 8726, 0 }, 3, "\xe2\x88\x96" },
+    { "&ssmile;", 8, { 8995, 0 }, 3, "\xe2\x8c\xa3" },
+    { "&sstarf;", 8, { 8902, 0 }, 3, "\xe2\x8b\x86" },
+    { "&star;", 6, { 9734, 0 }, 3, "\xe2\x98\x86" },
+    { "&starf;", 7, { 9733, 0 }, 3, "\xe2\x98\x85" },
+    { "&straightepsilon;", 17, { 1013, 0 }, 2, "\xcf\xb5" },
+    { "&straightphi;", 13, { 981, 0 }, 2, "\xcf\x95" },
+    { "&strns;", 7, { 175, 0 }, 2, "\xc2\xaf" },
+    { "&sub;", 5, { 8834, 0 }, 3, "\xe2\x8a\x82" },
+    { "&subE;", 6, { 10949, 0 }, 3, "\xe2\xab\x85" },
+    { "&subdot;", 8, { 10941, 0 }, 3, "\xe2\xaa\xbd" },
+    { "&sube;", 6, { 8838, 0 }, 3, "\xe2\x8a\x86" },
+    { "&subedot;", 9, { 10947, 0 }, 3, "\xe2\xab\x83" },
+    { "&submult;", 9, { 10945, 0 }, 3, "\xe2\xab\x81" },
+    { "&subnE;", 7, { 10955, 0 }, 3, "\xe2\xab\x8b" },
+    { "&subne;", 7, { 8842, 0 }, 3, "\xe2\x8a\x8a" },
+    { "&subplus;", 9, { 10943, 0 }, 3, "\xe2\xaa\xbf" },
+    { "&subrarr;", 9, { 10617, 0 }, 3, "\xe2\xa5\xb9" },
+    { "&subset;", 8, { 8834, 0 }, 3, "\xe2\x8a\x82" },
+    { "&subseteq;", 10, { 8838, 0 }, 3, "\xe2\x8a\x86" },
+    { "&subseteqq;", 11, { 10949, 0 }, 3, "\xe2\xab\x85" },
+    { "&subsetneq;", 11, { 8842, 0 }, 3, "\xe2\x8a\x8a" },
+    { "&subsetneqq;", 12, { 10955, 0 }, 3, "\xe2\xab\x8b" },
+    { "&subsim;", 8, { 10951, 0 }, 3, "\xe2\xab\x87" },
+    { "&subsub;", 8, { 10965, 0 }, 3, "\xe2\xab\x95" },
+    { "&subsup;", 8, { 10963, 0 }, 3, "\xe2\xab\x93" },
+    { "&succ;", 6, { 8827, 0 }, 3, "\xe2\x89\xbb" },
+    { "&succapprox;", 12, { 10936, 0 }, 3, "\xe2\xaa\xb8" },
+    { "&succcurlyeq;", 13, { 8829, 0 }, 3, "\xe2\x89\xbd" },
+    { "&succeq;", 8, { 10928, 0 }, 3, "\xe2\xaa\xb0" },
+    { "&succnapprox;", 13, { 10938, 0 }, 3, "\xe2\xaa\xba" },
+    { "&succneqq;", 10, { 10934, 0 }, 3, "\xe2\xaa\xb6" },
+    { "&succnsim;", 10, { 8937, 0 }, 3, "\xe2\x8b\xa9" },
+    { "&succsim;", 9, { 8831, 0 }, 3, "\xe2\x89\xbf" },
+    { "&sum;", 5, { 8721, 0 }, 3, "\xe2\x88\x91" },
+    { "&sung;", 6, { 9834, 0 }, 3, "\xe2\x99\xaa" },
+    { "&sup1;", 6, { 185, 0 }, 2, "\xc2\xb9" },
+    { "&sup2;", 6, { 178, 0 }, 2, "\xc2\xb2" },
+    { "&sup3;", 6, { 179, 0 }, 2, "\xc2\xb3" },
+    { "&sup;", 5, { 8835, 0 }, 3, "\xe2\x8a\x83" },
+    { "&supE;", 6, { 10950, 0 }, 3, "\xe2\xab\x86" },
+    { "&supdot;", 8, { 10942, 0 }, 3, "\xe2\xaa\xbe" },
+    { "&supdsub;", 9, { 10968, 0 }, 3, "\xe2\xab\x98" },
+    { "&supe;", 6, { 8839, 0 }, 3, "\xe2\x8a\x87" },
+    { "&supedot;", 9, { 10948, 0 }, 3, "\xe2\xab\x84" },
+    { "&suphsol;", 9, { 10185, 0 }, 3, "\xe2\x9f\x89" },
+    { "&suphsub;", 9, { 10967, 0 }, 3, "\xe2\xab\x97" },
+    { "&suplarr;", 9, { 10619, 0 }, 3, "\xe2\xa5\xbb" },
+    { "&supmult;", 9, { 10946, 0 }, 3, "\xe2\xab\x82" },
+    { "&supnE;", 7, { 10956, 0 }, 3, "\xe2\xab\x8c" },
+    { "&supne;", 7, { 8843, 0 }, 3, "\xe2\x8a\x8b" },
+    { "&supplus;", 9, { 10944, 0 }, 3, "\xe2\xab\x80" },
+    { "&supset;", 8, { 8835, 0 }, 3, "\xe2\x8a\x83" },
+    { "&supseteq;", 10, { 8839, 0 }, 3, "\xe2\x8a\x87" },
+    { "&supseteqq;", 11, { 10950, 0 }, 3, "\xe2\xab\x86" },
+    { "&supsetneq;", 11, { 8843, 0 }, 3, "\xe2\x8a\x8b" },
+    { "&supsetneqq;", 12, { 10956, 0 }, 3, "\xe2\xab\x8c" },
+    { "&supsim;", 8, { 10952, 0 }, 3, "\xe2\xab\x88" },
+    { "&supsub;", 8, { 10964, 0 }, 3, "\xe2\xab\x94" },
+    { "&supsup;", 8, { 10966, 0 }, 3, "\xe2\xab\x96" },
+    { "&swArr;", 7, { 8665, 0 }, 3, "\xe2\x87\x99" },
+    { "&swarhk;", 8, { 10534, 0 }, 3, "\xe2\xa4\xa6" },
+    { "&swarr;", 7, { 8601, 0 }, 3, "\xe2\x86\x99" },
+    { "&swarrow;", 9, { 8601, 0 }, 3, "\xe2\x86\x99" },
+    { "&swnwar;", 8, { 10538, 0 }, 3, "\xe2\xa4\xaa" },
+    { "&szlig;", 7, { 223, 0 }, 2, "\xc3\x9f" },
+    { "&target;", 8, { 8982, 0 }, 3, "\xe2\x8c\x96" },
+    { "&tau;", 5, { 964, 0 }, 2, "\xcf\x84" },
+    { "&tbrk;", 6, { 9140, 0 }, 3, "\xe2\x8e\xb4" },
+    { "&tcaron;", 8, { 357, 0 }, 2, "\xc5\xa5" },
+    { "&tcedil;", 8, { 355, 0 }, 2, "\xc5\xa3" },
+    { "&tcy;", 5, { 1090, 0 }, 2, "\xd1\x82" },
+    { "&tdot;", 6, { 8411, 0 }, 3, "\xe2\x83\x9b" },
+    { "&telrec;", 8, { 8981, 0 }, 3, "\xe2\x8c\x95" },
+    { "&tfr;", 5, { 120113, 0 }, 4, "\xf0\x9d\x94\xb1" },
+    { "&there4;", 8, { 8756, 0 }, 3, "\xe2\x88\xb4" },
+    { "&therefore;", 11, { 8756, 0 }, 3, "\xe2\x88\xb4" },
+    { "&theta;", 7, { 952, 0 }, 2, "\xce\xb8" },
+    { "&thetasym;", 10, { 977, 0 }, 2, "\xcf\x91" },
+    { "&thetav;", 8, { 977, 0 }, 2, "\xcf\x91" },
+    { "&thickapprox;", 13, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&thicksim;", 10, { 8764, 0 }, 3, "\xe2\x88\xbc" },
+    { "&thinsp;", 8, { 8201, 0 }, 3, "\xe2\x80\x89" },
+    { "&thkap;", 7, { 8776, 0 }, 3, "\xe2\x89\x88" },
+    { "&thksim;", 8, { 8764, 0 }, 3, "\xe2\x88\xbc" },
+    { "&thorn;", 7, { 254, 0 }, 2, "\xc3\xbe" },
+    { "&tilde;", 7, { 732, 0 }, 2, "\xcb\x9c" },
+    { "&times;", 7, { 215, 0 }, 2, "\xc3\x97" },
+    { "&timesb;", 8, { 8864, 0 }, 3, "\xe2\x8a\xa0" },
+    { "&timesbar;", 10, { 10801, 0 }, 3, "\xe2\xa8\xb1" },
+    { "&timesd;", 8, { 10800, 0 }, 3, "\xe2\xa8\xb0" },
+    { "&tint;", 6, { 8749, 0 }, 3, "\xe2\x88\xad" },
+    { "&toea;", 6, { 10536, 0 }, 3, "\xe2\xa4\xa8" },
+    { "&top;", 5, { 8868, 0 }, 3, "\xe2\x8a\xa4" },
+    { "&topbot;", 8, { 9014, 0 }, 3, "\xe2\x8c\xb6" },
+    { "&topcir;", 8, { 10993, 0 }, 3, "\xe2\xab\xb1" },
+    { "&topf;", 6, { 120165, 0 }, 4, "\xf0\x9d\x95\xa5" },
+    { "&topfork;", 9, { 10970, 0 }, 3, "\xe2\xab\x9a" },
+    { "&tosa;", 6, { 10537, 0 }, 3, "\xe2\xa4\xa9" },
+    { "&tprime;", 8, { 8244, 0 }, 3, "\xe2\x80\xb4" },
+    { "&trade;", 7, { 8482, 0 }, 3, "\xe2\x84\xa2" },
+    { "&triangle;", 10, { 9653, 0 }, 3, "\xe2\x96\xb5" },
+    { "&triangledown;", 14, { 9663, 0 }, 3, "\xe2\x96\xbf" },
+    { "&triangleleft;", 14, { 9667, 0 }, 3, "\xe2\x97\x83" },
+    { "&trianglelefteq;", 16, { 8884, 0 }, 3, "\xe2\x8a\xb4" },
+    { "&triangleq;", 11, { 8796, 0 }, 3, "\xe2\x89\x9c" },
+    { "&triangleright;", 15, { 9657, 0 }, 3, "\xe2\x96\xb9" },
+    { "&trianglerighteq;", 17, { 8885, 0 }, 3, "\xe2\x8a\xb5" },
+    { "&tridot;", 8, { 9708, 0 }, 3, "\xe2\x97\xac" },
+    { "&trie;", 6, { 8796, 0 }, 3, "\xe2\x89\x9c" },
+    { "&triminus;", 10, { 10810, 0 }, 3, "\xe2\xa8\xba" },
+    { "&triplus;", 9, { 10809, 0 }, 3, "\xe2\xa8\xb9" },
+    { "&trisb;", 7, { 10701, 0 }, 3, "\xe2\xa7\x8d" },
+    { "&tritime;", 9, { 10811, 0 }, 3, "\xe2\xa8\xbb" },
+    { "&trpezium;", 10, { 9186, 0 }, 3, "\xe2\x8f\xa2" },
+    { "&tscr;", 6, { 120009, 0 }, 4, "\xf0\x9d\x93\x89" },
+    { "&tscy;", 6, { 1094, 0 }, 2, "\xd1\x86" },
+    { "&tshcy;", 7, { 1115, 0 }, 2, "\xd1\x9b" },
+    { "&tstrok;", 8, { 359, 0 }, 2, "\xc5\xa7" },
+    { "&twixt;", 7, { 8812, 0 }, 3, "\xe2\x89\xac" },
+    { "&twoheadleftarrow;", 18, { 8606, 0 }, 3, "\xe2\x86\x9e" },
+    { "&twoheadrightarrow;", 19, { 8608, 0 }, 3, "\xe2\x86\xa0" },
+    { "&uArr;", 6, { 8657, 0 }, 3, "\xe2\x87\x91" },
+    { "&uHar;", 6, { 10595, 0 }, 3, "\xe2\xa5\xa3" },
+    { "&uacute;", 8, { 250, 0 }, 2, "\xc3\xba" },
+    { "&uarr;", 6, { 8593, 0 }, 3, "\xe2\x86\x91" },
+    { "&ubrcy;", 7, { 1118, 0 }, 2, "\xd1\x9e" },
+    { "&ubreve;", 8, { 365, 0 }, 2, "\xc5\xad" },
+    { "&ucirc;", 7, { 251, 0 }, 2, "\xc3\xbb" },
+    { "&ucy;", 5, { 1091, 0 }, 2, "\xd1\x83" },
+    { "&udarr;", 7, { 8645, 0 }, 3, "\xe2\x87\x85" },
+    { "&udblac;", 8, { 369, 0 }, 2, "\xc5\xb1" },
+    { "&udhar;", 7, { 10606, 0 }, 3, "\xe2\xa5\xae" },
+    { "&ufisht;", 8, { 10622, 0 }, 3, "\xe2\xa5\xbe" },
+    { "&ufr;", 5, { 120114, 0 }, 4, "\xf0\x9d\x94\xb2" },
+    { "&ugrave;", 8, { 249, 0 }, 2, "\xc3\xb9" },
+    { "&uharl;", 7, { 8639, 0 }, 3, "\xe2\x86\xbf" },
+    { "&uharr;", 7, { 8638, 0 }, 3, "\xe2\x86\xbe" },
+    { "&uhblk;", 7, { 9600, 0 }, 3, "\xe2\x96\x80" },
+    { "&ulcorn;", 8, { 8988, 0 }, 3, "\xe2\x8c\x9c" },
+    { "&ulcorner;", 10, { 8988, 0 }, 3, "\xe2\x8c\x9c" },
+    { "&ulcrop;", 8, { 8975, 0 }, 3, "\xe2\x8c\x8f" },
+    { "&ultri;", 7, { 9720, 0 }, 3, "\xe2\x97\xb8" },
+    { "&umacr;", 7, { 363, 0 }, 2, "\xc5\xab" },
+    { "&uml;", 5, { 168, 0 }, 2, "\xc2\xa8" },
+    { "&uogon;", 7, { 371, 0 }, 2, "\xc5\xb3" },
+    { "&uopf;", 6, { 120166, 0 }, 4, "\xf0\x9d\x95\xa6" },
+    { "&uparrow;", 9, { 8593, 0 }, 3, "\xe2\x86\x91" },
+    { "&updownarrow;", 13, { 8597, 0 }, 3, "\xe2\x86\x95" },
+    { "&upharpoonleft;", 15, { 8639, 0 }, 3, "\xe2\x86\xbf" },
+    { "&upharpoonright;", 16, { 8638, 0 }, 3, "\xe2\x86\xbe" },
+    { "&uplus;", 7, { 8846, 0 }, 3, "\xe2\x8a\x8e" },
+    { "&upsi;", 6, { 965, 0 }, 2, "\xcf\x85" },
+    { "&upsih;", 7, { 978, 0 }, 2, "\xcf\x92" },
+    { "&upsilon;", 9, { 965, 0 }, 2, "\xcf\x85" },
+    { "&upuparrows;", 12, { 8648, 0 }, 3, "\xe2\x87\x88" },
+    { "&urcorn;", 8, { 8989, 0 }, 3, "\xe2\x8c\x9d" },
+    { "&urcorner;", 10, { 8989, 0 }, 3, "\xe2\x8c\x9d" },
+    { "&urcrop;", 8, { 8974, 0 }, 3, "\xe2\x8c\x8e" },
+    { "&uring;", 7, { 367, 0 }, 2, "\xc5\xaf" },
+    { "&urtri;", 7, { 9721, 0 }, 3, "\xe2\x97\xb9" },
+    { "&uscr;", 6, { 120010, 0 }, 4, "\xf0\x9d\x93\x8a" },
+    { "&utdot;", 7, { 8944, 0 }, 3, "\xe2\x8b\xb0" },
+    { "&utilde;", 8, { 361, 0 }, 2, "\xc5\xa9" },
+    { "&utri;", 6, { 9653, 0 }, 3, "\xe2\x96\xb5" },
+    { "&utrif;", 7, { 9652, 0 }, 3, "\xe2\x96\xb4" },
+    { "&uuarr;", 7, { 8648, 0 }, 3, "\xe2\x87\x88" },
+    { "&uuml;", 6, { 252, 0 }, 2, "\xc3\xbc" },
+    { "&uwangle;", 9, { 10663, 0 }, 3, "\xe2\xa6\xa7" },
+    { "&vArr;", 6, { 8661, 0 }, 3, "\xe2\x87\x95" },
+    { "&vBar;", 6, { 10984, 0 }, 3, "\xe2\xab\xa8" },
+    { "&vBarv;", 7, { 10985, 0 }, 3, "\xe2\xab\xa9" },
+    { "&vDash;", 7, { 8872, 0 }, 3, "\xe2\x8a\xa8" },
+    { "&vangrt;", 8, { 10652, 0 }, 3, "\xe2\xa6\x9c" },
+    { "&varepsilon;", 12, { 1013, 0 }, 2, "\xcf\xb5" },
+    { "&varkappa;", 10, { 1008, 0 }, 2, "\xcf\xb0" },
+    { "&varnothing;", 12, { 8709, 0 }, 3, "\xe2\x88\x85" },
+    { "&varphi;", 8, { 981, 0 }, 2, "\xcf\x95" },
+    { "&varpi;", 7, { 982, 0 }, 2, "\xcf\x96" },
+    { "&varpropto;", 11, { 8733, 0 }, 3, "\xe2\x88\x9d" },
+    { "&varr;", 6, { 8597, 0 }, 3, "\xe2\x86\x95" },
+    { "&varrho;", 8, { 1009, 0 }, 2, "\xcf\xb1" },
+    { "&varsigma;", 10, { 962, 0 }, 2, "\xcf\x82" },
+    { "&varsubsetneq;", 14, { 8842, 65024 }, 6, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "&varsubsetneqq;", 15, { 10955, 65024 }, 6, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "&varsupsetneq;", 14, { 8843, 65024 }, 6, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { "&varsupsetneqq;", 15, { 10956, 65024 }, 6, "\xe2\xab\x8c\xef\xb8\x80" },
+    { "&vartheta;", 10, { 977, 0 }, 2, "\xcf\x91" },
+    { "&vartriangleleft;", 17, { 8882, 0 }, 3, "\xe2\x8a\xb2" },
+    { "&vartriangleright;", 18, { 8883, 0 }, 3, "\xe2\x8a\xb3" },
+    { "&vcy;", 5, { 1074, 0 }, 2, "\xd0\xb2" },
+    { "&vdash;", 7, { 8866, 0 }, 3, "\xe2\x8a\xa2" },
+    { "&vee;", 5, { 8744, 0 }, 3, "\xe2\x88\xa8" },
+    { "&veebar;", 8, { 8891, 0 }, 3, "\xe2\x8a\xbb" },
+    { "&veeeq;", 7, { 8794, 0 }, 3, "\xe2\x89\x9a" },
+    { "&vellip;", 8, { 8942, 0 }, 3, "\xe2\x8b\xae" },
+    { "&verbar;", 8, { 124, 0 }, 1, "\x7c" },
+    { "&vert;", 6, { 124, 0 }, 1, "\x7c" },
+    { "&vfr;", 5, { 120115, 0 }, 4, "\xf0\x9d\x94\xb3" },
+    { "&vltri;", 7, { 8882, 0 }, 3, "\xe2\x8a\xb2" },
+    { "&vnsub;", 7, { 8834, 8402 }, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&vnsup;", 7, { 8835, 8402 }, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&vopf;", 6, { 120167, 0 }, 4, "\xf0\x9d\x95\xa7" },
+    { "&vprop;", 7, { 8733, 0 }, 3, "\xe2\x88\x9d" },
+    { "&vrtri;", 7, { 8883, 0 }, 3, "\xe2\x8a\xb3" },
+    { "&vscr;", 6, { 120011, 0 }, 4, "\xf0\x9d\x93\x8b" },
+    { "&vsubnE;", 8, { 10955, 65024 }, 6, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "&vsubne;", 8, { 8842, 65024 }, 6, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "&vsupnE;", 8, { 10956, 65024 }, 6, "\xe2\xab\x8c\xef\xb8\x80" },
+    { "&vsupne;", 8, { 8843, 65024 }, 6, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { "&vzigzag;", 9, { 10650, 0 }, 3, "\xe2\xa6\x9a" },
+    { "&wcirc;", 7, { 373, 0 }, 2, "\xc5\xb5" },
+    { "&wedbar;", 8, { 10847, 0 }, 3, "\xe2\xa9\x9f" },
+    { "&wedge;", 7, { 8743, 0 }, 3, "\xe2\x88\xa7" },
+    { "&wedgeq;", 8, { 8793, 0 }, 3, "\xe2\x89\x99" },
+    { "&weierp;", 8, { 8472, 0 }, 3, "\xe2\x84\x98" },
+    { "&wfr;", 5, { 120116, 0 }, 4, "\xf0\x9d\x94\xb4" },
+    { "&wopf;", 6, { 120168, 0 }, 4, "\xf0\x9d\x95\xa8" },
+    { "&wp;", 4, { 8472, 0 }, 3, "\xe2\x84\x98" },
+    { "&wr;", 4, { 8768, 0 }, 3, "\xe2\x89\x80" },
+    { "&wreath;", 8, { 8768, 0 }, 3, "\xe2\x89\x80" },
+    { "&wscr;", 6, { 120012, 0 }, 4, "\xf0\x9d\x93\x8c" },
+    { "&xcap;", 6, { 8898, 0 }, 3, "\xe2\x8b\x82" },
+    { "&xcirc;", 7, { 9711, 0 }, 3, "\xe2\x97\xaf" },
+    { "&xcup;", 6, { 8899, 0 }, 3, "\xe2\x8b\x83" },
+    { "&xdtri;", 7, { 9661, 0 }, 3, "\xe2\x96\xbd" },
+    { "&xfr;", 5, { 120117, 0 }, 4, "\xf0\x9d\x94\xb5" },
+    { "&xhArr;", 7, { 10234, 0 }, 3, "\xe2\x9f\xba" },
+    { "&xharr;", 7, { 10231, 0 }, 3, "\xe2\x9f\xb7" },
+    { "&xi;", 4, { 958, 0 }, 2, "\xce\xbe" },
+    { "&xlArr;", 7, { 10232, 0 }, 3, "\xe2\x9f\xb8" },
+    { "&xlarr;", 7, { 10229, 0 }, 3, "\xe2\x9f\xb5" },
+    { "&xmap;", 6, { 10236, 0 }, 3, "\xe2\x9f\xbc" },
+    { "&xnis;", 6, { 8955, 0 }, 3, "\xe2\x8b\xbb" },
+    { "&xodot;", 7, { 10752, 0 }, 3, "\xe2\xa8\x80" },
+    { "&xopf;", 6, { 120169, 0 }, 4, "\xf0\x9d\x95\xa9" },
+    { "&xoplus;", 8, { 10753, 0 }, 3, "\xe2\xa8\x81" },
+    { "&xotime;", 8, { 10754, 0 }, 3, "\xe2\xa8\x82" },
+    { "&xrArr;", 7, { 10233, 0 }, 3, "\xe2\x9f\xb9" },
+    { "&xrarr;", 7, { 10230, 0 }, 3, "\xe2\x9f\xb6" },
+    { "&xscr;", 6, { 120013, 0 }, 4, "\xf0\x9d\x93\x8d" },
+    { "&xsqcup;", 8, { 10758, 0 }, 3, "\xe2\xa8\x86" },
+    { "&xuplus;", 8, { 10756, 0 }, 3, "\xe2\xa8\x84" },
+    { "&xutri;", 7, { 9651, 0 }, 3, "\xe2\x96\xb3" },
+    { "&xvee;", 6, { 8897, 0 }, 3, "\xe2\x8b\x81" },
+    { "&xwedge;", 8, { 8896, 0 }, 3, "\xe2\x8b\x80" },
+    { "&yacute;", 8, { 253, 0 }, 2, "\xc3\xbd" },
+    { "&yacy;", 6, { 1103, 0 }, 2, "\xd1\x8f" },
+    { "&ycirc;", 7, { 375, 0 }, 2, "\xc5\xb7" },
+    { "&ycy;", 5, { 1099, 0 }, 2, "\xd1\x8b" },
+    { "&yen;", 5, { 165, 0 }, 2, "\xc2\xa5" },
+    { "&yfr;", 5, { 120118, 0 }, 4, "\xf0\x9d\x94\xb6" },
+    { "&yicy;", 6, { 1111, 0 }, 2, "\xd1\x97" },
+    { "&yopf;", 6, { 120170, 0 }, 4, "\xf0\x9d\x95\xaa" },
+    { "&yscr;", 6, { 120014, 0 }, 4, "\xf0\x9d\x93\x8e" },
+    { "&yucy;", 6, { 1102, 0 }, 2, "\xd1\x8e" },
+    { "&yuml;", 6, { 255, 0 }, 2, "\xc3\xbf" },
+    { "&zacute;", 8, { 378, 0 }, 2, "\xc5\xba" },
+    { "&zcaron;", 8, { 382, 0 }, 2, "\xc5\xbe" },
+    { "&zcy;", 5, { 1079, 0 }, 2, "\xd0\xb7" },
+    { "&zdot;", 6, { 380, 0 }, 2, "\xc5\xbc" },
+    { "&zeetrf;", 8, { 8488, 0 }, 3, "\xe2\x84\xa8" },
+    { "&zeta;", 6, { 950, 0 }, 2, "\xce\xb6" },
+    { "&zfr;", 5, { 120119, 0 }, 4, "\xf0\x9d\x94\xb7" },
+    { "&zhcy;", 6, { 1078, 0 }, 2, "\xd0\xb6" },
+    { "&zigrarr;", 9, { 8669, 0 }, 3, "\xe2\x87\x9d" },
+    { "&zopf;", 6, { 120171, 0 }, 4, "\xf0\x9d\x95\xab" },
+    { "&zscr;", 6, { 120015, 0 }, 4, "\xf0\x9d\x93\x8f" },
+    { "&zwj;", 5, { 8205, 0 }, 3, "\xe2\x80\x8d" },
+    { "&zwnj;", 6, { 8204, 0 }, 3, "\xe2\x80\x8c" }
 };
 
+#define ENTITY_NAME_MIN_SIZE     4
+#define ENTITY_NAME_MAX_SIZE     33
+#define ENTITY_HASH_SIZE         2125
 
-typedef struct ENTITY_KEY_tag ENTITY_KEY;
-struct ENTITY_KEY_tag {
-    const char* name;
-    size_t name_size;
+static const short ENTITY_HASH_DISPLACEMENTS[ENTITY_HASH_SIZE] = {
+    1, 0, -2124, 0, 0, 2, 0, -2122, -2115, 0, -2112, 0,
+    1, 3, -2105, 3, 0, 0, 2, 0, 3, -2104, 1, 0,
+    0, 1, -2103, 0, -2102, -2101, 1, 0, 0, 0, 4, 0,
+    -2100, -2099, 0, -2095, -2086, 2, 1, 0, 2, 0, 0, 0,
+    2, -2081, 0, -2079, 0, -2078, 3, -2077, 0, -2075, -2074, 0,
+    0, -2067, -2065, 1, 0, 1, -2064, 2, 1, -2060, -2057, -2052,
+    1, 1, 2, 1, 2, 1, 0, 0, -2050, 0, -2049, -2045,
+    1, 1, -2043, 0, -2034, 1, -2027, 1, -2025, 2, 1, -2022,
+    0, -2020, -2015, 0, 0, 1, -2013, -2012, -2009, 0, 2, -2007,
+    -2003, 2, 0, 0, -1999, -1997, 3, -1995, 2, 0, 0, -1991,
+    2, -1990, -1989, -1986, 0, 0, 0, 2, 1, 0, -1985, 1,
+    0, 4, -1984, 0, -1983, -1981, -1980, -1977, -1975, 0, 0, 0,
+    0, 0, -1974, 0, 0, 0, 2, -1968, -1963, 0, 0, 0,
+    1, -1961, 1, 5, -1958, -1949, 1, 3, -1946, -1939, 0, 1,
+    -1938, 0, -1937, -1936, 2, -1935, 2, -1933, 0, 0, 0, 0,
+    3, 1, -1932, 0, 1, -1931, 1, 1, 0, -1927, 4, -1924,
+    0, 1, -1919, -1917, 0, -1916, 1, 0, -1914, -1912, 2, 0,
+    -1908, 7, 0, 5, 0, -1902, 0, 0, 1, 0, 0, 0,
+    -1900, -1898, 0, 0, -1890, 3, 0, 1, -1887, 0, 3, -1883,
+    0, -1882, -1880, 0, -1876, 0, 0, -1875, -1874, -1871, 1, 0,
+    0, 0, 0, -1868, -1864, 1, 0, -1863, -1862, 0, 5, 0,
+    1, 0, -1860, 2, 0, -1858, -1856, 1, 0, -1855, -1854, 0,
+    0, 0, 0, -1848, 4, 0, 0, 0, 2, -1839, -1833, 1,
+    0, 0, 1, 0, 0, -1831, 2, 1, -1829, -1814, 0, -1812,
+    -1811, 0, -1807, -1803, 1, -1797, 3, 2, -1795, 3, -1794, 0,
+    1, 1, 2, 2, 1, -1790, -1788, 4, 2, -1787, 0, -1784,
+    0, -1783, -1782, 0, 0, -1779, 2, -1776, -1770, -1765, 0, 0,
+    0, 0, -1760, 1, 1, 1, 0, 0, 2, 0, -1758, 2,
+    -1755, -1749, -1746, -1743, 0, 5, -1740, 1, -1735, -1734, 0, 2,
+    -1731, 0, 1, 4, 0, 0, 3, -1730, 1, 2, 0, -1727,
+    -1724, 0, 1, 0, 1, 4, -1722, 1, 0, 3, 0, 1,
+    1, 1, 0, -1717, 0, 0, 6, 0, 2, -1714, 1, 0,
+    0, 0, 0, 0, -1713, -1712, -1711, 2, 0, 1, 0, -1709,
+    0, 0, -1704, 0, 0, 2, 0, 1, 0, -1703, 0, -1700,
+    0, 1, -1698, 0, 0, 4, 1, 0, 3, 1, -1695, 4,
+    0, 0, 0, -1694, 0, 1, -1693, -1691, 4, -1689, -1688, -1682,
+    2, 0, 0, 0, 1, -1681, 0, 0, 0, 0, 1, 1,
+    2, 1, -1679, 0, 0, 0, 2, 1, -1677, 0, -1674, 0,
+    0, -1673, 3, 5, -1666, 2, 2, 0, -1665, -1662, 0, 4,
+    0, 0, 0, 0, -1660, -1659, -1656, 0, 0, 0, 3, -1655,
+    2, 0, -1654, -1652, -1650, 0, 4, 0, -1646, 0, 2, 7,
+    0, 1, 0, 0, -1642, 0, 0, 0, 1, 2, -1638, 1,
+    -1632, -1629, -1628, 2, 1, 1, 1, 0, 1, 0, 5, -1625,
+    -1623, 0, -1620, -1619, 4, 0, -1617, -1616, 0, 0, 0, -1614,
+    0, 0, -1612, 0, 5, 1, -1610, 0, 0, 2, -1609, -1607,
+    0, 0, -1604, 2, -1593, 0, -1586, 2, 0, 3, 0, 0,
+    0, -1585, 3, 0, -1583, 0, -1579, 0, 0, 1, -1571, 1,
+    -1569, 5, 2, 0, 0, -1568, 0, 0, -1567, 0, 0, -1564,
+    -1563, 1, -1559, 0, -1558, -1554, 0, -1548, 1, 0, 2, -1543,
+    -1538, 4, 0, -1536, -1534, -1531, 4, 1, 0, 0, -1530, -1528,
+    -1527, 0, -1526, 0, 0, 0, 0, -1524, -1523, 0, 0, 0,
+    0, -1522, 1, 0, -1518, -1517, 0, 0, 0, 5, -1516, 1,
+    0, -1511, 0, 1, 0, 8, 0, 0, 0, 0, 0, -1510,
+    0, 0, 1, -1509, -1508, 1, -1506, 4, 0, 0, 1, 1,
+    1, 1, -1505, 0, 0, 0, -1500, 0, -1497, -1496, -1494, 0,
+    0, -1488, 0, -1487, -1483, 0, -1481, -1478, -1474, 0, -1473, 0,
+    4, 1, 4, -1469, 0, 1, 0, -1466, 0, 0, 0, 10,
+    2, 0, -1462, -1459, 3, 2, 0, -1449, 1, 0, -1448, -1446,
+    -1445, 1, -1436, 0, -1434, 0, 0, 0, -1431, 4, -1429, 0,
+    0, -1426, 0, -1423, -1419, 1, 0, -1418, -1416, -1415, 0, -1413,
+    -1412, 1, -1411, 0, -1409, -1407, -1406, 0, 0, 1, -1403, 1,
+    1, -1402, -1396, 0, -1395, -1394, 1, 0, -1391, 0, 1, 2,
+    2, 0, 0, 2, 4, -1387, 0, 5, 0, -1385, -1384, -1380,
+    2, 0, 0, -1372, -1371, -1367, 0, -1357, -1356, -1354, -1353, 4,
+    1, -1352, 1, 3, 1, 0, -1349, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, -1346, 0, 0, 1, 7, 0, -1345, -1343,
+    4, 4, -1341, 1, 0, -1332, 1, 0, 4, 3, -1329, 0,
+    0, 0, -1328, -1322, 1, -1317, -1310, 0, 2, 0, 0, 0,
+    9, -1309, -1307, 1, 1, -1306, 0, 1, -1305, -1304, 0, 0,
+    -1298, -1297, -1294, 0, 0, 0, 4, 2, 1, -1293, 0, 2,
+    4, 0, 0, 0, -1292, 0, 1, -1288, 1, -1276, -1275, 0,
+    -1274, 1, 5, 1, 1, 1, -1273, 0, -1266, 0, 0, -1265,
+    -1262, -1261, -1260, 2, 0, 0, 1, 2, 0, -1258, 0, -1257,
+    0, 2, -1255, 0, 3, 1, 0, 0, 1, 0, 0, -1254,
+    -1253, 0, -1252, -1243, -1236, 1, -1234, 2, -1233, -1232, 0, 0,
+    1, -1230, 0, 0, -1229, -1221, 1, -1220, 3, -1219, -1218, -1217,
+    -1216, -1213, -1212, 0, -1211, 0, -1206, 0, 0, 3, 0, -1205,
+    0, 0, 1, 0, 3, -1204, 3, -1203, -1202, -1201, 0, 0,
+    0, -1192, -1191, 4, 0, 2, 0, 0, 0, -1184, 0, 1,
+    0, 0, 15, 2, -1182, -1177, -1172, 0, -1169, -1168, 13, -1167,
+    4, 1, 1, 5, -1158, -1157, 0, 0, -1156, -1155, 0, 1,
+    3, -1149, 0, 0, -1148, 0, 0, -1147, 2, -1146, -1145, 0,
+    -1143, 7, 0, -1142, 0, 0, -1138, -1137, 0, 3, 1, 0,
+    -1136, 0, -1134, 0, 0, 0, 0, -1133, 0, 1, 0, 3,
+    -1132, 2, -1129, -1127, -1126, -1119, 1, 6, -1118, -1113, 0, -1108,
+    -1103, 1, 0, -1101, 16, -1099, 3, 3, 1, 0, -1097, -1096,
+    0, -1095, 0, 2, 6, 0, 1, 0, 1, -1093, -1092, 0,
+    2, 0, 0, -1089, 0, 0, 0, -1088, 0, -1087, -1086, -1076,
+    -1075, -1073, 4, 0, -1070, -1069, -1063, 0, -1060, 0, -1058, 2,
+    1, 0, 0, 0, 0, 3, 1, 2, 0, 2, -1057, -1056,
+    -1054, -1053, 4, 1, 3, 0, 0, 0, 2, 0, 1, 0,
+    0, -1052, 0, -1049, 1, 3, -1043, 1, 1, -1042, 1, 2,
+    -1039, 0, -1037, -1035, -1033, -1032, 1, 1, -1031, 0, 0, -1022,
+    2, 0, 0, 0, 1, 5, 3, -1021, 0, 2, -1018, -1013,
+    -1011, -1006, 2, -1003, 0, -1002, 0, -998, 0, 0, 3, 0,
+    -997, -993, 0, -991, 0, 4, -990, 0, 0, 0, 1, -986,
+    0, 1, -985, -984, 2, -982, 0, -979, 0, 0, 0, 1,
+    0, 4, 0, -973, 7, 4, -972, 7, 0, 0, 0, 1,
+    0, 6, 0, 4, -971, -970, 4, -969, 6, 3, 7, 2,
+    0, -967, -965, 0, 1, 1, 0, 0, 0, -962, 0, 6,
+    -959, 2, 14, 2, 1, 0, -958, 2, -956, 0, -954, 1,
+    0, 2, 0, 2, -949, 0, 5, 3, 6, 2, -947, -943,
+    -941, 0, -940, -939, 1, 0, 0, 0, -935, -932, -931, -928,
+    3, -926, -925, -918, 0, 0, 0, 0, 0, -909, 0, 1,
+    -906, 0, -905, 0, -900, -890, 0, -889, -886, -885, -882, 0,
+    1, 2, 7, 0, 0, 0, 1, 6, -881, 0, 1, 0,
+    0, 0, -880, -879, -874, 0, -872, 3, -869, -867, 0, 1,
+    -866, 3, 2, -859, -857, 0, 1, -855, 0, -853, -852, 0,
+    1, -847, -846, -843, 0, 1, 0, 2, 0, 0, -836, 0,
+    3, -833, -829, 7, 0, -827, -825, 0, 0, 0, 0, 1,
+    -824, 0, 0, 2, -822, 1, 1, 3, 0, 2, -816, 1,
+    0, 0, -814, 4, 0, 0, 0, 0, 0, 0, 0, -811,
+    0, 0, 1, 1, -806, 0, -801, 0, 0, 0, -798, 0,
+    0, -797, 0, 0, -795, 0, -792, -789, 0, 0, 0, -787,
+    3, 0, 1, 0, -783, 0, 0, -779, 5, -778, 4, 0,
+    -777, 0, 1, 0, 0, 0, 0, -775, 0, 0, 0, -774,
+    1, -772, 0, -771, 0, 3, -768, -761, -759, 1, -749, 2,
+    4, 14, 2, -746, 1, 0, -740, 0, 0, 0, 3, 2,
+    0, 0, 2, -739, 0, 0, 12, -735, -724, 0, 0, 0,
+    -723, 0, 0, -717, 1, 0, 1, -714, -710, -709, 0, -706,
+    -705, 0, 0, 0, 1, -699, 0, 4, 2, -697, 0, -693,
+    -688, -687, 1, -685, 3, 2, 1, -684, -682, 1, 3, 0,
+    -680, -673, -671, 2, -670, 3, -666, 1, 2, -664, 0, 5,
+    4, -662, 0, 1, -659, 0, -655, 0, -651, -648, -647, -641,
+    0, 0, 0, -639, 0, 0, 0, 0, 0, 9, -638, 0,
+    -631, 6, 2, -623, 1, 0, -619, 0, 0, 2, -616, 0,
+    3, -609, -606, 9, 0, 0, 9, 0, 2, -605, 4, 0,
+    0, 1, 0, 0, 10, 0, 0, 5, 0, -603, -601, 0,
+    0, -592, -591, -589, -586, -582, 0, -578, 0, 0, -577, 0,
+    -576, 2, -575, 0, 0, 2, -574, 0, -573, -568, 0, 0,
+    1, 6, 0, -567, 9, 1, -563, 1, -562, 11, 0, 0,
+    4, 0, 0, 1, 1, 0, 0, 2, -561, 0, -558, 0,
+    5, -555, 2, 0, -547, -546, 5, 0, -545, 0, 0, 5,
+    -543, 22, 0, 1, 0, 4, -541, 1, 0, -540, -539, -534,
+    -533, 0, 0, -530, -529, 0, -525, 1, 0, -523, 0, -522,
+    -514, 16, 0, -512, 0, 0, 1, 0, 0, 2, 0, 1,
+    4, 0, -511, 6, 0, -510, 20, -509, 6, 1, -507, -503,
+    0, 8, 0, 1, -501, 0, -500, -499, 0, 1, 0, 0,
+    -498, 5, 6, -497, -496, 0, 3, 0, 0, -494, 2, 0,
+    -486, 1, 1, 0, 1, -480, 3, 0, -477, 6, -475, 0,
+    0, 1, 0, 0, 0, 2, 0, 0, -471, 0, 0, -469,
+    -465, 0, 0, 0, 0, -464, 0, 5, -463, 0, 0, -458,
+    -457, 7, -450, 0, -448, 0, 0, -447, 8, 1, 3, 2,
+    0, 0, -446, -444, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -435, 2, -433, -430, 0, 1, -428, -427, 0, 0, 1,
+    1, 1, 0, 0, -425, -424, -416, -415, -414, 0, 0, 0,
+    -409, 0, 0, 1, -408, 1, 0, 2, 0, 1, 2, 4,
+    -406, 0, 0, -403, -401, -396, 7, 0, 0, 0, -391, 0,
+    0, -383, 0, 3, 8, -381, 0, 0, 5, 0, -372, 0,
+    0, -371, -369, -366, -363, -359, -358, 1, 0, 1, 3, 0,
+    0, -357, -352, 0, -350, 1, -349, 0, 0, 0, 0, 0,
+    -347, -345, 0, 0, 0, 14, 0, 0, 10, -344, 0, 0,
+    0, -335, 7, 1, 0, 0, 1, 0, -334, 2, 2, 0,
+    -328, 0, -327, -326, 9, 0, 11, 0, -324, -323, -322, -321,
+    17, 14, -320, 0, 0, 0, 1, 0, -318, 0, 3, 3,
+    -305, 0, 5, 1, -301, 0, -289, -288, 0, 0, 0, 0,
+    1, 0, -276, 2, -271, -269, 0, 0, 0, -267, -262, 15,
+    19, 1, -258, -254, 9, -250, 0, -249, -247, -246, 0, -245,
+    -243, -235, 0, -234, 0, 0, -231, 2, 9, 2, 1, 10,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, -223, 0,
+    3, 0, -220, -219, 0, 1, -211, 13, 4, -210, -209, 5,
+    0, 5, 1, 11, 0, 0, 0, 10, -208, 0, 0, -201,
+    6, -200, 8, -195, 2, 0, -193, -192, 0, 5, -191, 21,
+    5, 0, 2, -188, -178, 0, -176, 1, -175, -174, 0, 0,
+    0, 0, 0, 0, 6, -172, -164, -162, 0, 0, -161, -159,
+    24, -156, 0, 11, 1, -153, 2, -146, -145, 7, 0, -144,
+    0, 0, 14, -143, 0, 3, -142, 7, -141, -137, -135, -133,
+    23, 0, 0, 0, 2, -132, 0, -129, 5, 27, 1, 6,
+    1, 0, -128, -127, 2, -124, 0, -120, 0, 0, 3, 0,
+    -119, -118, 0, -117, 18, 0, -116, -115, -112, -105, -96, 0,
+    0, 0, 0, 4, 1, 0, 0, -93, 0, 5, -88, 3,
+    5, 1, -87, -85, -82, 0, 0, 0, 0, 0, -71, -63,
+    -58, 0, 1, 1, -53, -51, 9, -50, 0, -48, -45, 0,
+    -44, 5, -43, 7, -42, 2, 0, 1, 0, 0, 0, 8,
+    0, -40, -38, 0, -36, 0, -25, 0, 0, -24, -23, -22,
+    27, 6, -20, -19, 0, 3, 0, -14, 1, -13, 0, -12,
+    5, -11, -6, 0, -5, -3, 0, 0, 0, 0, 0, 0,
+    -1,
 };
 
-static int
-entity_cmp(const void* p_key, const void* p_entity)
+static const unsigned short ENTITY_HASH_SLOTS[ENTITY_HASH_SIZE] = {
+    1798, 670, 1834, 904, 2042, 798, 1625, 178, 1171, 1225, 1303, 1733,
+    1830, 72, 732, 1418, 859, 197, 2035, 214, 1493, 1204, 1139, 140,
+    649, 972, 199, 2066, 687, 889, 1464, 2052, 1305, 1079, 656, 184,
+    1548, 1062, 105, 652, 1976, 1426, 695, 1283, 475, 1472, 2076, 1932,
+    780, 727, 588, 1454, 1899, 1116, 23, 1957, 110, 1666, 589, 1823,
+    62, 362, 120, 1971, 2102, 1131, 1363, 1224, 320, 666, 1637, 1833,
+    531, 686, 621, 443, 1842, 1299, 1512, 1186, 800, 395, 27, 1372,
+    1738, 887, 1111, 1847, 983, 1822, 2110, 534, 1732, 161, 1174, 351,
+    1694, 42, 1142, 263, 45, 1063, 402, 533, 1177, 166, 741, 1608,
+    1532, 1643, 2067, 8, 1520, 1106, 883, 1004, 768, 298, 1086, 436,
+    1569, 1335, 718, 669, 1708, 463, 792, 1507, 1656, 1974, 1864, 1082,
+    1814, 1026, 1829, 1481, 1621, 933, 1307, 510, 1677, 1607, 541, 1253,
+    875, 515, 723, 1323, 939, 1963, 303, 2056, 1715, 420, 847, 831,
+    1410, 1210, 1922, 1642, 1960, 494, 2039, 1093, 2028, 1845, 930, 696,
+    628, 898, 1740, 738, 1788, 583, 1074, 1444, 133, 1342, 1433, 1402,
+    1565, 2086, 1291, 481, 584, 680, 102, 947, 950, 1710, 1047, 1382,
+    1550, 1461, 1168, 1257, 547, 112, 1931, 2046, 1722, 1304, 538, 1217,
+    1778, 551, 549, 1504, 1751, 1587, 769, 386, 793, 336, 1575, 655,
+    1530, 1469, 508, 333, 627, 647, 1424, 1258, 33, 698, 145, 848,
+    148, 4, 1405, 1838, 743, 223, 456, 1613, 1148, 1359, 1894, 1757,
+    18, 437, 2123, 1593, 791, 480, 912, 745, 671, 245, 841, 862,
+    55, 103, 692, 576, 1501, 967, 1478, 599, 264, 1245, 1223, 1923,
+    1445, 639, 93, 1704, 730, 2058, 1070, 742, 797, 819, 454, 19,
+    1998, 1835, 1169, 36, 352, 1839, 579, 375, 1407, 954, 123, 845,
+    706, 1977, 1505, 484, 1985, 1018, 1638, 1709, 1205, 1044, 1535, 661,
+    809, 850, 598, 209, 658, 20, 302, 2061, 1777, 1462, 1669, 1467,
+    970, 1037, 810, 1580, 1129, 433, 2031, 1072, 60, 278, 820, 1959,
+    546, 1339, 2030, 2085, 1590, 70, 1071, 1947, 170, 0, 613, 1579,
+    1468, 1368, 276, 126, 261, 1012, 1134, 81, 1561, 1889, 1226, 1968,
+    208, 813, 1278, 1449, 822, 1069, 733, 255, 899, 701, 491, 681,
+    895, 96, 187, 476, 106, 638, 118, 1105, 427, 1718, 1515, 1882,
+    387, 1585, 690, 1640, 838, 478, 1095, 849, 61, 2, 1152, 292,
+    1735, 987, 1958, 2051, 300, 1446, 1782, 394, 470, 623, 247, 305,
+    1414, 1, 1087, 1242, 1202, 1477, 592, 1094, 191, 314, 1311, 1364,
+    1766, 212, 1286, 1351, 211, 1355, 497, 2021, 1935, 1618, 1264, 449,
+    204, 1573, 995, 1324, 1387, 1851, 1092, 273, 555, 1844, 117, 944,
+    821, 712, 1584, 1196, 69, 2017, 329, 634, 17, 1775, 78, 380,
+    1762, 863, 2049, 1150, 1361, 1039, 1297, 1800, 1360, 1354, 977, 34,
+    1639, 171, 526, 279, 205, 1801, 2041, 614, 1861, 2057, 1067, 1848,
+    466, 525, 828, 77, 1803, 754, 836, 593, 1849, 1322, 553, 1498,
+    717, 1836, 1120, 803, 597, 167, 802, 1211, 434, 1941, 360, 1553,
+    720, 2038, 896, 1888, 220, 1937, 1890, 203, 1651, 293, 1903, 926,
+    13, 1379, 711, 2124, 274, 778, 196, 1329, 185, 961, 1986, 1913,
+    988, 381, 2091, 101, 354, 2003, 1437, 390, 1066, 918, 153, 331,
+    68, 1333, 787, 1896, 207, 906, 1516, 1795, 304, 1792, 1281, 177,
+    1636, 138, 856, 1691, 1075, 465, 1570, 2122, 1658, 1568, 241, 852,
+    2016, 992, 952, 1207, 332, 959, 1812, 168, 1447, 1802, 1220, 1300,
+    1271, 1172, 1745, 1582, 1891, 44, 770, 2081, 1705, 1041, 1574, 596,
+    1371, 953, 53, 1033, 1843, 1981, 1048, 1126, 941, 1042, 1877, 236,
+    710, 1268, 2040, 152, 1476, 1663, 376, 1672, 582, 1763, 317, 1990,
+    1513, 319, 811, 1345, 1158, 640, 79, 1760, 1273, 460, 431, 511,
+    739, 1161, 1404, 1684, 1601, 960, 451, 452, 289, 522, 815, 1701,
+    159, 165, 1764, 664, 524, 399, 503, 134, 342, 1499, 1633, 1456,
+    495, 505, 2107, 1146, 580, 1983, 1854, 1514, 1753, 1200, 155, 1992,
+    1178, 659, 1163, 916, 761, 225, 474, 911, 272, 246, 867, 296,
+    358, 1870, 1348, 2114, 578, 257, 840, 512, 1581, 1014, 1866, 973,
+    1806, 1090, 1713, 910, 122, 1057, 1727, 1670, 1739, 76, 762, 1130,
+    1483, 1641, 188, 1665, 275, 981, 441, 202, 1754, 1107, 1137, 1156,
+    1269, 1786, 210, 1966, 559, 1743, 1554, 316, 194, 1236, 1813, 1596,
+    1153, 2011, 97, 391, 2008, 566, 1807, 868, 632, 2055, 1022, 149,
+    172, 1199, 1537, 872, 2037, 572, 1517, 516, 193, 1995, 1522, 1140,
+    135, 1524, 1096, 349, 1450, 1176, 1103, 2073, 473, 1061, 1298, 1662,
+    1787, 561, 1852, 417, 2121, 1988, 931, 1023, 648, 1328, 31, 412,
+    929, 1999, 1145, 404, 1259, 682, 1770, 1614, 1488, 1309, 704, 636,
+    490, 540, 1314, 37, 731, 753, 447, 2075, 577, 781, 222, 1218,
+    2117, 1925, 1474, 499, 125, 74, 2065, 445, 1301, 88, 921, 1466,
+    1113, 1016, 865, 1657, 1385, 1858, 444, 942, 1471, 1009, 285, 536,
+    174, 14, 602, 585, 1785, 1431, 1863, 1442, 1543, 2072, 630, 1956,
+    645, 517, 958, 1081, 1007, 1108, 1050, 1143, 1401, 2100, 1600, 313,
+    1856, 1392, 2092, 429, 472, 2027, 1157, 1232, 1289, 1135, 985, 523,
+    243, 30, 1874, 244, 783, 251, 861, 340, 586, 1952, 765, 1185,
+    1673, 439, 1136, 885, 183, 1175, 934, 206, 1455, 846, 1246, 1394,
+    646, 486, 2095, 315, 56, 1263, 548, 424, 455, 163, 282, 1598,
+    1744, 1490, 1141, 1078, 1058, 2080, 550, 136, 1519, 382, 286, 11,
+    408, 1317, 1147, 361, 1759, 1588, 2015, 1886, 99, 1492, 267, 339,
+    1321, 1905, 1679, 1984, 1993, 2034, 1374, 1779, 685, 1690, 908, 1623,
+    1681, 1867, 1652, 1675, 905, 180, 1293, 1799, 1646, 1091, 1980, 252,
+    226, 1362, 1826, 1045, 109, 520, 1231, 29, 991, 1003, 21, 1098,
+    1832, 1972, 353, 1594, 1005, 1365, 625, 1276, 372, 826, 1973, 281,
+    2088, 1815, 1680, 1716, 843, 773, 1425, 740, 1571, 1248, 294, 2077,
+    462, 1934, 1693, 2069, 998, 1622, 1419, 311, 1054, 410, 1555, 477,
+    41, 964, 1423, 984, 1632, 121, 1125, 1154, 923, 1127, 1846, 1746,
+    2109, 1344, 601, 2104, 2020, 675, 1241, 1924, 1872, 1439, 1025, 277,
+    1619, 107, 189, 186, 1688, 707, 2033, 804, 1885, 1790, 467, 1939,
+    1201, 10, 785, 1189, 1674, 1595, 1996, 1375, 448, 772, 1341, 2018,
+    1556, 1627, 1234, 2032, 689, 892, 869, 15, 746, 1654, 1166, 1373,
+    1771, 1235, 1678, 1408, 1536, 485, 144, 1212, 1545, 901, 1381, 965,
+    940, 1533, 1915, 1948, 1910, 1706, 519, 1711, 345, 1028, 855, 9,
+    900, 1219, 858, 1978, 1816, 142, 1774, 1376, 216, 814, 1927, 297,
+    878, 458, 816, 1434, 1723, 564, 218, 709, 2013, 1115, 22, 1128,
+    87, 757, 1857, 493, 1949, 737, 1487, 1559, 880, 506, 594, 1901,
+    256, 1918, 1668, 735, 635, 543, 1697, 347, 1887, 129, 337, 1494,
+    2087, 1441, 1006, 1452, 1459, 807, 729, 363, 943, 1591, 464, 1576,
+    888, 1380, 63, 1921, 1285, 80, 1002, 1804, 1331, 1912, 513, 2006,
+    860, 308, 1320, 1440, 108, 1013, 1539, 507, 295, 2068, 1747, 388,
+    1664, 291, 1458, 1698, 411, 1056, 1540, 1216, 1979, 1926, 428, 1040,
+    43, 1626, 1772, 1950, 1914, 1230, 1631, 902, 914, 1506, 1904, 1383,
+    1824, 355, 469, 1077, 616, 1495, 1496, 834, 115, 2082, 1420, 609,
+    217, 657, 1475, 1930, 64, 301, 1560, 1122, 200, 190, 1065, 1741,
+    528, 1592, 2120, 356, 1853, 1577, 1164, 1728, 306, 1327, 1692, 683,
+    1895, 1294, 1497, 1059, 978, 127, 1280, 1429, 1909, 482, 1244, 1085,
+    1827, 446, 1479, 1181, 1911, 150, 73, 213, 1969, 1000, 1443, 693,
+    557, 1871, 1084, 1228, 1500, 260, 1703, 1438, 1386, 487, 442, 312,
+    1919, 2009, 1243, 407, 113, 812, 2036, 725, 1192, 1453, 504, 1353,
+    937, 539, 1448, 644, 1928, 890, 605, 994, 1076, 334, 1132, 951,
+    2093, 1188, 1416, 401, 1417, 2054, 397, 968, 309, 1389, 377, 1648,
+    1752, 805, 1840, 132, 1780, 346, 1010, 1761, 1518, 1578, 283, 2001,
+    1907, 660, 1510, 38, 1528, 2010, 1206, 1123, 924, 418, 665, 1714,
+    771, 1617, 405, 571, 832, 1597, 1179, 1358, 201, 450, 884, 734,
+    94, 799, 1695, 2007, 1572, 1292, 1810, 1758, 359, 825, 927, 39,
+    219, 461, 864, 1427, 886, 1686, 119, 284, 1415, 1302, 1883, 2047,
+    2096, 1603, 971, 2101, 1938, 2118, 509, 1409, 3, 1599, 2026, 1552,
+    1316, 7, 2108, 1944, 938, 54, 784, 678, 1052, 1796, 563, 1920,
+    827, 2111, 492, 457, 1737, 749, 1653, 1296, 545, 324, 1170, 1083,
+    440, 1965, 833, 327, 713, 1876, 2116, 398, 1997, 590, 882, 58,
+    1208, 976, 75, 1411, 702, 1850, 1630, 1529, 280, 1929, 2045, 619,
+    2029, 1343, 1011, 147, 1769, 378, 1155, 496, 2079, 57, 1008, 1566,
+    891, 2106, 385, 271, 1249, 139, 1238, 71, 468, 979, 1262, 837,
+    1645, 581, 2099, 990, 1019, 777, 1860, 35, 1034, 835, 1564, 1088,
+    1290, 1272, 2119, 400, 370, 1683, 1659, 1523, 676, 626, 1198, 1347,
+    235, 748, 893, 2084, 1073, 1634, 1982, 705, 430, 1544, 562, 242,
+    104, 230, 530, 708, 922, 1989, 2089, 714, 483, 2050, 1398, 141,
+    982, 1892, 663, 367, 574, 903, 1197, 128, 1233, 238, 1318, 489,
+    1628, 1538, 1017, 383, 1184, 1491, 1878, 357, 1162, 1195, 1765, 423,
+    2078, 699, 724, 1820, 2014, 1237, 1967, 612, 1742, 2022, 1391, 2070,
+    650, 736, 1310, 1213, 1748, 1173, 955, 622, 248, 1629, 2053, 1819,
+    779, 722, 567, 917, 1611, 1509, 240, 1502, 1001, 1884, 1270, 1917,
+    426, 684, 1338, 1776, 1794, 1149, 1221, 422, 857, 425, 1647, 2048,
+    1027, 1831, 1879, 554, 1282, 1689, 1855, 591, 1546, 100, 1377, 1811,
+    1340, 438, 2083, 766, 653, 1370, 1336, 1789, 1430, 1508, 1724, 1868,
+    565, 1511, 1541, 986, 1717, 637, 1024, 535, 1696, 343, 2113, 1021,
+    610, 794, 435, 558, 1277, 654, 396, 1825, 1527, 453, 1671, 6,
+    368, 1589, 1649, 2024, 1489, 1403, 151, 604, 249, 1118, 325, 2074,
+    1900, 371, 2012, 498, 215, 1970, 32, 2115, 1315, 629, 1326, 307,
+    631, 1413, 936, 175, 1267, 1428, 1350, 1032, 299, 1719, 2004, 228,
+    66, 234, 1961, 1190, 51, 615, 2025, 2059, 287, 146, 326, 879,
+    521, 67, 1953, 181, 1485, 1035, 1421, 1254, 870, 266, 529, 871,
+    1725, 224, 795, 945, 839, 1991, 854, 697, 250, 1308, 1384, 1194,
+    49, 1239, 1313, 907, 1609, 1250, 232, 1531, 1295, 975, 1620, 1841,
+    932, 668, 1279, 674, 1975, 290, 414, 366, 1612, 1755, 728, 881,
+    774, 1604, 341, 1436, 633, 221, 1768, 624, 608, 169, 1138, 1306,
+    40, 1251, 1821, 239, 160, 1817, 962, 288, 28, 154, 1193, 1395,
+    829, 755, 2005, 1191, 726, 1660, 1356, 233, 1451, 925, 1558, 1862,
+    1064, 1144, 1133, 672, 95, 853, 1534, 1635, 1624, 176, 894, 2103,
+    752, 459, 993, 1828, 1730, 231, 1951, 328, 338, 350, 1165, 1183,
+    751, 1859, 1521, 1865, 259, 1089, 806, 1288, 963, 1615, 876, 124,
+    1605, 173, 788, 980, 1880, 1734, 419, 851, 1707, 1667, 1729, 1030,
+    157, 1287, 268, 322, 1551, 874, 1121, 1749, 374, 1312, 642, 46,
+    393, 1397, 1247, 1337, 1435, 1756, 552, 966, 721, 2105, 790, 1102,
+    1227, 16, 488, 1773, 587, 164, 1783, 928, 403, 335, 1209, 1700,
+    1080, 2060, 1412, 84, 1261, 1015, 694, 719, 501, 1731, 373, 915,
+    909, 1583, 1182, 1616, 1160, 569, 677, 116, 195, 229, 1029, 1101,
+    948, 1480, 573, 603, 130, 716, 700, 421, 2071, 237, 90, 310,
+    1055, 935, 824, 776, 65, 1151, 364, 763, 1781, 24, 348, 182,
+    143, 1319, 47, 789, 796, 830, 82, 527, 2090, 1275, 1274, 999,
+    137, 1916, 920, 1902, 1869, 1396, 1784, 560, 2094, 775, 1721, 198,
+    1562, 703, 679, 1482, 330, 974, 1109, 2112, 1215, 1547, 1332, 2064,
+    83, 254, 471, 227, 643, 764, 1388, 1942, 1180, 1818, 744, 1112,
+    89, 1908, 969, 1936, 818, 1893, 1940, 415, 1486, 1473, 269, 2044,
+    369, 1837, 413, 750, 1167, 1720, 323, 617, 1610, 1685, 673, 1049,
+    59, 1726, 1898, 758, 158, 1020, 192, 1809, 1432, 2063, 1503, 618,
+    620, 1797, 1873, 1549, 1068, 1650, 1994, 2002, 1946, 1099, 1406, 1260,
+    1682, 873, 1586, 919, 1346, 1349, 85, 989, 1378, 1046, 823, 1097,
+    1159, 1222, 1460, 1712, 86, 2097, 2019, 1955, 1463, 1943, 1038, 1400,
+    479, 502, 1330, 1265, 500, 913, 897, 1053, 1470, 5, 1229, 1457,
+    1399, 162, 606, 1104, 253, 1256, 759, 1808, 607, 379, 26, 537,
+    595, 1284, 416, 866, 48, 1881, 568, 2000, 2023, 611, 384, 409,
+    641, 1367, 1661, 265, 782, 1962, 1736, 877, 1369, 12, 514, 1906,
+    747, 114, 1602, 156, 1525, 91, 1422, 667, 1110, 1484, 258, 179,
+    2043, 1255, 1526, 1043, 1214, 1187, 1791, 801, 1060, 406, 1117, 1767,
+    544, 1119, 50, 1266, 344, 1987, 1644, 131, 842, 1252, 1390, 715,
+    1352, 1240, 949, 575, 318, 542, 600, 532, 1750, 1334, 2062, 389,
+    25, 1203, 1357, 817, 1964, 767, 556, 1100, 1676, 518, 691, 570,
+    760, 1954, 1325, 432, 688, 1805, 1031, 392, 1563, 270, 996, 1051,
+    1699, 1606, 365, 756, 1702, 844, 997, 1557, 651, 1114, 1542, 1875,
+    662, 946, 1393, 957, 1036, 262, 1897, 1124, 956, 808, 786, 321,
+    2098, 1655, 52, 1793, 1366, 98, 1945, 1933, 1567, 111, 92, 1687,
+    1465,
+};
+
+
+static unsigned
+entity_hash(unsigned seed, const char* name, size_t name_size)
 {
-    ENTITY_KEY* key = (ENTITY_KEY*) p_key;
-    ENTITY* ent = (ENTITY*) p_entity;
+    unsigned h = (seed != 0 ? seed : 0x811c9dc5U);
+    size_t i;
 
-    return strncmp(key->name, ent->name, key->name_size);
+    /* FNV-1a, kept in sync with scripts/build_entity_map.py. */
+    for(i = 0; i < name_size; i++)
+        h = ((h ^ (unsigned char) name[i]) * 0x01000193U) & 0xffffffffU;
+    return h;
 }
 
 const ENTITY*
 entity_lookup(const char* name, size_t name_size)
 {
-    ENTITY_KEY key = { name, name_size };
+    const ENTITY* ent;
+    int displacement;
+    unsigned slot;
+
+    if(name_size < ENTITY_NAME_MIN_SIZE  ||  name_size > ENTITY_NAME_MAX_SIZE)
+        return NULL;
+
+    /* The first hash picks a bucket; the bucket's displacement either names
+     * the slot directly (negative) or seeds the second hash. */
+    displacement = ENTITY_HASH_DISPLACEMENTS[entity_hash(0, name, name_size) % ENTITY_HASH_SIZE];
+    if(displacement < 0)
+        slot = (unsigned) (-displacement - 1);
+    else
+        slot = entity_hash((unsigned) displacement, name, name_size) % ENTITY_HASH_SIZE;
 
-    return bsearch(&key,
-                   ENTITY_MAP,
-                   sizeof(ENTITY_MAP) / sizeof(ENTITY_MAP[0]),
-                   sizeof(ENTITY),
-                   entity_cmp);
+    ent = &ENTITY_MAP[ENTITY_HASH_SLOTS[slot]];
+    if(ent->name_size != name_size  ||  memcmp(ent->name, name, name_size) != 0)
+        return NULL;
+    return ent;
 }
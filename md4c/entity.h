@@ -30,11 +30,15 @@
 
 
 /* Most entities are formed by single Unicode codepoint, few by two codepoints.
- * Single-codepoint entities have codepoints[1] set to zero. */
+ * Single-codepoint entities have codepoints[1] set to zero. The UTF-8 form
+ * of the codepoints is stored pre-encoded in utf8[]. */
 typedef struct ENTITY_tag ENTITY;
 struct ENTITY_tag {
     const char* name;
+    unsigned char name_size;
     unsigned codepoints[2];
+    unsigned char utf8_size;
+    char utf8[8];
 };
 
 const ENTITY* entity_lookup(const char* name, size_t name_size);
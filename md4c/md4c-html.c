@@ -45,6 +45,14 @@
     #define snprintf _snprintf
 #endif
 
+#if (defined __x86_64__ || defined __i386__)  &&  defined __GNUC__  &&  \
+    !defined _WIN32  &&  !defined MD4C_USE_UTF16  &&  !defined MD4C_NO_SIMD
+    /* Escaping scans 16 or 32 bytes at a time with SSSE3/AVX2, picked at
+     * runtime by md_simd_level(). */
+    #define MD_HTML_USE_SIMD
+    #include <immintrin.h>
+#endif
+
 
 
 typedef struct MD_HTML_tag MD_HTML;
@@ -54,6 +62,18 @@ struct MD_HTML_tag {
     unsigned flags;
     int image_nesting_level;
     char escape_map[256];
+#ifdef MD_HTML_USE_SIMD
+    /* The ASCII part of escape_map[] as nibble tables, per flag: A byte
+     * needs escaping iff (lo[byte & 0xf] & hi[byte >> 4]) != 0. Bytes >= 0x80
+     * are not covered; see scan_escapes_16(). */
+    unsigned char html_nibble_lo[16];
+    unsigned char html_nibble_hi[16];
+    unsigned char url_nibble_lo[16];
+    unsigned char url_nibble_hi[16];
+    MD_OFFSET (*escape_scanner)(const unsigned char* /*lo*/, const unsigned char* /*hi*/,
+                                unsigned /*high_mask*/, const MD_CHAR* /*data*/,
+                                MD_OFFSET /*off*/, MD_OFFSET /*size*/);
+#endif
 };
 
 #define NEED_HTML_ESC_FLAG   0x1
@@ -82,6 +102,108 @@ render_verbatim(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
         render_verbatim((r), (verbatim), (MD_SIZE) (strlen(verbatim)))
 
 
+#ifdef MD_HTML_USE_SIMD
+
+/* Bit mask of the bytes of v which need escaping. high_mask is 0xffff if
+ * all the non-ASCII bytes need escaping too, 0 if none does. */
+__attribute__((target("ssse3")))
+static inline unsigned
+scan_escapes_16(__m128i v, __m128i lo_table, __m128i hi_table, unsigned high_mask)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(v, nibble_mask));
+    __m128i hi = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask));
+    __m128i none = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+
+    return ((~(unsigned) _mm_movemask_epi8(none) & 0xffff)
+            | ((unsigned) _mm_movemask_epi8(v) & high_mask));
+}
+
+/* Both scanners return the offset of the first byte in [off, size) which
+ * needs escaping, or size; they are only called with size - off >= 16. The
+ * last (partial) block is handled by one overlapping block ending at size. */
+__attribute__((target("ssse3")))
+static inline MD_OFFSET
+scan_escape_blocks_16(__m128i lo_table, __m128i hi_table, unsigned high_mask,
+                      const MD_CHAR* data, MD_OFFSET off, MD_OFFSET size)
+{
+    unsigned hits;
+
+    while(off + 16 <= size) {
+        hits = scan_escapes_16(_mm_loadu_si128((const __m128i*) (data + off)),
+                               lo_table, hi_table, high_mask);
+        if(hits != 0)
+            return off + (MD_OFFSET) __builtin_ctz(hits);
+        off += 16;
+    }
+
+    if(off < size) {
+        MD_OFFSET tail = size - 16;
+        hits = scan_escapes_16(_mm_loadu_si128((const __m128i*) (data + tail)),
+                               lo_table, hi_table, high_mask);
+        if(hits != 0)
+            return tail + (MD_OFFSET) __builtin_ctz(hits);
+    }
+
+    return size;
+}
+
+__attribute__((target("ssse3")))
+static MD_OFFSET
+scan_escapes_ssse3(const unsigned char* lo, const unsigned char* hi, unsigned high_mask,
+                   const MD_CHAR* data, MD_OFFSET off, MD_OFFSET size)
+{
+    return scan_escape_blocks_16(_mm_loadu_si128((const __m128i*) lo),
+                                 _mm_loadu_si128((const __m128i*) hi),
+                                 high_mask, data, off, size);
+}
+
+__attribute__((target("avx2")))
+static MD_OFFSET
+scan_escapes_avx2(const unsigned char* lo, const unsigned char* hi, unsigned high_mask,
+                  const MD_CHAR* data, MD_OFFSET off, MD_OFFSET size)
+{
+    const __m128i lo_table = _mm_loadu_si128((const __m128i*) lo);
+    const __m128i hi_table = _mm_loadu_si128((const __m128i*) hi);
+    const __m256i lo_table2 = _mm256_broadcastsi128_si256(lo_table);
+    const __m256i hi_table2 = _mm256_broadcastsi128_si256(hi_table);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+
+    while(off + 32 <= size) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (data + off));
+        __m256i l = _mm256_shuffle_epi8(lo_table2, _mm256_and_si256(v, nibble_mask));
+        __m256i h = _mm256_shuffle_epi8(hi_table2, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask));
+        __m256i none = _mm256_cmpeq_epi8(_mm256_and_si256(l, h), _mm256_setzero_si256());
+        unsigned hits = ~(unsigned) _mm256_movemask_epi8(none);
+
+        if(high_mask != 0)
+            hits |= (unsigned) _mm256_movemask_epi8(v);
+        if(hits != 0)
+            return off + (MD_OFFSET) __builtin_ctz(hits);
+        off += 32;
+    }
+
+    /* Inlined here, the 16-byte code is VEX-encoded as well. */
+    if(off < size  &&  size - off < 16)
+        off = size - 16;
+    return scan_escape_blocks_16(lo_table, hi_table, high_mask, data, off, size);
+}
+
+static void
+build_nibble_tables(const MD_HTML* r, unsigned flag, unsigned char* lo, unsigned char* hi)
+{
+    int i;
+
+    for(i = 0; i < 8; i++)
+        hi[i] = (unsigned char) (1 << i);
+    for(i = 0; i < 128; i++) {
+        if(r->escape_map[i] & flag)
+            lo[i & 0xf] |= (unsigned char) (1 << (i >> 4));
+    }
+}
+
+#endif  /* MD_HTML_USE_SIMD */
+
 static void
 render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
@@ -92,12 +214,19 @@ render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     #define NEED_HTML_ESC(ch)   (r->escape_map[(unsigned char)(ch)] & NEED_HTML_ESC_FLAG)
 
     while(1) {
-        /* Optimization: Use some loop unrolling. */
-        while(off + 3 < size  &&  !NEED_HTML_ESC(data[off+0])  &&  !NEED_HTML_ESC(data[off+1])
-                              &&  !NEED_HTML_ESC(data[off+2])  &&  !NEED_HTML_ESC(data[off+3]))
-            off += 4;
-        while(off < size  &&  !NEED_HTML_ESC(data[off]))
-            off++;
+#ifdef MD_HTML_USE_SIMD
+        if(r->escape_scanner != NULL  &&  size - off >= 16) {
+            off = r->escape_scanner(r->html_nibble_lo, r->html_nibble_hi, 0, data, off, size);
+        } else
+#endif
+        {
+            /* Optimization: Use some loop unrolling. */
+            while(off + 3 < size  &&  !NEED_HTML_ESC(data[off+0])  &&  !NEED_HTML_ESC(data[off+1])
+                                  &&  !NEED_HTML_ESC(data[off+2])  &&  !NEED_HTML_ESC(data[off+3]))
+                off += 4;
+            while(off < size  &&  !NEED_HTML_ESC(data[off]))
+                off++;
+        }
 
         if(off > beg)
             render_verbatim(r, data + beg, off - beg);
@@ -128,8 +257,15 @@ render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     #define NEED_URL_ESC(ch)    (r->escape_map[(unsigned char)(ch)] & NEED_URL_ESC_FLAG)
 
     while(1) {
-        while(off < size  &&  !NEED_URL_ESC(data[off]))
-            off++;
+#ifdef MD_HTML_USE_SIMD
+        if(r->escape_scanner != NULL  &&  size - off >= 16) {
+            off = r->escape_scanner(r->url_nibble_lo, r->url_nibble_hi, 0xffff, data, off, size);
+        } else
+#endif
+        {
+            while(off < size  &&  !NEED_URL_ESC(data[off]))
+                off++;
+        }
         if(off > beg)
             render_verbatim(r, data + beg, off - beg);
 
@@ -235,9 +371,7 @@ render_entity(MD_HTML* r, const MD_CHAR* text, MD_SIZE size,
 
         ent = entity_lookup(text, size);
         if(ent != NULL) {
-            render_utf8_codepoint(r, ent->codepoints[0], fn_append);
-            if(ent->codepoints[1])
-                render_utf8_codepoint(r, ent->codepoints[1], fn_append);
+            fn_append(r, ent->utf8, ent->utf8_size);
             return;
         }
     }
@@ -545,13 +679,69 @@ debug_log_callback(const char* msg, void* userdata)
         fprintf(stderr, "MD4C: %s\n", msg);
 }
 
+static void
+init_renderer(MD_HTML* r, void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+              void* userdata, unsigned renderer_flags)
+{
+#ifdef MD_HTML_USE_SIMD
+    int simd_level;
+#endif
+    int i;
+
+    memset(r, 0, sizeof(MD_HTML));
+    r->process_output = process_output;
+    r->userdata = userdata;
+    r->flags = renderer_flags;
+
+    /* Build map of characters which need escaping. */
+    for(i = 0; i < 256; i++) {
+        unsigned char ch = (unsigned char) i;
+
+        if(strchr("\"&<>", ch) != NULL)
+            r->escape_map[i] |= NEED_HTML_ESC_FLAG;
+
+        if(!ISALNUM(ch)  &&  strchr("~-_.+!*(),%#@?=;:/,+$", ch) == NULL)
+            r->escape_map[i] |= NEED_URL_ESC_FLAG;
+    }
+
+#ifdef MD_HTML_USE_SIMD
+    simd_level = md_simd_level();
+    if(simd_level > 0) {
+        /* No byte >= 0x80 needs HTML escaping, and all of them need URL
+         * escaping: That is what the high_mask arguments passed to the
+         * scanner rely on. */
+        build_nibble_tables(r, NEED_HTML_ESC_FLAG, r->html_nibble_lo, r->html_nibble_hi);
+        build_nibble_tables(r, NEED_URL_ESC_FLAG, r->url_nibble_lo, r->url_nibble_hi);
+        r->escape_scanner = (simd_level >= 2 ? scan_escapes_avx2 : scan_escapes_ssse3);
+    }
+#endif
+}
+
 int
 md_html(const MD_CHAR* input, MD_SIZE input_size,
         void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
         void* userdata, unsigned parser_flags, unsigned renderer_flags)
 {
-    MD_HTML render = { process_output, userdata, renderer_flags, 0, { 0 } };
-    int i;
+    return md_html_with_state(NULL, input, input_size, process_output, userdata,
+                              parser_flags, renderer_flags);
+}
+
+int
+md_html_with_state(MD_PARSER_STATE* state, const MD_CHAR* input, MD_SIZE input_size,
+                   void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                   void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    return md_html_with_ref_defs(state, NULL, input, input_size, process_output, userdata,
+                                 parser_flags, renderer_flags);
+}
+
+int
+md_html_with_ref_defs(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                      const MD_CHAR* input, MD_SIZE input_size,
+                      void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                      void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
 
     MD_PARSER parser = {
         0,
@@ -565,16 +755,7 @@ md_html(const MD_CHAR* input, MD_SIZE input_size,
         NULL
     };
 
-    /* Build map of characters which need escaping. */
-    for(i = 0; i < 256; i++) {
-        unsigned char ch = (unsigned char) i;
-
-        if(strchr("\"&<>", ch) != NULL)
-            render.escape_map[i] |= NEED_HTML_ESC_FLAG;
-
-        if(!ISALNUM(ch)  &&  strchr("~-_.+!*(),%#@?=;:/,+$", ch) == NULL)
-            render.escape_map[i] |= NEED_URL_ESC_FLAG;
-    }
+    init_renderer(&render, process_output, userdata, renderer_flags);
 
     /* Consider skipping UTF-8 byte order mark (BOM). */
     if(renderer_flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1) {
@@ -585,6 +766,62 @@ md_html(const MD_CHAR* input, MD_SIZE input_size,
         }
     }
 
-    return md_parse(input, input_size, &parser, (void*) &render);
+    return md_parse_with_ref_defs(state, ref_defs, input, input_size, &parser, (void*) &render);
 }
 
+int
+md_html_range(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+              const MD_CHAR* input, MD_SIZE input_size, MD_OFFSET beg, MD_OFFSET end,
+              void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+              void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
+
+    MD_PARSER parser = {
+        0,
+        parser_flags,
+        enter_block_callback,
+        leave_block_callback,
+        enter_span_callback,
+        leave_span_callback,
+        text_callback,
+        debug_log_callback,
+        NULL
+    };
+
+    init_renderer(&render, process_output, userdata, renderer_flags);
+
+    /* Consider skipping UTF-8 byte order mark (BOM) at the start of the input. */
+    if(renderer_flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1  &&  beg == 0) {
+        static const MD_CHAR bom[3] = { (char)0xef, (char)0xbb, (char)0xbf };
+        if(end >= sizeof(bom)  &&  memcmp(input, bom, sizeof(bom)) == 0)
+            beg = sizeof(bom);
+    }
+
+    return md_parse_range(state, ref_defs, input, input_size, beg, end, &parser, NULL,
+                          (void*) &render, NULL);
+}
+
+int
+md_html_replay(const MD_TAPE* tape, const MD_CHAR* input, MD_SIZE input_size,
+               void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+               void* userdata, unsigned renderer_flags)
+{
+    MD_HTML render;
+
+    MD_PARSER parser = {
+        0,
+        0,
+        enter_block_callback,
+        leave_block_callback,
+        enter_span_callback,
+        leave_span_callback,
+        text_callback,
+        debug_log_callback,
+        NULL
+    };
+
+    init_renderer(&render, process_output, userdata, renderer_flags);
+
+    return md_replay_tape(tape, input, input_size, &parser, (void*) &render);
+}
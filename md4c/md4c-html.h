@@ -62,6 +62,39 @@ int md_html(const MD_CHAR* input, MD_SIZE input_size,
             void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
             void* userdata, unsigned parser_flags, unsigned renderer_flags);
 
+/* Same as md_html(), but using md_parse_with_state() with the given state. */
+int md_html_with_state(MD_PARSER_STATE* state, const MD_CHAR* input, MD_SIZE input_size,
+                       void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                       void* userdata, unsigned parser_flags, unsigned renderer_flags);
+
+/* Same as md_html_with_state(), but using md_parse_with_ref_defs() with the
+ * given table of reference definitions. Both state and ref_defs may be NULL. */
+int md_html_with_ref_defs(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                          const MD_CHAR* input, MD_SIZE input_size,
+                          void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                          void* userdata, unsigned parser_flags, unsigned renderer_flags);
+
+/* Same as md_html_with_ref_defs(), but renders just input[beg, end) using
+ * md_parse_range(). (Usually the range is between two boundaries of the
+ * input, so it renders the same as those blocks of the whole input do.) */
+int md_html_range(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                  const MD_CHAR* input, MD_SIZE input_size, MD_OFFSET beg, MD_OFFSET end,
+                  void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                  void* userdata, unsigned parser_flags, unsigned renderer_flags);
+
+/* Render into HTML a document recorded by md_parse_to_tape().
+ *
+ * Params input and input_size have to specify the same Markdown input which
+ * has been recorded. Other params are the same as with md_html(), except
+ * MD_HTML_FLAG_SKIP_UTF8_BOM has no effect (the tape determines the contents).
+ *
+ * Returns -1 on error (if md_replay_tape() fails.)
+ * Returns 0 on success.
+ */
+int md_html_replay(const MD_TAPE* tape, const MD_CHAR* input, MD_SIZE input_size,
+                   void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+                   void* userdata, unsigned renderer_flags);
+
 
 #ifdef __cplusplus
     }  /* extern "C" { */
@@ -31,6 +31,24 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if !defined _WIN32  &&  !defined MD4C_NO_THREADS
+    /* MD_FLAG_PARALLELBLOCKS and MD_FLAG_PARALLELINLINES are only honored
+     * with POSIX threads. */
+    #define MD4C_USE_THREADS
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#if (defined __x86_64__ || defined __i386__)  &&  defined __GNUC__  &&  !defined MD4C_USE_UTF16  &&  \
+    !defined _WIN32  &&  !defined MD4C_NO_SIMD
+    /* SSSE3/AVX2 kernels for scanning the inline marks, compiled with
+     * per-function target attributes and selected at runtime (see
+     * md_scan_marks()). */
+    #define MD4C_USE_SIMD
+    #include <cpuid.h>
+    #include <immintrin.h>
+#endif
+
 
 /*****************************
  ***  Miscellaneous Stuff  ***
@@ -119,6 +137,85 @@
 #define MD_UNUSED(x)                ((void)x)
 
 
+/***************************
+ ***  Memory Allocation  ***
+ ***************************/
+
+static void*
+md_default_alloc(MD_SIZE size, void* userdata)
+{
+    MD_UNUSED(userdata);
+    return malloc(size);
+}
+
+static void*
+md_default_realloc(void* ptr, MD_SIZE size, void* userdata)
+{
+    MD_UNUSED(userdata);
+    return realloc(ptr, size);
+}
+
+static void
+md_default_free(void* ptr, void* userdata)
+{
+    MD_UNUSED(userdata);
+    free(ptr);
+}
+
+static const MD_ALLOCATOR md_default_allocator = {
+    md_default_alloc, md_default_realloc, md_default_free, NULL
+};
+
+static MD_ALLOCATOR md_allocator = {
+    md_default_alloc, md_default_realloc, md_default_free, NULL
+};
+
+void
+md_set_allocator(const MD_ALLOCATOR* allocator)
+{
+    md_allocator = (allocator != NULL ? *allocator : md_default_allocator);
+}
+
+void*
+md_malloc(MD_SIZE size)
+{
+    return md_allocator.alloc_fn(size, md_allocator.userdata);
+}
+
+void*
+md_realloc(void* ptr, MD_SIZE size)
+{
+    return md_allocator.realloc_fn(ptr, size, md_allocator.userdata);
+}
+
+void
+md_free(void* ptr)
+{
+    if(ptr != NULL)
+        md_allocator.free_fn(ptr, md_allocator.userdata);
+}
+
+/* The sizes computed internally are size_t. Anything which does not fit into
+ * MD_SIZE is reported as an allocation failure instead of being truncated. */
+#define MD_FITS_SIZE(size)      ((size) <= (MD_SIZE) -1)
+
+static inline void*
+md_malloc_checked(size_t size)
+{
+    return (MD_FITS_SIZE(size) ? md_malloc((MD_SIZE) size) : NULL);
+}
+
+static inline void*
+md_realloc_checked(void* ptr, size_t size)
+{
+    return (MD_FITS_SIZE(size) ? md_realloc(ptr, (MD_SIZE) size) : NULL);
+}
+
+#define MD_MALLOC(size)         md_malloc_checked(size)
+#define MD_REALLOC(ptr, size)   md_realloc_checked((ptr), (size))
+#define MD_FREE(ptr)            md_free(ptr)
+
+
 /******************************
  ***  Some internal limits  ***
  ******************************/
@@ -148,6 +245,7 @@ typedef struct MD_MARK_tag MD_MARK;
 typedef struct MD_BLOCK_tag MD_BLOCK;
 typedef struct MD_CONTAINER_tag MD_CONTAINER;
 typedef struct MD_REF_DEF_tag MD_REF_DEF;
+typedef struct MD_BOUNDARY_tag MD_BOUNDARY;
 
 
 /* During analyzes of inline marks, we need to manage stacks of unresolved
@@ -168,9 +266,20 @@ struct MD_CTX_tag {
     MD_PARSER parser;
     void* userdata;
 
+    /* Offset of the text in the whole input. This is non-zero only when
+     * the text is a part of a stream (see md_parser_feed()) or a range of
+     * a larger text (see md_parse_range()). */
+    OFF input_off;
+
     /* When this is true, it allows some optimizations. */
     int doc_ends_with_newline;
 
+#ifdef MD4C_USE_SIMD
+    /* Bitmap of the positions of all '\r' and '\n' in the document, or NULL.
+     * See md_build_newline_index(). */
+    const uint64_t* newline_bits;
+#endif
+
     /* Helper temporary growing buffer. */
     CHAR* buffer;
     unsigned alloc_buffer;
@@ -179,8 +288,11 @@ struct MD_CTX_tag {
     MD_REF_DEF* ref_defs;
     int n_ref_defs;
     int alloc_ref_defs;
-    void** ref_def_hashtable;
+    MD_REF_DEF** ref_def_hashtable;   /* Open addressing, power-of-two size. */
     int ref_def_hashtable_size;
+    unsigned* ref_def_labels;         /* Folded labels of all the ref. defs. */
+    const MD_REF_DEF_TABLE* ext_ref_defs;   /* Fallback for ref. defs, or NULL. */
+    int ext_ref_defs_first;                 /* Look into ext_ref_defs first. */
     SZ max_ref_def_output;
 
     /* Stack of inline/span markers.
@@ -196,6 +308,14 @@ struct MD_CTX_tag {
 #else
     char mark_char_map[256];
 #endif
+#ifdef MD4C_USE_SIMD
+    /* mark_char_map[] as nibble tables: A byte is a mark char iff
+     * (mark_nibble_lo[byte & 0xf] & mark_nibble_hi[byte >> 4]) != 0.
+     * mark_scanner is NULL if the CPU (or the map) is not supported. */
+    unsigned char mark_nibble_lo[16];
+    unsigned char mark_nibble_hi[16];
+    OFF (*mark_scanner)(const MD_CTX* /*ctx*/, OFF /*off*/, OFF /*end*/);
+#endif
 
     /* For resolving of inline spans. */
     MD_MARKSTACK opener_stacks[16];
@@ -247,6 +367,8 @@ struct MD_CTX_tag {
     MD_BLOCK* current_block;
     int n_block_bytes;
     int alloc_block_bytes;
+    int block_bytes_end_with_container;     /* i.e. not with MD_LINE(s). */
+    int current_block_after_container;      /* The above before current_block. */
 
     /* For container block analysis. */
     MD_CONTAINER* containers;
@@ -261,6 +383,15 @@ struct MD_CTX_tag {
     int html_block_type;    /* For checking closing raw HTML condition. */
     int last_line_has_list_loosening_effect;
     int last_list_item_starts_with_two_blank_lines;
+
+    /* Count of top-level blocks started so far (see md_parser_feed()). */
+    unsigned n_top_level_blocks;
+
+    /* Boundaries between the top-level blocks (see md_parse_range()). */
+    MD_BOUNDARY_CALLBACK boundary_callback;     /* NULL if not wanted. */
+    MD_BOUNDARY* boundaries;
+    int n_boundaries;
+    int alloc_boundaries;
 };
 
 enum MD_LINETYPE_tag {
@@ -423,7 +554,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
             CHAR* new_buffer;                                               \
             SZ new_size = ((sz) + (sz) / 2 + 128) & ~127;                   \
                                                                             \
-            new_buffer = realloc(ctx->buffer, new_size);                    \
+            new_buffer = MD_REALLOC(ctx->buffer, new_size);                 \
             if(new_buffer == NULL) {                                        \
                 MD_LOG("realloc() failed.");                                \
                 ret = -1;                                                   \
@@ -542,242 +673,777 @@ struct MD_UNICODE_FOLD_INFO_tag {
 
 
 #if defined MD4C_USE_UTF16 || defined MD4C_USE_UTF8
-    /* Binary search over sorted "map" of codepoints. Consecutive sequences
-     * of codepoints may be encoded in the map by just using the
-     * (MIN_CODEPOINT | 0x40000000) and (MAX_CODEPOINT | 0x80000000).
-     *
-     * Returns index of the found record in the map (in the case of ranges,
-     * the minimal value is used); or -1 on failure. */
-    static int
-    md_unicode_bsearch__(unsigned codepoint, const unsigned* map, size_t map_size)
-    {
-        int beg, end;
-        int pivot_beg, pivot_end;
-
-        beg = 0;
-        end = (int) map_size-1;
-        while(beg <= end) {
-            /* Pivot may be a range, not just a single value. */
-            pivot_beg = pivot_end = (beg + end) / 2;
-            if(map[pivot_end] & 0x40000000)
-                pivot_end++;
-            if(map[pivot_beg] & 0x80000000)
-                pivot_beg--;
-
-            if(codepoint < (map[pivot_beg] & 0x00ffffff))
-                end = pivot_beg - 1;
-            else if(codepoint > (map[pivot_end] & 0x00ffffff))
-                beg = pivot_end + 1;
-            else
-                return pivot_beg;
-        }
+    typedef struct MD_UNICODE_FOLD_RULE_tag MD_UNICODE_FOLD_RULE;
+    struct MD_UNICODE_FOLD_RULE_tag {
+        unsigned char n_codepoints;
+        int value;
+    };
 
-        return -1;
+    /* Whitespace and punctuation: UNICODE_CLASS_MAP[block][class * 8 + (cp & 0xff) / 32]
+     * has the bit (cp & 31) set if the codepoint is in the class (0 = whitespace,
+     * 1 = punctuation); block = UNICODE_CLASS_STAGE1[cp / 256], or 0 past its end.
+     * (generated by scripts/build_unicode_tables.py) */
+    static const unsigned char UNICODE_CLASS_STAGE1[508] = {
+        1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17, 18, 0, 19, 20, 21,
+        22, 23, 24, 25, 0, 0, 26, 27, 28, 29, 29, 30, 29, 29, 31, 29, 29, 29, 32, 33, 34, 35, 36, 37, 38,
+        39, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 42, 43, 44, 45, 46, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 48, 0, 49, 50, 51, 0, 52, 0, 53, 0, 54, 0, 0, 55, 56, 57, 58, 0, 0, 59, 60, 61, 62, 63,
+        0, 64, 65, 66, 67, 68, 69, 70, 71, 72, 0, 73, 74, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 78, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 83, 84, 85, 86, 0, 0, 87, 88, 29, 29, 89,
+        0, 0, 0, 0, 0, 0, 90, 91, 0, 0, 0, 0, 0, 0, 92, 0, 0, 93, 94, 95, 0, 96, 97, 98, 29,
+        29, 29, 99, 100, 101, 29, 102, 103
+    };
+    static const uint32_t UNICODE_CLASS_MAP[104][16] = {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00001a00, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000,
+          0x00000000, 0xfc00fffe, 0xf8000001, 0x78000001, 0x00000000, 0x89d3dbfe, 0x00800000, 0x00800000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffc003c, 0xffffafe0 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x40200000, 0x000000b0, 0x00000000, 0x00000000, 0x00400000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0xfc000000, 0x00000000, 0x0000e600, 0x40000000, 0x00000049, 0x00180000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xe800ffc0, 0x00000000, 0x00000000, 0x00003c00, 0x00000000, 0x00000000, 0x40100000, 0x60000200 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00003fff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc3c00000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x7fff0000, 0x40000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00010030, 0x00000000, 0x00000000, 0x00000000, 0x2c0c0000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x00030000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x07f80000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x80800000, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00008000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x80000000, 0x0c008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xfcfffffe, 0x3d500000, 0x00000000, 0x00000000, 0x00000020, 0xc0000000, 0x07ffdfbf, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x0000fc00, 0x00000000, 0xc0000000, 0x00000000, 0x00000000, 0x08000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x000001ff, 0x03ff0000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x18000000, 0x00000000, 0x00000000, 0x00003800 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00600000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0f700000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x000007ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000031, 0x00000000, 0x00000000, 0x00000000, 0xc0000000, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xc0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00003f7f, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0xfc000000, 0x7ff007ff, 0x00000000, 0x00000000, 0x00000000, 0xf0000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0xf8000000, 0x00000000, 0xc0000000, 0x00000000, 0x00000000, 0x000800ff, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa0000000, 0xe000e003, 0x6000e000 },
+        { 0x000007ff, 0x00008000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffff0000, 0xffff00ff, 0x7fffffff, 0x7c000000, 0x00007c00, 0xffffffff, 0x00000001, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xc1d0037b, 0x0c0042af, 0x0000bc1f, 0x00000000, 0xffff0c00, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0x0000007f, 0x000007ff, 0x00000000, 0xf0000000, 0xffffffff, 0xffffffff, 0x000003ff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff, 0xfff00000, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffcfffff, 0xffbfffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xde0007e0 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffff7fff, 0x3fffffff, 0x00000000, 0xfbffffff, 0xffffffff, 0xffffffff, 0x000fffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff, 0xffff0000 },
+        { 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffff1e, 0xe0c10001, 0x00000000, 0x00000000, 0x18000000, 0x00000001, 0x00000000, 0x08000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc30000, 0x00000000, 0xffffffff, 0x0000800f },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x7fffffff, 0xfffffc00, 0x000100ff, 0xffffffff, 0xfffffc00, 0x0001ffff, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0xffffffff, 0x0000007f, 0xc0000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x0000e000, 0x00000000, 0x00000000, 0x40080000, 0x00000000, 0x00000000, 0x00000000, 0x00fc0000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x007fffff, 0x00000003, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x03c00f00, 0x00000000, 0x00f00000, 0x00000000, 0x00000000, 0x0000c000, 0x17000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x0000c000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0xc0003ffe, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0xf0000000, 0x03800000, 0x00000000, 0x00000000, 0xc0000000, 0x00030000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x08000000, 0x00000c00, 0x00000000, 0x00000000, 0x00000000, 0x00000800 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0xfffc0000, 0x00000007, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0xc0000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0xf0000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x03ff0000, 0xffff0000, 0xfff7ffff, 0x00000f7f, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xfc00fffe, 0xf8000001, 0xf8000001, 0x0000003f, 0x00000000, 0x00000000, 0x00000000, 0x30007f7f },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000007, 0xff800000, 0x00000000, 0xfe000000, 0x1fff73ff, 0x00000001, 0xffff0000, 0x1fffffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00010000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00800000, 0x01800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x01ff0000, 0x80000000, 0x00000000, 0x00000000, 0x00000100, 0x007f0000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0xfe000000, 0x00000000, 0x00000000, 0x1e000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x03e00000, 0x00000000, 0x000003c0, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00003f80, 0x00000000, 0x00000000, 0xd8000000, 0x00000003, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x0000000f, 0x00300000, 0x00000000, 0x00000000, 0xe80021e0, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x3f000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x2c00f800, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00fffffe, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x0000000e, 0x00001fff, 0x00000000, 0x02000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0xf0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000070, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x80000000, 0x0000007f, 0x00000000, 0xdc000000, 0x00000007, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x000003ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x0000003e, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01800000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x0000fff8, 0x00000000, 0x00000000, 0x00000000, 0xffe00000, 0x8003ffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x001f0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x0000c000, 0x00000000, 0x00000000, 0x00000000, 0x00200000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0xff800000, 0x00000030, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07800000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x90000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0xffff0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000000f, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xfffffe7f, 0xffffffff, 0x00001c1f, 0xfffff018, 0xffffc3ff, 0xffffffff, 0x000007ff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0x007fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000002, 0x08000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00200000, 0x00200000, 0x00008000, 0x00008000, 0x00000200, 0x00000200, 0x00000008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x07800000, 0x00000000, 0xffdfe000, 0x00000fef, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffff0fff, 0xffffffff, 0xffffffff, 0x000fffff, 0xfffe7fff, 0xfffefffe, 0x003fffff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffe000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00003fff, 0x00000000, 0xffffffc0 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffff0007, 0x0fffffff, 0x000301ff, 0x0000003f, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf0ffffff, 0x1fff1fff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xf87fffff, 0xffffffff, 0xffffffff, 0x03ffffff, 0x00010fff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffff0fff, 0xffffffff, 0x03ff00ff, 0xffffffff, 0xffff00ff, 0x00033fff, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0x000fffff, 0x1fff3fff, 0xffff01ff, 0xbfffffff, 0x0fffc03f, 0x01ff01ff },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+          0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfff7ffff, 0xffffffff, 0x000007ff, 0x00000000 }
+    };
+
+    /* Case folding: codepoint cp maps to the rule
+     * UNICODE_FOLD_RULES[UNICODE_FOLD_MAP[block][cp & 0xff]], with block as above. A rule
+     * folding to a single codepoint holds its offset from cp, else the index of
+     * the codepoints in UNICODE_FOLD_DATA.
+     * (generated by scripts/build_unicode_tables.py) */
+    static const unsigned char UNICODE_FOLD_STAGE1[490] = {
+        1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 10, 11, 0, 12, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 16, 0, 0, 0, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 18, 0, 0, 0, 19, 0, 0, 0, 0, 20, 21, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25
+    };
+    static const unsigned char UNICODE_FOLD_MAP[26][256] = {
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 3,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          5, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 4,
+          0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 7, 4, 0, 4, 0, 4, 0, 8,
+          0, 9, 4, 0, 4, 0, 10, 4, 0, 11, 11, 4, 0, 0, 12, 13,
+          14, 4, 0, 11, 15, 0, 16, 17, 4, 0, 0, 0, 16, 18, 0, 19,
+          4, 0, 4, 0, 4, 0, 20, 4, 0, 20, 0, 0, 4, 0, 20, 4,
+          0, 21, 21, 4, 0, 4, 0, 22, 4, 0, 0, 0, 4, 0, 0, 0,
+          0, 0, 0, 0, 23, 4, 0, 23, 4, 0, 23, 4, 0, 4, 0, 4,
+          0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          24, 23, 4, 0, 4, 0, 25, 26, 4, 0, 4, 0, 4, 0, 4, 0 },
+        { 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          27, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 28, 4, 0, 29, 30, 0,
+          0, 4, 0, 31, 32, 33, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+          0, 0, 0, 0, 0, 0, 35, 0, 36, 36, 36, 0, 37, 0, 38, 38,
+          39, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+          40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+          42, 43, 0, 0, 0, 44, 45, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          46, 47, 0, 0, 48, 49, 0, 4, 0, 50, 4, 0, 0, 27, 27, 27 },
+        { 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          52, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0 },
+        { 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+          53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+          53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+          55, 55, 55, 55, 55, 55, 0, 55, 0, 0, 0, 0, 0, 55, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          57, 58, 59, 60, 60, 61, 62, 63, 64, 0, 0, 0, 0, 0, 0, 0,
+          65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+          65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+          65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 65, 65,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 66, 67, 68, 69, 70, 71, 0, 0, 3, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+          72, 0, 73, 0, 74, 0, 75, 0, 0, 56, 0, 56, 0, 56, 0, 56,
+          0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          76, 77, 78, 79, 80, 81, 82, 83, 76, 77, 78, 79, 80, 81, 82, 83,
+          84, 85, 86, 87, 88, 89, 90, 91, 84, 85, 86, 87, 88, 89, 90, 91,
+          92, 93, 94, 95, 96, 97, 98, 99, 92, 93, 94, 95, 96, 97, 98, 99,
+          0, 0, 100, 101, 102, 0, 103, 104, 56, 56, 105, 105, 101, 0, 106, 0,
+          0, 0, 107, 108, 109, 0, 110, 111, 112, 112, 112, 112, 108, 0, 0, 0,
+          0, 0, 113, 39, 0, 0, 114, 115, 56, 56, 116, 116, 0, 0, 0, 0,
+          0, 0, 117, 40, 118, 0, 119, 120, 56, 56, 121, 121, 50, 0, 0, 0,
+          0, 0, 122, 123, 124, 0, 125, 126, 127, 127, 128, 128, 123, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 130, 131, 0, 0, 0, 0,
+          0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+          134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+          53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+          53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          4, 0, 135, 136, 137, 0, 0, 4, 0, 4, 0, 4, 0, 138, 139, 140,
+          141, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 142, 142,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0,
+          0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 143, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 144, 0, 0,
+          4, 0, 4, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 145, 146, 147, 148, 145, 0,
+          149, 150, 151, 152, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+          4, 0, 4, 0, 47, 153, 154, 4, 0, 4, 0, 0, 0, 0, 0, 0,
+          4, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+          155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+          155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+          155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+          155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 156, 157, 158, 159, 160, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 162, 163, 164, 165, 166, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+          167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+          167, 167, 167, 167, 167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+          167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+          167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 168, 168,
+          168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 168, 168,
+          168, 168, 168, 0, 168, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+          37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+          37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+          37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+          169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+          169, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+    };
+    static const MD_UNICODE_FOLD_RULE UNICODE_FOLD_RULES[170] = {
+        { 1, 0 }, { 1, 32 }, { 1, 775 }, { 2, 0 }, { 1, 1 }, { 2, 2 }, { 2, 4 }, { 1, -121 },
+        { 1, -268 }, { 1, 210 }, { 1, 206 }, { 1, 205 }, { 1, 79 }, { 1, 202 }, { 1, 203 }, { 1, 207 },
+        { 1, 211 }, { 1, 209 }, { 1, 213 }, { 1, 214 }, { 1, 218 }, { 1, 217 }, { 1, 219 }, { 1, 2 },
+        { 2, 6 }, { 1, -97 }, { 1, -56 }, { 1, -130 }, { 1, 10795 }, { 1, -163 }, { 1, 10792 }, { 1, -195 },
+        { 1, 69 }, { 1, 71 }, { 1, 116 }, { 1, 38 }, { 1, 37 }, { 1, 64 }, { 1, 63 }, { 3, 8 },
+        { 3, 11 }, { 1, 8 }, { 1, -30 }, { 1, -25 }, { 1, -15 }, { 1, -22 }, { 1, -54 }, { 1, -48 },
+        { 1, -60 }, { 1, -64 }, { 1, -7 }, { 1, 80 }, { 1, 15 }, { 1, 48 }, { 2, 14 }, { 1, 7264 },
+        { 1, -8 }, { 1, -6222 }, { 1, -6221 }, { 1, -6212 }, { 1, -6210 }, { 1, -6211 }, { 1, -6204 }, { 1, -6180 },
+        { 1, 35267 }, { 1, -3008 }, { 2, 16 }, { 2, 18 }, { 2, 20 }, { 2, 22 }, { 2, 24 }, { 1, -58 },
+        { 2, 26 }, { 3, 28 }, { 3, 31 }, { 3, 34 }, { 2, 37 }, { 2, 39 }, { 2, 41 }, { 2, 43 },
+        { 2, 45 }, { 2, 47 }, { 2, 49 }, { 2, 51 }, { 2, 53 }, { 2, 55 }, { 2, 57 }, { 2, 59 },
+        { 2, 61 }, { 2, 63 }, { 2, 65 }, { 2, 67 }, { 2, 69 }, { 2, 71 }, { 2, 73 }, { 2, 75 },
+        { 2, 77 }, { 2, 79 }, { 2, 81 }, { 2, 83 }, { 2, 85 }, { 2, 87 }, { 2, 89 }, { 2, 91 },
+        { 3, 93 }, { 1, -74 }, { 1, -7173 }, { 2, 96 }, { 2, 98 }, { 2, 100 }, { 2, 102 }, { 3, 104 },
+        { 1, -86 }, { 3, 107 }, { 2, 110 }, { 3, 112 }, { 1, -100 }, { 3, 115 }, { 2, 118 }, { 2, 120 },
+        { 3, 122 }, { 1, -112 }, { 2, 125 }, { 2, 127 }, { 2, 129 }, { 2, 131 }, { 3, 133 }, { 1, -128 },
+        { 1, -126 }, { 1, -7517 }, { 1, -8383 }, { 1, -8262 }, { 1, 28 }, { 1, 16 }, { 1, 26 }, { 1, -10743 },
+        { 1, -3814 }, { 1, -10727 }, { 1, -10780 }, { 1, -10749 }, { 1, -10783 }, { 1, -10782 }, { 1, -10815 }, { 1, -35332 },
+        { 1, -42280 }, { 1, -42308 }, { 1, -42319 }, { 1, -42315 }, { 1, -42305 }, { 1, -42258 }, { 1, -42282 }, { 1, -42261 },
+        { 1, 928 }, { 1, -42307 }, { 1, -35384 }, { 1, -38864 }, { 2, 136 }, { 2, 138 }, { 2, 140 }, { 3, 142 },
+        { 3, 145 }, { 2, 148 }, { 2, 150 }, { 2, 152 }, { 2, 154 }, { 2, 156 }, { 2, 158 }, { 1, 40 },
+        { 1, 39 }, { 1, 34 }
+    };
+    static const unsigned UNICODE_FOLD_DATA[160] = {
+        0x0073, 0x0073, 0x0069, 0x0307, 0x02bc, 0x006e, 0x006a, 0x030c, 0x03b9, 0x0308, 0x0301, 0x03c5,
+        0x0308, 0x0301, 0x0565, 0x0582, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030a, 0x0079, 0x030a,
+        0x0061, 0x02be, 0x03c5, 0x0313, 0x03c5, 0x0313, 0x0300, 0x03c5, 0x0313, 0x0301, 0x03c5, 0x0313,
+        0x0342, 0x1f00, 0x03b9, 0x1f01, 0x03b9, 0x1f02, 0x03b9, 0x1f03, 0x03b9, 0x1f04, 0x03b9, 0x1f05,
+        0x03b9, 0x1f06, 0x03b9, 0x1f07, 0x03b9, 0x1f20, 0x03b9, 0x1f21, 0x03b9, 0x1f22, 0x03b9, 0x1f23,
+        0x03b9, 0x1f24, 0x03b9, 0x1f25, 0x03b9, 0x1f26, 0x03b9, 0x1f27, 0x03b9, 0x1f60, 0x03b9, 0x1f61,
+        0x03b9, 0x1f62, 0x03b9, 0x1f63, 0x03b9, 0x1f64, 0x03b9, 0x1f65, 0x03b9, 0x1f66, 0x03b9, 0x1f67,
+        0x03b9, 0x1f70, 0x03b9, 0x03b1, 0x03b9, 0x03ac, 0x03b9, 0x03b1, 0x0342, 0x03b1, 0x0342, 0x03b9,
+        0x1f74, 0x03b9, 0x03b7, 0x03b9, 0x03ae, 0x03b9, 0x03b7, 0x0342, 0x03b7, 0x0342, 0x03b9, 0x03b9,
+        0x0308, 0x0300, 0x03b9, 0x0342, 0x03b9, 0x0308, 0x0342, 0x03c5, 0x0308, 0x0300, 0x03c1, 0x0313,
+        0x03c5, 0x0342, 0x03c5, 0x0308, 0x0342, 0x1f7c, 0x03b9, 0x03c9, 0x03b9, 0x03ce, 0x03b9, 0x03c9,
+        0x0342, 0x03c9, 0x0342, 0x03b9, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006c, 0x0066, 0x0066,
+        0x0069, 0x0066, 0x0066, 0x006c, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056b,
+        0x057e, 0x0576, 0x0574, 0x056d
+    };
+
+    /* Index of the block of the two-level tables above. */
+    #define UNICODE_BLOCK(stage1, codepoint)                                    \
+        ((codepoint) / 256 < SIZEOF_ARRAY(stage1) ? (stage1)[(codepoint) / 256] : 0)
+
+    /* Two table lookups. Invalid codepoints (> 0x10ffff) fall into the empty
+     * block. */
+    static inline int
+    md_unicode_class__(unsigned codepoint, int class_index)
+    {
+        const uint32_t* bitmap = UNICODE_CLASS_MAP[UNICODE_BLOCK(UNICODE_CLASS_STAGE1, codepoint)];
+        return (bitmap[class_index * 8 + (codepoint & 0xff) / 32] >> (codepoint & 31)) & 1;
     }
 
-    static int
+    /* Unicode "Zs" category and the ASCII whitespace. */
+    static inline int
     md_is_unicode_whitespace__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Zs" category.
-         * (generated by scripts/build_whitespace_map.py) */
-        static const unsigned WHITESPACE_MAP[] = {
-            S(0x0020), S(0x00a0), S(0x1680), R(0x2000,0x200a), S(0x202f), S(0x205f), S(0x3000)
-        };
-#undef R
-#undef S
-
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISWHITESPACE_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, WHITESPACE_MAP, SIZEOF_ARRAY(WHITESPACE_MAP)) >= 0);
+        return md_unicode_class__(codepoint, 0);
     }
 
-    static int
+    /* Unicode general "P" and "S" categories. */
+    static inline int
     md_is_unicode_punct__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode general "P" and "S" categories.
-         * (generated by scripts/build_punct_map.py) */
-        static const unsigned PUNCT_MAP[] = {
-            R(0x0021,0x002f), R(0x003a,0x0040), R(0x005b,0x0060), R(0x007b,0x007e), R(0x00a1,0x00a9),
-            R(0x00ab,0x00ac), R(0x00ae,0x00b1), S(0x00b4), R(0x00b6,0x00b8), S(0x00bb), S(0x00bf), S(0x00d7),
-            S(0x00f7), R(0x02c2,0x02c5), R(0x02d2,0x02df), R(0x02e5,0x02eb), S(0x02ed), R(0x02ef,0x02ff), S(0x0375),
-            S(0x037e), R(0x0384,0x0385), S(0x0387), S(0x03f6), S(0x0482), R(0x055a,0x055f), R(0x0589,0x058a),
-            R(0x058d,0x058f), S(0x05be), S(0x05c0), S(0x05c3), S(0x05c6), R(0x05f3,0x05f4), R(0x0606,0x060f),
-            S(0x061b), R(0x061d,0x061f), R(0x066a,0x066d), S(0x06d4), S(0x06de), S(0x06e9), R(0x06fd,0x06fe),
-            R(0x0700,0x070d), R(0x07f6,0x07f9), R(0x07fe,0x07ff), R(0x0830,0x083e), S(0x085e), S(0x0888),
-            R(0x0964,0x0965), S(0x0970), R(0x09f2,0x09f3), R(0x09fa,0x09fb), S(0x09fd), S(0x0a76), R(0x0af0,0x0af1),
-            S(0x0b70), R(0x0bf3,0x0bfa), S(0x0c77), S(0x0c7f), S(0x0c84), S(0x0d4f), S(0x0d79), S(0x0df4), S(0x0e3f),
-            S(0x0e4f), R(0x0e5a,0x0e5b), R(0x0f01,0x0f17), R(0x0f1a,0x0f1f), S(0x0f34), S(0x0f36), S(0x0f38),
-            R(0x0f3a,0x0f3d), S(0x0f85), R(0x0fbe,0x0fc5), R(0x0fc7,0x0fcc), R(0x0fce,0x0fda), R(0x104a,0x104f),
-            R(0x109e,0x109f), S(0x10fb), R(0x1360,0x1368), R(0x1390,0x1399), S(0x1400), R(0x166d,0x166e),
-            R(0x169b,0x169c), R(0x16eb,0x16ed), R(0x1735,0x1736), R(0x17d4,0x17d6), R(0x17d8,0x17db),
-            R(0x1800,0x180a), S(0x1940), R(0x1944,0x1945), R(0x19de,0x19ff), R(0x1a1e,0x1a1f), R(0x1aa0,0x1aa6),
-            R(0x1aa8,0x1aad), R(0x1b5a,0x1b6a), R(0x1b74,0x1b7e), R(0x1bfc,0x1bff), R(0x1c3b,0x1c3f),
-            R(0x1c7e,0x1c7f), R(0x1cc0,0x1cc7), S(0x1cd3), S(0x1fbd), R(0x1fbf,0x1fc1), R(0x1fcd,0x1fcf),
-            R(0x1fdd,0x1fdf), R(0x1fed,0x1fef), R(0x1ffd,0x1ffe), R(0x2010,0x2027), R(0x2030,0x205e),
-            R(0x207a,0x207e), R(0x208a,0x208e), R(0x20a0,0x20c0), R(0x2100,0x2101), R(0x2103,0x2106),
-            R(0x2108,0x2109), S(0x2114), R(0x2116,0x2118), R(0x211e,0x2123), S(0x2125), S(0x2127), S(0x2129),
-            S(0x212e), R(0x213a,0x213b), R(0x2140,0x2144), R(0x214a,0x214d), S(0x214f), R(0x218a,0x218b),
-            R(0x2190,0x2426), R(0x2440,0x244a), R(0x249c,0x24e9), R(0x2500,0x2775), R(0x2794,0x2b73),
-            R(0x2b76,0x2b95), R(0x2b97,0x2bff), R(0x2ce5,0x2cea), R(0x2cf9,0x2cfc), R(0x2cfe,0x2cff), S(0x2d70),
-            R(0x2e00,0x2e2e), R(0x2e30,0x2e5d), R(0x2e80,0x2e99), R(0x2e9b,0x2ef3), R(0x2f00,0x2fd5),
-            R(0x2ff0,0x2fff), R(0x3001,0x3004), R(0x3008,0x3020), S(0x3030), R(0x3036,0x3037), R(0x303d,0x303f),
-            R(0x309b,0x309c), S(0x30a0), S(0x30fb), R(0x3190,0x3191), R(0x3196,0x319f), R(0x31c0,0x31e3), S(0x31ef),
-            R(0x3200,0x321e), R(0x322a,0x3247), S(0x3250), R(0x3260,0x327f), R(0x328a,0x32b0), R(0x32c0,0x33ff),
-            R(0x4dc0,0x4dff), R(0xa490,0xa4c6), R(0xa4fe,0xa4ff), R(0xa60d,0xa60f), S(0xa673), S(0xa67e),
-            R(0xa6f2,0xa6f7), R(0xa700,0xa716), R(0xa720,0xa721), R(0xa789,0xa78a), R(0xa828,0xa82b),
-            R(0xa836,0xa839), R(0xa874,0xa877), R(0xa8ce,0xa8cf), R(0xa8f8,0xa8fa), S(0xa8fc), R(0xa92e,0xa92f),
-            S(0xa95f), R(0xa9c1,0xa9cd), R(0xa9de,0xa9df), R(0xaa5c,0xaa5f), R(0xaa77,0xaa79), R(0xaade,0xaadf),
-            R(0xaaf0,0xaaf1), S(0xab5b), R(0xab6a,0xab6b), S(0xabeb), S(0xfb29), R(0xfbb2,0xfbc2), R(0xfd3e,0xfd4f),
-            S(0xfdcf), R(0xfdfc,0xfdff), R(0xfe10,0xfe19), R(0xfe30,0xfe52), R(0xfe54,0xfe66), R(0xfe68,0xfe6b),
-            R(0xff01,0xff0f), R(0xff1a,0xff20), R(0xff3b,0xff40), R(0xff5b,0xff65), R(0xffe0,0xffe6),
-            R(0xffe8,0xffee), R(0xfffc,0xfffd), R(0x10100,0x10102), R(0x10137,0x1013f), R(0x10179,0x10189),
-            R(0x1018c,0x1018e), R(0x10190,0x1019c), S(0x101a0), R(0x101d0,0x101fc), S(0x1039f), S(0x103d0),
-            S(0x1056f), S(0x10857), R(0x10877,0x10878), S(0x1091f), S(0x1093f), R(0x10a50,0x10a58), S(0x10a7f),
-            S(0x10ac8), R(0x10af0,0x10af6), R(0x10b39,0x10b3f), R(0x10b99,0x10b9c), S(0x10ead), R(0x10f55,0x10f59),
-            R(0x10f86,0x10f89), R(0x11047,0x1104d), R(0x110bb,0x110bc), R(0x110be,0x110c1), R(0x11140,0x11143),
-            R(0x11174,0x11175), R(0x111c5,0x111c8), S(0x111cd), S(0x111db), R(0x111dd,0x111df), R(0x11238,0x1123d),
-            S(0x112a9), R(0x1144b,0x1144f), R(0x1145a,0x1145b), S(0x1145d), S(0x114c6), R(0x115c1,0x115d7),
-            R(0x11641,0x11643), R(0x11660,0x1166c), S(0x116b9), R(0x1173c,0x1173f), S(0x1183b), R(0x11944,0x11946),
-            S(0x119e2), R(0x11a3f,0x11a46), R(0x11a9a,0x11a9c), R(0x11a9e,0x11aa2), R(0x11b00,0x11b09),
-            R(0x11c41,0x11c45), R(0x11c70,0x11c71), R(0x11ef7,0x11ef8), R(0x11f43,0x11f4f), R(0x11fd5,0x11ff1),
-            S(0x11fff), R(0x12470,0x12474), R(0x12ff1,0x12ff2), R(0x16a6e,0x16a6f), S(0x16af5), R(0x16b37,0x16b3f),
-            R(0x16b44,0x16b45), R(0x16e97,0x16e9a), S(0x16fe2), S(0x1bc9c), S(0x1bc9f), R(0x1cf50,0x1cfc3),
-            R(0x1d000,0x1d0f5), R(0x1d100,0x1d126), R(0x1d129,0x1d164), R(0x1d16a,0x1d16c), R(0x1d183,0x1d184),
-            R(0x1d18c,0x1d1a9), R(0x1d1ae,0x1d1ea), R(0x1d200,0x1d241), S(0x1d245), R(0x1d300,0x1d356), S(0x1d6c1),
-            S(0x1d6db), S(0x1d6fb), S(0x1d715), S(0x1d735), S(0x1d74f), S(0x1d76f), S(0x1d789), S(0x1d7a9),
-            S(0x1d7c3), R(0x1d800,0x1d9ff), R(0x1da37,0x1da3a), R(0x1da6d,0x1da74), R(0x1da76,0x1da83),
-            R(0x1da85,0x1da8b), S(0x1e14f), S(0x1e2ff), R(0x1e95e,0x1e95f), S(0x1ecac), S(0x1ecb0), S(0x1ed2e),
-            R(0x1eef0,0x1eef1), R(0x1f000,0x1f02b), R(0x1f030,0x1f093), R(0x1f0a0,0x1f0ae), R(0x1f0b1,0x1f0bf),
-            R(0x1f0c1,0x1f0cf), R(0x1f0d1,0x1f0f5), R(0x1f10d,0x1f1ad), R(0x1f1e6,0x1f202), R(0x1f210,0x1f23b),
-            R(0x1f240,0x1f248), R(0x1f250,0x1f251), R(0x1f260,0x1f265), R(0x1f300,0x1f6d7), R(0x1f6dc,0x1f6ec),
-            R(0x1f6f0,0x1f6fc), R(0x1f700,0x1f776), R(0x1f77b,0x1f7d9), R(0x1f7e0,0x1f7eb), S(0x1f7f0),
-            R(0x1f800,0x1f80b), R(0x1f810,0x1f847), R(0x1f850,0x1f859), R(0x1f860,0x1f887), R(0x1f890,0x1f8ad),
-            R(0x1f8b0,0x1f8b1), R(0x1f900,0x1fa53), R(0x1fa60,0x1fa6d), R(0x1fa70,0x1fa7c), R(0x1fa80,0x1fa88),
-            R(0x1fa90,0x1fabd), R(0x1fabf,0x1fac5), R(0x1face,0x1fadb), R(0x1fae0,0x1fae8), R(0x1faf0,0x1faf8),
-            R(0x1fb00,0x1fb92), R(0x1fb94,0x1fbca)
-        };
-#undef R
-#undef S
-
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISPUNCT_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, PUNCT_MAP, SIZEOF_ARRAY(PUNCT_MAP)) >= 0);
+        return md_unicode_class__(codepoint, 1);
     }
 
     static void
     md_get_unicode_fold_info(unsigned codepoint, MD_UNICODE_FOLD_INFO* info)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
-         * (generated by scripts/build_folding_map.py) */
-        static const unsigned FOLD_MAP_1[] = {
-            R(0x0041,0x005a), S(0x00b5), R(0x00c0,0x00d6), R(0x00d8,0x00de), R(0x0100,0x012e), R(0x0132,0x0136),
-            R(0x0139,0x0147), R(0x014a,0x0176), S(0x0178), R(0x0179,0x017d), S(0x017f), S(0x0181), S(0x0182),
-            S(0x0184), S(0x0186), S(0x0187), S(0x0189), S(0x018a), S(0x018b), S(0x018e), S(0x018f), S(0x0190),
-            S(0x0191), S(0x0193), S(0x0194), S(0x0196), S(0x0197), S(0x0198), S(0x019c), S(0x019d), S(0x019f),
-            R(0x01a0,0x01a4), S(0x01a6), S(0x01a7), S(0x01a9), S(0x01ac), S(0x01ae), S(0x01af), S(0x01b1), S(0x01b2),
-            S(0x01b3), S(0x01b5), S(0x01b7), S(0x01b8), S(0x01bc), S(0x01c4), S(0x01c5), S(0x01c7), S(0x01c8),
-            S(0x01ca), R(0x01cb,0x01db), R(0x01de,0x01ee), S(0x01f1), S(0x01f2), S(0x01f4), S(0x01f6), S(0x01f7),
-            R(0x01f8,0x021e), S(0x0220), R(0x0222,0x0232), S(0x023a), S(0x023b), S(0x023d), S(0x023e), S(0x0241),
-            S(0x0243), S(0x0244), S(0x0245), R(0x0246,0x024e), S(0x0345), S(0x0370), S(0x0372), S(0x0376), S(0x037f),
-            S(0x0386), R(0x0388,0x038a), S(0x038c), S(0x038e), S(0x038f), R(0x0391,0x03a1), R(0x03a3,0x03ab),
-            S(0x03c2), S(0x03cf), S(0x03d0), S(0x03d1), S(0x03d5), S(0x03d6), R(0x03d8,0x03ee), S(0x03f0), S(0x03f1),
-            S(0x03f4), S(0x03f5), S(0x03f7), S(0x03f9), S(0x03fa), R(0x03fd,0x03ff), R(0x0400,0x040f),
-            R(0x0410,0x042f), R(0x0460,0x0480), R(0x048a,0x04be), S(0x04c0), R(0x04c1,0x04cd), R(0x04d0,0x052e),
-            R(0x0531,0x0556), R(0x10a0,0x10c5), S(0x10c7), S(0x10cd), R(0x13f8,0x13fd), S(0x1c80), S(0x1c81),
-            S(0x1c82), S(0x1c83), S(0x1c84), S(0x1c85), S(0x1c86), S(0x1c87), S(0x1c88), R(0x1c90,0x1cba),
-            R(0x1cbd,0x1cbf), R(0x1e00,0x1e94), S(0x1e9b), R(0x1ea0,0x1efe), R(0x1f08,0x1f0f), R(0x1f18,0x1f1d),
-            R(0x1f28,0x1f2f), R(0x1f38,0x1f3f), R(0x1f48,0x1f4d), S(0x1f59), S(0x1f5b), S(0x1f5d), S(0x1f5f),
-            R(0x1f68,0x1f6f), S(0x1fb8), S(0x1fb9), S(0x1fba), S(0x1fbb), S(0x1fbe), R(0x1fc8,0x1fcb), S(0x1fd8),
-            S(0x1fd9), S(0x1fda), S(0x1fdb), S(0x1fe8), S(0x1fe9), S(0x1fea), S(0x1feb), S(0x1fec), S(0x1ff8),
-            S(0x1ff9), S(0x1ffa), S(0x1ffb), S(0x2126), S(0x212a), S(0x212b), S(0x2132), R(0x2160,0x216f), S(0x2183),
-            R(0x24b6,0x24cf), R(0x2c00,0x2c2f), S(0x2c60), S(0x2c62), S(0x2c63), S(0x2c64), R(0x2c67,0x2c6b),
-            S(0x2c6d), S(0x2c6e), S(0x2c6f), S(0x2c70), S(0x2c72), S(0x2c75), S(0x2c7e), S(0x2c7f), R(0x2c80,0x2ce2),
-            S(0x2ceb), S(0x2ced), S(0x2cf2), R(0xa640,0xa66c), R(0xa680,0xa69a), R(0xa722,0xa72e), R(0xa732,0xa76e),
-            S(0xa779), S(0xa77b), S(0xa77d), R(0xa77e,0xa786), S(0xa78b), S(0xa78d), S(0xa790), S(0xa792),
-            R(0xa796,0xa7a8), S(0xa7aa), S(0xa7ab), S(0xa7ac), S(0xa7ad), S(0xa7ae), S(0xa7b0), S(0xa7b1), S(0xa7b2),
-            S(0xa7b3), R(0xa7b4,0xa7c2), S(0xa7c4), S(0xa7c5), S(0xa7c6), S(0xa7c7), S(0xa7c9), S(0xa7d0), S(0xa7d6),
-            S(0xa7d8), S(0xa7f5), R(0xab70,0xabbf), R(0xff21,0xff3a), R(0x10400,0x10427), R(0x104b0,0x104d3),
-            R(0x10570,0x1057a), R(0x1057c,0x1058a), R(0x1058c,0x10592), S(0x10594), S(0x10595), R(0x10c80,0x10cb2),
-            R(0x118a0,0x118bf), R(0x16e40,0x16e5f), R(0x1e900,0x1e921)
-        };
-        static const unsigned FOLD_MAP_1_DATA[] = {
-            0x0061, 0x007a, 0x03bc, 0x00e0, 0x00f6, 0x00f8, 0x00fe, 0x0101, 0x012f, 0x0133, 0x0137, 0x013a, 0x0148,
-            0x014b, 0x0177, 0x00ff, 0x017a, 0x017e, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257,
-            0x018c, 0x01dd, 0x0259, 0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272, 0x0275,
-            0x01a1, 0x01a5, 0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292,
-            0x01b9, 0x01bd, 0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x01dc, 0x01df, 0x01ef, 0x01f3, 0x01f3,
-            0x01f5, 0x0195, 0x01bf, 0x01f9, 0x021f, 0x019e, 0x0223, 0x0233, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
-            0x0180, 0x0289, 0x028c, 0x0247, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3, 0x03ac, 0x03ad, 0x03af,
-            0x03cc, 0x03cd, 0x03ce, 0x03b1, 0x03c1, 0x03c3, 0x03cb, 0x03c3, 0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0,
-            0x03d9, 0x03ef, 0x03ba, 0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037d, 0x0450, 0x045f,
-            0x0430, 0x044f, 0x0461, 0x0481, 0x048b, 0x04bf, 0x04cf, 0x04c2, 0x04ce, 0x04d1, 0x052f, 0x0561, 0x0586,
-            0x2d00, 0x2d25, 0x2d27, 0x2d2d, 0x13f0, 0x13f5, 0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a,
-            0x0463, 0xa64b, 0x10d0, 0x10fa, 0x10fd, 0x10ff, 0x1e01, 0x1e95, 0x1e61, 0x1ea1, 0x1eff, 0x1f00, 0x1f07,
-            0x1f10, 0x1f15, 0x1f20, 0x1f27, 0x1f30, 0x1f37, 0x1f40, 0x1f45, 0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60,
-            0x1f67, 0x1fb0, 0x1fb1, 0x1f70, 0x1f71, 0x03b9, 0x1f72, 0x1f75, 0x1fd0, 0x1fd1, 0x1f76, 0x1f77, 0x1fe0,
-            0x1fe1, 0x1f7a, 0x1f7b, 0x1fe5, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x03c9, 0x006b, 0x00e5, 0x214e, 0x2170,
-            0x217f, 0x2184, 0x24d0, 0x24e9, 0x2c30, 0x2c5f, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68, 0x2c6c, 0x0251,
-            0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76, 0x023f, 0x0240, 0x2c81, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0xa641,
-            0xa66d, 0xa681, 0xa69b, 0xa723, 0xa72f, 0xa733, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f, 0xa787, 0xa78c,
-            0x0265, 0xa791, 0xa793, 0xa797, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x029e, 0x0287, 0x029d,
-            0xab53, 0xa7b5, 0xa7c3, 0xa794, 0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0xa7d1, 0xa7d7, 0xa7d9, 0xa7f6, 0x13a0,
-            0x13ef, 0xff41, 0xff5a, 0x10428, 0x1044f, 0x104d8, 0x104fb, 0x10597, 0x105a1, 0x105a3, 0x105b1, 0x105b3,
-            0x105b9, 0x105bb, 0x105bc, 0x10cc0, 0x10cf2, 0x118c0, 0x118df, 0x16e60, 0x16e7f, 0x1e922, 0x1e943
-        };
-        static const unsigned FOLD_MAP_2[] = {
-            S(0x00df), S(0x0130), S(0x0149), S(0x01f0), S(0x0587), S(0x1e96), S(0x1e97), S(0x1e98), S(0x1e99),
-            S(0x1e9a), S(0x1e9e), S(0x1f50), R(0x1f80,0x1f87), R(0x1f88,0x1f8f), R(0x1f90,0x1f97), R(0x1f98,0x1f9f),
-            R(0x1fa0,0x1fa7), R(0x1fa8,0x1faf), S(0x1fb2), S(0x1fb3), S(0x1fb4), S(0x1fb6), S(0x1fbc), S(0x1fc2),
-            S(0x1fc3), S(0x1fc4), S(0x1fc6), S(0x1fcc), S(0x1fd6), S(0x1fe4), S(0x1fe6), S(0x1ff2), S(0x1ff3),
-            S(0x1ff4), S(0x1ff6), S(0x1ffc), S(0xfb00), S(0xfb01), S(0xfb02), S(0xfb05), S(0xfb06), S(0xfb13),
-            S(0xfb14), S(0xfb15), S(0xfb16), S(0xfb17)
-        };
-        static const unsigned FOLD_MAP_2_DATA[] = {
-            0x0073,0x0073, 0x0069,0x0307, 0x02bc,0x006e, 0x006a,0x030c, 0x0565,0x0582, 0x0068,0x0331, 0x0074,0x0308,
-            0x0077,0x030a, 0x0079,0x030a, 0x0061,0x02be, 0x0073,0x0073, 0x03c5,0x0313, 0x1f00,0x03b9, 0x1f07,0x03b9,
-            0x1f00,0x03b9, 0x1f07,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f60,0x03b9,
-            0x1f67,0x03b9, 0x1f60,0x03b9, 0x1f67,0x03b9, 0x1f70,0x03b9, 0x03b1,0x03b9, 0x03ac,0x03b9, 0x03b1,0x0342,
-            0x03b1,0x03b9, 0x1f74,0x03b9, 0x03b7,0x03b9, 0x03ae,0x03b9, 0x03b7,0x0342, 0x03b7,0x03b9, 0x03b9,0x0342,
-            0x03c1,0x0313, 0x03c5,0x0342, 0x1f7c,0x03b9, 0x03c9,0x03b9, 0x03ce,0x03b9, 0x03c9,0x0342, 0x03c9,0x03b9,
-            0x0066,0x0066, 0x0066,0x0069, 0x0066,0x006c, 0x0073,0x0074, 0x0073,0x0074, 0x0574,0x0576, 0x0574,0x0565,
-            0x0574,0x056b, 0x057e,0x0576, 0x0574,0x056d
-        };
-        static const unsigned FOLD_MAP_3[] = {
-            S(0x0390), S(0x03b0), S(0x1f52), S(0x1f54), S(0x1f56), S(0x1fb7), S(0x1fc7), S(0x1fd2), S(0x1fd3),
-            S(0x1fd7), S(0x1fe2), S(0x1fe3), S(0x1fe7), S(0x1ff7), S(0xfb03), S(0xfb04)
-        };
-        static const unsigned FOLD_MAP_3_DATA[] = {
-            0x03b9,0x0308,0x0301, 0x03c5,0x0308,0x0301, 0x03c5,0x0313,0x0300, 0x03c5,0x0313,0x0301,
-            0x03c5,0x0313,0x0342, 0x03b1,0x0342,0x03b9, 0x03b7,0x0342,0x03b9, 0x03b9,0x0308,0x0300,
-            0x03b9,0x0308,0x0301, 0x03b9,0x0308,0x0342, 0x03c5,0x0308,0x0300, 0x03c5,0x0308,0x0301,
-            0x03c5,0x0308,0x0342, 0x03c9,0x0342,0x03b9, 0x0066,0x0066,0x0069, 0x0066,0x0066,0x006c
-        };
-#undef R
-#undef S
-        static const struct {
-            const unsigned* map;
-            const unsigned* data;
-            size_t map_size;
-            unsigned n_codepoints;
-        } FOLD_MAP_LIST[] = {
-            { FOLD_MAP_1, FOLD_MAP_1_DATA, SIZEOF_ARRAY(FOLD_MAP_1), 1 },
-            { FOLD_MAP_2, FOLD_MAP_2_DATA, SIZEOF_ARRAY(FOLD_MAP_2), 2 },
-            { FOLD_MAP_3, FOLD_MAP_3_DATA, SIZEOF_ARRAY(FOLD_MAP_3), 3 }
-        };
-
-        int i;
+        const MD_UNICODE_FOLD_RULE* rule;
 
         /* Fast path for ASCII characters. */
         if(codepoint <= 0x7f) {
@@ -788,39 +1454,14 @@ struct MD_UNICODE_FOLD_INFO_tag {
             return;
         }
 
-        /* Try to locate the codepoint in any of the maps. */
-        for(i = 0; i < (int) SIZEOF_ARRAY(FOLD_MAP_LIST); i++) {
-            int index;
-
-            index = md_unicode_bsearch__(codepoint, FOLD_MAP_LIST[i].map, FOLD_MAP_LIST[i].map_size);
-            if(index >= 0) {
-                /* Found the mapping. */
-                unsigned n_codepoints = FOLD_MAP_LIST[i].n_codepoints;
-                const unsigned* map = FOLD_MAP_LIST[i].map;
-                const unsigned* codepoints = FOLD_MAP_LIST[i].data + (index * n_codepoints);
-
-                memcpy(info->codepoints, codepoints, sizeof(unsigned) * n_codepoints);
-                info->n_codepoints = n_codepoints;
-
-                if(FOLD_MAP_LIST[i].map[index] != codepoint) {
-                    /* The found mapping maps whole range of codepoints,
-                     * i.e. we have to offset info->codepoints[0] accordingly. */
-                    if((map[index] & 0x00ffffff)+1 == codepoints[0]) {
-                        /* Alternating type of the range. */
-                        info->codepoints[0] = codepoint + ((codepoint & 0x1) == (map[index] & 0x1) ? 1 : 0);
-                    } else {
-                        /* Range to range kind of mapping. */
-                        info->codepoints[0] += (codepoint - (map[index] & 0x00ffffff));
-                    }
-                }
-
-                return;
-            }
+        rule = &UNICODE_FOLD_RULES[UNICODE_FOLD_MAP[UNICODE_BLOCK(UNICODE_FOLD_STAGE1, codepoint)][codepoint & 0xff]];
+        if(rule->n_codepoints == 1) {
+            /* Rule 0 (offset 0) maps the codepoint to itself. */
+            info->codepoints[0] = codepoint + (unsigned) rule->value;
+        } else {
+            memcpy(info->codepoints, UNICODE_FOLD_DATA + rule->value, sizeof(unsigned) * rule->n_codepoints);
         }
-
-        /* No mapping found. Map the codepoint to itself. */
-        info->codepoints[0] = codepoint;
-        info->n_codepoints = 1;
+        info->n_codepoints = rule->n_codepoints;
     }
 #endif
 
@@ -870,68 +1511,70 @@ struct MD_UNICODE_FOLD_INFO_tag {
     }
 #elif defined MD4C_USE_UTF8
     #define IS_UTF8_LEAD1(byte)     ((unsigned char)(byte) <= 0x7f)
-    #define IS_UTF8_LEAD2(byte)     (((unsigned char)(byte) & 0xe0) == 0xc0)
-    #define IS_UTF8_LEAD3(byte)     (((unsigned char)(byte) & 0xf0) == 0xe0)
-    #define IS_UTF8_LEAD4(byte)     (((unsigned char)(byte) & 0xf8) == 0xf0)
     #define IS_UTF8_TAIL(byte)      (((unsigned char)(byte) & 0xc0) == 0x80)
 
-    static unsigned
+    /* Length of the sequence by its lead byte, or 0 if the byte cannot lead
+     * one (a tail byte or 0xf8 - 0xff). */
+    static const unsigned char UTF8_SEQUENCE_SIZE[256] = {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x00 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x10 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x20 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x30 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x40 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x50 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x60 */
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,   /* 0x70 */
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   /* 0x80 */
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   /* 0x90 */
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   /* 0xa0 */
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   /* 0xb0 */
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,   /* 0xc0 */
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,   /* 0xd0 */
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,   /* 0xe0 */
+        4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0   /* 0xf0 */
+    };
+
+    static inline unsigned
     md_decode_utf8__(const CHAR* str, SZ str_size, SZ* p_size)
     {
-        if(!IS_UTF8_LEAD1(str[0])) {
-            if(IS_UTF8_LEAD2(str[0])) {
-                if(1 < str_size && IS_UTF8_TAIL(str[1])) {
-                    if(p_size != NULL)
-                        *p_size = 2;
-
-                    return (((unsigned int)str[0] & 0x1f) << 6) |
-                           (((unsigned int)str[1] & 0x3f) << 0);
-                }
-            } else if(IS_UTF8_LEAD3(str[0])) {
-                if(2 < str_size && IS_UTF8_TAIL(str[1]) && IS_UTF8_TAIL(str[2])) {
-                    if(p_size != NULL)
-                        *p_size = 3;
-
-                    return (((unsigned int)str[0] & 0x0f) << 12) |
-                           (((unsigned int)str[1] & 0x3f) << 6) |
-                           (((unsigned int)str[2] & 0x3f) << 0);
-                }
-            } else if(IS_UTF8_LEAD4(str[0])) {
-                if(3 < str_size && IS_UTF8_TAIL(str[1]) && IS_UTF8_TAIL(str[2]) && IS_UTF8_TAIL(str[3])) {
-                    if(p_size != NULL)
-                        *p_size = 4;
-
-                    return (((unsigned int)str[0] & 0x07) << 18) |
-                           (((unsigned int)str[1] & 0x3f) << 12) |
-                           (((unsigned int)str[2] & 0x3f) << 6) |
-                           (((unsigned int)str[3] & 0x3f) << 0);
-                }
+        static const unsigned char LEAD_MASK[5] = { 0, 0x7f, 0x1f, 0x0f, 0x07 };
+        SZ n = UTF8_SEQUENCE_SIZE[(unsigned char) str[0]];
+
+        if(n > 1  &&  n <= str_size) {
+            unsigned codepoint = (unsigned char) str[0] & LEAD_MASK[n];
+            SZ i;
+
+            for(i = 1; i < n; i++) {
+                if(!IS_UTF8_TAIL(str[i]))
+                    break;
+                codepoint = (codepoint << 6) | ((unsigned char) str[i] & 0x3f);
+            }
+
+            if(i == n) {
+                if(p_size != NULL)
+                    *p_size = n;
+                return codepoint;
             }
         }
 
+        /* ASCII, or a broken sequence. */
         if(p_size != NULL)
             *p_size = 1;
         return (unsigned) str[0];
     }
 
-    static unsigned
+    static inline unsigned
     md_decode_utf8_before__(MD_CTX* ctx, OFF off)
     {
         if(!IS_UTF8_LEAD1(CH(off-1))) {
-            if(off > 1 && IS_UTF8_LEAD2(CH(off-2)) && IS_UTF8_TAIL(CH(off-1)))
-                return (((unsigned int)CH(off-2) & 0x1f) << 6) |
-                       (((unsigned int)CH(off-1) & 0x3f) << 0);
-
-            if(off > 2 && IS_UTF8_LEAD3(CH(off-3)) && IS_UTF8_TAIL(CH(off-2)) && IS_UTF8_TAIL(CH(off-1)))
-                return (((unsigned int)CH(off-3) & 0x0f) << 12) |
-                       (((unsigned int)CH(off-2) & 0x3f) << 6) |
-                       (((unsigned int)CH(off-1) & 0x3f) << 0);
-
-            if(off > 3 && IS_UTF8_LEAD4(CH(off-4)) && IS_UTF8_TAIL(CH(off-3)) && IS_UTF8_TAIL(CH(off-2)) && IS_UTF8_TAIL(CH(off-1)))
-                return (((unsigned int)CH(off-4) & 0x07) << 18) |
-                       (((unsigned int)CH(off-3) & 0x3f) << 12) |
-                       (((unsigned int)CH(off-2) & 0x3f) << 6) |
-                       (((unsigned int)CH(off-1) & 0x3f) << 0);
+            /* The lead byte has to be right before the (up to 3) tail bytes,
+             * and it has to announce exactly that many. */
+            SZ n = 1;
+
+            while(n < 4  &&  n < off  &&  IS_UTF8_TAIL(CH(off-n)))
+                n++;
+            if(n > 1  &&  n <= off  &&  UTF8_SEQUENCE_SIZE[(unsigned char) CH(off-n)] == n)
+                return md_decode_utf8__(STR(off-n), n, NULL);
         }
 
         return (unsigned) CH(off-1);
@@ -1029,7 +1672,7 @@ md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines, MD_SIZ
 {
     CHAR* buffer;
 
-    buffer = (CHAR*) malloc(sizeof(CHAR) * (end - beg));
+    buffer = (CHAR*) MD_MALLOC(sizeof(CHAR) * (end - beg));
     if(buffer == NULL) {
         MD_LOG("malloc() failed.");
         return -1;
@@ -1427,27 +2070,28 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
     if(build->substr_count >= build->substr_alloc) {
         MD_TEXTTYPE* new_substr_types;
         OFF* new_substr_offsets;
+        int substr_alloc;
 
-        build->substr_alloc = (build->substr_alloc > 0
+        substr_alloc = (build->substr_alloc > 0
                 ? build->substr_alloc + build->substr_alloc / 2
                 : 8);
-        new_substr_types = (MD_TEXTTYPE*) realloc(build->substr_types,
-                                    build->substr_alloc * sizeof(MD_TEXTTYPE));
+        new_substr_types = (MD_TEXTTYPE*) MD_REALLOC(build->substr_types,
+                                    substr_alloc * sizeof(MD_TEXTTYPE));
         if(new_substr_types == NULL) {
             MD_LOG("realloc() failed.");
             return -1;
         }
+        build->substr_types = new_substr_types;
         /* Note +1 to reserve space for final offset (== raw_size). */
-        new_substr_offsets = (OFF*) realloc(build->substr_offsets,
-                                    (build->substr_alloc+1) * sizeof(OFF));
+        new_substr_offsets = (OFF*) MD_REALLOC(build->substr_offsets,
+                                    (substr_alloc+1) * sizeof(OFF));
         if(new_substr_offsets == NULL) {
             MD_LOG("realloc() failed.");
-            free(new_substr_types);
             return -1;
         }
 
-        build->substr_types = new_substr_types;
         build->substr_offsets = new_substr_offsets;
+        build->substr_alloc = substr_alloc;
     }
 
     build->substr_types[build->substr_count] = type;
@@ -1461,10 +2105,11 @@ md_free_attribute(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build)
 {
     MD_UNUSED(ctx);
 
-    if(build->substr_alloc > 0) {
-        free(build->text);
-        free(build->substr_types);
-        free(build->substr_offsets);
+    /* Only a trivial attribute refers to the raw text. */
+    if(build->substr_types != build->trivial_types) {
+        MD_FREE(build->text);
+        MD_FREE(build->substr_types);
+        MD_FREE(build->substr_offsets);
     }
 }
 
@@ -1499,7 +2144,7 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         build->trivial_offsets[1] = raw_size;
         off = raw_size;
     } else {
-        build->text = (CHAR*) malloc(raw_size * sizeof(CHAR));
+        build->text = (CHAR*) MD_MALLOC(raw_size * sizeof(CHAR));
         if(build->text == NULL) {
             MD_LOG("malloc() failed.");
             goto abort;
@@ -1549,7 +2194,9 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
     return 0;
 
 abort:
+    /* The caller frees the build too. */
     md_free_attribute(ctx, build);
+    memset(build, 0, sizeof(MD_ATTRIBUTE_BUILD));
     return -1;
 }
 
@@ -1585,261 +2232,117 @@ struct MD_REF_DEF_tag {
     SZ title_size;
     OFF dest_beg;
     OFF dest_end;
+    OFF folded_label_off;       /* Index into MD_CTX::ref_def_labels[]. */
+    SZ folded_label_size;
     unsigned char label_needs_free : 1;
     unsigned char title_needs_free : 1;
 };
 
 /* Label equivalence is quite complicated with regards to whitespace and case
- * folding. This complicates computing a hash of it as well as direct comparison
- * of two labels. */
-
-static unsigned
-md_link_label_hash(const CHAR* label, SZ size)
+ * folding. Therefore each label is reduced to a canonical form: the sequence
+ * of its case-folded codepoints, with any whitespace run collapsed into a
+ * single space and with leading and trailing whitespace stripped. Two labels
+ * are equivalent iff their canonical forms are equal.
+ *
+ * The canonical form is written into buf[] (up to buf_size codepoints). The
+ * return value is the length of the whole canonical form, which may be more
+ * than buf_size. Note no label char yields more than 3 codepoints. */
+static SZ
+md_link_label_fold(const CHAR* label, SZ size, unsigned* buf, SZ buf_size)
 {
-    unsigned hash = MD_FNV1A_BASE;
+    SZ n = 0;
     OFF off;
-    unsigned codepoint;
-    int is_whitespace = FALSE;
 
     off = md_skip_unicode_whitespace(label, 0, size);
     while(off < size) {
+        unsigned codepoint;
         SZ char_size;
 
         codepoint = md_decode_unicode(label, off, size, &char_size);
-        is_whitespace = ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off]);
-
-        if(is_whitespace) {
-            codepoint = ' ';
-            hash = md_fnv1a(hash, &codepoint, sizeof(unsigned));
+        if(ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off])) {
             off = md_skip_unicode_whitespace(label, off, size);
+            if(off < size) {
+                if(n < buf_size)
+                    buf[n] = ' ';
+                n++;
+            }
         } else {
             MD_UNICODE_FOLD_INFO fold_info;
+            unsigned i;
 
             md_get_unicode_fold_info(codepoint, &fold_info);
-            hash = md_fnv1a(hash, fold_info.codepoints, fold_info.n_codepoints * sizeof(unsigned));
+            for(i = 0; i < fold_info.n_codepoints; i++) {
+                if(n < buf_size)
+                    buf[n] = fold_info.codepoints[i];
+                n++;
+            }
             off += char_size;
         }
     }
 
-    return hash;
-}
-
-static OFF
-md_link_label_cmp_load_fold_info(const CHAR* label, OFF off, SZ size,
-                                 MD_UNICODE_FOLD_INFO* fold_info)
-{
-    unsigned codepoint;
-    SZ char_size;
-
-    if(off >= size) {
-        /* Treat end of a link label as a whitespace. */
-        goto whitespace;
-    }
-
-    codepoint = md_decode_unicode(label, off, size, &char_size);
-    off += char_size;
-    if(ISUNICODEWHITESPACE_(codepoint)) {
-        /* Treat all whitespace as equivalent */
-        goto whitespace;
-    }
-
-    /* Get real folding info. */
-    md_get_unicode_fold_info(codepoint, fold_info);
-    return off;
-
-whitespace:
-    fold_info->codepoints[0] = _T(' ');
-    fold_info->n_codepoints = 1;
-    return md_skip_unicode_whitespace(label, off, size);
-}
-
-static int
-md_link_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size)
-{
-    OFF a_off;
-    OFF b_off;
-    MD_UNICODE_FOLD_INFO a_fi = { { 0 }, 0 };
-    MD_UNICODE_FOLD_INFO b_fi = { { 0 }, 0 };
-    OFF a_fi_off = 0;
-    OFF b_fi_off = 0;
-    int cmp;
-
-    a_off = md_skip_unicode_whitespace(a_label, 0, a_size);
-    b_off = md_skip_unicode_whitespace(b_label, 0, b_size);
-    while(a_off < a_size || a_fi_off < a_fi.n_codepoints ||
-          b_off < b_size || b_fi_off < b_fi.n_codepoints)
-    {
-        /* If needed, load fold info for next char. */
-        if(a_fi_off >= a_fi.n_codepoints) {
-            a_fi_off = 0;
-            a_off = md_link_label_cmp_load_fold_info(a_label, a_off, a_size, &a_fi);
-        }
-        if(b_fi_off >= b_fi.n_codepoints) {
-            b_fi_off = 0;
-            b_off = md_link_label_cmp_load_fold_info(b_label, b_off, b_size, &b_fi);
-        }
-
-        cmp = b_fi.codepoints[b_fi_off] - a_fi.codepoints[a_fi_off];
-        if(cmp != 0)
-            return cmp;
-
-        a_fi_off++;
-        b_fi_off++;
-    }
-
-    return 0;
-}
-
-typedef struct MD_REF_DEF_LIST_tag MD_REF_DEF_LIST;
-struct MD_REF_DEF_LIST_tag {
-    int n_ref_defs;
-    int alloc_ref_defs;
-    MD_REF_DEF* ref_defs[];  /* Valid items always  point into ctx->ref_defs[] */
-};
-
-static int
-md_ref_def_cmp(const void* a, const void* b)
-{
-    const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-    const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-    if(a_ref->hash < b_ref->hash)
-        return -1;
-    else if(a_ref->hash > b_ref->hash)
-        return +1;
-    else
-        return md_link_label_cmp(a_ref->label, a_ref->label_size, b_ref->label, b_ref->label_size);
-}
-
-static int
-md_ref_def_cmp_for_sort(const void* a, const void* b)
-{
-    int cmp;
-
-    cmp = md_ref_def_cmp(a, b);
-
-    /* Ensure stability of the sorting. */
-    if(cmp == 0) {
-        const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-        const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-        if(a_ref < b_ref)
-            cmp = -1;
-        else if(a_ref > b_ref)
-            cmp = +1;
-        else
-            cmp = 0;
-    }
-
-    return cmp;
+    return n;
 }
 
 static int
 md_build_ref_def_hashtable(MD_CTX* ctx)
 {
-    int i, j;
+    SZ n_labels = 0;
+    SZ alloc_labels = 0;
+    int mask;
+    int i;
 
     if(ctx->n_ref_defs == 0)
         return 0;
 
-    ctx->ref_def_hashtable_size = (ctx->n_ref_defs * 5) / 4;
-    ctx->ref_def_hashtable = malloc(ctx->ref_def_hashtable_size * sizeof(void*));
+    ctx->ref_def_hashtable_size = 16;
+    while(ctx->ref_def_hashtable_size < 2 * ctx->n_ref_defs)
+        ctx->ref_def_hashtable_size *= 2;
+    mask = ctx->ref_def_hashtable_size - 1;
+    ctx->ref_def_hashtable = (MD_REF_DEF**) MD_MALLOC(ctx->ref_def_hashtable_size * sizeof(MD_REF_DEF*));
     if(ctx->ref_def_hashtable == NULL) {
         MD_LOG("malloc() failed.");
         goto abort;
     }
-    memset(ctx->ref_def_hashtable, 0, ctx->ref_def_hashtable_size * sizeof(void*));
+    memset(ctx->ref_def_hashtable, 0, ctx->ref_def_hashtable_size * sizeof(MD_REF_DEF*));
 
-    /* Each member of ctx->ref_def_hashtable[] can be:
-     *  -- NULL,
-     *  -- pointer to the MD_REF_DEF in ctx->ref_defs[], or
-     *  -- pointer to a MD_REF_DEF_LIST, which holds multiple pointers to
-     *     such MD_REF_DEFs.
-     */
     for(i = 0; i < ctx->n_ref_defs; i++) {
         MD_REF_DEF* def = &ctx->ref_defs[i];
-        void* bucket;
-        MD_REF_DEF_LIST* list;
-
-        def->hash = md_link_label_hash(def->label, def->label_size);
-        bucket = ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size];
-
-        if(bucket == NULL) {
-            /* The bucket is empty. Make it just point to the def. */
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = def;
-            continue;
-        }
-
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-            /* The bucket already contains one ref. def. Lets see whether it
-             * is the same label (ref. def. duplicate) or different one
-             * (hash conflict). */
-            MD_REF_DEF* old_def = (MD_REF_DEF*) bucket;
-
-            if(md_link_label_cmp(def->label, def->label_size, old_def->label, old_def->label_size) == 0) {
-                /* Duplicate label: Ignore this ref. def. */
-                continue;
-            }
+        const unsigned* folded_label;
+        int slot;
 
-            /* Make the bucket complex, i.e. able to hold more ref. defs. */
-            list = (MD_REF_DEF_LIST*) malloc(sizeof(MD_REF_DEF_LIST) + 2 * sizeof(MD_REF_DEF*));
-            if(list == NULL) {
-                MD_LOG("malloc() failed.");
-                goto abort;
-            }
-            list->ref_defs[0] = old_def;
-            list->ref_defs[1] = def;
-            list->n_ref_defs = 2;
-            list->alloc_ref_defs = 2;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
-            continue;
-        }
+        /* Fold the label into ctx->ref_def_labels[]. */
+        if(n_labels + 3 * def->label_size > alloc_labels) {
+            unsigned* new_labels;
 
-        /* Append the def to the complex bucket list.
-         *
-         * Note in this case we ignore potential duplicates to avoid expensive
-         * iterating over the complex bucket. Below, we revisit all the complex
-         * buckets and handle it more cheaply after the complex bucket contents
-         * is sorted. */
-        list = (MD_REF_DEF_LIST*) bucket;
-        if(list->n_ref_defs >= list->alloc_ref_defs) {
-            int alloc_ref_defs = list->alloc_ref_defs + list->alloc_ref_defs / 2;
-            MD_REF_DEF_LIST* list_tmp = (MD_REF_DEF_LIST*) realloc(list,
-                        sizeof(MD_REF_DEF_LIST) + alloc_ref_defs * sizeof(MD_REF_DEF*));
-            if(list_tmp == NULL) {
+            alloc_labels = MAX(alloc_labels + alloc_labels / 2, n_labels + 3 * def->label_size);
+            new_labels = (unsigned*) MD_REALLOC(ctx->ref_def_labels, alloc_labels * sizeof(unsigned));
+            if(new_labels == NULL) {
                 MD_LOG("realloc() failed.");
                 goto abort;
             }
-            list = list_tmp;
-            list->alloc_ref_defs = alloc_ref_defs;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
+            ctx->ref_def_labels = new_labels;
         }
-
-        list->ref_defs[list->n_ref_defs] = def;
-        list->n_ref_defs++;
-    }
-
-    /* Sort the complex buckets so we can use bsearch() with them. */
-    for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-        void* bucket = ctx->ref_def_hashtable[i];
-        MD_REF_DEF_LIST* list;
-
-        if(bucket == NULL)
-            continue;
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
+        def->folded_label_off = n_labels;
+        def->folded_label_size = md_link_label_fold(def->label, def->label_size,
+                    ctx->ref_def_labels + n_labels, alloc_labels - n_labels);
+        folded_label = ctx->ref_def_labels + n_labels;
+        def->hash = md_fnv1a(MD_FNV1A_BASE, folded_label, def->folded_label_size * sizeof(unsigned));
+
+        /* Find a free slot. If we meet the same label on the way, this is a
+         * duplicate ref. def. and it is ignored: the 1st one wins. */
+        for(slot = def->hash & mask; ctx->ref_def_hashtable[slot] != NULL; slot = (slot + 1) & mask) {
+            const MD_REF_DEF* old_def = ctx->ref_def_hashtable[slot];
+
+            if(old_def->hash == def->hash  &&  old_def->folded_label_size == def->folded_label_size  &&
+               memcmp(ctx->ref_def_labels + old_def->folded_label_off, folded_label,
+                      def->folded_label_size * sizeof(unsigned)) == 0)
+                break;
+        }
+        if(ctx->ref_def_hashtable[slot] != NULL)
             continue;
 
-        list = (MD_REF_DEF_LIST*) bucket;
-        qsort(list->ref_defs, list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp_for_sort);
-
-        /* Disable all duplicates in the complex bucket by forcing all such
-         * records to point to the 1st such ref. def. I.e. no matter which
-         * record is found during the lookup, it will always point to the right
-         * ref. def. in ctx->ref_defs[]. */
-        for(j = 1; j < list->n_ref_defs; j++) {
-            if(md_ref_def_cmp(&list->ref_defs[j-1], &list->ref_defs[j]) == 0)
-                list->ref_defs[j] = list->ref_defs[j-1];
-        }
+        ctx->ref_def_hashtable[slot] = def;
+        n_labels += def->folded_label_size;
     }
 
     return 0;
@@ -1851,60 +2354,92 @@ abort:
 static void
 md_free_ref_def_hashtable(MD_CTX* ctx)
 {
-    if(ctx->ref_def_hashtable != NULL) {
-        int i;
+    MD_FREE(ctx->ref_def_hashtable);
+    MD_FREE(ctx->ref_def_labels);
+}
 
-        for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-            void* bucket = ctx->ref_def_hashtable[i];
-            if(bucket == NULL)
-                continue;
-            if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
-                continue;
-            free(bucket);
-        }
+/* Precompiled ref. defs (see md_ref_def_table_new()). The table owns a copy
+ * of the text the ref. defs. have been collected from, which their labels,
+ * titles and destinations refer to. */
+struct MD_REF_DEF_TABLE {
+    CHAR* text;
+    SZ size;
+    MD_REF_DEF* ref_defs;
+    int n_ref_defs;
+    MD_REF_DEF** ref_def_hashtable;
+    int ref_def_hashtable_size;
+    unsigned* ref_def_labels;
+};
+
+static const MD_REF_DEF*
+md_find_ref_def(MD_REF_DEF* const* hashtable, int hashtable_size, const unsigned* labels,
+                const unsigned* key, SZ key_size, unsigned hash)
+{
+    int mask = hashtable_size - 1;
+    int slot;
+
+    for(slot = hash & mask; hashtable[slot] != NULL; slot = (slot + 1) & mask) {
+        const MD_REF_DEF* def = hashtable[slot];
 
-        free(ctx->ref_def_hashtable);
+        if(def->hash == hash  &&  def->folded_label_size == key_size  &&
+           memcmp(labels + def->folded_label_off, key, key_size * sizeof(unsigned)) == 0)
+            return def;
     }
+
+    return NULL;
 }
 
+/* Size of the on-stack buffer for the canonical form of looked up labels.
+ * Longer labels use a heap buffer. */
+#define MD_REF_DEF_KEY_SIZE     128
+
+/* Look up the ref. def. of the document, or of MD_CTX::ext_ref_defs if the
+ * document has none of the label (or the other way around with
+ * MD_CTX::ext_ref_defs_first). The text which the destination offsets of
+ * the ref. def. refer to is stored to *p_dest_text. */
 static const MD_REF_DEF*
-md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
+md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size, const CHAR** p_dest_text)
 {
+    const MD_REF_DEF_TABLE* ext = ctx->ext_ref_defs;
+    unsigned key_buf[MD_REF_DEF_KEY_SIZE];
+    unsigned* key = key_buf;
+    SZ key_size;
     unsigned hash;
-    void* bucket;
-
-    if(ctx->ref_def_hashtable_size == 0)
-        return NULL;
+    const MD_REF_DEF* def = NULL;
 
-    hash = md_link_label_hash(label, label_size);
-    bucket = ctx->ref_def_hashtable[hash % ctx->ref_def_hashtable_size];
-
-    if(bucket == NULL) {
+    if(ctx->ref_def_hashtable_size == 0  &&  (ext == NULL  ||  ext->ref_def_hashtable_size == 0))
         return NULL;
-    } else if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-        const MD_REF_DEF* def = (MD_REF_DEF*) bucket;
 
-        if(md_link_label_cmp(def->label, def->label_size, label, label_size) == 0)
-            return def;
-        else
-            return NULL;
-    } else {
-        MD_REF_DEF_LIST* list = (MD_REF_DEF_LIST*) bucket;
-        MD_REF_DEF key_buf;
-        const MD_REF_DEF* key = &key_buf;
-        const MD_REF_DEF** ret;
-
-        key_buf.label = (CHAR*) label;
-        key_buf.label_size = label_size;
-        key_buf.hash = md_link_label_hash(key_buf.label, key_buf.label_size);
-
-        ret = (const MD_REF_DEF**) bsearch(&key, list->ref_defs,
-                    list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp);
-        if(ret != NULL)
-            return *ret;
-        else
+    key_size = md_link_label_fold(label, label_size, key_buf, MD_REF_DEF_KEY_SIZE);
+    if(key_size > MD_REF_DEF_KEY_SIZE) {
+        key = (unsigned*) MD_MALLOC(key_size * sizeof(unsigned));
+        if(key == NULL) {
+            MD_LOG("malloc() failed.");
             return NULL;
+        }
+        md_link_label_fold(label, label_size, key, key_size);
     }
+    hash = md_fnv1a(MD_FNV1A_BASE, key, key_size * sizeof(unsigned));
+
+    if(ctx->ext_ref_defs_first  &&  ext != NULL  &&  ext->ref_def_hashtable_size > 0) {
+        def = md_find_ref_def(ext->ref_def_hashtable, ext->ref_def_hashtable_size,
+                    ext->ref_def_labels, key, key_size, hash);
+        *p_dest_text = ext->text;
+    }
+    if(def == NULL  &&  ctx->ref_def_hashtable_size > 0) {
+        def = md_find_ref_def(ctx->ref_def_hashtable, ctx->ref_def_hashtable_size,
+                    ctx->ref_def_labels, key, key_size, hash);
+        *p_dest_text = ctx->text;
+    }
+    if(def == NULL  &&  !ctx->ext_ref_defs_first  &&  ext != NULL  &&  ext->ref_def_hashtable_size > 0) {
+        def = md_find_ref_def(ext->ref_def_hashtable, ext->ref_def_hashtable_size,
+                    ext->ref_def_labels, key, key_size, hash);
+        *p_dest_text = ext->text;
+    }
+
+    if(key != key_buf)
+        MD_FREE(key);
+    return def;
 }
 
 
@@ -1918,6 +2453,7 @@ md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
 
 typedef struct MD_LINK_ATTR_tag MD_LINK_ATTR;
 struct MD_LINK_ATTR_tag {
+    const CHAR* dest_text;  /* The text dest_beg and dest_end refer to. */
     OFF dest_beg;
     OFF dest_end;
 
@@ -2225,17 +2761,19 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lin
     /* So, it _is_ a reference definition. Remember it. */
     if(ctx->n_ref_defs >= ctx->alloc_ref_defs) {
         MD_REF_DEF* new_defs;
+        int alloc_ref_defs;
 
-        ctx->alloc_ref_defs = (ctx->alloc_ref_defs > 0
+        alloc_ref_defs = (ctx->alloc_ref_defs > 0
                 ? ctx->alloc_ref_defs + ctx->alloc_ref_defs / 2
                 : 16);
-        new_defs = (MD_REF_DEF*) realloc(ctx->ref_defs, ctx->alloc_ref_defs * sizeof(MD_REF_DEF));
+        new_defs = (MD_REF_DEF*) MD_REALLOC(ctx->ref_defs, alloc_ref_defs * sizeof(MD_REF_DEF));
         if(new_defs == NULL) {
             MD_LOG("realloc() failed.");
             goto abort;
         }
 
         ctx->ref_defs = new_defs;
+        ctx->alloc_ref_defs = alloc_ref_defs;
     }
     def = &ctx->ref_defs[ctx->n_ref_defs];
     memset(def, 0, sizeof(MD_REF_DEF));
@@ -2270,9 +2808,9 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lin
 abort:
     /* Failure. */
     if(def != NULL  &&  def->label_needs_free)
-        free(def->label);
+        MD_FREE(def->label);
     if(def != NULL  &&  def->title_needs_free)
-        free(def->title);
+        MD_FREE(def->title);
     return ret;
 }
 
@@ -2281,6 +2819,7 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
                      OFF beg, OFF end, MD_LINK_ATTR* attr)
 {
     const MD_REF_DEF* def;
+    const CHAR* dest_text;
     const MD_LINE* beg_line;
     int is_multiline;
     CHAR* label;
@@ -2308,8 +2847,9 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
         label_size = end - beg;
     }
 
-    def = md_lookup_ref_def(ctx, label, label_size);
+    def = md_lookup_ref_def(ctx, label, label_size, &dest_text);
     if(def != NULL) {
+        attr->dest_text = dest_text;
         attr->dest_beg = def->dest_beg;
         attr->dest_end = def->dest_end;
         attr->title = def->title;
@@ -2318,7 +2858,7 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     }
 
     if(is_multiline)
-        free(label);
+        MD_FREE(label);
 
     if(def != NULL) {
         /* See https://github.com/mity/md4c/issues/238 */
@@ -2353,6 +2893,7 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
 
     MD_ASSERT(CH(off) == _T('('));
     off++;
+    attr->dest_text = ctx->text;
 
     /* Optional white space with up to one line break. */
     while(off < lines[line_index].end  &&  ISWHITESPACE(off))
@@ -2433,7 +2974,7 @@ abort:
 }
 
 static void
-md_free_ref_defs(MD_CTX* ctx)
+md_clear_ref_defs(MD_CTX* ctx)
 {
     int i;
 
@@ -2441,12 +2982,19 @@ md_free_ref_defs(MD_CTX* ctx)
         MD_REF_DEF* def = &ctx->ref_defs[i];
 
         if(def->label_needs_free)
-            free(def->label);
+            MD_FREE(def->label);
         if(def->title_needs_free)
-            free(def->title);
+            MD_FREE(def->title);
     }
 
-    free(ctx->ref_defs);
+    ctx->n_ref_defs = 0;
+}
+
+static void
+md_free_ref_defs(MD_CTX* ctx)
+{
+    md_clear_ref_defs(ctx);
+    MD_FREE(ctx->ref_defs);
 }
 
 
@@ -2597,17 +3145,19 @@ md_add_mark(MD_CTX* ctx)
 {
     if(ctx->n_marks >= ctx->alloc_marks) {
         MD_MARK* new_marks;
+        int alloc_marks;
 
-        ctx->alloc_marks = (ctx->alloc_marks > 0
+        alloc_marks = (ctx->alloc_marks > 0
                 ? ctx->alloc_marks + ctx->alloc_marks / 2
                 : 64);
-        new_marks = realloc(ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
+        new_marks = MD_REALLOC(ctx->marks, alloc_marks * sizeof(MD_MARK));
         if(new_marks == NULL) {
             MD_LOG("realloc() failed.");
             return NULL;
         }
 
         ctx->marks = new_marks;
+        ctx->alloc_marks = alloc_marks;
     }
 
     return &ctx->marks[ctx->n_marks++];
@@ -2724,37 +3274,198 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
     }
 }
 
-static void
-md_build_mark_char_map(MD_CTX* ctx)
-{
-    memset(ctx->mark_char_map, 0, sizeof(ctx->mark_char_map));
+#ifdef MD4C_USE_SIMD
 
-    ctx->mark_char_map['\\'] = 1;
-    ctx->mark_char_map['*'] = 1;
-    ctx->mark_char_map['_'] = 1;
-    ctx->mark_char_map['`'] = 1;
-    ctx->mark_char_map['&'] = 1;
-    ctx->mark_char_map[';'] = 1;
-    ctx->mark_char_map['<'] = 1;
-    ctx->mark_char_map['>'] = 1;
-    ctx->mark_char_map['['] = 1;
-    ctx->mark_char_map['!'] = 1;
-    ctx->mark_char_map[']'] = 1;
-    ctx->mark_char_map['\0'] = 1;
+/* 0 = none, 1 = SSSE3, 2 = AVX2; -1 if not yet detected. Only accessed
+ * atomically through md_simd_level(), as several parses (and renderers of
+ * md4c-html.c) may run at once. */
+static int md_simd_level_cache = -1;
 
-    if(ctx->parser.flags & MD_FLAG_STRIKETHROUGH)
-        ctx->mark_char_map['~'] = 1;
+static int
+md_detect_simd_level(void)
+{
+    unsigned eax, ebx, ecx, edx;
+    int level = 0;
 
-    if(ctx->parser.flags & MD_FLAG_LATEXMATHSPANS)
-        ctx->mark_char_map['$'] = 1;
+    if(__get_cpuid(1, &eax, &ebx, &ecx, &edx)  &&  (ecx & bit_SSSE3)) {
+        level = 1;
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEEMAILAUTOLINKS)
-        ctx->mark_char_map['@'] = 1;
+        /* AVX2 also needs the OS to save the YMM registers (XCR0 bits 1, 2). */
+        if((ecx & bit_OSXSAVE)  &&  (ecx & bit_AVX)  &&  __get_cpuid_max(0, NULL) >= 7) {
+            unsigned xcr0_lo, xcr0_hi;
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEURLAUTOLINKS)
-        ctx->mark_char_map[':'] = 1;
+            __asm__ volatile("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+            __cpuid_count(7, 0, eax, ebx, ecx, edx);
+            if((xcr0_lo & 0x6) == 0x6  &&  (ebx & bit_AVX2))
+                level = 2;
+        }
+    }
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEWWWAUTOLINKS)
+    return level;
+}
+
+int
+md_simd_level(void)
+{
+    int level = __atomic_load_n(&md_simd_level_cache, __ATOMIC_RELAXED);
+
+    /* Racing threads all detect and store the same value. */
+    if(level < 0) {
+        level = md_detect_simd_level();
+        __atomic_store_n(&md_simd_level_cache, level, __ATOMIC_RELAXED);
+    }
+    return level;
+}
+
+/* Returns the position of the first mark char in the 16 bytes, or 16. */
+__attribute__((target("ssse3")))
+static inline unsigned
+md_scan_marks_16(__m128i v, __m128i lo_table, __m128i hi_table)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(v, nibble_mask));
+    __m128i hi = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask));
+    __m128i none = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+    unsigned hits = ~(unsigned) _mm_movemask_epi8(none) & 0xffff;
+
+    return (hits != 0 ? (unsigned) __builtin_ctz(hits) : 16);
+}
+
+/* Scans the 16-byte blocks from 'off' on. The rest (< 16 bytes) is done by
+ * one overlapping block ending at 'end'; the caller guarantees that it does
+ * not start before the original offset. */
+__attribute__((target("ssse3")))
+static inline OFF
+md_scan_marks_blocks_16(const MD_CTX* ctx, OFF off, OFF end, __m128i lo_table, __m128i hi_table)
+{
+    unsigned pos;
+
+    while(off + 16 <= end) {
+        pos = md_scan_marks_16(_mm_loadu_si128((const __m128i*) (ctx->text + off)),
+                               lo_table, hi_table);
+        if(pos < 16)
+            return off + pos;
+        off += 16;
+    }
+
+    if(off < end) {
+        OFF tail = end - 16;
+        pos = md_scan_marks_16(_mm_loadu_si128((const __m128i*) (ctx->text + tail)),
+                               lo_table, hi_table);
+        if(pos < 16)
+            return tail + pos;
+    }
+
+    return end;
+}
+
+__attribute__((target("ssse3")))
+static OFF
+md_scan_marks_ssse3(const MD_CTX* ctx, OFF off, OFF end)
+{
+    return md_scan_marks_blocks_16(ctx, off, end,
+                _mm_loadu_si128((const __m128i*) ctx->mark_nibble_lo),
+                _mm_loadu_si128((const __m128i*) ctx->mark_nibble_hi));
+}
+
+/* The 16-byte code is inlined here too, so it gets the VEX encoding and we
+ * avoid the AVX/SSE transition penalties. */
+__attribute__((target("avx2")))
+static OFF
+md_scan_marks_avx2(const MD_CTX* ctx, OFF off, OFF end)
+{
+    const __m128i lo_table = _mm_loadu_si128((const __m128i*) ctx->mark_nibble_lo);
+    const __m128i hi_table = _mm_loadu_si128((const __m128i*) ctx->mark_nibble_hi);
+    const __m256i lo_table2 = _mm256_broadcastsi128_si256(lo_table);
+    const __m256i hi_table2 = _mm256_broadcastsi128_si256(hi_table);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+
+    while(off + 32 <= end) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (ctx->text + off));
+        __m256i lo = _mm256_shuffle_epi8(lo_table2, _mm256_and_si256(v, nibble_mask));
+        __m256i hi = _mm256_shuffle_epi8(hi_table2, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask));
+        __m256i none = _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256());
+        unsigned hits = ~(unsigned) _mm256_movemask_epi8(none);
+
+        if(hits != 0)
+            return off + (OFF) __builtin_ctz(hits);
+        off += 32;
+    }
+
+    if(off < end  &&  end - off < 16)
+        off = end - 16;
+    return md_scan_marks_blocks_16(ctx, off, end, lo_table, hi_table);
+}
+
+static void
+md_build_mark_nibble_tables(MD_CTX* ctx)
+{
+    int simd_level = md_simd_level();
+    int i;
+
+    ctx->mark_scanner = NULL;
+    if(simd_level == 0)
+        return;
+
+    /* Every high nibble of ASCII gets a bit of its own, so the tables are
+     * exact for ASCII. Non-ASCII bytes map to no bits; that is fine as long
+     * as none of them is a mark char. */
+    memset(ctx->mark_nibble_lo, 0, sizeof(ctx->mark_nibble_lo));
+    memset(ctx->mark_nibble_hi, 0, sizeof(ctx->mark_nibble_hi));
+    for(i = 0; i < 8; i++)
+        ctx->mark_nibble_hi[i] = (unsigned char) (1 << i);
+    for(i = 0; i < (int) sizeof(ctx->mark_char_map); i++) {
+        if(ctx->mark_char_map[i]) {
+            if(i >= 128)
+                return;
+            ctx->mark_nibble_lo[i & 0xf] |= (unsigned char) (1 << (i >> 4));
+        }
+    }
+
+    ctx->mark_scanner = (simd_level >= 2 ? md_scan_marks_avx2 : md_scan_marks_ssse3);
+}
+
+#else
+
+int
+md_simd_level(void)
+{
+    return 0;
+}
+
+#endif  /* MD4C_USE_SIMD */
+
+static void
+md_build_mark_char_map(MD_CTX* ctx)
+{
+    memset(ctx->mark_char_map, 0, sizeof(ctx->mark_char_map));
+
+    ctx->mark_char_map['\\'] = 1;
+    ctx->mark_char_map['*'] = 1;
+    ctx->mark_char_map['_'] = 1;
+    ctx->mark_char_map['`'] = 1;
+    ctx->mark_char_map['&'] = 1;
+    ctx->mark_char_map[';'] = 1;
+    ctx->mark_char_map['<'] = 1;
+    ctx->mark_char_map['>'] = 1;
+    ctx->mark_char_map['['] = 1;
+    ctx->mark_char_map['!'] = 1;
+    ctx->mark_char_map[']'] = 1;
+    ctx->mark_char_map['\0'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_STRIKETHROUGH)
+        ctx->mark_char_map['~'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_LATEXMATHSPANS)
+        ctx->mark_char_map['$'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_PERMISSIVEEMAILAUTOLINKS)
+        ctx->mark_char_map['@'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_PERMISSIVEURLAUTOLINKS)
+        ctx->mark_char_map[':'] = 1;
+
+    if(ctx->parser.flags & MD_FLAG_PERMISSIVEWWWAUTOLINKS)
         ctx->mark_char_map['.'] = 1;
 
     if((ctx->parser.flags & MD_FLAG_TABLES) || (ctx->parser.flags & MD_FLAG_WIKILINKS))
@@ -2768,6 +3479,43 @@ md_build_mark_char_map(MD_CTX* ctx)
                 ctx->mark_char_map[i] = 1;
         }
     }
+
+#ifdef MD4C_USE_SIMD
+    md_build_mark_nibble_tables(ctx);
+#endif
+}
+
+#ifdef MD4C_USE_SIMD
+    #define MD_MARK_SCAN_MINLEN     16
+#endif
+
+/* Returns the offset of the first mark char in [off, end), or end if there
+ * is none. */
+static inline OFF
+md_scan_marks(const MD_CTX* ctx, OFF off, OFF end)
+{
+#ifdef MD4C_USE_UTF16
+    /* For UTF-16, mark_char_map[] covers only ASCII. */
+    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
+                                (ctx->mark_char_map[(unsigned char) CH(off)]))
+#else
+    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
+    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
+#endif
+
+#ifdef MD4C_USE_SIMD
+    if(ctx->mark_scanner != NULL  &&  end - off >= MD_MARK_SCAN_MINLEN)
+        return ctx->mark_scanner(ctx, off, end);
+#endif
+
+    /* Optimization: Use some loop unrolling. */
+    while(off + 3 < end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
+                         &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
+        off += 4;
+    while(off < end  &&  !IS_MARK_CHAR(off+0))
+        off++;
+
+    return off;
 }
 
 static int
@@ -3013,22 +3761,7 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_m
         while(TRUE) {
             CHAR ch;
 
-#ifdef MD4C_USE_UTF16
-    /* For UTF-16, mark_char_map[] covers only ASCII. */
-    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
-                                (ctx->mark_char_map[(unsigned char) CH(off)]))
-#else
-    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
-    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
-#endif
-
-            /* Optimization: Use some loop unrolling. */
-            while(off + 3 < line->end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
-                                       &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
-                off += 4;
-            while(off < line->end  &&  !IS_MARK_CHAR(off+0))
-                off++;
-
+            off = md_scan_marks(ctx, off, line->end);
             if(off >= line->end)
                 break;
 
@@ -3573,7 +4306,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
                             if(ctx->marks[mark->next].beg >= inline_link_end) {
                                 /* Cancel the link status. */
                                 if(attr.title_needs_free)
-                                    free(attr.title);
+                                    MD_FREE(attr.title);
                                 is_link = FALSE;
                                 break;
                             }
@@ -3606,10 +4339,11 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
             closer->flags |= MD_MARK_CLOSER | MD_MARK_RESOLVED;
 
             /* If it is a link, we store the destination and title in the two
-             * dummy marks after the opener. */
+             * dummy marks after the opener. (The destination need not be
+             * in the document, see MD_CTX::ext_ref_defs.) */
             MD_ASSERT(ctx->marks[opener_index+1].ch == 'D');
-            ctx->marks[opener_index+1].beg = attr.dest_beg;
-            ctx->marks[opener_index+1].end = attr.dest_end;
+            md_mark_store_ptr(ctx, opener_index+1, (void*) (attr.dest_text + attr.dest_beg));
+            ctx->marks[opener_index+1].prev = attr.dest_end - attr.dest_beg;
 
             MD_ASSERT(ctx->marks[opener_index+2].ch == 'D');
             md_mark_store_ptr(ctx, opener_index+2, attr.title);
@@ -4348,7 +5082,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
 
                     MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
                                 (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
-                                STR(dest_mark->beg), dest_mark->end - dest_mark->beg, FALSE,
+                                md_mark_get_ptr(ctx, (int)(dest_mark - ctx->marks)), dest_mark->prev, FALSE,
                                 md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
 								title_mark->prev));
 
@@ -4568,7 +5302,7 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     /* We have to remember the cell boundaries in local buffer because
      * ctx->marks[] shall be reused during cell contents processing. */
     n = ctx->n_table_cell_boundaries + 2;
-    pipe_offs = (OFF*) malloc(n * sizeof(OFF));
+    pipe_offs = (OFF*) MD_MALLOC(n * sizeof(OFF));
     if(pipe_offs == NULL) {
         MD_LOG("malloc() failed.");
         ret = -1;
@@ -4596,7 +5330,7 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     MD_LEAVE_BLOCK(MD_BLOCK_TR, NULL);
 
 abort:
-    free(pipe_offs);
+    MD_FREE(pipe_offs);
 
     ctx->table_cell_boundaries_head = -1;
     ctx->table_cell_boundaries_tail = -1;
@@ -4615,7 +5349,7 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
      * with the underlines. */
     MD_ASSERT(n_lines >= 2);
 
-    align = malloc(col_count * sizeof(MD_ALIGN));
+    align = MD_MALLOC(col_count * sizeof(MD_ALIGN));
     if(align == NULL) {
         MD_LOG("malloc() failed.");
         ret = -1;
@@ -4639,1851 +5373,4216 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
     }
 
 abort:
-    free(align);
+    MD_FREE(align);
     return ret;
 }
 
 
-/**************************
- ***  Processing Block  ***
- **************************/
-
-#define MD_BLOCK_CONTAINER_OPENER   0x01
-#define MD_BLOCK_CONTAINER_CLOSER   0x02
-#define MD_BLOCK_CONTAINER          (MD_BLOCK_CONTAINER_OPENER | MD_BLOCK_CONTAINER_CLOSER)
-#define MD_BLOCK_LOOSE_LIST         0x04
-#define MD_BLOCK_SETEXT_HEADER      0x08
-
-struct MD_BLOCK_tag {
-    MD_BLOCKTYPE type  :  8;
-    unsigned flags     :  8;
-
-    /* MD_BLOCK_H:      Header level (1 - 6)
-     * MD_BLOCK_CODE:   Non-zero if fenced, zero if indented.
-     * MD_BLOCK_LI:     Task mark character (0 if not task list item, 'x', 'X' or ' ').
-     * MD_BLOCK_TABLE:  Column count (as determined by the table underline).
-     */
-    unsigned data      : 16;
+/********************
+ ***  Event Tape  ***
+ ********************/
 
-    /* Leaf blocks:     Count of lines (MD_LINE or MD_VERBATIMLINE) on the block.
-     * MD_BLOCK_LI:     Task mark offset in the input doc.
-     * MD_BLOCK_OL:     Start item number.
-     */
-    MD_SIZE n_lines;
+/* The event tape is a buffer recording a sequence of MD_PARSER callbacks so
+ * that they can be replayed later (see md_parse_to_tape() and also
+ * MD_FLAG_PARALLELINLINES).
+ *
+ * The tape is a sequence of records. Each record starts with a header word:
+ *
+ *   -- bits 0-2:  Kind of the record (MD_TAPE_xxxx).
+ *   -- bit 3:     Set if the callback has got non-NULL detail.
+ *   -- bits 4-7:  MD_BLOCKTYPE, MD_SPANTYPE or MD_TEXTTYPE.
+ *   -- bits 8-31: For MD_TAPE_TEXT, size of the text. (If it does not fit,
+ *                 all the bits are set and the size follows in the next
+ *                 word.)
+ *
+ * Block and span records are followed by their detail structure, if any
+ * (see md_tape_push_detail()). Text records are followed by an offset of the
+ * text in the document; or, if the text is not part of the document (e.g. it
+ * comes from an entity or an escape), by MD_TAPE_INLINE and the text itself.
+ * MD_ATTRIBUTEs store their texts the same way.
+ *
+ * Everything in the tape is aligned to MD_TAPE_ALIGN so that the replay can
+ * point directly into it. */
+
+#define MD_TAPE_ALIGN               sizeof(unsigned)
+#define MD_TAPE_ALIGNED(size)       (((size) + MD_TAPE_ALIGN - 1) & ~(MD_TAPE_ALIGN - 1))
+
+#define MD_TAPE_ENTERBLOCK          0
+#define MD_TAPE_LEAVEBLOCK          1
+#define MD_TAPE_ENTERSPAN           2
+#define MD_TAPE_LEAVESPAN           3
+#define MD_TAPE_TEXT                4
+#define MD_TAPE_MARK                5   /* Not an event: Marks a stopping point of md_tape_replay(). */
+
+#define MD_TAPE_HAS_DETAIL          0x08
+#define MD_TAPE_BIGSIZE             0xffffff
+
+/* Special values of the text offset. */
+#define MD_TAPE_INLINE              ((unsigned) -1)
+#define MD_TAPE_NULL                ((unsigned) -2)
+
+struct MD_TAPE {
+    const CHAR* doc;        /* The document the text offsets refer to (while recording). */
+    SZ doc_size;
+    char* data;
+    size_t size;
+    size_t alloc;
 };
 
-struct MD_CONTAINER_tag {
-    CHAR ch;
-    unsigned is_loose    : 8;
-    unsigned is_task     : 8;
-    unsigned start;
-    unsigned mark_indent;
-    unsigned contents_indent;
-    OFF block_byte_off;
-    OFF task_mark_off;
-};
+static void
+md_tape_init(MD_TAPE* tape, const CHAR* doc, SZ doc_size)
+{
+    tape->doc = doc;
+    tape->doc_size = doc_size;
+    tape->data = NULL;
+    tape->size = 0;
+    tape->alloc = 0;
+}
 
+static void
+md_tape_fini(MD_TAPE* tape)
+{
+    MD_FREE(tape->data);
+}
 
-static int
-md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
+static void*
+md_tape_push(MD_TAPE* tape, size_t n_bytes)
 {
-    int i;
-    int ret;
+    void* ptr;
 
-    MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
-    MD_CHECK(md_process_inlines(ctx, lines, n_lines));
+    n_bytes = MD_TAPE_ALIGNED(n_bytes);
 
-abort:
-    /* Free any temporary memory blocks stored within some dummy marks. */
-    for(i = ctx->ptr_stack.top; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
-    ctx->ptr_stack.top = -1;
+    if(tape->size + n_bytes > tape->alloc) {
+        size_t alloc = (tape->alloc > 0 ? tape->alloc + tape->alloc / 2 : 4096);
+        char* new_data;
 
-    return ret;
+        if(alloc < tape->size + n_bytes)
+            alloc = tape->size + n_bytes;
+        if(!MD_FITS_SIZE(alloc)  &&  MD_FITS_SIZE(tape->size + n_bytes))
+            alloc = (MD_SIZE) -1;
+        new_data = (char*) MD_REALLOC(tape->data, alloc);
+        if(new_data == NULL)
+            return NULL;
+
+        tape->data = new_data;
+        tape->alloc = alloc;
+    }
+
+    ptr = tape->data + tape->size;
+    tape->size += n_bytes;
+    return ptr;
 }
 
 static int
-md_process_verbatim_block_contents(MD_CTX* ctx, MD_TEXTTYPE text_type, const MD_VERBATIMLINE* lines, MD_SIZE n_lines)
+md_tape_push_word(MD_TAPE* tape, unsigned word)
 {
-    static const CHAR indent_chunk_str[] = _T("                ");
-    static const SZ indent_chunk_size = SIZEOF_ARRAY(indent_chunk_str) - 1;
+    unsigned* ptr;
 
-    MD_SIZE line_index;
-    int ret = 0;
-
-    for(line_index = 0; line_index < n_lines; line_index++) {
-        const MD_VERBATIMLINE* line = &lines[line_index];
-        int indent = line->indent;
+    ptr = (unsigned*) md_tape_push(tape, sizeof(unsigned));
+    if(ptr == NULL)
+        return -1;
+    *ptr = word;
+    return 0;
+}
 
-        MD_ASSERT(indent >= 0);
+/* Push offset of the text, or the text itself if it is not in the document.
+ * (The size has to be stored by the caller.) */
+static int
+md_tape_push_chars(MD_TAPE* tape, const CHAR* str, SZ size)
+{
+    void* ptr;
 
-        /* Output code indentation. */
-        while(indent > (int) indent_chunk_size) {
-            MD_TEXT(text_type, indent_chunk_str, indent_chunk_size);
-            indent -= indent_chunk_size;
-        }
-        if(indent > 0)
-            MD_TEXT(text_type, indent_chunk_str, indent);
+    if(str == NULL)
+        return md_tape_push_word(tape, MD_TAPE_NULL);
 
-        /* Output the code line itself. */
-        MD_TEXT_INSECURE(text_type, STR(line->beg), line->end - line->beg);
+    if(tape->doc <= str  &&  str + size <= tape->doc + tape->doc_size  &&
+       (unsigned) (str - tape->doc) < MD_TAPE_NULL)
+        return md_tape_push_word(tape, (unsigned) (str - tape->doc));
 
-        /* Enforce end-of-line. */
-        MD_TEXT(text_type, _T("\n"), 1);
+    if(md_tape_push_word(tape, MD_TAPE_INLINE) != 0)
+        return -1;
+    if(size > 0) {
+        ptr = md_tape_push(tape, size * sizeof(CHAR));
+        if(ptr == NULL)
+            return -1;
+        memcpy(ptr, str, size * sizeof(CHAR));
     }
-
-abort:
-    return ret;
+    return 0;
 }
 
+/* Stored MD_ATTRIBUTE is: size, count of substrings (n), n MD_TEXTTYPEs,
+ * (n+1) MD_OFFSETs, and the text (as by md_tape_push_chars()). */
 static int
-md_process_code_block_contents(MD_CTX* ctx, int is_fenced, const MD_VERBATIMLINE* lines, MD_SIZE n_lines)
+md_tape_push_attribute(MD_TAPE* tape, const MD_ATTRIBUTE* attr)
 {
-    if(is_fenced) {
-        /* Skip the first line in case of fenced code: It is the fence.
-         * (Only the starting fence is present due to logic in md_analyze_line().) */
-        lines++;
-        n_lines--;
-    } else {
-        /* Ignore blank lines at start/end of indented code block. */
-        while(n_lines > 0  &&  lines[0].beg == lines[0].end) {
-            lines++;
-            n_lines--;
-        }
-        while(n_lines > 0  &&  lines[n_lines-1].beg == lines[n_lines-1].end) {
-            n_lines--;
-        }
-    }
+    unsigned n_substr;
+    void* ptr;
 
-    if(n_lines == 0)
-        return 0;
+    /* See the invariants documented with MD_ATTRIBUTE. */
+    n_substr = 1;
+    while(attr->substr_offsets[n_substr] < attr->size)
+        n_substr++;
 
-    return md_process_verbatim_block_contents(ctx, MD_TEXT_CODE, lines, n_lines);
+    if(md_tape_push_word(tape, attr->size) != 0  ||  md_tape_push_word(tape, n_substr) != 0)
+        return -1;
+
+    ptr = md_tape_push(tape, n_substr * sizeof(MD_TEXTTYPE) + (n_substr+1) * sizeof(MD_OFFSET));
+    if(ptr == NULL)
+        return -1;
+    memcpy(ptr, attr->substr_types, n_substr * sizeof(MD_TEXTTYPE));
+    memcpy((char*) ptr + n_substr * sizeof(MD_TEXTTYPE), attr->substr_offsets, (n_substr+1) * sizeof(MD_OFFSET));
+
+    return md_tape_push_chars(tape, attr->text, attr->size);
+}
+
+/* Size of the detail structure of the block which holds no pointers, or zero
+ * for other blocks. */
+static size_t
+md_tape_plain_detail_size(MD_BLOCKTYPE type)
+{
+    switch(type) {
+        case MD_BLOCK_UL:       return sizeof(MD_BLOCK_UL_DETAIL);
+        case MD_BLOCK_OL:       return sizeof(MD_BLOCK_OL_DETAIL);
+        case MD_BLOCK_LI:       return sizeof(MD_BLOCK_LI_DETAIL);
+        case MD_BLOCK_H:        return sizeof(MD_BLOCK_H_DETAIL);
+        case MD_BLOCK_TABLE:    return sizeof(MD_BLOCK_TABLE_DETAIL);
+        case MD_BLOCK_TH:       /* Pass through. */
+        case MD_BLOCK_TD:       return sizeof(MD_BLOCK_TD_DETAIL);
+        default:                return 0;
+    }
 }
 
 static int
-md_setup_fenced_code_detail(MD_CTX* ctx, const MD_BLOCK* block, MD_BLOCK_CODE_DETAIL* det,
-                            MD_ATTRIBUTE_BUILD* info_build, MD_ATTRIBUTE_BUILD* lang_build)
+md_tape_push_detail(MD_TAPE* tape, int is_span, unsigned type, const void* detail)
 {
-    const MD_VERBATIMLINE* fence_line = (const MD_VERBATIMLINE*)(block + 1);
-    OFF beg = fence_line->beg;
-    OFF end = fence_line->end;
-    OFF lang_end;
-    CHAR fence_ch = CH(fence_line->beg);
     int ret = 0;
 
-    /* Skip the fence itself. */
-    while(beg < ctx->size  &&  CH(beg) == fence_ch)
-        beg++;
-    /* Trim initial spaces. */
-    while(beg < ctx->size  &&  CH(beg) == _T(' '))
-        beg++;
-
-    /* Trim trailing spaces. */
-    while(end > beg  &&  CH(end-1) == _T(' '))
-        end--;
+    if(!is_span) {
+        size_t size = md_tape_plain_detail_size((MD_BLOCKTYPE) type);
 
-    /* Build info string attribute. */
-    MD_CHECK(md_build_attribute(ctx, STR(beg), end - beg, 0, &det->info, info_build));
+        if(size > 0) {
+            void* ptr = md_tape_push(tape, size);
+            if(ptr == NULL)
+                return -1;
+            memcpy(ptr, detail, size);
+        } else if(type == MD_BLOCK_CODE) {
+            const MD_BLOCK_CODE_DETAIL* det = (const MD_BLOCK_CODE_DETAIL*) detail;
+
+            MD_CHECK(md_tape_push_word(tape, (unsigned) det->fence_char));
+            if(det->fence_char != 0) {
+                MD_CHECK(md_tape_push_attribute(tape, &det->info));
+                MD_CHECK(md_tape_push_attribute(tape, &det->lang));
+            }
+        }
+    } else {
+        switch(type) {
+            case MD_SPAN_A:
+            {
+                const MD_SPAN_A_DETAIL* det = (const MD_SPAN_A_DETAIL*) detail;
 
-    /* Build info string attribute. */
-    lang_end = beg;
-    while(lang_end < end  &&  !ISWHITESPACE(lang_end))
-        lang_end++;
-    MD_CHECK(md_build_attribute(ctx, STR(beg), lang_end - beg, 0, &det->lang, lang_build));
+                MD_CHECK(md_tape_push_word(tape, (unsigned) det->is_autolink));
+                MD_CHECK(md_tape_push_attribute(tape, &det->href));
+                MD_CHECK(md_tape_push_attribute(tape, &det->title));
+                break;
+            }
 
-    det->fence_char = fence_ch;
+            case MD_SPAN_IMG:
+            {
+                const MD_SPAN_IMG_DETAIL* det = (const MD_SPAN_IMG_DETAIL*) detail;
+
+                MD_CHECK(md_tape_push_attribute(tape, &det->src));
+                MD_CHECK(md_tape_push_attribute(tape, &det->title));
+                break;
+            }
+
+            case MD_SPAN_WIKILINK:
+            {
+                const MD_SPAN_WIKILINK_DETAIL* det = (const MD_SPAN_WIKILINK_DETAIL*) detail;
+
+                MD_CHECK(md_tape_push_attribute(tape, &det->target));
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
 
 abort:
     return ret;
 }
 
 static int
-md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
+md_tape_record(MD_TAPE* tape, unsigned kind, unsigned type, const void* detail)
 {
-    union {
-        MD_BLOCK_H_DETAIL header;
-        MD_BLOCK_CODE_DETAIL code;
-        MD_BLOCK_TABLE_DETAIL table;
-    } det;
-    MD_ATTRIBUTE_BUILD info_build;
-    MD_ATTRIBUTE_BUILD lang_build;
-    int is_in_tight_list;
-    int clean_fence_code_detail = FALSE;
-    int ret = 0;
+    unsigned header = kind | (type << 4);
 
-    memset(&det, 0, sizeof(det));
+    if(detail != NULL)
+        header |= MD_TAPE_HAS_DETAIL;
+    if(md_tape_push_word(tape, header) != 0)
+        return -1;
 
-    if(ctx->n_containers == 0)
-        is_in_tight_list = FALSE;
-    else
-        is_in_tight_list = !ctx->containers[ctx->n_containers-1].is_loose;
+    if(detail == NULL)
+        return 0;
+    return md_tape_push_detail(tape, (kind == MD_TAPE_ENTERSPAN || kind == MD_TAPE_LEAVESPAN), type, detail);
+}
 
-    switch(block->type) {
-        case MD_BLOCK_H:
-            det.header.level = block->data;
-            break;
+static int
+md_tape_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    return md_tape_record((MD_TAPE*) userdata, MD_TAPE_ENTERBLOCK, type, detail);
+}
 
-        case MD_BLOCK_CODE:
-            /* For fenced code block, we may need to set the info string. */
-            if(block->data != 0) {
-                memset(&det.code, 0, sizeof(MD_BLOCK_CODE_DETAIL));
-                clean_fence_code_detail = TRUE;
-                MD_CHECK(md_setup_fenced_code_detail(ctx, block, &det.code, &info_build, &lang_build));
-            }
-            break;
+static int
+md_tape_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    return md_tape_record((MD_TAPE*) userdata, MD_TAPE_LEAVEBLOCK, type, detail);
+}
 
-        case MD_BLOCK_TABLE:
-            det.table.col_count = block->data;
-            det.table.head_row_count = 1;
-            det.table.body_row_count = block->n_lines - 2;
-            break;
+static int
+md_tape_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_tape_record((MD_TAPE*) userdata, MD_TAPE_ENTERSPAN, type, detail);
+}
 
-        default:
-            /* Noop. */
-            break;
+static int
+md_tape_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_tape_record((MD_TAPE*) userdata, MD_TAPE_LEAVESPAN, type, detail);
+}
+
+static int
+md_tape_text(MD_TEXTTYPE type, const CHAR* text, SZ size, void* userdata)
+{
+    MD_TAPE* tape = (MD_TAPE*) userdata;
+    unsigned header = MD_TAPE_TEXT | ((unsigned) type << 4);
+
+    if(size < MD_TAPE_BIGSIZE) {
+        if(md_tape_push_word(tape, header | (size << 8)) != 0)
+            return -1;
+    } else {
+        if(md_tape_push_word(tape, header | (MD_TAPE_BIGSIZE << 8)) != 0  ||
+           md_tape_push_word(tape, size) != 0)
+            return -1;
     }
 
-    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
-        MD_ENTER_BLOCK(block->type, (void*) &det);
+    return md_tape_push_chars(tape, text, size);
+}
 
-    /* Process the block contents accordingly to is type. */
-    switch(block->type) {
-        case MD_BLOCK_HR:
-            /* noop */
-            break;
+/* Set up the parser callbacks so that they record into a tape. */
+static void
+md_tape_setup_parser(MD_PARSER* parser)
+{
+    parser->enter_block = md_tape_enter_block;
+    parser->leave_block = md_tape_leave_block;
+    parser->enter_span = md_tape_enter_span;
+    parser->leave_span = md_tape_leave_span;
+    parser->text = md_tape_text;
+}
 
-        case MD_BLOCK_CODE:
-            MD_CHECK(md_process_code_block_contents(ctx, (block->data != 0),
-                            (const MD_VERBATIMLINE*)(block + 1), block->n_lines));
-            break;
+static unsigned
+md_tape_read_word(const MD_TAPE* tape, size_t* p_pos)
+{
+    unsigned word = *(const unsigned*) (tape->data + *p_pos);
+    *p_pos += sizeof(unsigned);
+    return word;
+}
 
-        case MD_BLOCK_HTML:
-            MD_CHECK(md_process_verbatim_block_contents(ctx, MD_TEXT_HTML,
-                            (const MD_VERBATIMLINE*)(block + 1), block->n_lines));
-            break;
+static const CHAR*
+md_tape_read_chars(const MD_TAPE* tape, const CHAR* doc, SZ size, size_t* p_pos)
+{
+    unsigned off = md_tape_read_word(tape, p_pos);
+    const CHAR* str;
 
-        case MD_BLOCK_TABLE:
-            MD_CHECK(md_process_table_block_contents(ctx, block->data,
-                            (const MD_LINE*)(block + 1), block->n_lines));
-            break;
+    switch(off) {
+        case MD_TAPE_NULL:
+            return NULL;
+
+        case MD_TAPE_INLINE:
+            str = (const CHAR*) (tape->data + *p_pos);
+            *p_pos += MD_TAPE_ALIGNED(size * sizeof(CHAR));
+            return str;
 
         default:
-            MD_CHECK(md_process_normal_block_contents(ctx,
-                            (const MD_LINE*)(block + 1), block->n_lines));
-            break;
+            return doc + off;
     }
+}
 
-    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
-        MD_LEAVE_BLOCK(block->type, (void*) &det);
-
-abort:
-    if(clean_fence_code_detail) {
-        md_free_attribute(ctx, &info_build);
-        md_free_attribute(ctx, &lang_build);
-    }
-    return ret;
+static void
+md_tape_read_attribute(const MD_TAPE* tape, const CHAR* doc, size_t* p_pos, MD_ATTRIBUTE* attr)
+{
+    unsigned n_substr;
+
+    attr->size = md_tape_read_word(tape, p_pos);
+    n_substr = md_tape_read_word(tape, p_pos);
+    attr->substr_types = (const MD_TEXTTYPE*) (tape->data + *p_pos);
+    attr->substr_offsets = (const MD_OFFSET*) (tape->data + *p_pos + n_substr * sizeof(MD_TEXTTYPE));
+    *p_pos += MD_TAPE_ALIGNED(n_substr * sizeof(MD_TEXTTYPE) + (n_substr+1) * sizeof(MD_OFFSET));
+    attr->text = md_tape_read_chars(tape, doc, attr->size, p_pos);
 }
 
+/* Replay the tape, starting at *p_pos, to the callbacks of the parser. Stops
+ * at the end of the tape or after the next MD_TAPE_MARK record. Returns
+ * non-zero if any callback does so. */
 static int
-md_process_all_blocks(MD_CTX* ctx)
+md_tape_replay(const MD_TAPE* tape, const CHAR* doc, size_t* p_pos,
+               const MD_PARSER* parser, void* userdata)
 {
-    int byte_off = 0;
+    union {
+        MD_BLOCK_UL_DETAIL ul;
+        MD_BLOCK_OL_DETAIL ol;
+        MD_BLOCK_LI_DETAIL li;
+        MD_BLOCK_H_DETAIL header;
+        MD_BLOCK_CODE_DETAIL code;
+        MD_BLOCK_TABLE_DETAIL table;
+        MD_BLOCK_TD_DETAIL td;
+        MD_SPAN_A_DETAIL a;
+        MD_SPAN_IMG_DETAIL img;
+        MD_SPAN_WIKILINK_DETAIL wikilink;
+    } det;
+    size_t pos = *p_pos;
     int ret = 0;
 
-    /* ctx->containers now is not needed for detection of lists and list items
-     * so we reuse it for tracking what lists are loose or tight. We rely
-     * on the fact the vector is large enough to hold the deepest nesting
-     * level of lists. */
-    ctx->n_containers = 0;
-
-    while(byte_off < ctx->n_block_bytes) {
-        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
-        union {
-            MD_BLOCK_UL_DETAIL ul;
-            MD_BLOCK_OL_DETAIL ol;
-            MD_BLOCK_LI_DETAIL li;
-        } det;
-
-        switch(block->type) {
-            case MD_BLOCK_UL:
-                det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
-                det.ul.mark = (CHAR) block->data;
-                break;
-
-            case MD_BLOCK_OL:
-                det.ol.start = block->n_lines;
-                det.ol.is_tight =  (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
-                det.ol.mark_delimiter = (CHAR) block->data;
-                break;
+    while(pos < tape->size) {
+        unsigned header = md_tape_read_word(tape, &pos);
+        unsigned kind = header & 0x07;
+        unsigned type = (header >> 4) & 0x0f;
+        void* detail = NULL;
 
-            case MD_BLOCK_LI:
-                det.li.is_task = (block->data != 0);
-                det.li.task_mark = (CHAR) block->data;
-                det.li.task_mark_offset = (OFF) block->n_lines;
-                break;
+        if(kind == MD_TAPE_TEXT) {
+            SZ size = header >> 8;
+            const CHAR* str;
 
-            default:
-                /* noop */
+            if(size == MD_TAPE_BIGSIZE)
+                size = md_tape_read_word(tape, &pos);
+            str = md_tape_read_chars(tape, doc, size, &pos);
+            ret = parser->text((MD_TEXTTYPE) type, str, size, userdata);
+            if(ret != 0)
                 break;
+            continue;
         }
 
-        if(block->flags & MD_BLOCK_CONTAINER) {
-            if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
-                MD_LEAVE_BLOCK(block->type, &det);
+        if(kind == MD_TAPE_MARK)
+            break;
 
-                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL || block->type == MD_BLOCK_QUOTE)
-                    ctx->n_containers--;
-            }
+        if(header & MD_TAPE_HAS_DETAIL) {
+            memset(&det, 0, sizeof(det));
+            detail = (void*) &det;
+
+            if(kind == MD_TAPE_ENTERBLOCK  ||  kind == MD_TAPE_LEAVEBLOCK) {
+                size_t size = md_tape_plain_detail_size((MD_BLOCKTYPE) type);
+
+                if(size > 0) {
+                    memcpy(&det, tape->data + pos, size);
+                    pos += MD_TAPE_ALIGNED(size);
+                } else if(type == MD_BLOCK_CODE) {
+                    det.code.fence_char = (CHAR) md_tape_read_word(tape, &pos);
+                    if(det.code.fence_char != 0) {
+                        md_tape_read_attribute(tape, doc, &pos, &det.code.info);
+                        md_tape_read_attribute(tape, doc, &pos, &det.code.lang);
+                    }
+                }
+            } else {
+                switch(type) {
+                    case MD_SPAN_A:
+                        det.a.is_autolink = (int) md_tape_read_word(tape, &pos);
+                        md_tape_read_attribute(tape, doc, &pos, &det.a.href);
+                        md_tape_read_attribute(tape, doc, &pos, &det.a.title);
+                        break;
 
-            if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
-                MD_ENTER_BLOCK(block->type, &det);
+                    case MD_SPAN_IMG:
+                        md_tape_read_attribute(tape, doc, &pos, &det.img.src);
+                        md_tape_read_attribute(tape, doc, &pos, &det.img.title);
+                        break;
 
-                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
-                    ctx->containers[ctx->n_containers].is_loose = (block->flags & MD_BLOCK_LOOSE_LIST);
-                    ctx->n_containers++;
-                } else if(block->type == MD_BLOCK_QUOTE) {
-                    /* This causes that any text in a block quote, even if
-                     * nested inside a tight list item, is wrapped with
-                     * <p>...</p>. */
-                    ctx->containers[ctx->n_containers].is_loose = TRUE;
-                    ctx->n_containers++;
+                    case MD_SPAN_WIKILINK:
+                        md_tape_read_attribute(tape, doc, &pos, &det.wikilink.target);
+                        break;
+
+                    default:
+                        break;
                 }
             }
-        } else {
-            MD_CHECK(md_process_leaf_block(ctx, block));
-
-            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
-                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
-            else
-                byte_off += block->n_lines * sizeof(MD_LINE);
         }
 
-        byte_off += sizeof(MD_BLOCK);
+        switch(kind) {
+            case MD_TAPE_ENTERBLOCK:    ret = parser->enter_block((MD_BLOCKTYPE) type, detail, userdata); break;
+            case MD_TAPE_LEAVEBLOCK:    ret = parser->leave_block((MD_BLOCKTYPE) type, detail, userdata); break;
+            case MD_TAPE_ENTERSPAN:     ret = parser->enter_span((MD_SPANTYPE) type, detail, userdata); break;
+            case MD_TAPE_LEAVESPAN:     ret = parser->leave_span((MD_SPANTYPE) type, detail, userdata); break;
+            default:                    MD_UNREACHABLE(); break;
+        }
+        if(ret != 0)
+            break;
     }
 
-    ctx->n_block_bytes = 0;
-
-abort:
+    *p_pos = pos;
     return ret;
 }
 
+/**************************
+ ***  Processing Block  ***
+ **************************/
 
-/************************************
- ***  Grouping Lines into Blocks  ***
- ************************************/
-
-static void*
-md_push_block_bytes(MD_CTX* ctx, int n_bytes)
-{
-    void* ptr;
-
-    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
-        void* new_block_bytes;
+#define MD_BLOCK_CONTAINER_OPENER   0x01
+#define MD_BLOCK_CONTAINER_CLOSER   0x02
+#define MD_BLOCK_CONTAINER          (MD_BLOCK_CONTAINER_OPENER | MD_BLOCK_CONTAINER_CLOSER)
+#define MD_BLOCK_LOOSE_LIST         0x04
+#define MD_BLOCK_SETEXT_HEADER      0x08
 
-        ctx->alloc_block_bytes = (ctx->alloc_block_bytes > 0
-                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
-                : 512);
-        new_block_bytes = realloc(ctx->block_bytes, ctx->alloc_block_bytes);
-        if(new_block_bytes == NULL) {
-            MD_LOG("realloc() failed.");
-            return NULL;
-        }
+struct MD_BLOCK_tag {
+    MD_BLOCKTYPE type  :  8;
+    unsigned flags     :  8;
 
-        /* Fix the ->current_block after the reallocation. */
-        if(ctx->current_block != NULL) {
-            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
-            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
-        }
+    /* MD_BLOCK_H:      Header level (1 - 6)
+     * MD_BLOCK_CODE:   Non-zero if fenced, zero if indented.
+     * MD_BLOCK_LI:     Task mark character (0 if not task list item, 'x', 'X' or ' ').
+     * MD_BLOCK_TABLE:  Column count (as determined by the table underline).
+     */
+    unsigned data      : 16;
 
-        ctx->block_bytes = new_block_bytes;
-    }
+    /* Leaf blocks:     Count of lines (MD_LINE or MD_VERBATIMLINE) on the block.
+     * MD_BLOCK_LI:     Task mark offset in the input doc.
+     * MD_BLOCK_OL:     Start item number.
+     */
+    MD_SIZE n_lines;
+};
 
-    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
-    ctx->n_block_bytes += n_bytes;
-    return ptr;
-}
-
-static int
-md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
-{
-    MD_BLOCK* block;
-
-    MD_ASSERT(ctx->current_block == NULL);
-
-    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
-    if(block == NULL)
-        return -1;
-
-    switch(line->type) {
-        case MD_LINE_HR:
-            block->type = MD_BLOCK_HR;
-            break;
-
-        case MD_LINE_ATXHEADER:
-        case MD_LINE_SETEXTHEADER:
-            block->type = MD_BLOCK_H;
-            break;
-
-        case MD_LINE_FENCEDCODE:
-        case MD_LINE_INDENTEDCODE:
-            block->type = MD_BLOCK_CODE;
-            break;
-
-        case MD_LINE_TEXT:
-            block->type = MD_BLOCK_P;
-            break;
-
-        case MD_LINE_HTML:
-            block->type = MD_BLOCK_HTML;
-            break;
-
-        case MD_LINE_BLANK:
-        case MD_LINE_SETEXTUNDERLINE:
-        case MD_LINE_TABLEUNDERLINE:
-        default:
-            MD_UNREACHABLE();
-            break;
-    }
+struct MD_CONTAINER_tag {
+    CHAR ch;
+    unsigned is_loose    : 8;
+    unsigned is_task     : 8;
+    unsigned start;
+    unsigned mark_indent;
+    unsigned contents_indent;
+    OFF block_byte_off;
+    OFF task_mark_off;
+};
 
-    block->flags = 0;
-    block->data = line->data;
-    block->n_lines = 0;
+struct MD_BOUNDARY_tag {
+    OFF beg;            /* Offset of the line in the text. */
+    int block_byte_off; /* Where its block starts in MD_CTX::block_bytes. */
+    int n_ref_defs;     /* Count of ref. defs. before the line. */
+};
 
-    ctx->current_block = block;
-    return 0;
-}
 
-/* Eat from start of current (textual) block any reference definitions and
- * remember them so we can resolve any links referring to them.
- *
- * (Reference definitions can only be at start of it as they cannot break
- * a paragraph.)
- */
 static int
-md_consume_link_reference_definitions(MD_CTX* ctx)
+md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
 {
-    MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-    MD_SIZE n_lines = ctx->current_block->n_lines;
-    MD_SIZE n = 0;
-
-    /* Compute how many lines at the start of the block form one or more
-     * reference definitions. */
-    while(n < n_lines) {
-        int n_link_ref_lines;
-
-        n_link_ref_lines = md_is_link_reference_definition(ctx,
-                                    lines + n, n_lines - n);
-        /* Not a reference definition? */
-        if(n_link_ref_lines == 0)
-            break;
-
-        /* We fail if it is the ref. def. but it could not be stored due
-         * a memory allocation error. */
-        if(n_link_ref_lines < 0)
-            return -1;
-
-        n += n_link_ref_lines;
-    }
+    int i;
+    int ret = 0;
 
-    /* If there was at least one reference definition, we need to remove
-     * its lines from the block, or perhaps even the whole block. */
-    if(n > 0) {
-        if(n == n_lines) {
-            /* Remove complete block. */
-            ctx->n_block_bytes -= n * sizeof(MD_LINE);
-            ctx->n_block_bytes -= sizeof(MD_BLOCK);
-            ctx->current_block = NULL;
-        } else {
-            /* Remove just some initial lines from the block. */
-            memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
-            ctx->current_block->n_lines -= n;
-            ctx->n_block_bytes -= n * sizeof(MD_LINE);
+    if(ctx->parser.flags & MD_FLAG_SKIPINLINES) {
+        /* Leave the contents to md_parse_inlines(). Unlike MD_TEXT(), report
+         * an empty line too (the first line of a task list item may be
+         * empty), as it counts for the line breaks; unless it is the only
+         * line, which has no contents at all. */
+        if(n_lines == 1  &&  lines[0].beg == lines[0].end)
+            return 0;
+        for(i = 0; i < (int) n_lines; i++) {
+            ret = ctx->parser.text(MD_TEXT_RAW, STR(lines[i].beg), lines[i].end - lines[i].beg, ctx->userdata);
+            if(ret != 0) {
+                MD_LOG("Aborted from text() callback.");
+                return ret;
+            }
         }
+        return 0;
     }
 
-    return 0;
+    MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
+    MD_CHECK(md_process_inlines(ctx, lines, n_lines));
+
+abort:
+    /* Free any temporary memory blocks stored within some dummy marks. */
+    for(i = ctx->ptr_stack.top; i >= 0; i = ctx->marks[i].next)
+        MD_FREE(md_mark_get_ptr(ctx, i));
+    ctx->ptr_stack.top = -1;
+
+    return ret;
 }
 
 static int
-md_end_current_block(MD_CTX* ctx)
+md_process_verbatim_block_contents(MD_CTX* ctx, MD_TEXTTYPE text_type, const MD_VERBATIMLINE* lines, MD_SIZE n_lines)
 {
+    static const CHAR indent_chunk_str[] = _T("                ");
+    static const SZ indent_chunk_size = SIZEOF_ARRAY(indent_chunk_str) - 1;
+
+    MD_SIZE line_index;
     int ret = 0;
 
-    if(ctx->current_block == NULL)
-        return ret;
+    for(line_index = 0; line_index < n_lines; line_index++) {
+        const MD_VERBATIMLINE* line = &lines[line_index];
+        int indent = line->indent;
 
-    /* Check whether there is a reference definition. (We do this here instead
-     * of in md_analyze_line() because reference definition can take multiple
-     * lines.) */
-    if(ctx->current_block->type == MD_BLOCK_P  ||
-       (ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)))
-    {
-        MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-        if(lines[0].beg < ctx->size  &&  CH(lines[0].beg) == _T('[')) {
-            MD_CHECK(md_consume_link_reference_definitions(ctx));
-            if(ctx->current_block == NULL)
-                return ret;
+        MD_ASSERT(indent >= 0);
+
+        /* Output code indentation. */
+        while(indent > (int) indent_chunk_size) {
+            MD_TEXT(text_type, indent_chunk_str, indent_chunk_size);
+            indent -= indent_chunk_size;
         }
-    }
+        if(indent > 0)
+            MD_TEXT(text_type, indent_chunk_str, indent);
 
-    if(ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)) {
-        MD_SIZE n_lines = ctx->current_block->n_lines;
+        /* Output the code line itself. */
+        MD_TEXT_INSECURE(text_type, STR(line->beg), line->end - line->beg);
 
-        if(n_lines > 1) {
-            /* Get rid of the underline. */
-            ctx->current_block->n_lines--;
-            ctx->n_block_bytes -= sizeof(MD_LINE);
-        } else {
-            /* Only the underline has left after eating the ref. defs.
-             * Keep the line as beginning of a new ordinary paragraph. */
-            ctx->current_block->type = MD_BLOCK_P;
-            return 0;
-        }
+        /* Enforce end-of-line. */
+        MD_TEXT(text_type, _T("\n"), 1);
     }
 
-    /* Mark we are not building any block anymore. */
-    ctx->current_block = NULL;
-
 abort:
     return ret;
 }
 
 static int
-md_add_line_into_current_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* analysis)
+md_process_code_block_contents(MD_CTX* ctx, int is_fenced, const MD_VERBATIMLINE* lines, MD_SIZE n_lines)
 {
-    MD_ASSERT(ctx->current_block != NULL);
-
-    if(ctx->current_block->type == MD_BLOCK_CODE || ctx->current_block->type == MD_BLOCK_HTML) {
-        MD_VERBATIMLINE* line;
-
-        line = (MD_VERBATIMLINE*) md_push_block_bytes(ctx, sizeof(MD_VERBATIMLINE));
-        if(line == NULL)
-            return -1;
-
-        line->indent = analysis->indent;
-        line->beg = analysis->beg;
-        line->end = analysis->end;
+    if(is_fenced) {
+        /* Skip the first line in case of fenced code: It is the fence.
+         * (Only the starting fence is present due to logic in md_analyze_line().) */
+        lines++;
+        n_lines--;
     } else {
-        MD_LINE* line;
-
-        line = (MD_LINE*) md_push_block_bytes(ctx, sizeof(MD_LINE));
-        if(line == NULL)
-            return -1;
-
-        line->beg = analysis->beg;
-        line->end = analysis->end;
+        /* Ignore blank lines at start/end of indented code block. */
+        while(n_lines > 0  &&  lines[0].beg == lines[0].end) {
+            lines++;
+            n_lines--;
+        }
+        while(n_lines > 0  &&  lines[n_lines-1].beg == lines[n_lines-1].end) {
+            n_lines--;
+        }
     }
-    ctx->current_block->n_lines++;
 
-    return 0;
+    if(n_lines == 0)
+        return 0;
+
+    return md_process_verbatim_block_contents(ctx, MD_TEXT_CODE, lines, n_lines);
 }
 
 static int
-md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
-                        unsigned data, unsigned flags)
+md_setup_fenced_code_detail(MD_CTX* ctx, const MD_BLOCK* block, MD_BLOCK_CODE_DETAIL* det,
+                            MD_ATTRIBUTE_BUILD* info_build, MD_ATTRIBUTE_BUILD* lang_build)
 {
-    MD_BLOCK* block;
+    const MD_VERBATIMLINE* fence_line = (const MD_VERBATIMLINE*)(block + 1);
+    OFF beg = fence_line->beg;
+    OFF end = fence_line->end;
+    OFF lang_end;
+    CHAR fence_ch = CH(fence_line->beg);
     int ret = 0;
 
-    MD_CHECK(md_end_current_block(ctx));
+    /* Skip the fence itself. */
+    while(beg < ctx->size  &&  CH(beg) == fence_ch)
+        beg++;
+    /* Trim initial spaces. */
+    while(beg < ctx->size  &&  CH(beg) == _T(' '))
+        beg++;
 
-    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
-    if(block == NULL)
-        return -1;
+    /* Trim trailing spaces. */
+    while(end > beg  &&  CH(end-1) == _T(' '))
+        end--;
 
-    block->type = type;
-    block->flags = flags;
-    block->data = data;
-    block->n_lines = start;
+    /* Build info string attribute. */
+    MD_CHECK(md_build_attribute(ctx, STR(beg), end - beg, 0, &det->info, info_build));
+
+    /* Build info string attribute. */
+    lang_end = beg;
+    while(lang_end < end  &&  !ISWHITESPACE(lang_end))
+        lang_end++;
+    MD_CHECK(md_build_attribute(ctx, STR(beg), lang_end - beg, 0, &det->lang, lang_build));
+
+    det->fence_char = fence_ch;
 
 abort:
     return ret;
 }
 
-
-
-/***********************
- ***  Line Analysis  ***
- ***********************/
-
 static int
-md_is_hr_line(MD_CTX* ctx, OFF beg, OFF* p_end, OFF* p_killer)
+md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block, int is_in_tight_list)
 {
-    OFF off = beg + 1;
-    int n = 1;
-
-    while(off < ctx->size  &&  (CH(off) == CH(beg) || CH(off) == _T(' ') || CH(off) == _T('\t'))) {
-        if(CH(off) == CH(beg))
-            n++;
-        off++;
-    }
+    union {
+        MD_BLOCK_H_DETAIL header;
+        MD_BLOCK_CODE_DETAIL code;
+        MD_BLOCK_TABLE_DETAIL table;
+    } det;
+    MD_ATTRIBUTE_BUILD info_build = { 0 };
+    MD_ATTRIBUTE_BUILD lang_build = { 0 };
+    int clean_fence_code_detail = FALSE;
+    int ret = 0;
 
-    if(n < 3) {
-        *p_killer = off;
-        return FALSE;
+    memset(&det, 0, sizeof(det));
+
+    switch(block->type) {
+        case MD_BLOCK_H:
+            det.header.level = block->data;
+            break;
+
+        case MD_BLOCK_CODE:
+            /* For fenced code block, we may need to set the info string. */
+            if(block->data != 0) {
+                memset(&det.code, 0, sizeof(MD_BLOCK_CODE_DETAIL));
+                clean_fence_code_detail = TRUE;
+                MD_CHECK(md_setup_fenced_code_detail(ctx, block, &det.code, &info_build, &lang_build));
+            }
+            break;
+
+        case MD_BLOCK_TABLE:
+            det.table.col_count = block->data;
+            det.table.head_row_count = 1;
+            det.table.body_row_count = block->n_lines - 2;
+            break;
+
+        default:
+            /* Noop. */
+            break;
     }
 
-    /* Nothing else can be present on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off)) {
-        *p_killer = off;
-        return FALSE;
+    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
+        MD_ENTER_BLOCK(block->type, (void*) &det);
+
+    /* Process the block contents accordingly to is type. */
+    switch(block->type) {
+        case MD_BLOCK_HR:
+            /* noop */
+            break;
+
+        case MD_BLOCK_CODE:
+            MD_CHECK(md_process_code_block_contents(ctx, (block->data != 0),
+                            (const MD_VERBATIMLINE*)(block + 1), block->n_lines));
+            break;
+
+        case MD_BLOCK_HTML:
+            MD_CHECK(md_process_verbatim_block_contents(ctx, MD_TEXT_HTML,
+                            (const MD_VERBATIMLINE*)(block + 1), block->n_lines));
+            break;
+
+        case MD_BLOCK_TABLE:
+            MD_CHECK(md_process_table_block_contents(ctx, block->data,
+                            (const MD_LINE*)(block + 1), block->n_lines));
+            break;
+
+        default:
+            MD_CHECK(md_process_normal_block_contents(ctx,
+                            (const MD_LINE*)(block + 1), block->n_lines));
+            break;
     }
 
-    *p_end = off;
-    return TRUE;
+    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
+        MD_LEAVE_BLOCK(block->type, (void*) &det);
+
+abort:
+    if(clean_fence_code_detail) {
+        md_free_attribute(ctx, &info_build);
+        md_free_attribute(ctx, &lang_build);
+    }
+    return ret;
 }
 
+#ifdef MD4C_USE_THREADS
+
+/* With MD_FLAG_PARALLELINLINES, contents of the leaf blocks is processed by
+ * a pool of worker threads. The leaf blocks are divided into batches of
+ * consecutive blocks; each worker takes the next batch, processes it with its
+ * own copy of the context and records all the callbacks into the batch's
+ * event tape. The calling thread then walks all the blocks as usual and
+ * replays the tapes in the document order.
+ *
+ * The only inline processing state spanning multiple blocks is the budget
+ * limiting output of link reference definitions (MD_CTX::max_ref_def_output).
+ * Each batch is processed with the full budget and it remembers how much of
+ * it has been used. If it is more than what would be left when processing the
+ * document sequentially, the batch is processed once again by the calling
+ * thread. */
+
+/* Count of leaf blocks in a batch. */
+#define PARALLEL_LEAF_BATCH         64
+
+/* How many batches may be processed ahead of the replay (per worker). */
+#define PARALLEL_BATCH_WINDOW       4
+
+typedef struct MD_LEAF_tag MD_LEAF;
+struct MD_LEAF_tag {
+    const MD_BLOCK* block;
+    int is_in_tight_list;
+};
+
+typedef struct MD_LEAF_BATCH_tag MD_LEAF_BATCH;
+struct MD_LEAF_BATCH_tag {
+    MD_TAPE tape;
+    SZ ref_def_output;      /* Consumed part of MD_CTX::max_ref_def_output. */
+    int ret;
+    int is_done;
+    int is_replayable;      /* Used only by the calling thread. */
+};
+
+typedef struct MD_LEAF_POOL_tag MD_LEAF_POOL;
+struct MD_LEAF_POOL_tag {
+    MD_CTX worker_ctx;      /* Template of the workers' contexts. */
+    MD_LEAF* leaves;
+    int n_leaves;
+    MD_LEAF_BATCH* batches;
+    int n_batches;
+    pthread_t* threads;
+    int n_threads;
+
+    /* Protected by the lock: */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int next_batch;         /* Next batch to be taken by a worker. */
+    int n_replayed;         /* Count of batches already replayed. */
+    int window;
+    int is_aborted;
+
+    /* Used only by the calling thread. */
+    int leaf_index;         /* Index of the leaf to be replayed next. */
+    size_t tape_pos;
+};
+
 static int
-md_is_atxheader_line(MD_CTX* ctx, OFF beg, OFF* p_beg, OFF* p_end, unsigned* p_level)
+md_tape_mark(MD_TAPE* tape)
 {
-    int n;
-    OFF off = beg + 1;
+    return md_tape_record(tape, MD_TAPE_MARK, 0, NULL);
+}
 
-    while(off < ctx->size  &&  CH(off) == _T('#')  &&  off - beg < 7)
-        off++;
-    n = off - beg;
+static void*
+md_leaf_pool_thread(void* arg)
+{
+    MD_LEAF_POOL* pool = (MD_LEAF_POOL*) arg;
+    MD_CTX wctx;
+    MD_CTX* ctx = &wctx;
 
-    if(n > 6)
-        return FALSE;
-    *p_level = n;
+    memcpy(&wctx, &pool->worker_ctx, sizeof(MD_CTX));
 
-    if(!(ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
-       !ISBLANK(off)  &&  !ISNEWLINE(off))
-        return FALSE;
+    pthread_mutex_lock(&pool->lock);
+    while(!pool->is_aborted  &&  pool->next_batch < pool->n_batches) {
+        MD_LEAF_BATCH* batch;
+        int i, n;
+        int ret = 0;
 
-    while(off < ctx->size  &&  ISBLANK(off))
-        off++;
-    *p_beg = off;
-    *p_end = off;
-    return TRUE;
+        if(pool->next_batch >= pool->n_replayed + pool->window) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+            continue;
+        }
+
+        batch = &pool->batches[pool->next_batch];
+        i = pool->next_batch * PARALLEL_LEAF_BATCH;
+        n = MIN(i + PARALLEL_LEAF_BATCH, pool->n_leaves);
+        pool->next_batch++;
+        pthread_mutex_unlock(&pool->lock);
+
+        ctx->userdata = &batch->tape;
+        ctx->max_ref_def_output = pool->worker_ctx.max_ref_def_output;
+        ctx->html_comment_horizon = 0;
+        ctx->html_proc_instr_horizon = 0;
+        ctx->html_decl_horizon = 0;
+        ctx->html_cdata_horizon = 0;
+
+        for(; i < n; i++) {
+            MD_CHECK(md_process_leaf_block(ctx, pool->leaves[i].block, pool->leaves[i].is_in_tight_list));
+            MD_CHECK(md_tape_mark(&batch->tape));
+        }
+
+abort:
+        pthread_mutex_lock(&pool->lock);
+        batch->ret = ret;
+        batch->ref_def_output = pool->worker_ctx.max_ref_def_output - ctx->max_ref_def_output;
+        if(ctx->max_ref_def_output == 0)
+            batch->ref_def_output = pool->worker_ctx.max_ref_def_output;
+        batch->is_done = TRUE;
+        pthread_cond_broadcast(&pool->cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    MD_FREE(wctx.buffer);
+    MD_FREE(wctx.marks);
+    return NULL;
 }
 
-static int
-md_is_setext_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_level)
+static void
+md_leaf_pool_destroy(MD_LEAF_POOL* pool)
 {
-    OFF off = beg + 1;
+    int i;
 
-    while(off < ctx->size  &&  CH(off) == CH(beg))
-        off++;
+    pthread_mutex_lock(&pool->lock);
+    pool->is_aborted = TRUE;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
 
-    /* Optionally, space(s) or tabs can follow. */
-    while(off < ctx->size  &&  ISBLANK(off))
-        off++;
+    for(i = 0; i < pool->n_threads; i++)
+        pthread_join(pool->threads[i], NULL);
 
-    /* But nothing more is allowed on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off))
-        return FALSE;
+    for(i = 0; i < pool->n_batches; i++)
+        md_tape_fini(&pool->batches[i].tape);
 
-    *p_level = (CH(beg) == _T('=') ? 1 : 2);
-    *p_end = off;
-    return TRUE;
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->lock);
+    MD_FREE(pool->threads);
+    MD_FREE(pool->batches);
+    MD_FREE(pool->leaves);
+    MD_FREE(pool);
 }
 
-static int
-md_is_table_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_col_count)
+/* Start processing of the leaf blocks in a worker pool. Returns NULL if the
+ * blocks should rather be processed sequentially. */
+static MD_LEAF_POOL*
+md_leaf_pool_create(MD_CTX* ctx)
 {
-    OFF off = beg;
-    int found_pipe = FALSE;
-    unsigned col_count = 0;
+    MD_LEAF_POOL* pool;
+    long n_cpus;
+    int byte_off = 0;
+    int n_containers = 0;
+    int alloc_leaves = 0;
+    int i;
 
-    if(off < ctx->size  &&  CH(off) == _T('|')) {
-        found_pipe = TRUE;
-        off++;
-        while(off < ctx->size  &&  ISWHITESPACE(off))
-            off++;
-    }
+    n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if(n_cpus < 2)
+        return NULL;
 
-    while(1) {
-        int delimited = FALSE;
+    pool = (MD_LEAF_POOL*) MD_MALLOC(sizeof(MD_LEAF_POOL));
+    if(pool == NULL)
+        return NULL;
+    memset(pool, 0, sizeof(MD_LEAF_POOL));
 
-        /* Cell underline ("-----", ":----", "----:" or ":----:") */
-        if(off < ctx->size  &&  CH(off) == _T(':'))
-            off++;
-        if(off >= ctx->size  ||  CH(off) != _T('-'))
-            return FALSE;
-        while(off < ctx->size  &&  CH(off) == _T('-'))
-            off++;
-        if(off < ctx->size  &&  CH(off) == _T(':'))
-            off++;
+    /* Collect the leaf blocks, together with the info whether they are in
+     * a tight list. (Same as md_process_all_blocks() does.) */
+    while(byte_off < ctx->n_block_bytes) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
 
-        col_count++;
-        if(col_count > TABLE_MAXCOLCOUNT) {
-            MD_LOG("Suppressing table (column_count >" STRINGIZE(TABLE_MAXCOLCOUNT) ")");
-            return FALSE;
-        }
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
+                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL || block->type == MD_BLOCK_QUOTE)
+                    n_containers--;
+            }
 
-        /* Pipe delimiter (optional at the end of line). */
-        while(off < ctx->size  &&  ISWHITESPACE(off))
-            off++;
-        if(off < ctx->size  &&  CH(off) == _T('|')) {
-            delimited = TRUE;
-            found_pipe =  TRUE;
-            off++;
-            while(off < ctx->size  &&  ISWHITESPACE(off))
-                off++;
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
+                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
+                    ctx->containers[n_containers].is_loose = (block->flags & MD_BLOCK_LOOSE_LIST);
+                    n_containers++;
+                } else if(block->type == MD_BLOCK_QUOTE) {
+                    ctx->containers[n_containers].is_loose = TRUE;
+                    n_containers++;
+                }
+            }
+        } else {
+            if(pool->n_leaves >= alloc_leaves) {
+                MD_LEAF* new_leaves;
+
+                alloc_leaves = (alloc_leaves > 0 ? alloc_leaves * 2 : 256);
+                new_leaves = (MD_LEAF*) MD_REALLOC(pool->leaves, alloc_leaves * sizeof(MD_LEAF));
+                if(new_leaves == NULL) {
+                    MD_FREE(pool->leaves);
+                    MD_FREE(pool);
+                    return NULL;
+                }
+                pool->leaves = new_leaves;
+            }
+
+            pool->leaves[pool->n_leaves].block = block;
+            pool->leaves[pool->n_leaves].is_in_tight_list =
+                    (n_containers > 0  &&  !ctx->containers[n_containers-1].is_loose);
+            pool->n_leaves++;
+
+            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+            else
+                byte_off += block->n_lines * sizeof(MD_LINE);
         }
 
-        /* Success, if we reach end of line. */
-        if(off >= ctx->size  ||  ISNEWLINE(off))
-            break;
+        byte_off += sizeof(MD_BLOCK);
+    }
 
-        if(!delimited)
-            return FALSE;
+    pool->n_batches = (pool->n_leaves + PARALLEL_LEAF_BATCH - 1) / PARALLEL_LEAF_BATCH;
+    pool->n_threads = (int) MIN(n_cpus - 1, pool->n_batches - 1);
+    if(pool->n_threads < 1) {
+        MD_FREE(pool->leaves);
+        MD_FREE(pool);
+        return NULL;
     }
 
-    if(!found_pipe)
-        return FALSE;
+    pool->batches = (MD_LEAF_BATCH*) MD_MALLOC(pool->n_batches * sizeof(MD_LEAF_BATCH));
+    pool->threads = (pthread_t*) MD_MALLOC(pool->n_threads * sizeof(pthread_t));
+    if(pool->batches == NULL  ||  pool->threads == NULL) {
+        MD_FREE(pool->batches);
+        MD_FREE(pool->threads);
+        MD_FREE(pool->leaves);
+        MD_FREE(pool);
+        return NULL;
+    }
+    memset(pool->batches, 0, pool->n_batches * sizeof(MD_LEAF_BATCH));
+    for(i = 0; i < pool->n_batches; i++)
+        md_tape_init(&pool->batches[i].tape, ctx->text, ctx->size);
+
+    /* Workers get their own buffers for inline processing; everything else
+     * they need is read-only by now. */
+    memcpy(&pool->worker_ctx, ctx, sizeof(MD_CTX));
+    md_tape_setup_parser(&pool->worker_ctx.parser);
+    pool->worker_ctx.parser.debug_log = NULL;
+    pool->worker_ctx.buffer = NULL;
+    pool->worker_ctx.alloc_buffer = 0;
+    pool->worker_ctx.marks = NULL;
+    pool->worker_ctx.n_marks = 0;
+    pool->worker_ctx.alloc_marks = 0;
+
+    pool->window = pool->n_threads * PARALLEL_BATCH_WINDOW;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+
+    for(i = 0; i < pool->n_threads; i++) {
+        if(pthread_create(&pool->threads[i], NULL, md_leaf_pool_thread, pool) != 0)
+            break;
+    }
+    pool->n_threads = i;
+    if(pool->n_threads == 0) {
+        md_leaf_pool_destroy(pool);
+        return NULL;
+    }
 
-    *p_end = off;
-    *p_col_count = col_count;
-    return TRUE;
+    return pool;
 }
 
+/* Replay the next leaf block recorded by the pool, or process it if the pool
+ * could not do it. */
 static int
-md_is_opening_code_fence(MD_CTX* ctx, OFF beg, OFF* p_end)
+md_leaf_pool_replay(MD_CTX* ctx, MD_LEAF_POOL* pool, const MD_BLOCK* block, int is_in_tight_list)
 {
-    OFF off = beg;
+    int index = pool->leaf_index / PARALLEL_LEAF_BATCH;
+    MD_LEAF_BATCH* batch = &pool->batches[index];
+    int ret = 0;
 
-    while(off < ctx->size && CH(off) == CH(beg))
-        off++;
+    MD_ASSERT(pool->leaves[pool->leaf_index].block == block);
 
-    /* Fence must have at least three characters. */
-    if(off - beg < 3)
-        return FALSE;
+    if(pool->leaf_index % PARALLEL_LEAF_BATCH == 0) {
+        pthread_mutex_lock(&pool->lock);
+        while(!batch->is_done)
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        pthread_mutex_unlock(&pool->lock);
 
-    ctx->code_fence_length = off - beg;
+        /* If the batch has failed or it would run out of the budget,
+         * we process it ourselves. */
+        batch->is_replayable = (batch->ret == 0  &&  (batch->ref_def_output == 0  ||
+                                batch->ref_def_output < ctx->max_ref_def_output));
+        if(batch->is_replayable)
+            ctx->max_ref_def_output -= batch->ref_def_output;
+        pool->tape_pos = 0;
+    }
 
-    /* Optionally, space(s) can follow. */
-    while(off < ctx->size  &&  CH(off) == _T(' '))
-        off++;
+    if(batch->is_replayable) {
+        ret = md_tape_replay(&batch->tape, ctx->text, &pool->tape_pos, &ctx->parser, ctx->userdata);
+        if(ret != 0)
+            MD_LOG("Aborted from a callback.");
+    } else {
+        ret = md_process_leaf_block(ctx, block, is_in_tight_list);
+    }
 
-    /* Optionally, an info string can follow. */
-    while(off < ctx->size  &&  !ISNEWLINE(off)) {
-        /* Backtick-based fence must not contain '`' in the info string. */
-        if(CH(beg) == _T('`')  &&  CH(off) == _T('`'))
-            return FALSE;
-        off++;
+    pool->leaf_index++;
+    if(pool->leaf_index % PARALLEL_LEAF_BATCH == 0  ||  pool->leaf_index == pool->n_leaves) {
+        md_tape_fini(&batch->tape);
+        md_tape_init(&batch->tape, ctx->text, ctx->size);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->n_replayed++;
+        pthread_cond_broadcast(&pool->cond);
+        pthread_mutex_unlock(&pool->lock);
     }
 
-    *p_end = off;
-    return TRUE;
+    return ret;
 }
 
+#endif  /* #ifdef MD4C_USE_THREADS */
+
+/* Report the boundaries which precede the block at byte_off. */
 static int
-md_is_closing_code_fence(MD_CTX* ctx, CHAR ch, OFF beg, OFF* p_end)
+md_report_boundaries(MD_CTX* ctx, int* p_index, int byte_off)
 {
-    OFF off = beg;
-    int ret = FALSE;
-
-    /* Closing fence must have at least the same length and use same char as
-     * opening one. */
-    while(off < ctx->size  &&  CH(off) == ch)
-        off++;
-    if(off - beg < ctx->code_fence_length)
-        goto out;
+    int ret = 0;
 
-    /* Optionally, space(s) can follow */
-    while(off < ctx->size  &&  CH(off) == _T(' '))
-        off++;
+    while(*p_index < ctx->n_boundaries  &&  ctx->boundaries[*p_index].block_byte_off == byte_off) {
+        const MD_BOUNDARY* boundary = &ctx->boundaries[*p_index];
 
-    /* But nothing more is allowed on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off))
-        goto out;
-
-    ret = TRUE;
+        ret = ctx->boundary_callback(ctx->input_off + boundary->beg,
+                                     (MD_SIZE) boundary->n_ref_defs, ctx->userdata);
+        if(ret != 0) {
+            MD_LOG("Aborted from a callback.");
+            break;
+        }
+        (*p_index)++;
+    }
 
-out:
-    /* Note we set *p_end even on failure: If we are not closing fence, caller
-     * would eat the line anyway without any parsing. */
-    *p_end = off;
     return ret;
 }
 
+static int
+md_process_all_blocks(MD_CTX* ctx)
+{
+    int byte_off = 0;
+    int i_boundary = 0;
+    int ret = 0;
+#ifdef MD4C_USE_THREADS
+    MD_LEAF_POOL* pool = NULL;
 
-/* Helper data for md_is_html_block_start_condition() and
- * md_is_html_block_end_condition() */
-typedef struct TAG_tag TAG;
-struct TAG_tag {
-    const CHAR* name;
-    unsigned len    : 8;
-};
-
-#ifdef X
-    #undef X
+    if((ctx->parser.flags & MD_FLAG_PARALLELINLINES)  &&  !(ctx->parser.flags & MD_FLAG_SKIPINLINES))
+        pool = md_leaf_pool_create(ctx);
 #endif
-#define X(name)     { _T(name), (sizeof(name)-1) / sizeof(CHAR) }
-#define Xend        { NULL, 0 }
-
-static const TAG t1[] = { X("pre"), X("script"), X("style"), X("textarea"), Xend };
-
-static const TAG a6[] = { X("address"), X("article"), X("aside"), Xend };
-static const TAG b6[] = { X("base"), X("basefont"), X("blockquote"), X("body"), Xend };
-static const TAG c6[] = { X("caption"), X("center"), X("col"), X("colgroup"), Xend };
-static const TAG d6[] = { X("dd"), X("details"), X("dialog"), X("dir"),
-                          X("div"), X("dl"), X("dt"), Xend };
-static const TAG f6[] = { X("fieldset"), X("figcaption"), X("figure"), X("footer"),
-                          X("form"), X("frame"), X("frameset"), Xend };
-static const TAG h6[] = { X("h1"), X("h2"), X("h3"), X("h4"), X("h5"), X("h6"),
-                          X("head"), X("header"), X("hr"), X("html"), Xend };
-static const TAG i6[] = { X("iframe"), Xend };
-static const TAG l6[] = { X("legend"), X("li"), X("link"), Xend };
-static const TAG m6[] = { X("main"), X("menu"), X("menuitem"), Xend };
-static const TAG n6[] = { X("nav"), X("noframes"), Xend };
-static const TAG o6[] = { X("ol"), X("optgroup"), X("option"), Xend };
-static const TAG p6[] = { X("p"), X("param"), Xend };
-static const TAG s6[] = { X("search"), X("section"), X("summary"), Xend };
-static const TAG t6[] = { X("table"), X("tbody"), X("td"), X("tfoot"), X("th"),
-                          X("thead"), X("title"), X("tr"), X("track"), Xend };
-static const TAG u6[] = { X("ul"), Xend };
-static const TAG xx[] = { Xend };
 
-#undef X
-#undef Xend
+    /* ctx->containers now is not needed for detection of lists and list items
+     * so we reuse it for tracking what lists are loose or tight. We rely
+     * on the fact the vector is large enough to hold the deepest nesting
+     * level of lists. */
+    ctx->n_containers = 0;
 
-/* Returns type of the raw HTML block, or FALSE if it is not HTML block.
- * (Refer to CommonMark specification for details about the types.)
- */
-static int
-md_is_html_block_start_condition(MD_CTX* ctx, OFF beg)
-{
-    /* Type 6 is started by a long list of allowed tags. We use two-level
-     * tree to speed-up the search. */
-    static const TAG* map6[26] = {
-        a6, b6, c6, d6, xx, f6, xx, h6, i6, xx, xx, l6, m6,
-        n6, o6, p6, xx, xx, s6, t6, u6, xx, xx, xx, xx, xx
-    };
-    OFF off = beg + 1;
-    int i;
+    while(byte_off < ctx->n_block_bytes) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
+        union {
+            MD_BLOCK_UL_DETAIL ul;
+            MD_BLOCK_OL_DETAIL ol;
+            MD_BLOCK_LI_DETAIL li;
+        } det;
 
-    /* Check for type 1: <script, <pre, or <style */
-    for(i = 0; t1[i].name != NULL; i++) {
-        if(off + t1[i].len <= ctx->size) {
-            if(md_ascii_case_eq(STR(off), t1[i].name, t1[i].len))
-                return 1;
-        }
-    }
+        if(i_boundary < ctx->n_boundaries)
+            MD_CHECK(md_report_boundaries(ctx, &i_boundary, byte_off));
 
-    /* Check for type 2: <!-- */
-    if(off + 3 < ctx->size  &&  CH(off) == _T('!')  &&  CH(off+1) == _T('-')  &&  CH(off+2) == _T('-'))
-        return 2;
+        switch(block->type) {
+            case MD_BLOCK_UL:
+                det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
+                det.ul.mark = (CHAR) block->data;
+                break;
 
-    /* Check for type 3: <? */
-    if(off < ctx->size  &&  CH(off) == _T('?'))
-        return 3;
+            case MD_BLOCK_OL:
+                det.ol.start = block->n_lines;
+                det.ol.is_tight =  (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
+                det.ol.mark_delimiter = (CHAR) block->data;
+                break;
 
-    /* Check for type 4 or 5: <! */
-    if(off < ctx->size  &&  CH(off) == _T('!')) {
-        /* Check for type 4: <! followed by uppercase letter. */
-        if(off + 1 < ctx->size  &&  ISASCII(off+1))
-            return 4;
+            case MD_BLOCK_LI:
+                det.li.is_task = (block->data != 0);
+                det.li.task_mark = (CHAR) block->data;
+                det.li.task_mark_offset = (OFF) block->n_lines;
+                if(block->data != 0)
+                    det.li.task_mark_offset += ctx->input_off;
+                break;
 
-        /* Check for type 5: <![CDATA[ */
-        if(off + 8 < ctx->size) {
-            if(md_ascii_eq(STR(off), _T("![CDATA["), 8))
-                return 5;
+            default:
+                /* noop */
+                break;
         }
-    }
 
-    /* Check for type 6: Many possible starting tags listed above. */
-    if(off + 1 < ctx->size  &&  (ISALPHA(off) || (CH(off) == _T('/') && ISALPHA(off+1)))) {
-        int slot;
-        const TAG* tags;
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
+                MD_LEAVE_BLOCK(block->type, &det);
 
-        if(CH(off) == _T('/'))
-            off++;
+                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL || block->type == MD_BLOCK_QUOTE)
+                    ctx->n_containers--;
+            }
 
-        slot = (ISUPPER(off) ? CH(off) - 'A' : CH(off) - 'a');
-        tags = map6[slot];
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
+                MD_ENTER_BLOCK(block->type, &det);
 
-        for(i = 0; tags[i].name != NULL; i++) {
-            if(off + tags[i].len <= ctx->size) {
-                if(md_ascii_case_eq(STR(off), tags[i].name, tags[i].len)) {
-                    OFF tmp = off + tags[i].len;
-                    if(tmp >= ctx->size)
-                        return 6;
-                    if(ISBLANK(tmp) || ISNEWLINE(tmp) || CH(tmp) == _T('>'))
-                        return 6;
-                    if(tmp+1 < ctx->size && CH(tmp) == _T('/') && CH(tmp+1) == _T('>'))
-                        return 6;
-                    break;
+                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
+                    ctx->containers[ctx->n_containers].is_loose = (block->flags & MD_BLOCK_LOOSE_LIST);
+                    ctx->n_containers++;
+                } else if(block->type == MD_BLOCK_QUOTE) {
+                    /* This causes that any text in a block quote, even if
+                     * nested inside a tight list item, is wrapped with
+                     * <p>...</p>. */
+                    ctx->containers[ctx->n_containers].is_loose = TRUE;
+                    ctx->n_containers++;
                 }
             }
-        }
-    }
+        } else {
+            int is_in_tight_list;
 
-    /* Check for type 7: any COMPLETE other opening or closing tag. */
-    if(off + 1 < ctx->size) {
-        OFF end;
+            if(ctx->n_containers == 0)
+                is_in_tight_list = FALSE;
+            else
+                is_in_tight_list = !ctx->containers[ctx->n_containers-1].is_loose;
 
-        if(md_is_html_tag(ctx, NULL, 0, beg, ctx->size, &end)) {
-            /* Only optional whitespace and new line may follow. */
-            while(end < ctx->size  &&  ISWHITESPACE(end))
-                end++;
-            if(end >= ctx->size  ||  ISNEWLINE(end))
-                return 7;
+#ifdef MD4C_USE_THREADS
+            if(pool != NULL)
+                MD_CHECK(md_leaf_pool_replay(ctx, pool, block, is_in_tight_list));
+            else
+#endif
+                MD_CHECK(md_process_leaf_block(ctx, block, is_in_tight_list));
+
+            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+            else
+                byte_off += block->n_lines * sizeof(MD_LINE);
         }
+
+        byte_off += sizeof(MD_BLOCK);
     }
 
-    return FALSE;
+    if(i_boundary < ctx->n_boundaries)
+        MD_CHECK(md_report_boundaries(ctx, &i_boundary, byte_off));
+
+    ctx->n_block_bytes = 0;
+
+abort:
+#ifdef MD4C_USE_THREADS
+    if(pool != NULL)
+        md_leaf_pool_destroy(pool);
+#endif
+    return ret;
 }
 
-/* Case sensitive check whether there is a substring 'what' between 'beg'
- * and end of line. */
-static int
-md_line_contains(MD_CTX* ctx, OFF beg, const CHAR* what, SZ what_len, OFF* p_end)
+
+/************************************
+ ***  Grouping Lines into Blocks  ***
+ ************************************/
+
+static void*
+md_push_block_bytes(MD_CTX* ctx, int n_bytes)
 {
-    OFF i;
-    for(i = beg; i + what_len < ctx->size; i++) {
-        if(ISNEWLINE(i))
-            break;
-        if(memcmp(STR(i), what, what_len * sizeof(CHAR)) == 0) {
-            *p_end = i + what_len;
-            return TRUE;
+    void* ptr;
+
+    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
+        void* new_block_bytes;
+        int alloc_block_bytes;
+
+        alloc_block_bytes = (ctx->alloc_block_bytes > 0
+                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
+                : 512);
+        new_block_bytes = MD_REALLOC(ctx->block_bytes, alloc_block_bytes);
+        if(new_block_bytes == NULL) {
+            MD_LOG("realloc() failed.");
+            return NULL;
+        }
+
+        /* Fix the ->current_block after the reallocation. */
+        if(ctx->current_block != NULL) {
+            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
+            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
         }
+
+        ctx->block_bytes = new_block_bytes;
+        ctx->alloc_block_bytes = alloc_block_bytes;
     }
 
-    *p_end = i;
-    return FALSE;
+    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
+    ctx->n_block_bytes += n_bytes;
+    return ptr;
 }
 
-/* Returns type of HTML block end condition or FALSE if not an end condition.
- *
- * Note it fills p_end even when it is not end condition as the caller
- * does not need to analyze contents of a raw HTML block.
- */
 static int
-md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
+md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
 {
-    switch(ctx->html_block_type) {
-        case 1:
-        {
-            OFF off = beg;
-            int i;
+    MD_BLOCK* block;
 
-            while(off+1 < ctx->size  &&  !ISNEWLINE(off)) {
-                if(CH(off) == _T('<')  &&  CH(off+1) == _T('/')) {
-                    for(i = 0; t1[i].name != NULL; i++) {
-                        if(off + 2 + t1[i].len < ctx->size) {
-                            if(md_ascii_case_eq(STR(off+2), t1[i].name, t1[i].len)  &&
-                               CH(off+2+t1[i].len) == _T('>'))
-                            {
-                                *p_end = off+2+t1[i].len+1;
-                                return TRUE;
-                            }
-                        }
-                    }
-                }
-                off++;
-            }
-            *p_end = off;
-            return FALSE;
-        }
+    MD_ASSERT(ctx->current_block == NULL);
 
-        case 2:
-            return (md_line_contains(ctx, beg, _T("-->"), 3, p_end) ? 2 : FALSE);
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
 
-        case 3:
-            return (md_line_contains(ctx, beg, _T("?>"), 2, p_end) ? 3 : FALSE);
+    ctx->current_block_after_container = ctx->block_bytes_end_with_container;
+    ctx->block_bytes_end_with_container = FALSE;
+    if(ctx->n_containers == 0)
+        ctx->n_top_level_blocks++;
 
-        case 4:
-            return (md_line_contains(ctx, beg, _T(">"), 1, p_end) ? 4 : FALSE);
+    switch(line->type) {
+        case MD_LINE_HR:
+            block->type = MD_BLOCK_HR;
+            break;
 
-        case 5:
-            return (md_line_contains(ctx, beg, _T("]]>"), 3, p_end) ? 5 : FALSE);
+        case MD_LINE_ATXHEADER:
+        case MD_LINE_SETEXTHEADER:
+            block->type = MD_BLOCK_H;
+            break;
 
-        case 6:     /* Pass through */
-        case 7:
-            if(beg >= ctx->size  ||  ISNEWLINE(beg)) {
-                /* Blank line ends types 6 and 7. */
-                *p_end = beg;
-                return ctx->html_block_type;
-            }
-            return FALSE;
+        case MD_LINE_FENCEDCODE:
+        case MD_LINE_INDENTEDCODE:
+            block->type = MD_BLOCK_CODE;
+            break;
+
+        case MD_LINE_TEXT:
+            block->type = MD_BLOCK_P;
+            break;
+
+        case MD_LINE_HTML:
+            block->type = MD_BLOCK_HTML;
+            break;
 
+        case MD_LINE_BLANK:
+        case MD_LINE_SETEXTUNDERLINE:
+        case MD_LINE_TABLEUNDERLINE:
         default:
             MD_UNREACHABLE();
+            break;
     }
-    return FALSE;
-}
-
-
-static int
-md_is_container_compatible(const MD_CONTAINER* pivot, const MD_CONTAINER* container)
-{
-    /* Block quote has no "items" like lists. */
-    if(container->ch == _T('>'))
-        return FALSE;
 
-    if(container->ch != pivot->ch)
-        return FALSE;
-    if(container->mark_indent > pivot->contents_indent)
-        return FALSE;
+    block->flags = 0;
+    block->data = line->data;
+    block->n_lines = 0;
 
-    return TRUE;
+    ctx->current_block = block;
+    return 0;
 }
 
+/* Eat from start of current (textual) block any reference definitions and
+ * remember them so we can resolve any links referring to them.
+ *
+ * (Reference definitions can only be at start of it as they cannot break
+ * a paragraph.)
+ */
 static int
-md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
+md_consume_link_reference_definitions(MD_CTX* ctx)
 {
-    if(ctx->n_containers >= ctx->alloc_containers) {
-        MD_CONTAINER* new_containers;
+    MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
+    MD_SIZE n_lines = ctx->current_block->n_lines;
+    MD_SIZE n = 0;
 
-        ctx->alloc_containers = (ctx->alloc_containers > 0
-                ? ctx->alloc_containers + ctx->alloc_containers / 2
-                : 16);
-        new_containers = realloc(ctx->containers, ctx->alloc_containers * sizeof(MD_CONTAINER));
-        if(new_containers == NULL) {
-            MD_LOG("realloc() failed.");
+    /* Compute how many lines at the start of the block form one or more
+     * reference definitions. */
+    while(n < n_lines) {
+        int n_link_ref_lines;
+
+        n_link_ref_lines = md_is_link_reference_definition(ctx,
+                                    lines + n, n_lines - n);
+        /* Not a reference definition? */
+        if(n_link_ref_lines == 0)
+            break;
+
+        /* We fail if it is the ref. def. but it could not be stored due
+         * a memory allocation error. */
+        if(n_link_ref_lines < 0)
             return -1;
-        }
 
-        ctx->containers = new_containers;
+        n += n_link_ref_lines;
+    }
+
+    /* If there was at least one reference definition, we need to remove
+     * its lines from the block, or perhaps even the whole block. */
+    if(n > 0) {
+        if(n == n_lines) {
+            /* Remove complete block. */
+            ctx->n_block_bytes -= n * sizeof(MD_LINE);
+            ctx->n_block_bytes -= sizeof(MD_BLOCK);
+            ctx->current_block = NULL;
+            ctx->block_bytes_end_with_container = ctx->current_block_after_container;
+        } else {
+            /* Remove just some initial lines from the block. */
+            memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
+            ctx->current_block->n_lines -= n;
+            ctx->n_block_bytes -= n * sizeof(MD_LINE);
+        }
     }
 
-    memcpy(&ctx->containers[ctx->n_containers++], container, sizeof(MD_CONTAINER));
     return 0;
 }
 
 static int
-md_enter_child_containers(MD_CTX* ctx, int n_children)
+md_end_current_block(MD_CTX* ctx)
 {
-    int i;
     int ret = 0;
 
-    for(i = ctx->n_containers - n_children; i < ctx->n_containers; i++) {
-        MD_CONTAINER* c = &ctx->containers[i];
-        int is_ordered_list = FALSE;
-
-        switch(c->ch) {
-            case _T(')'):
-            case _T('.'):
-                is_ordered_list = TRUE;
-                MD_FALLTHROUGH();
-
-            case _T('-'):
-            case _T('+'):
-            case _T('*'):
-                /* Remember offset in ctx->block_bytes so we can revisit the
-                 * block if we detect it is a loose list. */
-                md_end_current_block(ctx);
-                c->block_byte_off = ctx->n_block_bytes;
+    if(ctx->current_block == NULL)
+        return ret;
 
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL),
-                                c->start, c->ch, MD_BLOCK_CONTAINER_OPENER));
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                                c->task_mark_off,
-                                (c->is_task ? CH(c->task_mark_off) : 0),
-                                MD_BLOCK_CONTAINER_OPENER));
-                break;
+    /* Check whether there is a reference definition. (We do this here instead
+     * of in md_analyze_line() because reference definition can take multiple
+     * lines.) */
+    if(ctx->current_block->type == MD_BLOCK_P  ||
+       (ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)))
+    {
+        MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
+        if(lines[0].beg < ctx->size  &&  CH(lines[0].beg) == _T('[')) {
+            MD_CHECK(md_consume_link_reference_definitions(ctx));
+            if(ctx->current_block == NULL)
+                return ret;
+        }
+    }
 
-            case _T('>'):
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_QUOTE, 0, 0, MD_BLOCK_CONTAINER_OPENER));
-                break;
+    if(ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)) {
+        MD_SIZE n_lines = ctx->current_block->n_lines;
 
-            default:
-                MD_UNREACHABLE();
-                break;
+        if(n_lines > 1) {
+            /* Get rid of the underline. */
+            ctx->current_block->n_lines--;
+            ctx->n_block_bytes -= sizeof(MD_LINE);
+        } else {
+            /* Only the underline has left after eating the ref. defs.
+             * Keep the line as beginning of a new ordinary paragraph. */
+            ctx->current_block->type = MD_BLOCK_P;
+            return 0;
         }
     }
 
+    /* Mark we are not building any block anymore. */
+    ctx->current_block = NULL;
+
 abort:
     return ret;
 }
 
 static int
-md_leave_child_containers(MD_CTX* ctx, int n_keep)
+md_add_line_into_current_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* analysis)
 {
-    int ret = 0;
-
-    while(ctx->n_containers > n_keep) {
-        MD_CONTAINER* c = &ctx->containers[ctx->n_containers-1];
-        int is_ordered_list = FALSE;
+    MD_ASSERT(ctx->current_block != NULL);
 
-        switch(c->ch) {
-            case _T(')'):
-            case _T('.'):
-                is_ordered_list = TRUE;
-                MD_FALLTHROUGH();
+    if(ctx->current_block->type == MD_BLOCK_CODE || ctx->current_block->type == MD_BLOCK_HTML) {
+        MD_VERBATIMLINE* line;
 
-            case _T('-'):
-            case _T('+'):
-            case _T('*'):
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                                c->task_mark_off, (c->is_task ? CH(c->task_mark_off) : 0),
-                                MD_BLOCK_CONTAINER_CLOSER));
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL), 0,
-                                c->ch, MD_BLOCK_CONTAINER_CLOSER));
-                break;
+        line = (MD_VERBATIMLINE*) md_push_block_bytes(ctx, sizeof(MD_VERBATIMLINE));
+        if(line == NULL)
+            return -1;
 
-            case _T('>'):
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_QUOTE, 0,
-                                0, MD_BLOCK_CONTAINER_CLOSER));
-                break;
+        line->indent = analysis->indent;
+        line->beg = analysis->beg;
+        line->end = analysis->end;
+    } else {
+        MD_LINE* line;
 
-            default:
-                MD_UNREACHABLE();
-                break;
-        }
+        line = (MD_LINE*) md_push_block_bytes(ctx, sizeof(MD_LINE));
+        if(line == NULL)
+            return -1;
 
-        ctx->n_containers--;
+        line->beg = analysis->beg;
+        line->end = analysis->end;
     }
+    ctx->current_block->n_lines++;
 
-abort:
-    return ret;
+    return 0;
 }
 
 static int
-md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
+md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
+                        unsigned data, unsigned flags)
 {
-    OFF off = beg;
-    OFF max_end;
+    MD_BLOCK* block;
+    int ret = 0;
 
-    if(off >= ctx->size  ||  indent >= ctx->code_indent_offset)
-        return FALSE;
+    MD_CHECK(md_end_current_block(ctx));
 
-    /* Check for block quote mark. */
-    if(CH(off) == _T('>')) {
-        off++;
-        p_container->ch = _T('>');
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + 1;
-        *p_end = off;
-        return TRUE;
-    }
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
 
-    /* Check for list item bullet mark. */
-    if(ISANYOF(off, _T("-+*"))  &&  (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1))) {
-        p_container->ch = CH(off);
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + 1;
-        *p_end = off+1;
-        return TRUE;
-    }
+    block->type = type;
+    block->flags = flags;
+    block->data = data;
+    block->n_lines = start;
+    ctx->block_bytes_end_with_container = TRUE;
 
-    /* Check for ordered list item marks. */
-    max_end = off + 9;
-    if(max_end > ctx->size)
-        max_end = ctx->size;
-    p_container->start = 0;
-    while(off < max_end  &&  ISDIGIT(off)) {
-        p_container->start = p_container->start * 10 + CH(off) - _T('0');
+abort:
+    return ret;
+}
+
+
+
+/***********************
+ ***  Line Analysis  ***
+ ***********************/
+
+static int
+md_is_hr_line(MD_CTX* ctx, OFF beg, OFF* p_end, OFF* p_killer)
+{
+    OFF off = beg + 1;
+    int n = 1;
+
+    while(off < ctx->size  &&  (CH(off) == CH(beg) || CH(off) == _T(' ') || CH(off) == _T('\t'))) {
+        if(CH(off) == CH(beg))
+            n++;
         off++;
     }
-    if(off > beg  &&
-       off < ctx->size  &&
-       (CH(off) == _T('.') || CH(off) == _T(')'))  &&
-       (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1)))
-    {
-        p_container->ch = CH(off);
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + off - beg + 1;
-        *p_end = off+1;
-        return TRUE;
+
+    if(n < 3) {
+        *p_killer = off;
+        return FALSE;
     }
 
-    return FALSE;
+    /* Nothing else can be present on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off)) {
+        *p_killer = off;
+        return FALSE;
+    }
+
+    *p_end = off;
+    return TRUE;
 }
 
-static unsigned
-md_line_indentation(MD_CTX* ctx, unsigned total_indent, OFF beg, OFF* p_end)
+static int
+md_is_atxheader_line(MD_CTX* ctx, OFF beg, OFF* p_beg, OFF* p_end, unsigned* p_level)
 {
-    OFF off = beg;
-    unsigned indent = total_indent;
+    int n;
+    OFF off = beg + 1;
 
-    while(off < ctx->size  &&  ISBLANK(off)) {
-        if(CH(off) == _T('\t'))
-            indent = (indent + 4) & ~3;
-        else
-            indent++;
+    while(off < ctx->size  &&  CH(off) == _T('#')  &&  off - beg < 7)
         off++;
-    }
+    n = off - beg;
+
+    if(n > 6)
+        return FALSE;
+    *p_level = n;
+
+    if(!(ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
+       !ISBLANK(off)  &&  !ISNEWLINE(off))
+        return FALSE;
 
+    while(off < ctx->size  &&  ISBLANK(off))
+        off++;
+    *p_beg = off;
     *p_end = off;
-    return indent - total_indent;
+    return TRUE;
 }
 
-static const MD_LINE_ANALYSIS md_dummy_blank_line = { MD_LINE_BLANK, 0, 0, 0, 0, 0 };
+static int
+md_is_setext_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_level)
+{
+    OFF off = beg + 1;
+
+    while(off < ctx->size  &&  CH(off) == CH(beg))
+        off++;
+
+    /* Optionally, space(s) or tabs can follow. */
+    while(off < ctx->size  &&  ISBLANK(off))
+        off++;
+
+    /* But nothing more is allowed on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off))
+        return FALSE;
+
+    *p_level = (CH(beg) == _T('=') ? 1 : 2);
+    *p_end = off;
+    return TRUE;
+}
 
-/* Analyze type of the line and find some its properties. This serves as a
- * main input for determining type and boundaries of a block. */
 static int
-md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
-                const MD_LINE_ANALYSIS* pivot_line, MD_LINE_ANALYSIS* line)
+md_is_table_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_col_count)
 {
-    unsigned total_indent = 0;
-    int n_parents = 0;
-    int n_brothers = 0;
-    int n_children = 0;
-    MD_CONTAINER container = { 0 };
-    int prev_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
     OFF off = beg;
-    OFF hr_killer = 0;
-    int ret = 0;
+    int found_pipe = FALSE;
+    unsigned col_count = 0;
 
-    line->indent = md_line_indentation(ctx, total_indent, off, &off);
-    total_indent += line->indent;
-    line->beg = off;
-    line->enforce_new_block = FALSE;
+    if(off < ctx->size  &&  CH(off) == _T('|')) {
+        found_pipe = TRUE;
+        off++;
+        while(off < ctx->size  &&  ISWHITESPACE(off))
+            off++;
+    }
 
-    /* Given the indentation and block quote marks '>', determine how many of
-     * the current containers are our parents. */
-    while(n_parents < ctx->n_containers) {
-        MD_CONTAINER* c = &ctx->containers[n_parents];
+    while(1) {
+        int delimited = FALSE;
 
-        if(c->ch == _T('>')  &&  line->indent < ctx->code_indent_offset  &&
-            off < ctx->size  &&  CH(off) == _T('>'))
-        {
-            /* Block quote mark. */
+        /* Cell underline ("-----", ":----", "----:" or ":----:") */
+        if(off < ctx->size  &&  CH(off) == _T(':'))
+            off++;
+        if(off >= ctx->size  ||  CH(off) != _T('-'))
+            return FALSE;
+        while(off < ctx->size  &&  CH(off) == _T('-'))
+            off++;
+        if(off < ctx->size  &&  CH(off) == _T(':'))
             off++;
-            total_indent++;
-            line->indent = md_line_indentation(ctx, total_indent, off, &off);
-            total_indent += line->indent;
-
-            /* The optional 1st space after '>' is part of the block quote mark. */
-            if(line->indent > 0)
-                line->indent--;
 
-            line->beg = off;
+        col_count++;
+        if(col_count > TABLE_MAXCOLCOUNT) {
+            MD_LOG("Suppressing table (column_count >" STRINGIZE(TABLE_MAXCOLCOUNT) ")");
+            return FALSE;
+        }
 
-        } else if(c->ch != _T('>')  &&  line->indent >= c->contents_indent) {
-            /* List. */
-            line->indent -= c->contents_indent;
-        } else {
-            break;
+        /* Pipe delimiter (optional at the end of line). */
+        while(off < ctx->size  &&  ISWHITESPACE(off))
+            off++;
+        if(off < ctx->size  &&  CH(off) == _T('|')) {
+            delimited = TRUE;
+            found_pipe =  TRUE;
+            off++;
+            while(off < ctx->size  &&  ISWHITESPACE(off))
+                off++;
         }
 
-        n_parents++;
-    }
+        /* Success, if we reach end of line. */
+        if(off >= ctx->size  ||  ISNEWLINE(off))
+            break;
 
-    if(off >= ctx->size  ||  ISNEWLINE(off)) {
-        /* Blank line does not need any real indentation to be nested inside
-         * a list. */
-        if(n_brothers + n_children == 0) {
-            while(n_parents < ctx->n_containers  &&  ctx->containers[n_parents].ch != _T('>'))
-                n_parents++;
-        }
+        if(!delimited)
+            return FALSE;
     }
 
-    while(TRUE) {
-        /* Check whether we are fenced code continuation. */
-        if(pivot_line->type == MD_LINE_FENCEDCODE) {
-            line->beg = off;
+    if(!found_pipe)
+        return FALSE;
 
-            /* We are another MD_LINE_FENCEDCODE unless we are closing fence
-             * which we transform into MD_LINE_BLANK. */
-            if(line->indent < ctx->code_indent_offset) {
-                if(md_is_closing_code_fence(ctx, CH(pivot_line->beg), off, &off)) {
-                    line->type = MD_LINE_BLANK;
-                    ctx->last_line_has_list_loosening_effect = FALSE;
-                    break;
-                }
-            }
+    *p_end = off;
+    *p_col_count = col_count;
+    return TRUE;
+}
 
-            /* Change indentation accordingly to the initial code fence. */
-            if(n_parents == ctx->n_containers) {
-                if(line->indent > pivot_line->indent)
-                    line->indent -= pivot_line->indent;
-                else
-                    line->indent = 0;
+static int
+md_is_opening_code_fence(MD_CTX* ctx, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
 
-                line->type = MD_LINE_FENCEDCODE;
-                break;
-            }
-        }
+    while(off < ctx->size && CH(off) == CH(beg))
+        off++;
 
-        /* Check whether we are HTML block continuation. */
-        if(pivot_line->type == MD_LINE_HTML  &&  ctx->html_block_type > 0) {
-            if(n_parents < ctx->n_containers) {
-                /* HTML block is implicitly ended if the enclosing container
-                 * block ends. */
-                ctx->html_block_type = 0;
-            } else {
-                int html_block_type;
+    /* Fence must have at least three characters. */
+    if(off - beg < 3)
+        return FALSE;
 
-                html_block_type = md_is_html_block_end_condition(ctx, off, &off);
-                if(html_block_type > 0) {
-                    MD_ASSERT(html_block_type == ctx->html_block_type);
+    ctx->code_fence_length = off - beg;
 
-                    /* Make sure this is the last line of the block. */
-                    ctx->html_block_type = 0;
+    /* Optionally, space(s) can follow. */
+    while(off < ctx->size  &&  CH(off) == _T(' '))
+        off++;
 
-                    /* Some end conditions serve as blank lines at the same time. */
-                    if(html_block_type == 6 || html_block_type == 7) {
-                        line->type = MD_LINE_BLANK;
-                        line->indent = 0;
-                        break;
-                    }
-                }
+    /* Optionally, an info string can follow. */
+    while(off < ctx->size  &&  !ISNEWLINE(off)) {
+        /* Backtick-based fence must not contain '`' in the info string. */
+        if(CH(beg) == _T('`')  &&  CH(off) == _T('`'))
+            return FALSE;
+        off++;
+    }
 
-                line->type = MD_LINE_HTML;
-                n_parents = ctx->n_containers;
-                break;
-            }
-        }
+    *p_end = off;
+    return TRUE;
+}
 
-        /* Check for blank line. */
-        if(off >= ctx->size  ||  ISNEWLINE(off)) {
-            if(pivot_line->type == MD_LINE_INDENTEDCODE  &&  n_parents == ctx->n_containers) {
-                line->type = MD_LINE_INDENTEDCODE;
-                if(line->indent > ctx->code_indent_offset)
-                    line->indent -= ctx->code_indent_offset;
-                else
-                    line->indent = 0;
-                ctx->last_line_has_list_loosening_effect = FALSE;
-            } else {
-                line->type = MD_LINE_BLANK;
-                ctx->last_line_has_list_loosening_effect = (n_parents > 0  &&
-                        n_brothers + n_children == 0  &&
-                        ctx->containers[n_parents-1].ch != _T('>'));
+static int
+md_is_closing_code_fence(MD_CTX* ctx, CHAR ch, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
+    int ret = FALSE;
 
-    #if 1
-                /* See https://github.com/mity/md4c/issues/6
-                 *
-                 * This ugly checking tests we are in (yet empty) list item but
-                 * not its very first line (i.e. not the line with the list
-                 * item mark).
-                 *
-                 * If we are such a blank line, then any following non-blank
-                 * line which would be part of the list item actually has to
-                 * end the list because according to the specification, "a list
-                 * item can begin with at most one blank line."
-                 */
-                if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
-                {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
-                }
-    #endif
-            }
-            break;
-        } else {
-    #if 1
-            /* This is the 2nd half of the hack. If the flag is set (i.e. there
-             * was a 2nd blank line at the beginning of the list item) and if
-             * we would otherwise still belong to the list item, we enforce
-             * the end of the list. */
-            if(ctx->last_list_item_starts_with_two_blank_lines) {
-                if(n_parents > 0  &&  n_parents == ctx->n_containers  &&
-                   ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
-                {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI) {
-                        n_parents--;
+    /* Closing fence must have at least the same length and use same char as
+     * opening one. */
+    while(off < ctx->size  &&  CH(off) == ch)
+        off++;
+    if(off - beg < ctx->code_fence_length)
+        goto out;
 
-                        line->indent = total_indent;
-                        if(n_parents > 0)
-                            line->indent -= MIN(line->indent, ctx->containers[n_parents-1].contents_indent);
-                    }
-                }
+    /* Optionally, space(s) can follow */
+    while(off < ctx->size  &&  CH(off) == _T(' '))
+        off++;
 
-                ctx->last_list_item_starts_with_two_blank_lines = FALSE;
-            }
-    #endif
-            ctx->last_line_has_list_loosening_effect = FALSE;
+    /* But nothing more is allowed on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off))
+        goto out;
+
+    ret = TRUE;
+
+out:
+    /* Note we set *p_end even on failure: If we are not closing fence, caller
+     * would eat the line anyway without any parsing. */
+    *p_end = off;
+    return ret;
+}
+
+
+/* Helper data for md_is_html_block_start_condition() and
+ * md_is_html_block_end_condition() */
+typedef struct TAG_tag TAG;
+struct TAG_tag {
+    const CHAR* name;
+    unsigned len    : 8;
+};
+
+#ifdef X
+    #undef X
+#endif
+#define X(name)     { _T(name), (sizeof(name)-1) / sizeof(CHAR) }
+#define Xend        { NULL, 0 }
+
+static const TAG t1[] = { X("pre"), X("script"), X("style"), X("textarea"), Xend };
+
+static const TAG a6[] = { X("address"), X("article"), X("aside"), Xend };
+static const TAG b6[] = { X("base"), X("basefont"), X("blockquote"), X("body"), Xend };
+static const TAG c6[] = { X("caption"), X("center"), X("col"), X("colgroup"), Xend };
+static const TAG d6[] = { X("dd"), X("details"), X("dialog"), X("dir"),
+                          X("div"), X("dl"), X("dt"), Xend };
+static const TAG f6[] = { X("fieldset"), X("figcaption"), X("figure"), X("footer"),
+                          X("form"), X("frame"), X("frameset"), Xend };
+static const TAG h6[] = { X("h1"), X("h2"), X("h3"), X("h4"), X("h5"), X("h6"),
+                          X("head"), X("header"), X("hr"), X("html"), Xend };
+static const TAG i6[] = { X("iframe"), Xend };
+static const TAG l6[] = { X("legend"), X("li"), X("link"), Xend };
+static const TAG m6[] = { X("main"), X("menu"), X("menuitem"), Xend };
+static const TAG n6[] = { X("nav"), X("noframes"), Xend };
+static const TAG o6[] = { X("ol"), X("optgroup"), X("option"), Xend };
+static const TAG p6[] = { X("p"), X("param"), Xend };
+static const TAG s6[] = { X("search"), X("section"), X("summary"), Xend };
+static const TAG t6[] = { X("table"), X("tbody"), X("td"), X("tfoot"), X("th"),
+                          X("thead"), X("title"), X("tr"), X("track"), Xend };
+static const TAG u6[] = { X("ul"), Xend };
+static const TAG xx[] = { Xend };
+
+#undef X
+#undef Xend
+
+/* Returns type of the raw HTML block, or FALSE if it is not HTML block.
+ * (Refer to CommonMark specification for details about the types.)
+ */
+static int
+md_is_html_block_start_condition(MD_CTX* ctx, OFF beg)
+{
+    /* Type 6 is started by a long list of allowed tags. We use two-level
+     * tree to speed-up the search. */
+    static const TAG* map6[26] = {
+        a6, b6, c6, d6, xx, f6, xx, h6, i6, xx, xx, l6, m6,
+        n6, o6, p6, xx, xx, s6, t6, u6, xx, xx, xx, xx, xx
+    };
+    OFF off = beg + 1;
+    int i;
+
+    /* Check for type 1: <script, <pre, or <style */
+    for(i = 0; t1[i].name != NULL; i++) {
+        if(off + t1[i].len <= ctx->size) {
+            if(md_ascii_case_eq(STR(off), t1[i].name, t1[i].len))
+                return 1;
         }
+    }
 
-        /* Check whether we are Setext underline. */
-        if(line->indent < ctx->code_indent_offset  &&  pivot_line->type == MD_LINE_TEXT
-            &&  off < ctx->size  &&  ISANYOF2(off, _T('='), _T('-'))
-            &&  (n_parents == ctx->n_containers))
-        {
-            unsigned level;
+    /* Check for type 2: <!-- */
+    if(off + 3 < ctx->size  &&  CH(off) == _T('!')  &&  CH(off+1) == _T('-')  &&  CH(off+2) == _T('-'))
+        return 2;
 
-            if(md_is_setext_underline(ctx, off, &off, &level)) {
-                line->type = MD_LINE_SETEXTUNDERLINE;
-                line->data = level;
-                break;
-            }
+    /* Check for type 3: <? */
+    if(off < ctx->size  &&  CH(off) == _T('?'))
+        return 3;
+
+    /* Check for type 4 or 5: <! */
+    if(off < ctx->size  &&  CH(off) == _T('!')) {
+        /* Check for type 4: <! followed by uppercase letter. */
+        if(off + 1 < ctx->size  &&  ISASCII(off+1))
+            return 4;
+
+        /* Check for type 5: <![CDATA[ */
+        if(off + 8 < ctx->size) {
+            if(md_ascii_eq(STR(off), _T("![CDATA["), 8))
+                return 5;
         }
+    }
 
-        /* Check for thematic break line. */
-        if(line->indent < ctx->code_indent_offset
-            &&  off < ctx->size  &&  off >= hr_killer
-            &&  ISANYOF(off, _T("-_*")))
-        {
-            if(md_is_hr_line(ctx, off, &off, &hr_killer)) {
-                line->type = MD_LINE_HR;
-                break;
+    /* Check for type 6: Many possible starting tags listed above. */
+    if(off + 1 < ctx->size  &&  (ISALPHA(off) || (CH(off) == _T('/') && ISALPHA(off+1)))) {
+        int slot;
+        const TAG* tags;
+
+        if(CH(off) == _T('/'))
+            off++;
+
+        slot = (ISUPPER(off) ? CH(off) - 'A' : CH(off) - 'a');
+        tags = map6[slot];
+
+        for(i = 0; tags[i].name != NULL; i++) {
+            if(off + tags[i].len <= ctx->size) {
+                if(md_ascii_case_eq(STR(off), tags[i].name, tags[i].len)) {
+                    OFF tmp = off + tags[i].len;
+                    if(tmp >= ctx->size)
+                        return 6;
+                    if(ISBLANK(tmp) || ISNEWLINE(tmp) || CH(tmp) == _T('>'))
+                        return 6;
+                    if(tmp+1 < ctx->size && CH(tmp) == _T('/') && CH(tmp+1) == _T('>'))
+                        return 6;
+                    break;
+                }
             }
         }
+    }
 
-        /* Check for "brother" container. I.e. whether we are another list item
-         * in already started list. */
-        if(n_parents < ctx->n_containers  &&  n_brothers + n_children == 0) {
-            OFF tmp;
+    /* Check for type 7: any COMPLETE other opening or closing tag. */
+    if(off + 1 < ctx->size) {
+        OFF end;
 
-            if(md_is_container_mark(ctx, line->indent, off, &tmp, &container)  &&
-               md_is_container_compatible(&ctx->containers[n_parents], &container))
-            {
-                pivot_line = &md_dummy_blank_line;
+        if(md_is_html_tag(ctx, NULL, 0, beg, ctx->size, &end)) {
+            /* Only optional whitespace and new line may follow. */
+            while(end < ctx->size  &&  ISWHITESPACE(end))
+                end++;
+            if(end >= ctx->size  ||  ISNEWLINE(end))
+                return 7;
+        }
+    }
 
-                off = tmp;
+    return FALSE;
+}
+
+/* Case sensitive check whether there is a substring 'what' between 'beg'
+ * and end of line. */
+static int
+md_line_contains(MD_CTX* ctx, OFF beg, const CHAR* what, SZ what_len, OFF* p_end)
+{
+    OFF i;
+    for(i = beg; i + what_len < ctx->size; i++) {
+        if(ISNEWLINE(i))
+            break;
+        if(memcmp(STR(i), what, what_len * sizeof(CHAR)) == 0) {
+            *p_end = i + what_len;
+            return TRUE;
+        }
+    }
+
+    *p_end = i;
+    return FALSE;
+}
+
+/* Returns type of HTML block end condition or FALSE if not an end condition.
+ *
+ * Note it fills p_end even when it is not end condition as the caller
+ * does not need to analyze contents of a raw HTML block.
+ */
+static int
+md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
+{
+    switch(ctx->html_block_type) {
+        case 1:
+        {
+            OFF off = beg;
+            int i;
+
+            while(off+1 < ctx->size  &&  !ISNEWLINE(off)) {
+                if(CH(off) == _T('<')  &&  CH(off+1) == _T('/')) {
+                    for(i = 0; t1[i].name != NULL; i++) {
+                        if(off + 2 + t1[i].len < ctx->size) {
+                            if(md_ascii_case_eq(STR(off+2), t1[i].name, t1[i].len)  &&
+                               CH(off+2+t1[i].len) == _T('>'))
+                            {
+                                *p_end = off+2+t1[i].len+1;
+                                return TRUE;
+                            }
+                        }
+                    }
+                }
+                off++;
+            }
+            *p_end = off;
+            return FALSE;
+        }
+
+        case 2:
+            return (md_line_contains(ctx, beg, _T("-->"), 3, p_end) ? 2 : FALSE);
+
+        case 3:
+            return (md_line_contains(ctx, beg, _T("?>"), 2, p_end) ? 3 : FALSE);
+
+        case 4:
+            return (md_line_contains(ctx, beg, _T(">"), 1, p_end) ? 4 : FALSE);
+
+        case 5:
+            return (md_line_contains(ctx, beg, _T("]]>"), 3, p_end) ? 5 : FALSE);
+
+        case 6:     /* Pass through */
+        case 7:
+            if(beg >= ctx->size  ||  ISNEWLINE(beg)) {
+                /* Blank line ends types 6 and 7. */
+                *p_end = beg;
+                return ctx->html_block_type;
+            }
+            return FALSE;
+
+        default:
+            MD_UNREACHABLE();
+    }
+    return FALSE;
+}
+
+
+static int
+md_is_container_compatible(const MD_CONTAINER* pivot, const MD_CONTAINER* container)
+{
+    /* Block quote has no "items" like lists. */
+    if(container->ch == _T('>'))
+        return FALSE;
+
+    if(container->ch != pivot->ch)
+        return FALSE;
+    if(container->mark_indent > pivot->contents_indent)
+        return FALSE;
+
+    return TRUE;
+}
+
+static int
+md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
+{
+    if(ctx->n_containers >= ctx->alloc_containers) {
+        MD_CONTAINER* new_containers;
+        int alloc_containers;
+
+        alloc_containers = (ctx->alloc_containers > 0
+                ? ctx->alloc_containers + ctx->alloc_containers / 2
+                : 16);
+        new_containers = MD_REALLOC(ctx->containers, alloc_containers * sizeof(MD_CONTAINER));
+        if(new_containers == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        ctx->containers = new_containers;
+        ctx->alloc_containers = alloc_containers;
+    }
+
+    memcpy(&ctx->containers[ctx->n_containers++], container, sizeof(MD_CONTAINER));
+    return 0;
+}
+
+static int
+md_enter_child_containers(MD_CTX* ctx, int n_children)
+{
+    int i;
+    int ret = 0;
+
+    if(ctx->n_containers == n_children)
+        ctx->n_top_level_blocks++;
+
+    for(i = ctx->n_containers - n_children; i < ctx->n_containers; i++) {
+        MD_CONTAINER* c = &ctx->containers[i];
+        int is_ordered_list = FALSE;
+
+        switch(c->ch) {
+            case _T(')'):
+            case _T('.'):
+                is_ordered_list = TRUE;
+                MD_FALLTHROUGH();
+
+            case _T('-'):
+            case _T('+'):
+            case _T('*'):
+                /* Remember offset in ctx->block_bytes so we can revisit the
+                 * block if we detect it is a loose list. */
+                md_end_current_block(ctx);
+                c->block_byte_off = ctx->n_block_bytes;
+
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL),
+                                c->start, c->ch, MD_BLOCK_CONTAINER_OPENER));
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                                c->task_mark_off,
+                                (c->is_task ? CH(c->task_mark_off) : 0),
+                                MD_BLOCK_CONTAINER_OPENER));
+                break;
+
+            case _T('>'):
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_QUOTE, 0, 0, MD_BLOCK_CONTAINER_OPENER));
+                break;
+
+            default:
+                MD_UNREACHABLE();
+                break;
+        }
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_leave_child_containers(MD_CTX* ctx, int n_keep)
+{
+    int ret = 0;
+
+    while(ctx->n_containers > n_keep) {
+        MD_CONTAINER* c = &ctx->containers[ctx->n_containers-1];
+        int is_ordered_list = FALSE;
+
+        switch(c->ch) {
+            case _T(')'):
+            case _T('.'):
+                is_ordered_list = TRUE;
+                MD_FALLTHROUGH();
+
+            case _T('-'):
+            case _T('+'):
+            case _T('*'):
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                                c->task_mark_off, (c->is_task ? CH(c->task_mark_off) : 0),
+                                MD_BLOCK_CONTAINER_CLOSER));
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL), 0,
+                                c->ch, MD_BLOCK_CONTAINER_CLOSER));
+                break;
+
+            case _T('>'):
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_QUOTE, 0,
+                                0, MD_BLOCK_CONTAINER_CLOSER));
+                break;
+
+            default:
+                MD_UNREACHABLE();
+                break;
+        }
+
+        ctx->n_containers--;
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
+{
+    OFF off = beg;
+    OFF max_end;
+
+    if(off >= ctx->size  ||  indent >= ctx->code_indent_offset)
+        return FALSE;
+
+    /* Check for block quote mark. */
+    if(CH(off) == _T('>')) {
+        off++;
+        p_container->ch = _T('>');
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + 1;
+        *p_end = off;
+        return TRUE;
+    }
+
+    /* Check for list item bullet mark. */
+    if(ISANYOF(off, _T("-+*"))  &&  (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1))) {
+        p_container->ch = CH(off);
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + 1;
+        *p_end = off+1;
+        return TRUE;
+    }
+
+    /* Check for ordered list item marks. */
+    max_end = off + 9;
+    if(max_end > ctx->size)
+        max_end = ctx->size;
+    p_container->start = 0;
+    while(off < max_end  &&  ISDIGIT(off)) {
+        p_container->start = p_container->start * 10 + CH(off) - _T('0');
+        off++;
+    }
+    if(off > beg  &&
+       off < ctx->size  &&
+       (CH(off) == _T('.') || CH(off) == _T(')'))  &&
+       (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1)))
+    {
+        p_container->ch = CH(off);
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + off - beg + 1;
+        *p_end = off+1;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+static unsigned
+md_line_indentation(MD_CTX* ctx, unsigned total_indent, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
+    unsigned indent = total_indent;
+
+    while(off < ctx->size  &&  ISBLANK(off)) {
+        if(CH(off) == _T('\t'))
+            indent = (indent + 4) & ~3;
+        else
+            indent++;
+        off++;
+    }
+
+    *p_end = off;
+    return indent - total_indent;
+}
+
+static const MD_LINE_ANALYSIS md_dummy_blank_line = { MD_LINE_BLANK, 0, 0, 0, 0, 0 };
+
+#ifdef MD4C_USE_SIMD
+
+/* For small documents, the index would not pay off. */
+#define MD_NEWLINE_INDEX_MINSIZE    (16 * 1024)
+
+__attribute__((target("ssse3")))
+static inline uint64_t
+md_newline_bits_16(const CHAR* text, __m128i cr, __m128i lf)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*) text);
+    return (uint64_t) (unsigned) _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+}
+
+__attribute__((target("ssse3")))
+static void
+md_newline_index_ssse3(const CHAR* text, SZ n_words, uint64_t* bits)
+{
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    SZ i;
+
+    for(i = 0; i < n_words; i++) {
+        const CHAR* block = text + i * 64;
+        bits[i] = md_newline_bits_16(block, cr, lf)
+                | (md_newline_bits_16(block + 16, cr, lf) << 16)
+                | (md_newline_bits_16(block + 32, cr, lf) << 32)
+                | (md_newline_bits_16(block + 48, cr, lf) << 48);
+    }
+}
+
+__attribute__((target("avx2")))
+static inline uint64_t
+md_newline_bits_32(const CHAR* text, __m256i cr, __m256i lf)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*) text);
+    return (uint64_t) (unsigned) _mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+}
+
+__attribute__((target("avx2")))
+static void
+md_newline_index_avx2(const CHAR* text, SZ n_words, uint64_t* bits)
+{
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    SZ i;
+
+    for(i = 0; i < n_words; i++) {
+        const CHAR* block = text + i * 64;
+        bits[i] = md_newline_bits_32(block, cr, lf)
+                | (md_newline_bits_32(block + 32, cr, lf) << 32);
+    }
+}
+
+/* Build ctx->newline_bits with one vectorized pass over the document, so that
+ * md_analyze_line() can find the line ends 64 bytes at a time, without
+ * looking at the line contents again. Without the index (small document,
+ * no SIMD, or out of memory), it just scans the line. */
+static void
+md_build_newline_index(MD_CTX* ctx)
+{
+    SZ n_full = ctx->size / 64;
+    SZ n_words = (ctx->size + 63) / 64;
+    uint64_t* bits;
+    SZ off;
+    int simd_level = md_simd_level();
+
+    if(simd_level <= 0  ||  ctx->size < MD_NEWLINE_INDEX_MINSIZE)
+        return;
+
+    bits = (uint64_t*) MD_MALLOC(n_words * sizeof(uint64_t));
+    if(bits == NULL)
+        return;
+
+    if(simd_level >= 2)
+        md_newline_index_avx2(ctx->text, n_full, bits);
+    else
+        md_newline_index_ssse3(ctx->text, n_full, bits);
+
+    if(n_words > n_full) {
+        bits[n_full] = 0;
+        for(off = n_full * 64; off < ctx->size; off++) {
+            if(ISNEWLINE_(ctx->text[off]))
+                bits[n_full] |= (uint64_t) 1 << (off - n_full * 64);
+        }
+    }
+
+    ctx->newline_bits = bits;
+}
+
+/* Returns offset of the first '\r' or '\n' at or after off, or ctx->size.
+ * (ctx->size may be the end of a chunk which is smaller than the indexed
+ * document.) */
+static inline OFF
+md_next_newline(MD_CTX* ctx, OFF off)
+{
+    SZ word = off / 64;
+    uint64_t w;
+
+    if(off >= ctx->size)
+        return ctx->size;
+
+    w = ctx->newline_bits[word] & (~(uint64_t) 0 << (off % 64));
+    while(w == 0) {
+        word++;
+        if(word * 64 >= ctx->size)
+            return ctx->size;
+        w = ctx->newline_bits[word];
+    }
+
+    off = word * 64 + (OFF) __builtin_ctzll(w);
+    return MIN(off, ctx->size);
+}
+
+#endif  /* MD4C_USE_SIMD */
+
+/* Analyze type of the line and find some its properties. This serves as a
+ * main input for determining type and boundaries of a block. */
+static int
+md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
+                const MD_LINE_ANALYSIS* pivot_line, MD_LINE_ANALYSIS* line)
+{
+    unsigned total_indent = 0;
+    int n_parents = 0;
+    int n_brothers = 0;
+    int n_children = 0;
+    MD_CONTAINER container = { 0 };
+    int prev_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
+    OFF off = beg;
+    OFF hr_killer = 0;
+    int ret = 0;
+
+    line->indent = md_line_indentation(ctx, total_indent, off, &off);
+    total_indent += line->indent;
+    line->beg = off;
+    line->enforce_new_block = FALSE;
+
+    /* Given the indentation and block quote marks '>', determine how many of
+     * the current containers are our parents. */
+    while(n_parents < ctx->n_containers) {
+        MD_CONTAINER* c = &ctx->containers[n_parents];
+
+        if(c->ch == _T('>')  &&  line->indent < ctx->code_indent_offset  &&
+            off < ctx->size  &&  CH(off) == _T('>'))
+        {
+            /* Block quote mark. */
+            off++;
+            total_indent++;
+            line->indent = md_line_indentation(ctx, total_indent, off, &off);
+            total_indent += line->indent;
+
+            /* The optional 1st space after '>' is part of the block quote mark. */
+            if(line->indent > 0)
+                line->indent--;
+
+            line->beg = off;
+
+        } else if(c->ch != _T('>')  &&  line->indent >= c->contents_indent) {
+            /* List. */
+            line->indent -= c->contents_indent;
+        } else {
+            break;
+        }
+
+        n_parents++;
+    }
+
+    if(off >= ctx->size  ||  ISNEWLINE(off)) {
+        /* Blank line does not need any real indentation to be nested inside
+         * a list. */
+        if(n_brothers + n_children == 0) {
+            while(n_parents < ctx->n_containers  &&  ctx->containers[n_parents].ch != _T('>'))
+                n_parents++;
+        }
+    }
+
+    while(TRUE) {
+        /* Check whether we are fenced code continuation. */
+        if(pivot_line->type == MD_LINE_FENCEDCODE) {
+            line->beg = off;
+
+            /* We are another MD_LINE_FENCEDCODE unless we are closing fence
+             * which we transform into MD_LINE_BLANK. */
+            if(line->indent < ctx->code_indent_offset) {
+                if(md_is_closing_code_fence(ctx, CH(pivot_line->beg), off, &off)) {
+                    line->type = MD_LINE_BLANK;
+                    ctx->last_line_has_list_loosening_effect = FALSE;
+                    break;
+                }
+            }
+
+            /* Change indentation accordingly to the initial code fence. */
+            if(n_parents == ctx->n_containers) {
+                if(line->indent > pivot_line->indent)
+                    line->indent -= pivot_line->indent;
+                else
+                    line->indent = 0;
+
+                line->type = MD_LINE_FENCEDCODE;
+                break;
+            }
+        }
+
+        /* Check whether we are HTML block continuation. */
+        if(pivot_line->type == MD_LINE_HTML  &&  ctx->html_block_type > 0) {
+            if(n_parents < ctx->n_containers) {
+                /* HTML block is implicitly ended if the enclosing container
+                 * block ends. */
+                ctx->html_block_type = 0;
+            } else {
+                int html_block_type;
+
+                html_block_type = md_is_html_block_end_condition(ctx, off, &off);
+                if(html_block_type > 0) {
+                    MD_ASSERT(html_block_type == ctx->html_block_type);
+
+                    /* Make sure this is the last line of the block. */
+                    ctx->html_block_type = 0;
+
+                    /* Some end conditions serve as blank lines at the same time. */
+                    if(html_block_type == 6 || html_block_type == 7) {
+                        line->type = MD_LINE_BLANK;
+                        line->indent = 0;
+                        break;
+                    }
+                }
+
+                line->type = MD_LINE_HTML;
+                n_parents = ctx->n_containers;
+                break;
+            }
+        }
+
+        /* Check for blank line. */
+        if(off >= ctx->size  ||  ISNEWLINE(off)) {
+            if(pivot_line->type == MD_LINE_INDENTEDCODE  &&  n_parents == ctx->n_containers) {
+                line->type = MD_LINE_INDENTEDCODE;
+                if(line->indent > ctx->code_indent_offset)
+                    line->indent -= ctx->code_indent_offset;
+                else
+                    line->indent = 0;
+                ctx->last_line_has_list_loosening_effect = FALSE;
+            } else {
+                line->type = MD_LINE_BLANK;
+                ctx->last_line_has_list_loosening_effect = (n_parents > 0  &&
+                        n_brothers + n_children == 0  &&
+                        ctx->containers[n_parents-1].ch != _T('>'));
+
+    #if 1
+                /* See https://github.com/mity/md4c/issues/6
+                 *
+                 * This ugly checking tests we are in (yet empty) list item but
+                 * not its very first line (i.e. not the line with the list
+                 * item mark).
+                 *
+                 * If we are such a blank line, then any following non-blank
+                 * line which would be part of the list item actually has to
+                 * end the list because according to the specification, "a list
+                 * item can begin with at most one blank line."
+                 */
+                if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
+                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK)  &&
+                   ctx->block_bytes_end_with_container)
+                {
+                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
+                    if(top_block->type == MD_BLOCK_LI)
+                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
+                }
+    #endif
+            }
+            break;
+        } else {
+    #if 1
+            /* This is the 2nd half of the hack. If the flag is set (i.e. there
+             * was a 2nd blank line at the beginning of the list item) and if
+             * we would otherwise still belong to the list item, we enforce
+             * the end of the list. */
+            if(ctx->last_list_item_starts_with_two_blank_lines) {
+                if(n_parents > 0  &&  n_parents == ctx->n_containers  &&
+                   ctx->containers[n_parents-1].ch != _T('>')  &&
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
+                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK)  &&
+                   ctx->block_bytes_end_with_container)
+                {
+                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
+                    if(top_block->type == MD_BLOCK_LI) {
+                        n_parents--;
+
+                        line->indent = total_indent;
+                        if(n_parents > 0)
+                            line->indent -= MIN(line->indent, ctx->containers[n_parents-1].contents_indent);
+                    }
+                }
+
+                ctx->last_list_item_starts_with_two_blank_lines = FALSE;
+            }
+    #endif
+            ctx->last_line_has_list_loosening_effect = FALSE;
+        }
+
+        /* Check whether we are Setext underline. */
+        if(line->indent < ctx->code_indent_offset  &&  pivot_line->type == MD_LINE_TEXT
+            &&  off < ctx->size  &&  ISANYOF2(off, _T('='), _T('-'))
+            &&  (n_parents == ctx->n_containers))
+        {
+            unsigned level;
+
+            if(md_is_setext_underline(ctx, off, &off, &level)) {
+                line->type = MD_LINE_SETEXTUNDERLINE;
+                line->data = level;
+                break;
+            }
+        }
+
+        /* Check for thematic break line. */
+        if(line->indent < ctx->code_indent_offset
+            &&  off < ctx->size  &&  off >= hr_killer
+            &&  ISANYOF(off, _T("-_*")))
+        {
+            if(md_is_hr_line(ctx, off, &off, &hr_killer)) {
+                line->type = MD_LINE_HR;
+                break;
+            }
+        }
+
+        /* Check for "brother" container. I.e. whether we are another list item
+         * in already started list. */
+        if(n_parents < ctx->n_containers  &&  n_brothers + n_children == 0) {
+            OFF tmp;
+
+            if(md_is_container_mark(ctx, line->indent, off, &tmp, &container)  &&
+               md_is_container_compatible(&ctx->containers[n_parents], &container))
+            {
+                pivot_line = &md_dummy_blank_line;
+
+                off = tmp;
+
+                total_indent += container.contents_indent - container.mark_indent;
+                line->indent = md_line_indentation(ctx, total_indent, off, &off);
+                total_indent += line->indent;
+                line->beg = off;
+
+                /* Some of the following whitespace actually still belongs to the mark. */
+                if(off >= ctx->size || ISNEWLINE(off)) {
+                    container.contents_indent++;
+                } else if(line->indent <= ctx->code_indent_offset) {
+                    container.contents_indent += line->indent;
+                    line->indent = 0;
+                } else {
+                    container.contents_indent += 1;
+                    line->indent--;
+                }
+
+                ctx->containers[n_parents].mark_indent = container.mark_indent;
+                ctx->containers[n_parents].contents_indent = container.contents_indent;
+
+                n_brothers++;
+                continue;
+            }
+        }
+
+        /* Check for indented code.
+         * Note indented code block cannot interrupt a paragraph. */
+        if(line->indent >= ctx->code_indent_offset  &&  (pivot_line->type != MD_LINE_TEXT)) {
+            line->type = MD_LINE_INDENTEDCODE;
+            line->indent -= ctx->code_indent_offset;
+            line->data = 0;
+            break;
+        }
+
+        /* Check for start of a new container block. */
+        if(line->indent < ctx->code_indent_offset  &&
+           md_is_container_mark(ctx, line->indent, off, &off, &container))
+        {
+            if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
+                        (off >= ctx->size || ISNEWLINE(off))  &&  container.ch != _T('>'))
+            {
+                /* Noop. List mark followed by a blank line cannot interrupt a paragraph. */
+            } else if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
+                        ISANYOF2_(container.ch, _T('.'), _T(')'))  &&  container.start != 1)
+            {
+                /* Noop. Ordered list cannot interrupt a paragraph unless the start index is 1. */
+            } else {
+                total_indent += container.contents_indent - container.mark_indent;
+                line->indent = md_line_indentation(ctx, total_indent, off, &off);
+                total_indent += line->indent;
+
+                line->beg = off;
+                line->data = container.ch;
+
+                /* Some of the following whitespace actually still belongs to the mark. */
+                if(off >= ctx->size || ISNEWLINE(off)) {
+                    container.contents_indent++;
+                } else if(line->indent <= ctx->code_indent_offset) {
+                    container.contents_indent += line->indent;
+                    line->indent = 0;
+                } else {
+                    container.contents_indent += 1;
+                    line->indent--;
+                }
+
+                if(n_brothers + n_children == 0)
+                    pivot_line = &md_dummy_blank_line;
+
+                if(n_children == 0)
+                    MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+
+                n_children++;
+                MD_CHECK(md_push_container(ctx, &container));
+                continue;
+            }
+        }
+
+        /* Check whether we are table continuation. */
+        if(pivot_line->type == MD_LINE_TABLE  &&  n_parents == ctx->n_containers) {
+            line->type = MD_LINE_TABLE;
+            break;
+        }
+
+        /* Check for ATX header. */
+        if(line->indent < ctx->code_indent_offset  &&
+                off < ctx->size  &&  CH(off) == _T('#'))
+        {
+            unsigned level;
+
+            if(md_is_atxheader_line(ctx, off, &line->beg, &off, &level)) {
+                line->type = MD_LINE_ATXHEADER;
+                line->data = level;
+                break;
+            }
+        }
+
+        /* Check whether we are starting code fence. */
+        if(line->indent < ctx->code_indent_offset  &&
+                off < ctx->size  &&  ISANYOF2(off, _T('`'), _T('~')))
+        {
+            if(md_is_opening_code_fence(ctx, off, &off)) {
+                line->type = MD_LINE_FENCEDCODE;
+                line->data = 1;
+                line->enforce_new_block = TRUE;
+                break;
+            }
+        }
+
+        /* Check for start of raw HTML block. */
+        if(off < ctx->size  &&  CH(off) == _T('<')
+            &&  !(ctx->parser.flags & MD_FLAG_NOHTMLBLOCKS))
+        {
+            ctx->html_block_type = md_is_html_block_start_condition(ctx, off);
+
+            /* HTML block type 7 cannot interrupt paragraph. */
+            if(ctx->html_block_type == 7  &&  pivot_line->type == MD_LINE_TEXT)
+                ctx->html_block_type = 0;
+
+            if(ctx->html_block_type > 0) {
+                /* The line itself also may immediately close the block. */
+                if(md_is_html_block_end_condition(ctx, off, &off) == ctx->html_block_type) {
+                    /* Make sure this is the last line of the block. */
+                    ctx->html_block_type = 0;
+                }
+
+                line->enforce_new_block = TRUE;
+                line->type = MD_LINE_HTML;
+                break;
+            }
+        }
+
+        /* Check for table underline. */
+        if((ctx->parser.flags & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
+            &&  off < ctx->size  &&  ISANYOF3(off, _T('|'), _T('-'), _T(':'))
+            &&  n_parents == ctx->n_containers)
+        {
+            unsigned col_count;
+
+            if(ctx->current_block != NULL  &&  ctx->current_block->n_lines == 1  &&
+                md_is_table_underline(ctx, off, &off, &col_count))
+            {
+                line->data = col_count;
+                line->type = MD_LINE_TABLEUNDERLINE;
+                break;
+            }
+        }
+
+        /* By default, we are normal text line. */
+        line->type = MD_LINE_TEXT;
+        if(pivot_line->type == MD_LINE_TEXT  &&  n_brothers + n_children == 0) {
+            /* Lazy continuation. */
+            n_parents = ctx->n_containers;
+        }
+
+        /* Check for task mark. */
+        if((ctx->parser.flags & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
+           ISANYOF_(ctx->containers[ctx->n_containers-1].ch, _T("-+*.)")))
+        {
+            OFF tmp = off;
+
+            while(tmp < ctx->size  &&  tmp < off + 3  &&  ISBLANK(tmp))
+                tmp++;
+            if(tmp + 2 < ctx->size  &&  CH(tmp) == _T('[')  &&
+               ISANYOF(tmp+1, _T("xX "))  &&  CH(tmp+2) == _T(']')  &&
+               (tmp + 3 == ctx->size  ||  ISBLANK(tmp+3)  ||  ISNEWLINE(tmp+3)))
+            {
+                MD_CONTAINER* task_container = (n_children > 0 ? &ctx->containers[ctx->n_containers-1] : &container);
+                task_container->is_task = TRUE;
+                task_container->task_mark_off = tmp + 1;
+                off = tmp + 3;
+                while(off < ctx->size  &&  ISWHITESPACE(off))
+                    off++;
+                line->beg = off;
+            }
+        }
+
+        break;
+    }
+
+    /* Scan for end of the line.
+     *
+     * Note this is quite a bottleneck of the parsing as we here iterate almost
+     * over compete document.
+     */
+#ifdef MD4C_USE_SIMD
+    if(ctx->newline_bits != NULL) {
+        off = md_next_newline(ctx, off);
+    } else
+#endif
+#if defined __linux__ && !defined MD4C_USE_UTF16
+    /* Recent glibc versions have superbly optimized strcspn(), even using
+     * vectorization if available. */
+    if(ctx->doc_ends_with_newline  &&  off < ctx->size) {
+        while(TRUE) {
+            off += (OFF) strcspn(STR(off), "\r\n");
+
+            /* strcspn() can stop on zero terminator; but that can appear
+             * anywhere in the Markfown input... */
+            if(CH(off) == _T('\0'))
+                off++;
+            else
+                break;
+        }
+    } else
+#endif
+    {
+        /* Optimization: Use some loop unrolling. */
+        while(off + 3 < ctx->size  &&  !ISNEWLINE(off+0)  &&  !ISNEWLINE(off+1)
+                                   &&  !ISNEWLINE(off+2)  &&  !ISNEWLINE(off+3))
+            off += 4;
+        while(off < ctx->size  &&  !ISNEWLINE(off))
+            off++;
+    }
+
+    /* Set end of the line. */
+    line->end = off;
+
+    /* But for ATX header, we should exclude the optional trailing mark. */
+    if(line->type == MD_LINE_ATXHEADER) {
+        OFF tmp = line->end;
+        while(tmp > line->beg && ISBLANK(tmp-1))
+            tmp--;
+        while(tmp > line->beg && CH(tmp-1) == _T('#'))
+            tmp--;
+        if(tmp == line->beg || ISBLANK(tmp-1) || (ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS))
+            line->end = tmp;
+    }
+
+    /* Trim trailing spaces. */
+    if(line->type != MD_LINE_INDENTEDCODE  &&  line->type != MD_LINE_FENCEDCODE  && line->type != MD_LINE_HTML) {
+        while(line->end > line->beg && ISBLANK(line->end-1))
+            line->end--;
+    }
+
+    /* Eat also the new line. */
+    if(off < ctx->size && CH(off) == _T('\r'))
+        off++;
+    if(off < ctx->size && CH(off) == _T('\n'))
+        off++;
+
+    *p_end = off;
+
+    /* If we belong to a list after seeing a blank line, the list is loose. */
+    if(prev_line_has_list_loosening_effect  &&  line->type != MD_LINE_BLANK  &&  n_parents + n_brothers > 0) {
+        MD_CONTAINER* c = &ctx->containers[n_parents + n_brothers - 1];
+        if(c->ch != _T('>')) {
+            MD_BLOCK* block = (MD_BLOCK*) (((char*)ctx->block_bytes) + c->block_byte_off);
+            block->flags |= MD_BLOCK_LOOSE_LIST;
+        }
+    }
+
+    /* Leave any containers we are not part of anymore. */
+    if(n_children == 0  &&  n_parents + n_brothers < ctx->n_containers)
+        MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+
+    /* Enter any container we found a mark for. */
+    if(n_brothers > 0) {
+        MD_ASSERT(n_brothers == 1);
+        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                    ctx->containers[n_parents].task_mark_off,
+                    (ctx->containers[n_parents].is_task ? CH(ctx->containers[n_parents].task_mark_off) : 0),
+                    MD_BLOCK_CONTAINER_CLOSER));
+        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                    container.task_mark_off,
+                    (container.is_task ? CH(container.task_mark_off) : 0),
+                    MD_BLOCK_CONTAINER_OPENER));
+        ctx->containers[n_parents].is_task = container.is_task;
+        ctx->containers[n_parents].task_mark_off = container.task_mark_off;
+    }
+
+    if(n_children > 0)
+        MD_CHECK(md_enter_child_containers(ctx, n_children));
+
+abort:
+    return ret;
+}
+
+static int
+md_process_line(MD_CTX* ctx, const MD_LINE_ANALYSIS** p_pivot_line, MD_LINE_ANALYSIS* line)
+{
+    const MD_LINE_ANALYSIS* pivot_line = *p_pivot_line;
+    int ret = 0;
+
+    /* Blank line ends current leaf block. */
+    if(line->type == MD_LINE_BLANK) {
+        MD_CHECK(md_end_current_block(ctx));
+        *p_pivot_line = &md_dummy_blank_line;
+        return 0;
+    }
+
+    if(line->enforce_new_block)
+        MD_CHECK(md_end_current_block(ctx));
+
+    /* Some line types form block on their own. */
+    if(line->type == MD_LINE_HR || line->type == MD_LINE_ATXHEADER) {
+        MD_CHECK(md_end_current_block(ctx));
+
+        /* Add our single-line block. */
+        MD_CHECK(md_start_new_block(ctx, line));
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        MD_CHECK(md_end_current_block(ctx));
+        *p_pivot_line = &md_dummy_blank_line;
+        return 0;
+    }
+
+    /* MD_LINE_SETEXTUNDERLINE changes meaning of the current block and ends it. */
+    if(line->type == MD_LINE_SETEXTUNDERLINE) {
+        MD_ASSERT(ctx->current_block != NULL);
+        ctx->current_block->type = MD_BLOCK_H;
+        ctx->current_block->data = line->data;
+        ctx->current_block->flags |= MD_BLOCK_SETEXT_HEADER;
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        MD_CHECK(md_end_current_block(ctx));
+        if(ctx->current_block == NULL) {
+            *p_pivot_line = &md_dummy_blank_line;
+        } else {
+            /* This happens if we have consumed all the body as link ref. defs.
+             * and downgraded the underline into start of a new paragraph block. */
+            line->type = MD_LINE_TEXT;
+            *p_pivot_line = line;
+        }
+        return 0;
+    }
+
+    /* MD_LINE_TABLEUNDERLINE changes meaning of the current block. */
+    if(line->type == MD_LINE_TABLEUNDERLINE) {
+        MD_ASSERT(ctx->current_block != NULL);
+        MD_ASSERT(ctx->current_block->n_lines == 1);
+        ctx->current_block->type = MD_BLOCK_TABLE;
+        ctx->current_block->data = line->data;
+        MD_ASSERT(pivot_line != &md_dummy_blank_line);
+        ((MD_LINE_ANALYSIS*)pivot_line)->type = MD_LINE_TABLE;
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        return 0;
+    }
+
+    /* The current block also ends if the line has different type. */
+    if(line->type != pivot_line->type)
+        MD_CHECK(md_end_current_block(ctx));
+
+    /* The current line may start a new block. */
+    if(ctx->current_block == NULL) {
+        MD_CHECK(md_start_new_block(ctx, line));
+        *p_pivot_line = line;
+    }
+
+    /* In all other cases the line is just a continuation of the current block. */
+    MD_CHECK(md_add_line_into_current_block(ctx, line));
+
+abort:
+    return ret;
+}
+
+/* State of the line analysis which is carried over from one line to the next. */
+typedef struct MD_ANALYSIS_STATE_tag MD_ANALYSIS_STATE;
+struct MD_ANALYSIS_STATE_tag {
+    const MD_LINE_ANALYSIS* pivot_line;
+    MD_LINE_ANALYSIS line_buf[2];
+};
+
+static int
+md_analyze_lines(MD_CTX* ctx, MD_ANALYSIS_STATE* state, OFF beg, OFF end)
+{
+    MD_LINE_ANALYSIS* line = &state->line_buf[0];
+    OFF off = beg;
+    int ret = 0;
+
+    while(off < end) {
+        if(line == state->pivot_line)
+            line = (line == &state->line_buf[0] ? &state->line_buf[1] : &state->line_buf[0]);
+
+        MD_CHECK(md_analyze_line(ctx, off, &off, state->pivot_line, line));
+        MD_CHECK(md_process_line(ctx, &state->pivot_line, line));
+    }
+
+abort:
+    return ret;
+}
+
+/* Whether the analysis is outside of any leaf block, as if after a blank
+ * line. (The analysis of a line depends on the line before, so only then
+ * a new top-level block starts the same as it would in a new document.) */
+static int
+md_is_after_block(MD_CTX* ctx, const MD_ANALYSIS_STATE* state)
+{
+    return (state->pivot_line == &md_dummy_blank_line  &&
+            ctx->current_block == NULL  &&  ctx->html_block_type == 0);
+}
+
+static int
+md_push_boundary(MD_CTX* ctx, OFF beg, int block_byte_off, int n_ref_defs)
+{
+    MD_BOUNDARY* boundary;
+
+    if(ctx->n_boundaries >= ctx->alloc_boundaries) {
+        MD_BOUNDARY* new_boundaries;
+        int alloc_boundaries;
+
+        alloc_boundaries = (ctx->alloc_boundaries > 0
+                ? ctx->alloc_boundaries + ctx->alloc_boundaries / 2
+                : 64);
+        new_boundaries = MD_REALLOC(ctx->boundaries, alloc_boundaries * sizeof(MD_BOUNDARY));
+        if(new_boundaries == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        ctx->boundaries = new_boundaries;
+        ctx->alloc_boundaries = alloc_boundaries;
+    }
+
+    boundary = &ctx->boundaries[ctx->n_boundaries++];
+    boundary->beg = beg;
+    boundary->block_byte_off = block_byte_off;
+    boundary->n_ref_defs = n_ref_defs;
+    return 0;
+}
+
+/* Same as md_analyze_lines() for the whole document, remembering the
+ * boundaries for md_parse_range(): each non-blank line which comes when the
+ * analysis is after a block and outside of any container, each line which
+ * starts a top-level block by ending all the containers or an indented code
+ * block, and the end of the document if it is in such a state too. */
+static int
+md_analyze_lines_with_boundaries(MD_CTX* ctx, MD_ANALYSIS_STATE* state)
+{
+    MD_LINE_ANALYSIS* line = &state->line_buf[0];
+    OFF off = 0;
+    int ret = 0;
+
+    while(off < ctx->size) {
+        OFF line_beg = off;
+        int is_boundary = (ctx->n_containers == 0  &&  md_is_after_block(ctx, state));
+        int n_block_bytes = ctx->n_block_bytes;   /* The analysis may push containers. */
+        int is_in_paragraph = (ctx->n_containers == 0  &&  ctx->current_block != NULL  &&
+                (state->pivot_line->type == MD_LINE_TEXT  ||  state->pivot_line->type == MD_LINE_TABLE));
+        int is_in_indented_code = (ctx->n_containers == 0  &&  ctx->current_block != NULL  &&
+                state->pivot_line->type == MD_LINE_INDENTEDCODE);
+        int is_in_container = (ctx->n_containers > 0);
+
+        if(line == state->pivot_line)
+            line = (line == &state->line_buf[0] ? &state->line_buf[1] : &state->line_buf[0]);
+
+        MD_CHECK(md_analyze_line(ctx, off, &off, state->pivot_line, line));
+        if(is_boundary  &&  line->type != MD_LINE_BLANK)
+            MD_CHECK(md_push_boundary(ctx, line_beg, n_block_bytes, ctx->n_ref_defs));
+        MD_CHECK(md_process_line(ctx, &state->pivot_line, line));
+
+        /* An ATX header interrupting a paragraph (or a table) ends it just as
+         * the end of the document would. Its MD_BLOCK (with the only MD_LINE)
+         * is now the last one; the paragraph may have shrunk by ref. defs. */
+        if(is_in_paragraph  &&  line->type == MD_LINE_ATXHEADER  &&  ctx->n_containers == 0) {
+            MD_CHECK(md_push_boundary(ctx, line_beg,
+                        ctx->n_block_bytes - (int) (sizeof(MD_BLOCK) + sizeof(MD_LINE)),
+                        ctx->n_ref_defs));
+        }
+
+        /* So does a line which closes all the containers, or which ends an
+         * indented code block, if it starts a new top-level block. The block
+         * follows the closers of the containers (and the code block, which
+         * may have shrunk by its trailing blank lines). */
+        if((is_in_container  ||  is_in_indented_code)  &&  ctx->n_containers == 0) {
+            if(line->type == MD_LINE_HR  ||  line->type == MD_LINE_ATXHEADER) {
+                MD_CHECK(md_push_boundary(ctx, line_beg,
+                            ctx->n_block_bytes - (int) (sizeof(MD_BLOCK) + sizeof(MD_LINE)),
+                            ctx->n_ref_defs));
+            } else if(state->pivot_line == line  &&  ctx->current_block != NULL) {
+                MD_CHECK(md_push_boundary(ctx, line_beg,
+                            (int) ((char*) ctx->current_block - (char*) ctx->block_bytes),
+                            ctx->n_ref_defs));
+            }
+        }
+    }
+
+    /* A text appended to the document could be parsed on its own only if the
+     * document ends with a complete line. */
+    if(ctx->n_containers == 0  &&  md_is_after_block(ctx, state)  &&
+       (ctx->size == 0  ||  ctx->doc_ends_with_newline))
+        MD_CHECK(md_push_boundary(ctx, ctx->size, ctx->n_block_bytes, ctx->n_ref_defs));
+
+abort:
+    return ret;
+}
+
+
+/*************************************
+ ***  Parallel Analysis of Blocks  ***
+ *************************************/
+
+#ifdef MD4C_USE_THREADS
+
+/* With MD_FLAG_PARALLELBLOCKS, the document is cut into chunks which are
+ * analyzed concurrently, each one as if it were a standalone document, and
+ * the results are then stitched together in the document order.
+ *
+ * The chunk boundaries are only guesses made by a cheap textual scan: A chunk
+ * starts with a line which follows a blank line and which starts in the 1st
+ * column with a character which can start neither a container mark nor
+ * a continuation of a block quote. Such a line always starts a new top-level
+ * block, unless the blank line before it is actually part of a fenced code
+ * block, an indented code block or a raw HTML block. So when stitching, we
+ * check the real state of the analysis at the end of the preceding chunk and
+ * if the guess was wrong, we throw the chunk's results away and analyze it
+ * again sequentially. Either way, the result is exactly the same as without
+ * the flag. */
+
+/* Documents are cut into chunks of at least this size. */
+#define PARALLEL_CHUNK_MINSIZE      (512 * 1024)
+
+/* Limit of chunks (and threads) per document. */
+#define PARALLEL_CHUNK_MAXCOUNT     16
+
+typedef struct MD_BLOCK_CHUNK_tag MD_BLOCK_CHUNK;
+struct MD_BLOCK_CHUNK_tag {
+    MD_CTX ctx;             /* ctx.size is end of the chunk. */
+    MD_ANALYSIS_STATE state;
+    OFF beg;
+    int ret;
+    int is_analyzed;
+    pthread_t thread;
+};
+
+/* Find beginning of the first line after off which is a suitable chunk
+ * boundary (see above). Returns end if there is no such line. */
+static OFF
+md_find_chunk_boundary(MD_CTX* ctx, OFF off, OFF end)
+{
+    int prev_line_is_blank = FALSE;
+    OFF line_beg;
+
+    /* Skip the rest of the line we are in. */
+    while(off < end  &&  !ISNEWLINE(off))
+        off++;
+
+    while(off < end) {
+        /* Eat the new line. */
+        if(CH(off) == _T('\r'))
+            off++;
+        if(off < end  &&  CH(off) == _T('\n'))
+            off++;
+
+        line_beg = off;
+        while(off < end  &&  ISBLANK(off))
+            off++;
+        if(off >= end)
+            break;
+
+        if(ISNEWLINE(off)) {
+            prev_line_is_blank = TRUE;
+            continue;
+        }
+
+        if(prev_line_is_blank  &&  off == line_beg  &&  !ISANYOF(off, _T("-+*>0123456789")))
+            return line_beg;
+
+        prev_line_is_blank = FALSE;
+        while(off < end  &&  !ISNEWLINE(off))
+            off++;
+    }
+
+    return end;
+}
+
+static void*
+md_analyze_chunk_thread(void* arg)
+{
+    MD_BLOCK_CHUNK* chunk = (MD_BLOCK_CHUNK*) arg;
+
+    chunk->ret = md_analyze_lines(&chunk->ctx, &chunk->state, chunk->beg, chunk->ctx.size);
+    return NULL;
+}
+
+/* Append the results of the chunk analysis to ctx, as if ctx has analyzed
+ * the chunk itself. The caller has to make sure the chunk is a start of a new
+ * top-level block. */
+static int
+md_stitch_chunk(MD_CTX* ctx, MD_ANALYSIS_STATE* state, MD_BLOCK_CHUNK* chunk)
+{
+    MD_CTX* src = &chunk->ctx;
+    int base;
+    int i;
+    int ret = 0;
+
+    MD_ASSERT(ctx->current_block == NULL);
+
+    /* The new top-level block closes all the containers. */
+    MD_CHECK(md_leave_child_containers(ctx, 0));
+
+    base = ctx->n_block_bytes;
+    if(ctx->n_block_bytes + src->n_block_bytes > ctx->alloc_block_bytes) {
+        int alloc_block_bytes = ctx->n_block_bytes + src->n_block_bytes;
+        void* new_block_bytes;
+
+        alloc_block_bytes = MAX(alloc_block_bytes + alloc_block_bytes / 2, 512);
+        new_block_bytes = MD_REALLOC(ctx->block_bytes, alloc_block_bytes);
+        if(new_block_bytes == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+
+        ctx->block_bytes = new_block_bytes;
+        ctx->alloc_block_bytes = alloc_block_bytes;
+    }
+    if(src->n_block_bytes > 0) {
+        memcpy((char*) ctx->block_bytes + base, src->block_bytes, src->n_block_bytes);
+        ctx->block_bytes_end_with_container = src->block_bytes_end_with_container;
+    }
+    ctx->n_block_bytes += src->n_block_bytes;
+    if(src->current_block != NULL) {
+        ctx->current_block = (MD_BLOCK*) ((char*) ctx->block_bytes + base +
+                ((char*) src->current_block - (char*) src->block_bytes));
+        ctx->current_block_after_container = src->current_block_after_container;
+    }
+
+    /* md_process_all_blocks() relies on ctx->containers being large enough
+     * for the deepest nesting seen during the analysis. */
+    if(src->alloc_containers > ctx->alloc_containers) {
+        MD_CONTAINER* new_containers;
+
+        new_containers = MD_REALLOC(ctx->containers, src->alloc_containers * sizeof(MD_CONTAINER));
+        if(new_containers == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+
+        ctx->containers = new_containers;
+        ctx->alloc_containers = src->alloc_containers;
+    }
+
+    for(i = 0; i < src->n_containers; i++) {
+        MD_CHECK(md_push_container(ctx, &src->containers[i]));
+        ctx->containers[ctx->n_containers-1].block_byte_off += base;
+    }
+
+    /* Take over the reference definitions (including ownership of any
+     * strings they hold). */
+    if(src->n_ref_defs > 0) {
+        if(ctx->n_ref_defs + src->n_ref_defs > ctx->alloc_ref_defs) {
+            int alloc_ref_defs = ctx->n_ref_defs + src->n_ref_defs;
+            MD_REF_DEF* new_defs;
+
+            alloc_ref_defs = MAX(alloc_ref_defs + alloc_ref_defs / 2, 16);
+            new_defs = (MD_REF_DEF*) MD_REALLOC(ctx->ref_defs, alloc_ref_defs * sizeof(MD_REF_DEF));
+            if(new_defs == NULL) {
+                MD_LOG("realloc() failed.");
+                ret = -1;
+                goto abort;
+            }
+
+            ctx->ref_defs = new_defs;
+            ctx->alloc_ref_defs = alloc_ref_defs;
+        }
+
+        memcpy(ctx->ref_defs + ctx->n_ref_defs, src->ref_defs, src->n_ref_defs * sizeof(MD_REF_DEF));
+        ctx->n_ref_defs += src->n_ref_defs;
+        src->n_ref_defs = 0;
+    }
+
+    ctx->code_fence_length = src->code_fence_length;
+    ctx->html_block_type = src->html_block_type;
+    ctx->last_line_has_list_loosening_effect = src->last_line_has_list_loosening_effect;
+    ctx->last_list_item_starts_with_two_blank_lines = src->last_list_item_starts_with_two_blank_lines;
+
+    if(chunk->state.pivot_line == &md_dummy_blank_line) {
+        state->pivot_line = &md_dummy_blank_line;
+    } else {
+        memcpy(state->line_buf, chunk->state.line_buf, sizeof(state->line_buf));
+        state->pivot_line = &state->line_buf[chunk->state.pivot_line - chunk->state.line_buf];
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_analyze_lines_parallel(MD_CTX* ctx, MD_ANALYSIS_STATE* state)
+{
+    MD_BLOCK_CHUNK* chunks;
+    long n_cpus;
+    int n_chunks;
+    int i;
+    int ret = 0;
+
+    n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    n_chunks = (int) MIN(ctx->size / PARALLEL_CHUNK_MINSIZE, PARALLEL_CHUNK_MAXCOUNT);
+    if(n_cpus < n_chunks)
+        n_chunks = (int) n_cpus;
+    if(n_chunks < 2)
+        return md_analyze_lines(ctx, state, 0, ctx->size);
+
+    chunks = (MD_BLOCK_CHUNK*) MD_MALLOC(n_chunks * sizeof(MD_BLOCK_CHUNK));
+    if(chunks == NULL)
+        return md_analyze_lines(ctx, state, 0, ctx->size);
+
+    /* Find the chunk boundaries. */
+    chunks[0].beg = 0;
+    for(i = 1; i < n_chunks; i++) {
+        OFF off = MAX(chunks[i-1].beg, (OFF) ((uint64_t) ctx->size * i / n_chunks));
+
+        off = md_find_chunk_boundary(ctx, off, ctx->size);
+        if(off >= ctx->size)
+            break;
+        chunks[i].beg = off;
+    }
+    n_chunks = i;
+    if(n_chunks < 2) {
+        MD_FREE(chunks);
+        return md_analyze_lines(ctx, state, 0, ctx->size);
+    }
+
+    /* Start analysis of all the chunks but the 1st one in their own threads. */
+    for(i = 1; i < n_chunks; i++) {
+        MD_BLOCK_CHUNK* chunk = &chunks[i];
+        MD_CTX* chunk_ctx = &chunk->ctx;
+
+        memcpy(chunk_ctx, ctx, sizeof(MD_CTX));
+        chunk_ctx->size = (i+1 < n_chunks ? chunks[i+1].beg : ctx->size);
+        chunk_ctx->doc_ends_with_newline = (i+1 < n_chunks ? TRUE : ctx->doc_ends_with_newline);
+        chunk_ctx->buffer = NULL;
+        chunk_ctx->alloc_buffer = 0;
+        chunk_ctx->ref_defs = NULL;
+        chunk_ctx->n_ref_defs = 0;
+        chunk_ctx->alloc_ref_defs = 0;
+        chunk_ctx->block_bytes = NULL;
+        chunk_ctx->current_block = NULL;
+        chunk_ctx->n_block_bytes = 0;
+        chunk_ctx->alloc_block_bytes = 0;
+        chunk_ctx->containers = NULL;
+        chunk_ctx->n_containers = 0;
+        chunk_ctx->alloc_containers = 0;
+        chunk->state.pivot_line = &md_dummy_blank_line;
+        chunk->ret = 0;
+        chunk->is_analyzed = (pthread_create(&chunk->thread, NULL, md_analyze_chunk_thread, chunk) == 0);
+    }
+
+    /* Analyze the 1st chunk ourselves and then stitch the others to it. */
+    ret = md_analyze_lines(ctx, state, 0, chunks[1].beg);
+
+    for(i = 1; i < n_chunks; i++) {
+        MD_BLOCK_CHUNK* chunk = &chunks[i];
+
+        if(chunk->is_analyzed)
+            pthread_join(chunk->thread, NULL);
+
+        if(ret == 0) {
+            if(chunk->is_analyzed  &&  chunk->ret == 0  &&
+               state->pivot_line == &md_dummy_blank_line  &&
+               ctx->current_block == NULL  &&  ctx->html_block_type == 0)
+            {
+                ret = md_stitch_chunk(ctx, state, chunk);
+            } else {
+                /* The boundary guess was wrong (or the thread has failed). */
+                ret = md_analyze_lines(ctx, state, chunk->beg, chunk->ctx.size);
+            }
+        }
+
+        md_free_ref_defs(&chunk->ctx);
+        MD_FREE(chunk->ctx.buffer);
+        MD_FREE(chunk->ctx.block_bytes);
+        MD_FREE(chunk->ctx.containers);
+    }
+
+    MD_FREE(chunks);
+    return ret;
+}
+
+#endif  /* #ifdef MD4C_USE_THREADS */
+
+/* Analyze and process all the blocks of the document (without entering and
+ * leaving the document itself). */
+static int
+md_process_doc_blocks(MD_CTX *ctx)
+{
+    MD_ANALYSIS_STATE state;
+    int ret = 0;
+
+    state.pivot_line = &md_dummy_blank_line;
+
+    if(ctx->boundary_callback != NULL)
+        MD_CHECK(md_analyze_lines_with_boundaries(ctx, &state));
+#ifdef MD4C_USE_THREADS
+    else if(ctx->parser.flags & MD_FLAG_PARALLELBLOCKS)
+        MD_CHECK(md_analyze_lines_parallel(ctx, &state));
+#endif
+    else
+        MD_CHECK(md_analyze_lines(ctx, &state, 0, ctx->size));
+
+    md_end_current_block(ctx);
+
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+
+    /* Process all blocks. */
+    MD_CHECK(md_leave_child_containers(ctx, 0));
+    MD_CHECK(md_process_all_blocks(ctx));
+
+abort:
+    return ret;
+}
+
+static int
+md_process_doc(MD_CTX *ctx)
+{
+    int ret = 0;
+
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+    MD_CHECK(md_process_doc_blocks(ctx));
+    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+
+abort:
+
+#if 0
+    /* Output some memory consumption statistics. */
+    {
+        char buffer[256];
+        sprintf(buffer, "Alloced %u bytes for block buffer.",
+                    (unsigned)(ctx->alloc_block_bytes));
+        MD_LOG(buffer);
+
+        sprintf(buffer, "Alloced %u bytes for containers buffer.",
+                    (unsigned)(ctx->alloc_containers * sizeof(MD_CONTAINER)));
+        MD_LOG(buffer);
+
+        sprintf(buffer, "Alloced %u bytes for marks buffer.",
+                    (unsigned)(ctx->alloc_marks * sizeof(MD_MARK)));
+        MD_LOG(buffer);
+
+        sprintf(buffer, "Alloced %u bytes for aux. buffer.",
+                    (unsigned)(ctx->alloc_buffer * sizeof(MD_CHAR)));
+        MD_LOG(buffer);
+    }
+#endif
+
+    return ret;
+}
+
+
+/********************
+ ***  Public API  ***
+ ********************/
+
+/* The buffers of MD_CTX which md_parse_with_state() keeps for the next call. */
+struct MD_PARSER_STATE {
+    CHAR* buffer;
+    unsigned alloc_buffer;
+    MD_REF_DEF* ref_defs;
+    int alloc_ref_defs;
+    MD_MARK* marks;
+    int alloc_marks;
+    void* block_bytes;
+    int alloc_block_bytes;
+    MD_CONTAINER* containers;
+    int alloc_containers;
+};
+
+MD_PARSER_STATE*
+md_parser_state_new(void)
+{
+    MD_PARSER_STATE* state;
+
+    state = (MD_PARSER_STATE*) MD_MALLOC(sizeof(MD_PARSER_STATE));
+    if(state != NULL)
+        memset(state, 0, sizeof(MD_PARSER_STATE));
+    return state;
+}
+
+void
+md_parser_state_trim(MD_PARSER_STATE* state, MD_SIZE max_size)
+{
+    if(state->alloc_buffer * sizeof(CHAR) > max_size) {
+        MD_FREE(state->buffer);
+        state->buffer = NULL;
+        state->alloc_buffer = 0;
+    }
+    if(state->alloc_ref_defs * sizeof(MD_REF_DEF) > max_size) {
+        MD_FREE(state->ref_defs);
+        state->ref_defs = NULL;
+        state->alloc_ref_defs = 0;
+    }
+    if(state->alloc_marks * sizeof(MD_MARK) > max_size) {
+        MD_FREE(state->marks);
+        state->marks = NULL;
+        state->alloc_marks = 0;
+    }
+    if((unsigned) state->alloc_block_bytes > max_size) {
+        MD_FREE(state->block_bytes);
+        state->block_bytes = NULL;
+        state->alloc_block_bytes = 0;
+    }
+    if(state->alloc_containers * sizeof(MD_CONTAINER) > max_size) {
+        MD_FREE(state->containers);
+        state->containers = NULL;
+        state->alloc_containers = 0;
+    }
+}
+
+void
+md_parser_state_free(MD_PARSER_STATE* state)
+{
+    if(state != NULL) {
+        md_parser_state_trim(state, 0);
+        MD_FREE(state);
+    }
+}
+
+/* Limit of MD_CTX::max_ref_def_output for a text of the given size. The text
+ * of the table of ref. defs (if any) counts as if it were appended to it. */
+static SZ
+md_max_ref_def_output(SZ size, const MD_REF_DEF_TABLE* ref_defs)
+{
+    size = MIN(size, (SZ)(1024 * 1024 / 16));
+    if(ref_defs != NULL)
+        size = MIN(size + MIN(ref_defs->size, (SZ)(1024 * 1024 / 16)), (SZ)(1024 * 1024 / 16));
+    return 16 * size;
+}
+
+/* Setup the context structure for parsing the text (without any buffers). */
+static void
+md_setup_ctx(MD_CTX* ctx, const CHAR* text, SZ size, const MD_PARSER* parser, void* userdata)
+{
+    int i;
+
+    memset(ctx, 0, sizeof(MD_CTX));
+    ctx->text = text;
+    ctx->size = size;
+    memcpy(&ctx->parser, parser, sizeof(MD_PARSER));
+    ctx->userdata = userdata;
+    ctx->code_indent_offset = (ctx->parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
+    md_build_mark_char_map(ctx);
+    ctx->doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+#ifdef MD4C_USE_SIMD
+    md_build_newline_index(ctx);
+#endif
+    ctx->max_ref_def_output = md_max_ref_def_output(size, NULL);
+
+    /* Reset all mark stacks and lists. */
+    for(i = 0; i < (int) SIZEOF_ARRAY(ctx->opener_stacks); i++)
+        ctx->opener_stacks[i].top = -1;
+    ctx->ptr_stack.top = -1;
+    ctx->unresolved_link_head = -1;
+    ctx->unresolved_link_tail = -1;
+    ctx->table_cell_boundaries_head = -1;
+    ctx->table_cell_boundaries_tail = -1;
+}
+
+/* Let the context use the buffers of the state (if not NULL). */
+static void
+md_ctx_take_state(MD_CTX* ctx, MD_PARSER_STATE* state)
+{
+    if(state != NULL) {
+        ctx->buffer = state->buffer;
+        ctx->alloc_buffer = state->alloc_buffer;
+        ctx->ref_defs = state->ref_defs;
+        ctx->alloc_ref_defs = state->alloc_ref_defs;
+        ctx->marks = state->marks;
+        ctx->alloc_marks = state->alloc_marks;
+        ctx->block_bytes = state->block_bytes;
+        ctx->alloc_block_bytes = state->alloc_block_bytes;
+        ctx->containers = state->containers;
+        ctx->alloc_containers = state->alloc_containers;
+    }
+}
+
+/* Release everything the context holds, except the buffers which go back to
+ * the state (if not NULL) for the next document. */
+static void
+md_ctx_release(MD_CTX* ctx, MD_PARSER_STATE* state)
+{
+    md_free_ref_def_hashtable(ctx);
+    MD_FREE(ctx->boundaries);
+    ctx->boundaries = NULL;
+    ctx->n_boundaries = 0;
+    ctx->alloc_boundaries = 0;
+#ifdef MD4C_USE_SIMD
+    MD_FREE((void*) ctx->newline_bits);
+#endif
+    if(state != NULL) {
+        /* Keep the buffers (possibly reallocated) for the next document. */
+        md_clear_ref_defs(ctx);
+        state->buffer = ctx->buffer;
+        state->alloc_buffer = ctx->alloc_buffer;
+        state->ref_defs = ctx->ref_defs;
+        state->alloc_ref_defs = ctx->alloc_ref_defs;
+        state->marks = ctx->marks;
+        state->alloc_marks = ctx->alloc_marks;
+        state->block_bytes = ctx->block_bytes;
+        state->alloc_block_bytes = ctx->alloc_block_bytes;
+        state->containers = ctx->containers;
+        state->alloc_containers = ctx->alloc_containers;
+    } else {
+        md_free_ref_defs(ctx);
+        MD_FREE(ctx->buffer);
+        MD_FREE(ctx->marks);
+        MD_FREE(ctx->block_bytes);
+        MD_FREE(ctx->containers);
+    }
+}
+
+int
+md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    return md_parse_with_state(NULL, text, size, parser, userdata);
+}
+
+int
+md_parse_with_state(MD_PARSER_STATE* state, const MD_CHAR* text, MD_SIZE size,
+                    const MD_PARSER* parser, void* userdata)
+{
+    return md_parse_with_ref_defs(state, NULL, text, size, parser, userdata);
+}
+
+int
+md_parse_with_ref_defs(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                       const MD_CHAR* text, MD_SIZE size,
+                       const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    int ret;
+
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
+
+    md_setup_ctx(&ctx, text, size, parser, userdata);
+    ctx.ext_ref_defs = ref_defs;
+    ctx.max_ref_def_output = md_max_ref_def_output(size, ref_defs);
+    md_ctx_take_state(&ctx, state);
+
+    /* All the work. */
+    ret = md_process_doc(&ctx);
+
+    /* Clean-up. */
+    md_ctx_release(&ctx, state);
+    return ret;
+}
+
+int
+md_parse_range(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+               const MD_CHAR* text, MD_SIZE size, MD_OFFSET beg, MD_OFFSET end,
+               const MD_PARSER* parser, MD_BOUNDARY_CALLBACK boundary, void* userdata,
+               MD_SIZE* p_n_ref_defs)
+{
+    MD_CTX ctx;
+    int ret;
+
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
+
+    if(beg > end  ||  end > size) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Invalid range.", userdata);
+        return -1;
+    }
+
+    md_setup_ctx(&ctx, text + beg, end - beg, parser, userdata);
+    ctx.input_off = beg;
+    ctx.ext_ref_defs = ref_defs;
+    ctx.ext_ref_defs_first = TRUE;
+    ctx.boundary_callback = boundary;
+    /* Same limit as for the whole text, so the range does not run out of it
+     * where the whole text would not. */
+    ctx.max_ref_def_output = md_max_ref_def_output(size, NULL);
+    md_ctx_take_state(&ctx, state);
+
+    ret = md_process_doc(&ctx);
+    if(p_n_ref_defs != NULL)
+        *p_n_ref_defs = (MD_SIZE) ctx.n_ref_defs;
+
+    md_ctx_release(&ctx, state);
+    return ret;
+}
+
+static int
+md_ref_def_table_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    MD_UNUSED(type);
+    MD_UNUSED(detail);
+    MD_UNUSED(userdata);
+    return 0;
+}
+
+static int
+md_ref_def_table_span_callback(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    MD_UNUSED(type);
+    MD_UNUSED(detail);
+    MD_UNUSED(userdata);
+    return 0;
+}
+
+static int
+md_ref_def_table_text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_UNUSED(type);
+    MD_UNUSED(text);
+    MD_UNUSED(size);
+    MD_UNUSED(userdata);
+    return 0;
+}
+
+MD_REF_DEF_TABLE*
+md_ref_def_table_new(const MD_CHAR* text, MD_SIZE size, unsigned flags)
+{
+    MD_PARSER parser = {
+        0,
+        flags,
+        md_ref_def_table_block_callback,
+        md_ref_def_table_block_callback,
+        md_ref_def_table_span_callback,
+        md_ref_def_table_span_callback,
+        md_ref_def_table_text_callback,
+        NULL,
+        NULL
+    };
+
+    return md_ref_def_table_new_with_parser(text, size, &parser, NULL, NULL);
+}
+
+MD_REF_DEF_TABLE*
+md_ref_def_table_new_with_parser(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser,
+                                 MD_BOUNDARY_CALLBACK boundary, void* userdata)
+{
+    MD_REF_DEF_TABLE* table;
+    MD_CTX ctx;
+    int i;
+    int ret;
+
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return NULL;
+    }
+
+    table = (MD_REF_DEF_TABLE*) MD_MALLOC(sizeof(MD_REF_DEF_TABLE));
+    if(table == NULL)
+        return NULL;
+    memset(table, 0, sizeof(MD_REF_DEF_TABLE));
+
+    /* The ref. defs refer to the text, so the table keeps its own copy. */
+    table->text = (CHAR*) MD_MALLOC(MAX(size, 1) * sizeof(CHAR));
+    if(table->text == NULL) {
+        MD_FREE(table);
+        return NULL;
+    }
+    memcpy(table->text, text, size * sizeof(CHAR));
+    table->size = size;
 
-                total_indent += container.contents_indent - container.mark_indent;
-                line->indent = md_line_indentation(ctx, total_indent, off, &off);
-                total_indent += line->indent;
-                line->beg = off;
+    md_setup_ctx(&ctx, text, size, parser, userdata);
+    ctx.boundary_callback = boundary;
+    ret = md_process_doc(&ctx);
 
-                /* Some of the following whitespace actually still belongs to the mark. */
-                if(off >= ctx->size || ISNEWLINE(off)) {
-                    container.contents_indent++;
-                } else if(line->indent <= ctx->code_indent_offset) {
-                    container.contents_indent += line->indent;
-                    line->indent = 0;
-                } else {
-                    container.contents_indent += 1;
-                    line->indent--;
-                }
+    /* The callbacks have seen the text itself; move the ref. defs over to
+     * the copy. */
+    for(i = 0; i < ctx.n_ref_defs; i++) {
+        MD_REF_DEF* def = &ctx.ref_defs[i];
+
+        if(!def->label_needs_free)
+            def->label = table->text + (def->label - text);
+        if(!def->title_needs_free  &&  def->title != NULL)
+            def->title = table->text + (def->title - text);
+    }
+
+    /* Take over the ref. defs and their index; drop all the rest. */
+    table->ref_defs = ctx.ref_defs;
+    table->n_ref_defs = ctx.n_ref_defs;
+    table->ref_def_hashtable = ctx.ref_def_hashtable;
+    table->ref_def_hashtable_size = ctx.ref_def_hashtable_size;
+    table->ref_def_labels = ctx.ref_def_labels;
+#ifdef MD4C_USE_SIMD
+    MD_FREE((void*) ctx.newline_bits);
+#endif
+    MD_FREE(ctx.buffer);
+    MD_FREE(ctx.marks);
+    MD_FREE(ctx.block_bytes);
+    MD_FREE(ctx.containers);
+    MD_FREE(ctx.boundaries);
+
+    if(ret != 0) {
+        md_ref_def_table_free(table);
+        return NULL;
+    }
+    return table;
+}
 
-                ctx->containers[n_parents].mark_indent = container.mark_indent;
-                ctx->containers[n_parents].contents_indent = container.contents_indent;
+int
+md_ref_def_table_size(const MD_REF_DEF_TABLE* table)
+{
+    int i;
+    int n = 0;
 
-                n_brothers++;
-                continue;
-            }
-        }
+    /* Duplicate ref. defs are not in the index. */
+    for(i = 0; i < table->ref_def_hashtable_size; i++) {
+        if(table->ref_def_hashtable[i] != NULL)
+            n++;
+    }
+    return n;
+}
 
-        /* Check for indented code.
-         * Note indented code block cannot interrupt a paragraph. */
-        if(line->indent >= ctx->code_indent_offset  &&  (pivot_line->type != MD_LINE_TEXT)) {
-            line->type = MD_LINE_INDENTEDCODE;
-            line->indent -= ctx->code_indent_offset;
-            line->data = 0;
-            break;
-        }
+void
+md_ref_def_table_free(MD_REF_DEF_TABLE* table)
+{
+    int i;
 
-        /* Check for start of a new container block. */
-        if(line->indent < ctx->code_indent_offset  &&
-           md_is_container_mark(ctx, line->indent, off, &off, &container))
-        {
-            if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
-                        (off >= ctx->size || ISNEWLINE(off))  &&  container.ch != _T('>'))
-            {
-                /* Noop. List mark followed by a blank line cannot interrupt a paragraph. */
-            } else if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
-                        ISANYOF2_(container.ch, _T('.'), _T(')'))  &&  container.start != 1)
-            {
-                /* Noop. Ordered list cannot interrupt a paragraph unless the start index is 1. */
-            } else {
-                total_indent += container.contents_indent - container.mark_indent;
-                line->indent = md_line_indentation(ctx, total_indent, off, &off);
-                total_indent += line->indent;
+    if(table == NULL)
+        return;
 
-                line->beg = off;
-                line->data = container.ch;
+    for(i = 0; i < table->n_ref_defs; i++) {
+        MD_REF_DEF* def = &table->ref_defs[i];
 
-                /* Some of the following whitespace actually still belongs to the mark. */
-                if(off >= ctx->size || ISNEWLINE(off)) {
-                    container.contents_indent++;
-                } else if(line->indent <= ctx->code_indent_offset) {
-                    container.contents_indent += line->indent;
-                    line->indent = 0;
-                } else {
-                    container.contents_indent += 1;
-                    line->indent--;
-                }
+        if(def->label_needs_free)
+            MD_FREE(def->label);
+        if(def->title_needs_free)
+            MD_FREE(def->title);
+    }
+    MD_FREE(table->ref_defs);
+    MD_FREE(table->ref_def_hashtable);
+    MD_FREE(table->ref_def_labels);
+    MD_FREE(table->text);
+    MD_FREE(table);
+}
 
-                if(n_brothers + n_children == 0)
-                    pivot_line = &md_dummy_blank_line;
+int
+md_parse_inlines(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                 const MD_CHAR* text, MD_SIZE size,
+                 const MD_LINE_RANGE* lines, MD_SIZE n_lines,
+                 const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    MD_LINE* block_lines;
+    MD_SIZE i;
+    int ret;
 
-                if(n_children == 0)
-                    MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
 
-                n_children++;
-                MD_CHECK(md_push_container(ctx, &container));
-                continue;
-            }
+    for(i = 0; i < n_lines; i++) {
+        if(lines[i].beg > lines[i].end  ||  lines[i].end > size  ||
+           (i > 0  &&  lines[i-1].end >= lines[i].beg))
+        {
+            if(parser->debug_log != NULL)
+                parser->debug_log("Invalid range.", userdata);
+            return -1;
         }
+    }
 
-        /* Check whether we are table continuation. */
-        if(pivot_line->type == MD_LINE_TABLE  &&  n_parents == ctx->n_containers) {
-            line->type = MD_LINE_TABLE;
-            break;
-        }
+    if(n_lines == 0)
+        return 0;
 
-        /* Check for ATX header. */
-        if(line->indent < ctx->code_indent_offset  &&
-                off < ctx->size  &&  CH(off) == _T('#'))
-        {
-            unsigned level;
+    block_lines = (MD_LINE*) MD_MALLOC(n_lines * sizeof(MD_LINE));
+    if(block_lines == NULL) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("malloc() failed.", userdata);
+        return -1;
+    }
+    for(i = 0; i < n_lines; i++) {
+        block_lines[i].beg = lines[i].beg;
+        block_lines[i].end = lines[i].end;
+    }
 
-            if(md_is_atxheader_line(ctx, off, &line->beg, &off, &level)) {
-                line->type = MD_LINE_ATXHEADER;
-                line->data = level;
-                break;
-            }
-        }
+    /* Set up for an empty text first, so that no index of the line ends
+     * (which only the block analysis needs) is built for the whole text. */
+    md_setup_ctx(&ctx, text, 0, parser, userdata);
+    ctx.size = size;
+    ctx.parser.flags &= ~MD_FLAG_SKIPINLINES;
+    ctx.ext_ref_defs = ref_defs;
+    ctx.ext_ref_defs_first = TRUE;
+    /* Same limit as for the whole text (see md_parse_range()). */
+    ctx.max_ref_def_output = md_max_ref_def_output(size, NULL);
+    md_ctx_take_state(&ctx, state);
 
-        /* Check whether we are starting code fence. */
-        if(line->indent < ctx->code_indent_offset  &&
-                off < ctx->size  &&  ISANYOF2(off, _T('`'), _T('~')))
-        {
-            if(md_is_opening_code_fence(ctx, off, &off)) {
-                line->type = MD_LINE_FENCEDCODE;
-                line->data = 1;
-                line->enforce_new_block = TRUE;
-                break;
-            }
-        }
+    ret = md_process_normal_block_contents(&ctx, block_lines, n_lines);
 
-        /* Check for start of raw HTML block. */
-        if(off < ctx->size  &&  CH(off) == _T('<')
-            &&  !(ctx->parser.flags & MD_FLAG_NOHTMLBLOCKS))
-        {
-            ctx->html_block_type = md_is_html_block_start_condition(ctx, off);
+    md_ctx_release(&ctx, state);
+    MD_FREE(block_lines);
+    return ret;
+}
 
-            /* HTML block type 7 cannot interrupt paragraph. */
-            if(ctx->html_block_type == 7  &&  pivot_line->type == MD_LINE_TEXT)
-                ctx->html_block_type = 0;
+/* Streaming parser (see md_parser_feed()).
+ *
+ * The input not processed yet is kept in MD_PARSER_STREAM::text. It always
+ * starts with a top-level block, so it can be processed as a document of its
+ * own. Its complete lines are analyzed as they arrive, with a context of its
+ * own (MD_PARSER_STREAM::scan_ctx), to find where the last top-level block
+ * starts (see md_stream_is_after_block()). Whatever precedes that is complete
+ * and gets processed: The block analysis only looks back, so no later line
+ * can change it anymore. If the analysis ends up outside of any block, it is
+ * all complete.
+ *
+ * The ref. defs. of the processed blocks are copied into
+ * MD_PARSER_STREAM::ref_defs, which the later blocks see as
+ * MD_CTX::ext_ref_defs. So that no block sees a ref. def. which follows it,
+ * however the input has been split into pieces, the text is processed in
+ * parts: Each top-level block (or a paragraph with the blocks interrupting
+ * it) which has any ref. defs. starts a part of its own (see
+ * MD_PARSER_STREAM::ref_def_block_begs). */
+struct MD_PARSER_STREAM {
+    MD_PARSER parser;
+    void* userdata;
+    MD_PARSER_STATE state;      /* Buffers for processing the blocks. */
 
-            if(ctx->html_block_type > 0) {
-                /* The line itself also may immediately close the block. */
-                if(md_is_html_block_end_condition(ctx, off, &off) == ctx->html_block_type) {
-                    /* Make sure this is the last line of the block. */
-                    ctx->html_block_type = 0;
-                }
+    CHAR* text;
+    SZ size;
+    SZ alloc;
+    OFF input_off;              /* Offset of text[0] in the whole input. */
 
-                line->enforce_new_block = TRUE;
-                line->type = MD_LINE_HTML;
-                break;
-            }
-        }
+    MD_CTX scan_ctx;
+    MD_PARSER_STATE scan_buffers;
+    MD_ANALYSIS_STATE scan_state;
+    OFF scan_end;               /* End of the analyzed lines. */
+    OFF last_block_beg;         /* Start of the last top-level block. */
+    int last_block_n_ref_defs;  /* scan_ctx.n_ref_defs at last_block_beg. */
 
-        /* Check for table underline. */
-        if((ctx->parser.flags & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
-            &&  off < ctx->size  &&  ISANYOF3(off, _T('|'), _T('-'), _T(':'))
-            &&  n_parents == ctx->n_containers)
-        {
-            unsigned col_count;
+    OFF* ref_def_block_begs;    /* Starts of the analyzed top-level blocks with ref. defs. */
+    int n_ref_def_block_begs;
+    int alloc_ref_def_block_begs;
 
-            if(ctx->current_block != NULL  &&  ctx->current_block->n_lines == 1  &&
-                md_is_table_underline(ctx, off, &off, &col_count))
-            {
-                line->data = col_count;
-                line->type = MD_LINE_TABLEUNDERLINE;
-                break;
-            }
-        }
+    MD_REF_DEF_TABLE* ref_defs; /* NULL until there are any. */
+    int alloc_ref_defs;
+    SZ n_ref_def_labels;
+    SZ alloc_ref_def_labels;
+    SZ n_ref_def_text;
+    SZ alloc_ref_def_text;
+    SZ ref_def_output;          /* Spent from MD_CTX::max_ref_def_output. */
 
-        /* By default, we are normal text line. */
-        line->type = MD_LINE_TEXT;
-        if(pivot_line->type == MD_LINE_TEXT  &&  n_brothers + n_children == 0) {
-            /* Lazy continuation. */
-            n_parents = ctx->n_containers;
-        }
+    int is_in_doc;
+    int ret;
+};
 
-        /* Check for task mark. */
-        if((ctx->parser.flags & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
-           ISANYOF_(ctx->containers[ctx->n_containers-1].ch, _T("-+*.)")))
-        {
-            OFF tmp = off;
+/* Start the analysis of the text anew. */
+static void
+md_stream_reset_scan(MD_PARSER_STREAM* stream)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
+
+    md_ctx_release(ctx, &stream->scan_buffers);
+    md_setup_ctx(ctx, stream->text, 0, &stream->parser, stream->userdata);
+    md_ctx_take_state(ctx, &stream->scan_buffers);
+    ctx->doc_ends_with_newline = TRUE;
+
+    stream->scan_state.pivot_line = &md_dummy_blank_line;
+    stream->scan_end = 0;
+    stream->last_block_beg = 0;
+    stream->last_block_n_ref_defs = 0;
+    stream->n_ref_def_block_begs = 0;
+}
 
-            while(tmp < ctx->size  &&  tmp < off + 3  &&  ISBLANK(tmp))
-                tmp++;
-            if(tmp + 2 < ctx->size  &&  CH(tmp) == _T('[')  &&
-               ISANYOF(tmp+1, _T("xX "))  &&  CH(tmp+2) == _T(']')  &&
-               (tmp + 3 == ctx->size  ||  ISBLANK(tmp+3)  ||  ISNEWLINE(tmp+3)))
-            {
-                MD_CONTAINER* task_container = (n_children > 0 ? &ctx->containers[ctx->n_containers-1] : &container);
-                task_container->is_task = TRUE;
-                task_container->task_mark_off = tmp + 1;
-                off = tmp + 3;
-                while(off < ctx->size  &&  ISWHITESPACE(off))
-                    off++;
-                line->beg = off;
-            }
-        }
+/* Called when the last top-level block has ended: Remember its start if it
+ * has any ref. defs. */
+static int
+md_stream_end_last_block(MD_PARSER_STREAM* stream, int n_ref_defs)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
 
-        break;
-    }
+    if(n_ref_defs == stream->last_block_n_ref_defs  ||  stream->last_block_beg == 0)
+        return 0;
 
-    /* Scan for end of the line.
-     *
-     * Note this is quite a bottleneck of the parsing as we here iterate almost
-     * over compete document.
-     */
-#if defined __linux__ && !defined MD4C_USE_UTF16
-    /* Recent glibc versions have superbly optimized strcspn(), even using
-     * vectorization if available. */
-    if(ctx->doc_ends_with_newline  &&  off < ctx->size) {
-        while(TRUE) {
-            off += (OFF) strcspn(STR(off), "\r\n");
+    if(stream->n_ref_def_block_begs >= stream->alloc_ref_def_block_begs) {
+        int alloc = MAX(stream->alloc_ref_def_block_begs * 2, 16);
+        OFF* new_begs;
 
-            /* strcspn() can stop on zero terminator; but that can appear
-             * anywhere in the Markfown input... */
-            if(CH(off) == _T('\0'))
-                off++;
-            else
-                break;
+        new_begs = (OFF*) MD_REALLOC(stream->ref_def_block_begs, alloc * sizeof(OFF));
+        if(new_begs == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
         }
-    } else
-#endif
-    {
-        /* Optimization: Use some loop unrolling. */
-        while(off + 3 < ctx->size  &&  !ISNEWLINE(off+0)  &&  !ISNEWLINE(off+1)
-                                   &&  !ISNEWLINE(off+2)  &&  !ISNEWLINE(off+3))
-            off += 4;
-        while(off < ctx->size  &&  !ISNEWLINE(off))
-            off++;
+        stream->ref_def_block_begs = new_begs;
+        stream->alloc_ref_def_block_begs = alloc;
     }
 
-    /* Set end of the line. */
-    line->end = off;
-
-    /* But for ATX header, we should exclude the optional trailing mark. */
-    if(line->type == MD_LINE_ATXHEADER) {
-        OFF tmp = line->end;
-        while(tmp > line->beg && ISBLANK(tmp-1))
-            tmp--;
-        while(tmp > line->beg && CH(tmp-1) == _T('#'))
-            tmp--;
-        if(tmp == line->beg || ISBLANK(tmp-1) || (ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS))
-            line->end = tmp;
-    }
+    stream->ref_def_block_begs[stream->n_ref_def_block_begs++] = stream->last_block_beg;
+    return 0;
+}
 
-    /* Trim trailing spaces. */
-    if(line->type != MD_LINE_INDENTEDCODE  &&  line->type != MD_LINE_FENCEDCODE  && line->type != MD_LINE_HTML) {
-        while(line->end > line->beg && ISBLANK(line->end-1))
-            line->end--;
-    }
+/* Analyze the (complete) lines of the text up to end. */
+static int
+md_stream_scan(MD_PARSER_STREAM* stream, OFF end)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
+    MD_ANALYSIS_STATE* state = &stream->scan_state;
+    MD_LINE_ANALYSIS* line = &state->line_buf[0];
+    OFF off = stream->scan_end;
+    int ret = 0;
 
-    /* Eat also the new line. */
-    if(off < ctx->size && CH(off) == _T('\r'))
-        off++;
-    if(off < ctx->size && CH(off) == _T('\n'))
-        off++;
+    ctx->text = stream->text;
+    ctx->size = end;
 
-    *p_end = off;
+    while(off < end) {
+        OFF line_beg = off;
+        unsigned n_top_level_blocks = ctx->n_top_level_blocks;
+        int n_ref_defs = ctx->n_ref_defs;
+        int is_after_block = md_is_after_block(ctx, state);
 
-    /* If we belong to a list after seeing a blank line, the list is loose. */
-    if(prev_line_has_list_loosening_effect  &&  line->type != MD_LINE_BLANK  &&  n_parents + n_brothers > 0) {
-        MD_CONTAINER* c = &ctx->containers[n_parents + n_brothers - 1];
-        if(c->ch != _T('>')) {
-            MD_BLOCK* block = (MD_BLOCK*) (((char*)ctx->block_bytes) + c->block_byte_off);
-            block->flags |= MD_BLOCK_LOOSE_LIST;
-        }
-    }
+        if(line == state->pivot_line)
+            line = (line == &state->line_buf[0] ? &state->line_buf[1] : &state->line_buf[0]);
 
-    /* Leave any containers we are not part of anymore. */
-    if(n_children == 0  &&  n_parents + n_brothers < ctx->n_containers)
-        MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+        MD_CHECK(md_analyze_line(ctx, off, &off, state->pivot_line, line));
+        MD_CHECK(md_process_line(ctx, &state->pivot_line, line));
 
-    /* Enter any container we found a mark for. */
-    if(n_brothers > 0) {
-        MD_ASSERT(n_brothers == 1);
-        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                    ctx->containers[n_parents].task_mark_off,
-                    (ctx->containers[n_parents].is_task ? CH(ctx->containers[n_parents].task_mark_off) : 0),
-                    MD_BLOCK_CONTAINER_CLOSER));
-        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                    container.task_mark_off,
-                    (container.is_task ? CH(container.task_mark_off) : 0),
-                    MD_BLOCK_CONTAINER_OPENER));
-        ctx->containers[n_parents].is_task = container.is_task;
-        ctx->containers[n_parents].task_mark_off = container.task_mark_off;
+        if(is_after_block  &&  ctx->n_top_level_blocks != n_top_level_blocks) {
+            MD_CHECK(md_stream_end_last_block(stream, n_ref_defs));
+            stream->last_block_beg = line_beg;
+            stream->last_block_n_ref_defs = n_ref_defs;
+        }
     }
 
-    if(n_children > 0)
-        MD_CHECK(md_enter_child_containers(ctx, n_children));
+    stream->scan_end = end;
 
 abort:
     return ret;
 }
 
+/* Make room for n ref. defs. in stream->ref_defs, keeping its index at most
+ * half full. */
 static int
-md_process_line(MD_CTX* ctx, const MD_LINE_ANALYSIS** p_pivot_line, MD_LINE_ANALYSIS* line)
+md_stream_reserve_ref_defs(MD_PARSER_STREAM* stream, int n)
 {
-    const MD_LINE_ANALYSIS* pivot_line = *p_pivot_line;
-    int ret = 0;
+    MD_CTX* ctx = &stream->scan_ctx;
+    MD_REF_DEF_TABLE* table = stream->ref_defs;
+    int hashtable_size;
+    int i;
 
-    /* Blank line ends current leaf block. */
-    if(line->type == MD_LINE_BLANK) {
-        MD_CHECK(md_end_current_block(ctx));
-        *p_pivot_line = &md_dummy_blank_line;
-        return 0;
+    if(n > stream->alloc_ref_defs) {
+        int alloc_ref_defs = MAX(n + n / 2, 16);
+        MD_REF_DEF* new_defs;
+
+        new_defs = (MD_REF_DEF*) MD_REALLOC(table->ref_defs, alloc_ref_defs * sizeof(MD_REF_DEF));
+        if(new_defs == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+        table->ref_defs = new_defs;
+        stream->alloc_ref_defs = alloc_ref_defs;
+
+        /* The index refers to the old array. */
+        MD_FREE(table->ref_def_hashtable);
+        table->ref_def_hashtable = NULL;
+        table->ref_def_hashtable_size = 0;
     }
 
-    if(line->enforce_new_block)
-        MD_CHECK(md_end_current_block(ctx));
+    hashtable_size = MAX(table->ref_def_hashtable_size, 16);
+    while(hashtable_size < 2 * n)
+        hashtable_size *= 2;
+    if(hashtable_size > table->ref_def_hashtable_size) {
+        MD_REF_DEF** hashtable;
+        int mask = hashtable_size - 1;
 
-    /* Some line types form block on their own. */
-    if(line->type == MD_LINE_HR || line->type == MD_LINE_ATXHEADER) {
-        MD_CHECK(md_end_current_block(ctx));
+        hashtable = (MD_REF_DEF**) MD_MALLOC(hashtable_size * sizeof(MD_REF_DEF*));
+        if(hashtable == NULL) {
+            MD_LOG("malloc() failed.");
+            return -1;
+        }
+        memset(hashtable, 0, hashtable_size * sizeof(MD_REF_DEF*));
 
-        /* Add our single-line block. */
-        MD_CHECK(md_start_new_block(ctx, line));
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
-        MD_CHECK(md_end_current_block(ctx));
-        *p_pivot_line = &md_dummy_blank_line;
-        return 0;
-    }
+        /* All the labels in the table are distinct. */
+        for(i = 0; i < table->n_ref_defs; i++) {
+            MD_REF_DEF* def = &table->ref_defs[i];
+            int slot;
 
-    /* MD_LINE_SETEXTUNDERLINE changes meaning of the current block and ends it. */
-    if(line->type == MD_LINE_SETEXTUNDERLINE) {
-        MD_ASSERT(ctx->current_block != NULL);
-        ctx->current_block->type = MD_BLOCK_H;
-        ctx->current_block->data = line->data;
-        ctx->current_block->flags |= MD_BLOCK_SETEXT_HEADER;
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
-        MD_CHECK(md_end_current_block(ctx));
-        if(ctx->current_block == NULL) {
-            *p_pivot_line = &md_dummy_blank_line;
-        } else {
-            /* This happens if we have consumed all the body as link ref. defs.
-             * and downgraded the underline into start of a new paragraph block. */
-            line->type = MD_LINE_TEXT;
-            *p_pivot_line = line;
+            for(slot = def->hash & mask; hashtable[slot] != NULL; slot = (slot + 1) & mask)
+                ;
+            hashtable[slot] = def;
         }
-        return 0;
+
+        MD_FREE(table->ref_def_hashtable);
+        table->ref_def_hashtable = hashtable;
+        table->ref_def_hashtable_size = hashtable_size;
     }
 
-    /* MD_LINE_TABLEUNDERLINE changes meaning of the current block. */
-    if(line->type == MD_LINE_TABLEUNDERLINE) {
-        MD_ASSERT(ctx->current_block != NULL);
-        MD_ASSERT(ctx->current_block->n_lines == 1);
-        ctx->current_block->type = MD_BLOCK_TABLE;
-        ctx->current_block->data = line->data;
-        MD_ASSERT(pivot_line != &md_dummy_blank_line);
-        ((MD_LINE_ANALYSIS*)pivot_line)->type = MD_LINE_TABLE;
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
+    return 0;
+}
+
+/* Add the ref. defs. of the processed blocks to stream->ref_defs. The table
+ * keeps its own copies of the folded labels, titles and destinations. Of
+ * duplicate labels, the 1st definition wins, as within a document. */
+static int
+md_stream_keep_ref_defs(MD_PARSER_STREAM* stream, MD_CTX* doc_ctx)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
+    MD_REF_DEF_TABLE* table = stream->ref_defs;
+    int i;
+
+    if(doc_ctx->n_ref_defs == 0)
         return 0;
+
+    if(table == NULL) {
+        table = (MD_REF_DEF_TABLE*) MD_MALLOC(sizeof(MD_REF_DEF_TABLE));
+        if(table == NULL) {
+            MD_LOG("malloc() failed.");
+            return -1;
+        }
+        memset(table, 0, sizeof(MD_REF_DEF_TABLE));
+        stream->ref_defs = table;
     }
 
-    /* The current block also ends if the line has different type. */
-    if(line->type != pivot_line->type)
-        MD_CHECK(md_end_current_block(ctx));
+    if(md_stream_reserve_ref_defs(stream, table->n_ref_defs + doc_ctx->n_ref_defs) != 0)
+        return -1;
 
-    /* The current line may start a new block. */
-    if(ctx->current_block == NULL) {
-        MD_CHECK(md_start_new_block(ctx, line));
-        *p_pivot_line = line;
+    /* The index of the document holds exactly its distinct labels. */
+    for(i = 0; i < doc_ctx->ref_def_hashtable_size; i++) {
+        MD_REF_DEF* def = doc_ctx->ref_def_hashtable[i];
+        const unsigned* folded_label;
+        MD_REF_DEF* new_def;
+        SZ dest_size;
+        int mask = table->ref_def_hashtable_size - 1;
+        int slot;
+
+        if(def == NULL)
+            continue;
+
+        folded_label = doc_ctx->ref_def_labels + def->folded_label_off;
+        if(md_find_ref_def(table->ref_def_hashtable, table->ref_def_hashtable_size,
+                    table->ref_def_labels, folded_label, def->folded_label_size, def->hash) != NULL)
+            continue;
+
+        if(stream->n_ref_def_labels + def->folded_label_size > stream->alloc_ref_def_labels) {
+            SZ alloc_labels = stream->n_ref_def_labels + def->folded_label_size;
+            unsigned* new_labels;
+
+            alloc_labels = MAX(alloc_labels + alloc_labels / 2, 64);
+            new_labels = (unsigned*) MD_REALLOC(table->ref_def_labels, alloc_labels * sizeof(unsigned));
+            if(new_labels == NULL) {
+                MD_LOG("realloc() failed.");
+                return -1;
+            }
+            table->ref_def_labels = new_labels;
+            stream->alloc_ref_def_labels = alloc_labels;
+        }
+
+        dest_size = def->dest_end - def->dest_beg;
+        if(stream->n_ref_def_text + dest_size > stream->alloc_ref_def_text) {
+            SZ alloc_text = stream->n_ref_def_text + dest_size;
+            CHAR* new_text;
+
+            alloc_text = MAX(alloc_text + alloc_text / 2, 256);
+            new_text = (CHAR*) MD_REALLOC(table->text, alloc_text * sizeof(CHAR));
+            if(new_text == NULL) {
+                MD_LOG("realloc() failed.");
+                return -1;
+            }
+            table->text = new_text;
+            stream->alloc_ref_def_text = alloc_text;
+        }
+
+        new_def = &table->ref_defs[table->n_ref_defs];
+        memset(new_def, 0, sizeof(MD_REF_DEF));
+
+        /* The label itself is not needed anymore, only its size (see
+         * md_is_link_reference()). */
+        new_def->label_size = def->label_size;
+        new_def->hash = def->hash;
+        new_def->folded_label_off = stream->n_ref_def_labels;
+        new_def->folded_label_size = def->folded_label_size;
+        memcpy(table->ref_def_labels + stream->n_ref_def_labels, folded_label,
+               def->folded_label_size * sizeof(unsigned));
+
+        if(def->title_needs_free) {
+            new_def->title = def->title;
+            def->title_needs_free = FALSE;
+        } else if(def->title_size > 0) {
+            new_def->title = (CHAR*) MD_MALLOC(def->title_size * sizeof(CHAR));
+            if(new_def->title == NULL) {
+                MD_LOG("malloc() failed.");
+                return -1;
+            }
+            memcpy(new_def->title, def->title, def->title_size * sizeof(CHAR));
+        }
+        new_def->title_size = def->title_size;
+        new_def->title_needs_free = (new_def->title != NULL);
+
+        new_def->dest_beg = stream->n_ref_def_text;
+        new_def->dest_end = stream->n_ref_def_text + dest_size;
+        memcpy(table->text + stream->n_ref_def_text, doc_ctx->text + def->dest_beg, dest_size * sizeof(CHAR));
+
+        stream->n_ref_def_labels += def->folded_label_size;
+        stream->n_ref_def_text += dest_size;
+        table->n_ref_defs++;
+
+        for(slot = def->hash & mask; table->ref_def_hashtable[slot] != NULL; slot = (slot + 1) & mask)
+            ;
+        table->ref_def_hashtable[slot] = new_def;
     }
 
-    /* In all other cases the line is just a continuation of the current block. */
-    MD_CHECK(md_add_line_into_current_block(ctx, line));
+    return 0;
+}
+
+/* Process text[beg .. end) as the next top-level blocks of the document. */
+static int
+md_stream_process_part(MD_PARSER_STREAM* stream, OFF beg, OFF end)
+{
+    MD_CTX doc_ctx;
+    MD_CTX* ctx = &doc_ctx;
+    SZ max_ref_def_output;
+    int ret = 0;
+
+    md_setup_ctx(ctx, stream->text + beg, end - beg, &stream->parser, stream->userdata);
+    md_ctx_take_state(ctx, &stream->state);
+    ctx->input_off = stream->input_off + beg;
+    ctx->ext_ref_defs = stream->ref_defs;
+    ctx->ext_ref_defs_first = TRUE;
+
+    /* The limit set by md_setup_ctx() is for the whole input. */
+    max_ref_def_output = md_max_ref_def_output(stream->input_off + end, NULL);
+    max_ref_def_output = (max_ref_def_output > stream->ref_def_output
+                                ? max_ref_def_output - stream->ref_def_output : 0);
+    ctx->max_ref_def_output = max_ref_def_output;
+
+    MD_CHECK(md_process_doc_blocks(ctx));
+    MD_CHECK(md_stream_keep_ref_defs(stream, ctx));
+    stream->ref_def_output += max_ref_def_output - ctx->max_ref_def_output;
 
 abort:
+    md_ctx_release(ctx, &stream->state);
     return ret;
 }
 
+/* Process text[0 .. size) as the next top-level blocks of the document, in
+ * parts split at the analyzed blocks with ref. defs. */
 static int
-md_process_doc(MD_CTX *ctx)
+md_stream_process(MD_PARSER_STREAM* stream, SZ size, int is_final)
 {
-    const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
-    MD_LINE_ANALYSIS line_buf[2];
-    MD_LINE_ANALYSIS* line = &line_buf[0];
-    OFF off = 0;
+    MD_CTX* ctx = &stream->scan_ctx;
+    OFF beg = 0;
+    int i;
     int ret = 0;
 
-    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+    if(!stream->is_in_doc) {
+        MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+        stream->is_in_doc = TRUE;
+    }
 
-    while(off < ctx->size) {
-        if(line == pivot_line)
-            line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+    for(i = 0; i < stream->n_ref_def_block_begs  &&  stream->ref_def_block_begs[i] < size; i++) {
+        MD_CHECK(md_stream_process_part(stream, beg, stream->ref_def_block_begs[i]));
+        beg = stream->ref_def_block_begs[i];
+    }
+    MD_CHECK(md_stream_process_part(stream, beg, size));
 
-        MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
-        MD_CHECK(md_process_line(ctx, &pivot_line, line));
+    if(is_final) {
+        MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+        stream->is_in_doc = FALSE;
     }
 
-    md_end_current_block(ctx);
+abort:
+    return ret;
+}
 
-    MD_CHECK(md_build_ref_def_hashtable(ctx));
+MD_PARSER_STREAM*
+md_parser_stream_new(const MD_PARSER* parser, void* userdata)
+{
+    MD_PARSER_STREAM* stream;
 
-    /* Process all blocks. */
-    MD_CHECK(md_leave_child_containers(ctx, 0));
-    MD_CHECK(md_process_all_blocks(ctx));
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return NULL;
+    }
 
-    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+    stream = (MD_PARSER_STREAM*) MD_MALLOC(sizeof(MD_PARSER_STREAM));
+    if(stream == NULL)
+        return NULL;
+    memset(stream, 0, sizeof(MD_PARSER_STREAM));
+    memcpy(&stream->parser, parser, sizeof(MD_PARSER));
+    stream->userdata = userdata;
+    md_stream_reset_scan(stream);
+    return stream;
+}
 
-abort:
+int
+md_parser_feed(MD_PARSER_STREAM* stream, const MD_CHAR* text, MD_SIZE size)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
+    SZ old_size = stream->size;
+    OFF end;
+    OFF cut;
+    int ret = 0;
 
-#if 0
-    /* Output some memory consumption statistics. */
-    {
-        char buffer[256];
-        sprintf(buffer, "Alloced %u bytes for block buffer.",
-                    (unsigned)(ctx->alloc_block_bytes));
-        MD_LOG(buffer);
+    if(stream->ret != 0)
+        return stream->ret;
 
-        sprintf(buffer, "Alloced %u bytes for containers buffer.",
-                    (unsigned)(ctx->alloc_containers * sizeof(MD_CONTAINER)));
-        MD_LOG(buffer);
+    if(stream->size + size > stream->alloc) {
+        SZ alloc = stream->size + size;
+        CHAR* new_text;
 
-        sprintf(buffer, "Alloced %u bytes for marks buffer.",
-                    (unsigned)(ctx->alloc_marks * sizeof(MD_MARK)));
-        MD_LOG(buffer);
+        alloc = MAX(alloc + alloc / 2, 256);
+        new_text = (CHAR*) MD_REALLOC(stream->text, alloc * sizeof(CHAR));
+        if(new_text == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+        stream->text = new_text;
+        stream->alloc = alloc;
+    }
+    memcpy(stream->text + stream->size, text, size * sizeof(CHAR));
+    stream->size += size;
 
-        sprintf(buffer, "Alloced %u bytes for aux. buffer.",
-                    (unsigned)(ctx->alloc_buffer * sizeof(MD_CHAR)));
-        MD_LOG(buffer);
+    /* Only the complete lines can be analyzed. (Note '\r' at the very end
+     * may still be followed by '\n'.) */
+    end = stream->size;
+    if(end > 0  &&  stream->text[end-1] == _T('\r'))
+        end--;
+    while(end > old_size  &&  !ISNEWLINE_(stream->text[end-1]))
+        end--;
+    if(end <= stream->scan_end  ||  !ISNEWLINE_(stream->text[end-1]))
+        return 0;
+
+    MD_CHECK(md_stream_scan(stream, end));
+
+    if(ctx->n_containers == 0  &&  md_is_after_block(ctx, &stream->scan_state)) {
+        MD_CHECK(md_stream_end_last_block(stream, ctx->n_ref_defs));
+        cut = end;
+    } else {
+        cut = stream->last_block_beg;
     }
-#endif
+    if(cut == 0)
+        return 0;
+
+    MD_CHECK(md_stream_process(stream, cut, FALSE));
+
+    /* Drop the processed text and analyze the rest anew. */
+    memmove(stream->text, stream->text + cut, (stream->size - cut) * sizeof(CHAR));
+    stream->size -= cut;
+    stream->input_off += cut;
+    md_stream_reset_scan(stream);
+    MD_CHECK(md_stream_scan(stream, end - cut));
 
+abort:
+    stream->ret = ret;
     return ret;
 }
 
+int
+md_parser_finish(MD_PARSER_STREAM* stream)
+{
+    MD_CTX* ctx = &stream->scan_ctx;
+    int ret = stream->ret;
+
+    /* Analyze the rest, including an incomplete last line, to see whether
+     * its last top-level block has any ref. defs. */
+    if(ret == 0  &&  stream->size > stream->scan_end) {
+        ctx->doc_ends_with_newline = ISNEWLINE_(stream->text[stream->size-1]);
+        ret = md_stream_scan(stream, stream->size);
+    }
+    if(ret == 0)
+        ret = md_end_current_block(ctx);
+    if(ret == 0)
+        ret = md_stream_end_last_block(stream, ctx->n_ref_defs);
+    if(ret == 0)
+        ret = md_stream_process(stream, stream->size, TRUE);
+
+    /* Get ready for the next document. */
+    md_ref_def_table_free(stream->ref_defs);
+    stream->ref_defs = NULL;
+    stream->alloc_ref_defs = 0;
+    stream->n_ref_def_labels = 0;
+    stream->alloc_ref_def_labels = 0;
+    stream->n_ref_def_text = 0;
+    stream->alloc_ref_def_text = 0;
+    stream->ref_def_output = 0;
+    stream->size = 0;
+    stream->input_off = 0;
+    stream->is_in_doc = FALSE;
+    stream->ret = 0;
+    md_stream_reset_scan(stream);
 
-/********************
- ***  Public API  ***
- ********************/
+    return ret;
+}
+
+void
+md_parser_stream_free(MD_PARSER_STREAM* stream)
+{
+    if(stream == NULL)
+        return;
+
+    md_ctx_release(&stream->scan_ctx, &stream->scan_buffers);
+    md_parser_state_trim(&stream->scan_buffers, 0);
+    md_parser_state_trim(&stream->state, 0);
+    md_ref_def_table_free(stream->ref_defs);
+    MD_FREE(stream->ref_def_block_begs);
+    MD_FREE(stream->text);
+    MD_FREE(stream);
+}
 
 int
-md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+md_parse_to_tape(const MD_CHAR* text, MD_SIZE size, unsigned flags, MD_TAPE** p_tape)
 {
-    MD_CTX ctx;
-    int i;
+    MD_PARSER parser;
+    MD_TAPE* tape;
     int ret;
 
+    *p_tape = NULL;
+
+    tape = (MD_TAPE*) MD_MALLOC(sizeof(MD_TAPE));
+    if(tape == NULL)
+        return -1;
+    md_tape_init(tape, text, size);
+
+    memset(&parser, 0, sizeof(MD_PARSER));
+    parser.flags = flags;
+    md_tape_setup_parser(&parser);
+
+    ret = md_parse(text, size, &parser, (void*) tape);
+    if(ret != 0) {
+        md_free_tape(tape);
+        return ret;
+    }
+
+    /* Release the slack; the tape may live long. */
+    if(tape->size > 0  &&  tape->size < tape->alloc) {
+        char* new_data = (char*) MD_REALLOC(tape->data, tape->size);
+        if(new_data != NULL) {
+            tape->data = new_data;
+            tape->alloc = tape->size;
+        }
+    }
+
+    tape->doc = NULL;
+    *p_tape = tape;
+    return 0;
+}
+
+int
+md_replay_tape(const MD_TAPE* tape, const MD_CHAR* text, MD_SIZE size,
+               const MD_PARSER* parser, void* userdata)
+{
+    size_t pos = 0;
+
     if(parser->abi_version != 0) {
         if(parser->debug_log != NULL)
             parser->debug_log("Unsupported abi_version.", userdata);
         return -1;
     }
 
-    /* Setup context structure. */
-    memset(&ctx, 0, sizeof(MD_CTX));
-    ctx.text = text;
-    ctx.size = size;
-    memcpy(&ctx.parser, parser, sizeof(MD_PARSER));
-    ctx.userdata = userdata;
-    ctx.code_indent_offset = (ctx.parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
-    md_build_mark_char_map(&ctx);
-    ctx.doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
-    ctx.max_ref_def_output = 16 * MIN(size, (MD_SIZE)(1024 * 1024 / 16));
-
-    /* Reset all mark stacks and lists. */
-    for(i = 0; i < (int) SIZEOF_ARRAY(ctx.opener_stacks); i++)
-        ctx.opener_stacks[i].top = -1;
-    ctx.ptr_stack.top = -1;
-    ctx.unresolved_link_head = -1;
-    ctx.unresolved_link_tail = -1;
-    ctx.table_cell_boundaries_head = -1;
-    ctx.table_cell_boundaries_tail = -1;
+    if(size != tape->doc_size) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("The text does not match the tape.", userdata);
+        return -1;
+    }
 
-    /* All the work. */
-    ret = md_process_doc(&ctx);
+    return md_tape_replay(tape, text, &pos, parser, userdata);
+}
 
-    /* Clean-up. */
-    md_free_ref_defs(&ctx);
-    md_free_ref_def_hashtable(&ctx);
-    free(ctx.buffer);
-    free(ctx.marks);
-    free(ctx.block_bytes);
-    free(ctx.containers);
+MD_SIZE
+md_tape_size(const MD_TAPE* tape)
+{
+    return (MD_SIZE) tape->size;
+}
 
-    return ret;
+void
+md_free_tape(MD_TAPE* tape)
+{
+    if(tape != NULL) {
+        md_tape_fini(tape);
+        MD_FREE(tape);
+    }
 }
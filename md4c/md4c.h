@@ -188,7 +188,14 @@ typedef enum MD_TEXTTYPE {
 
     /* Text is inside an equation. This is processed the same way as inlined code
      * spans (`code`). */
-    MD_TEXT_LATEXMATH
+    MD_TEXT_LATEXMATH,
+
+    /* With MD_FLAG_SKIPINLINES, one line of the unprocessed contents of
+     * a paragraph, a header or a table cell, always pointing into the
+     * document. MD_TEXT_BR and MD_TEXT_SOFTBR are not sent in between, and
+     * unlike any other text, an empty line is reported too (unless it is
+     * the only line of the block). See md_parse_inlines(). */
+    MD_TEXT_RAW
 } MD_TEXTTYPE;
 
 
@@ -318,6 +325,9 @@ typedef struct MD_SPAN_WIKILINK {
 #define MD_FLAG_WIKILINKS                   0x2000  /* Enable wiki links extension. */
 #define MD_FLAG_UNDERLINE                   0x4000  /* Enable underline extension (and disables '_' for normal emphasis). */
 #define MD_FLAG_HARD_SOFT_BREAKS            0x8000  /* Force all soft breaks to act as hard breaks. */
+#define MD_FLAG_PARALLELBLOCKS              0x10000 /* Analyze block structure of huge documents on multiple threads. */
+#define MD_FLAG_PARALLELINLINES             0x20000 /* Process contents of leaf blocks on multiple threads. */
+#define MD_FLAG_SKIPINLINES                 0x40000 /* Report contents of paragraphs, headers and table cells as MD_TEXT_RAW lines. */
 
 #define MD_FLAG_PERMISSIVEAUTOLINKS         (MD_FLAG_PERMISSIVEEMAILAUTOLINKS | MD_FLAG_PERMISSIVEURLAUTOLINKS | MD_FLAG_PERMISSIVEWWWAUTOLINKS)
 #define MD_FLAG_NOHTML                      (MD_FLAG_NOHTMLBLOCKS | MD_FLAG_NOHTMLSPANS)
@@ -399,6 +409,270 @@ typedef MD_PARSER MD_RENDERER;
  */
 int md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
 
+/* Memory allocator.
+ *
+ * By default, all the memory md4c needs is allocated with malloc(), realloc()
+ * and free(). md_set_allocator() replaces them process-wide, e.g. with an
+ * arena, a tracking allocator or one with less contention between threads.
+ * The functions may be called from several threads at once (with
+ * MD_FLAG_PARALLELBLOCKS and MD_FLAG_PARALLELINLINES also from the worker
+ * threads of md4c), and free_fn() is never given NULL.
+ *
+ * The allocator has to be set before anything is allocated with it, and
+ * it must not be changed while anything allocated (including any MD_TAPE or
+ * MD_PARSER_STATE) is still alive. md_set_allocator(NULL) restores the
+ * default.
+ */
+typedef struct MD_ALLOCATOR {
+    void* (*alloc_fn)(MD_SIZE /*size*/, void* /*userdata*/);
+    void* (*realloc_fn)(void* /*ptr*/, MD_SIZE /*size*/, void* /*userdata*/);
+    void (*free_fn)(void* /*ptr*/, void* /*userdata*/);
+
+    /* Passed to the functions above. */
+    void* userdata;
+} MD_ALLOCATOR;
+
+void md_set_allocator(const MD_ALLOCATOR* allocator);
+
+/* Allocate with the current allocator. They return NULL on failure, like
+ * their libc counterparts, and md_free() accepts NULL. These are meant for
+ * code built on top of md4c which wants to share its allocator. */
+void* md_malloc(MD_SIZE size);
+void* md_realloc(void* ptr, MD_SIZE size);
+void md_free(void* ptr);
+
+/* The vector instruction set the parser (and the HTML renderer) uses on this
+ * machine: 0 = none, 1 = SSSE3, 2 = AVX2. It is detected on the first call,
+ * which may happen from several threads at once. */
+int md_simd_level(void);
+
+/* Parser state.
+ *
+ * md_parse() allocates its internal buffers anew for every document and
+ * releases them at the end. When many documents are parsed one after another,
+ * an MD_PARSER_STATE can keep the buffers between the calls of
+ * md_parse_with_state() instead.
+ *
+ * A state may be used by one md_parse_with_state() call at a time only.
+ */
+typedef struct MD_PARSER_STATE MD_PARSER_STATE;
+
+/* Create a new state (without any buffers). Returns NULL on error. */
+MD_PARSER_STATE* md_parser_state_new(void);
+
+/* Same as md_parse(), but reusing (and keeping) the buffers of the state. */
+int md_parse_with_state(MD_PARSER_STATE* state, const MD_CHAR* text, MD_SIZE size,
+                        const MD_PARSER* parser, void* userdata);
+
+/* Release each buffer of the state which is larger than max_size bytes, e.g.
+ * after an unusually large document. */
+void md_parser_state_trim(MD_PARSER_STATE* state, MD_SIZE max_size);
+
+void md_parser_state_free(MD_PARSER_STATE* state);
+
+
+/* Precompiled reference definitions.
+ *
+ * When many documents refer to one shared set of link reference definitions
+ * (e.g. a glossary), the set can be compiled once into an MD_REF_DEF_TABLE
+ * and passed to md_parse_with_ref_defs(). Labels which the document itself
+ * does not define are then looked up in the table.
+ *
+ * A table is immutable once created, so it may be used by any number of
+ * parses at once, from any threads.
+ */
+typedef struct MD_REF_DEF_TABLE MD_REF_DEF_TABLE;
+
+/* Collect the reference definitions of the Markdown text into a new table.
+ * The text is parsed as a document with the given parser flags; everything in
+ * it but the reference definitions is ignored. The table keeps a copy of what
+ * it needs, so the text may be released afterwards.
+ *
+ * Returns NULL on error.
+ */
+MD_REF_DEF_TABLE* md_ref_def_table_new(const MD_CHAR* text, MD_SIZE size, unsigned flags);
+
+/* Number of (distinct) reference definitions in the table. */
+int md_ref_def_table_size(const MD_REF_DEF_TABLE* table);
+
+void md_ref_def_table_free(MD_REF_DEF_TABLE* table);
+
+/* Same as md_parse_with_state(), with the reference definitions of the table
+ * (if not NULL) as a fallback for those of the document. The state may be
+ * NULL too. */
+int md_parse_with_ref_defs(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                           const MD_CHAR* text, MD_SIZE size,
+                           const MD_PARSER* parser, void* userdata);
+
+
+/* Incremental reparse.
+ *
+ * A document may be split into parts at the lines which start a top-level
+ * block right after another one has ended (or after blank lines) outside of
+ * any container, and at ATX headers which interrupt a top-level paragraph.
+ * Each part then parses the same as it does within the whole document,
+ * except for links to reference definitions in the other parts.
+ * Those split points are called boundaries here; the end of the document is
+ * a boundary too if the document ends with such a complete line, so that any
+ * text appended to it would parse on its own.
+ *
+ * After an edit of a document, only the text from the last boundary before
+ * the edit to the first boundary after it needs to be parsed again, provided
+ * the edited part still ends with a boundary there and the set of reference
+ * definitions has not changed.
+ */
+typedef int (*MD_BOUNDARY_CALLBACK)(MD_OFFSET off, MD_SIZE n_ref_defs, void* userdata);
+
+/* Parse text[beg, end) of the text of the given size as a document, the same
+ * as md_parse_with_ref_defs(). All the offsets reported (including
+ * MD_BLOCK_LI_DETAIL::task_mark_offset) are offsets in the whole text.
+ *
+ * Unlike with md_parse_with_ref_defs(), the labels are looked up in ref_defs
+ * (if not NULL) before the reference definitions of the range itself. With
+ * a table made of the whole text, the links then resolve as in the whole
+ * text, even where a label is defined more than once.
+ *
+ * The limit on the output of links to reference definitions (a guard against
+ * pathological inputs) is derived from the size of the whole text. A text
+ * which reaches the limit may therefore parse differently in parts.
+ *
+ * If boundary is not NULL, it is called for each boundary of the document,
+ * in between the callbacks for the blocks before and after it, with the
+ * offset of the boundary and the count of the reference definitions from beg
+ * up to it. A non-zero return value aborts the parsing as any other callback.
+ *
+ * If p_n_ref_defs is not NULL, the count of the reference definitions in the
+ * whole range is stored there.
+ */
+int md_parse_range(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                   const MD_CHAR* text, MD_SIZE size, MD_OFFSET beg, MD_OFFSET end,
+                   const MD_PARSER* parser, MD_BOUNDARY_CALLBACK boundary, void* userdata,
+                   MD_SIZE* p_n_ref_defs);
+
+/* Same as md_ref_def_table_new(), but the text is parsed with the callbacks
+ * of the parser (and with the boundary callback as md_parse_range() calls it,
+ * if not NULL). One pass over a document can so both index it and collect its
+ * reference definitions. The strings passed to the callbacks point into the
+ * text itself, as with md_parse().
+ */
+MD_REF_DEF_TABLE* md_ref_def_table_new_with_parser(const MD_CHAR* text, MD_SIZE size,
+                                                   const MD_PARSER* parser,
+                                                   MD_BOUNDARY_CALLBACK boundary, void* userdata);
+
+
+/* Deferred inline processing.
+ *
+ * Parsing with MD_FLAG_SKIPINLINES yields just the block structure of
+ * a document: instead of analyzing the contents of each paragraph, header
+ * and table cell, the parser reports its lines as MD_TEXT_RAW. The contents
+ * of any of these blocks can be processed later on, when needed, with
+ * md_parse_inlines().
+ */
+typedef struct MD_LINE_RANGE {
+    MD_OFFSET beg;
+    MD_OFFSET end;
+} MD_LINE_RANGE;
+
+/* Process the contents of one paragraph, header or table cell of the text of
+ * the given size: the lines given by their offsets in the text, as reported
+ * with MD_TEXT_RAW. Only the span and text callbacks of the parser are called,
+ * the same as md_parse_range() calls them for the block within the whole
+ * text, provided ref_defs (if not NULL) is a table of the reference
+ * definitions of the whole text (see md_ref_def_table_new_with_parser()).
+ * MD_FLAG_SKIPINLINES is ignored.
+ *
+ * The lines must be in order and not overlap. Returns -1 if they are not.
+ */
+int md_parse_inlines(MD_PARSER_STATE* state, const MD_REF_DEF_TABLE* ref_defs,
+                     const MD_CHAR* text, MD_SIZE size,
+                     const MD_LINE_RANGE* lines, MD_SIZE n_lines,
+                     const MD_PARSER* parser, void* userdata);
+
+
+/* Streaming parser.
+ *
+ * When the input arrives piece by piece (e.g. from a pipe, or as it is being
+ * generated), it may be fed to an MD_PARSER_STREAM as it comes. The callbacks
+ * are called for each top-level block as soon as the input shows it is
+ * complete; only the last top-level block (which may still continue) is held
+ * back. Time to the first callback then does not depend on the length of
+ * the input.
+ *
+ * The callbacks are the same as md_parse() would call for the whole input,
+ * with one exception: A link can only refer to a reference definition which
+ * precedes the top-level block of the link in the input, or which is within
+ * that block. (A paragraph and the blocks interrupting it count as one block
+ * here. md_parse() allows the definitions anywhere in the document.) This
+ * does not depend on how the input is split into pieces.
+ *
+ * MD_BLOCK_DOC is entered together with the first top-level block, and left
+ * by md_parser_finish(). The strings passed to the callbacks are valid only
+ * during the callback, as with md_parse().
+ */
+typedef struct MD_PARSER_STREAM MD_PARSER_STREAM;
+
+/* Create a new stream, which calls the callbacks of the parser (the
+ * structure is copied) with the userdata. Returns NULL on error. */
+MD_PARSER_STREAM* md_parser_stream_new(const MD_PARSER* parser, void* userdata);
+
+/* Feed the next piece of the input. A piece may end anywhere, even in
+ * the middle of a line or of a character.
+ *
+ * The return value is as of md_parse(). After an error, the stream ignores
+ * any further input and keeps returning the error until md_parser_finish(). */
+int md_parser_feed(MD_PARSER_STREAM* stream, const MD_CHAR* text, MD_SIZE size);
+
+/* Process the rest of the input and end the document. The stream is then
+ * ready for another document (also after an error).
+ *
+ * The return value is as of md_parse(), or the error of md_parser_feed(), if
+ * any. */
+int md_parser_finish(MD_PARSER_STREAM* stream);
+
+void md_parser_stream_free(MD_PARSER_STREAM* stream);
+
+
+/* Event tape.
+ *
+ * md_parse_to_tape() parses the document as md_parse() does, but instead of
+ * calling any callbacks it records them into a compact binary tape. The tape
+ * can then be replayed, any number of times, to any set of callbacks with
+ * md_replay_tape(). That is much faster than parsing the document again, so
+ * a single parse may feed several renderers.
+ *
+ * Texts which are part of the document are stored in the tape only as an
+ * offset and a size, therefore md_replay_tape() has to be given the same
+ * document text which has been parsed.
+ *
+ * The detail structures passed to the callbacks during the replay (and all
+ * the strings they refer to) are valid only during the callback, the same
+ * as with md_parse().
+ */
+typedef struct MD_TAPE MD_TAPE;
+
+/* Parse the document into a new tape, stored into *p_tape. The tape has to be
+ * released with md_free_tape().
+ *
+ * Zero is returned on success, -1 on a runtime error (with *p_tape set to
+ * NULL).
+ */
+int md_parse_to_tape(const MD_CHAR* text, MD_SIZE size, unsigned flags, MD_TAPE** p_tape);
+
+/* Replay the tape to the callbacks of the parser. Only abi_version and
+ * the callbacks are used from the parser structure.
+ *
+ * Zero is returned on success, -1 if 'size' does not match the recorded
+ * document. If the processing is aborted due any callback returning non-zero,
+ * the return value of the callback is returned.
+ */
+int md_replay_tape(const MD_TAPE* tape, const MD_CHAR* text, MD_SIZE size,
+                   const MD_PARSER* parser, void* userdata);
+
+/* Size of the tape in bytes. */
+MD_SIZE md_tape_size(const MD_TAPE* tape);
+
+void md_free_tape(MD_TAPE* tape);
+
 
 #ifdef __cplusplus
     }  /* extern "C" { */
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Generates the entity tables of entity.c from the WHATWG entity list
+# (https://html.spec.whatwg.org/entities.json).
+#
+# Usage: build_entity_map.py entities.json
+#
+# Besides the sorted ENTITY_MAP (with the UTF-8 form of every entity
+# pre-encoded), a minimal perfect hash over the entity names is emitted so
+# entity_lookup() can resolve a name with one hash and one compare.
+# The output is meant to replace the tables in entity.c.
+
+import json
+import sys
+
+UTF8_MAX = 7        # ENTITY::utf8 has room for the bytes plus a terminator.
+
+
+def entity_hash(seed, name):
+    # Must stay in sync with entity_hash() in entity.c.
+    h = seed if seed != 0 else 0x811c9dc5
+    for ch in name:
+        h = ((h ^ ch) * 0x01000193) & 0xffffffff
+    return h
+
+
+def build_hash(names):
+    """Hash-and-displace: every name first lands in a bucket by the unseeded
+    hash; each bucket then gets either a seed which moves all its names to
+    free slots, or (for single-name buckets) a direct reference to a free
+    slot, encoded as -(slot+1). Returns (displacements, slots)."""
+    n = len(names)
+    buckets = [[] for _ in range(n)]
+    for i, name in enumerate(names):
+        buckets[entity_hash(0, name) % n].append(i)
+
+    displacements = [0] * n
+    slots = [None] * n
+    order = sorted(range(n), key=lambda b: -len(buckets[b]))
+
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            taken = set()
+            for i in bucket:
+                slot = entity_hash(seed, names[i]) % n
+                if slots[slot] is not None or slot in taken:
+                    break
+                taken.add(slot)
+            else:
+                break
+            seed += 1
+        for i in bucket:
+            slots[entity_hash(seed, names[i]) % n] = i
+        displacements[b] = seed
+
+    free = [s for s in range(n) if slots[s] is None]
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) != 1:
+            continue
+        slot = free.pop()
+        slots[slot] = bucket[0]
+        displacements[b] = -(slot + 1)
+
+    assert not free
+    assert max(displacements) < 0x8000 and min(displacements) >= -0x8000
+    return displacements, slots
+
+
+def c_bytes(data):
+    return '"' + "".join("\\x%02x" % b for b in data) + '"'
+
+
+def main():
+    with open(sys.argv[1], encoding="utf-8") as f:
+        entities = json.load(f)
+
+    # Legacy forms without the trailing semicolon are not recognized by
+    # CommonMark.
+    names = sorted(name for name in entities if name.endswith(";"))
+    encoded = [name.encode("ascii") for name in names]
+    displacements, slots = build_hash(encoded)
+
+    print("/* Generated by scripts/build_entity_map.py. */")
+    print("static const ENTITY ENTITY_MAP[] = {")
+    lines = []
+    for name in names:
+        codepoints = entities[name]["codepoints"]
+        assert 1 <= len(codepoints) <= 2
+        utf8 = "".join(chr(cp) for cp in codepoints).encode("utf-8")
+        assert len(utf8) <= UTF8_MAX
+        cps = codepoints + [0] * (2 - len(codepoints))
+        lines.append('    { "%s", %d, { %d, %d }, %d, %s }'
+                     % (name, len(name), cps[0], cps[1], len(utf8), c_bytes(utf8)))
+    print(",\n".join(lines))
+    print("};")
+    print()
+    print("#define ENTITY_NAME_MIN_SIZE     %d" % min(len(n) for n in names))
+    print("#define ENTITY_NAME_MAX_SIZE     %d" % max(len(n) for n in names))
+    print("#define ENTITY_HASH_SIZE         %d" % len(names))
+    print()
+    print("static const short ENTITY_HASH_DISPLACEMENTS[ENTITY_HASH_SIZE] = {")
+    for i in range(0, len(displacements), 12):
+        print("    " + " ".join("%d," % d for d in displacements[i:i+12]))
+    print("};")
+    print()
+    print("static const unsigned short ENTITY_HASH_SLOTS[ENTITY_HASH_SIZE] = {")
+    for i in range(0, len(slots), 12):
+        print("    " + " ".join("%d," % s for s in slots[i:i+12]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+# Generates the two-level Unicode lookup tables of md4c.c (whitespace and
+# punctuation classes, case folding) from the Unicode Character Database.
+#
+# Usage: build_unicode_tables.py UnicodeData.txt CaseFolding.txt
+#
+# The output is meant to replace the tables in the "Unicode Support" section
+# of md4c.c.
+
+import sys
+
+CODEPOINT_COUNT = 0x110000
+BLOCK_SIZE = 256
+
+# CommonMark counts these ASCII controls as whitespace too.
+EXTRA_WHITESPACE = (0x09, 0x0b, 0x0c)
+
+
+def read_categories(path):
+    categories = {}
+    range_first = None
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            fields = line.split(";")
+            if len(fields) < 3:
+                continue
+            codepoint = int(fields[0], 16)
+            name = fields[1]
+            category = fields[2]
+            if name.endswith(", First>"):
+                range_first = codepoint
+                continue
+            if name.endswith(", Last>"):
+                for cp in range(range_first, codepoint + 1):
+                    categories[cp] = category
+                range_first = None
+                continue
+            categories[codepoint] = category
+    return categories
+
+
+def read_folding(path):
+    folding = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(";")]
+            # Full case folding: the common and the full mappings.
+            if fields[1] not in ("C", "F"):
+                continue
+            folding[int(fields[0], 16)] = [int(x, 16) for x in fields[2].split()]
+    return folding
+
+
+def two_level(values, default):
+    """Splits values (a list with an entry per codepoint) into blocks.
+    Returns (stage1, blocks), with block 0 being the default-only block and
+    stage1 not covering the trailing default blocks."""
+    empty = tuple([default] * BLOCK_SIZE)
+    blocks = [empty]
+    block_index = {empty: 0}
+    stage1 = []
+    for beg in range(0, len(values), BLOCK_SIZE):
+        block = tuple(values[beg:beg + BLOCK_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+    while stage1 and stage1[-1] == 0:
+        stage1.pop()
+    return stage1, blocks
+
+
+def emit_array(decl, items, per_line, indent=4):
+    pad = " " * indent
+    print(pad + decl + " = {")
+    for i in range(0, len(items), per_line):
+        print(pad + "    " + ", ".join(items[i:i + per_line]) + ("," if i + per_line < len(items) else ""))
+    print(pad + "};")
+
+
+def main():
+    categories = read_categories(sys.argv[1])
+    folding = read_folding(sys.argv[2])
+
+    # Whitespace ("Zs") and punctuation ("P*" and "S*") as bit 0 and 1.
+    classes = [0] * CODEPOINT_COUNT
+    for cp, category in categories.items():
+        if category == "Zs":
+            classes[cp] |= 1
+        if category[0] in "PS":
+            classes[cp] |= 2
+    for cp in EXTRA_WHITESPACE:
+        classes[cp] |= 1
+
+    stage1, blocks = two_level(classes, 0)
+    assert len(blocks) <= 0x100
+    bitmaps = []
+    for block in blocks:
+        words = []
+        for bit in (1, 2):
+            for w in range(BLOCK_SIZE // 32):
+                word = 0
+                for i in range(32):
+                    if block[w * 32 + i] & bit:
+                        word |= 1 << i
+                words.append("0x%08x" % word)
+        bitmaps.append(words)
+
+    print("    /* Whitespace and punctuation: UNICODE_CLASS_MAP[block][class * 8 + (cp & 0xff) / 32]")
+    print("     * has the bit (cp & 31) set if the codepoint is in the class (0 = whitespace,")
+    print("     * 1 = punctuation); block = UNICODE_CLASS_STAGE1[cp / 256], or 0 past its end.")
+    print("     * (generated by scripts/build_unicode_tables.py) */")
+    emit_array("static const unsigned char UNICODE_CLASS_STAGE1[%d]" % len(stage1),
+               ["%d" % x for x in stage1], 25)
+    print("    static const uint32_t UNICODE_CLASS_MAP[%d][16] = {" % len(bitmaps))
+    for i, words in enumerate(bitmaps):
+        print("        { " + ", ".join(words[:8]) + ",")
+        print("          " + ", ".join(words[8:]) + " }" + ("," if i + 1 < len(bitmaps) else ""))
+    print("    };")
+    print()
+
+    # Case folding: each codepoint maps to a rule; rule 0 is the identity.
+    rules = [(1, 0)]
+    rule_index = {(1, 0): 0}
+    data = []
+    data_index = {}
+    fold_rules = [0] * CODEPOINT_COUNT
+    for cp, mapping in sorted(folding.items()):
+        if len(mapping) == 1:
+            rule = (1, mapping[0] - cp)
+        else:
+            key = tuple(mapping)
+            if key not in data_index:
+                data_index[key] = len(data)
+                data.extend(mapping)
+            rule = (len(mapping), data_index[key])
+        if rule not in rule_index:
+            rule_index[rule] = len(rules)
+            rules.append(rule)
+        fold_rules[cp] = rule_index[rule]
+
+    stage1, blocks = two_level(fold_rules, 0)
+    print("    /* Case folding: codepoint cp maps to the rule")
+    print("     * UNICODE_FOLD_RULES[UNICODE_FOLD_MAP[block][cp & 0xff]], with block as above. A rule")
+    print("     * folding to a single codepoint holds its offset from cp, else the index of")
+    print("     * the codepoints in UNICODE_FOLD_DATA.")
+    print("     * (generated by scripts/build_unicode_tables.py) */")
+    emit_array("static const unsigned char UNICODE_FOLD_STAGE1[%d]" % len(stage1),
+               ["%d" % x for x in stage1], 25)
+    rule_type = "unsigned char" if len(rules) <= 0x100 else "unsigned short"
+    print("    static const %s UNICODE_FOLD_MAP[%d][%d] = {" % (rule_type, len(blocks), BLOCK_SIZE))
+    for i, block in enumerate(blocks):
+        items = ["%d" % x for x in block]
+        for j in range(0, BLOCK_SIZE, 16):
+            lead = "        { " if j == 0 else "          "
+            tail = "," if j + 16 < BLOCK_SIZE else (" }," if i + 1 < len(blocks) else " }")
+            print(lead + ", ".join(items[j:j + 16]) + tail)
+    print("    };")
+    emit_array("static const MD_UNICODE_FOLD_RULE UNICODE_FOLD_RULES[%d]" % len(rules),
+               ["{ %d, %d }" % r for r in rules], 8)
+    emit_array("static const unsigned UNICODE_FOLD_DATA[%d]" % len(data),
+               ["0x%04x" % x for x in data], 12)
+
+    assert len(blocks) <= 0x100 and len(rules) <= 0x10000
+
+
+if __name__ == "__main__":
+    main()
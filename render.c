@@ -0,0 +1,8 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "md4c-html.h"
+static void out(const MD_CHAR* t, MD_SIZE n, void* u){ fwrite(t,1,n,(FILE*)u); }
+int main(int argc,char**argv){ unsigned pf=strtoul(argv[1],0,0); 
+ for(int i=2;i<argc;i++){ FILE*f=fopen(argv[i],"rb"); fseek(f,0,SEEK_END); long n=ftell(f); fseek(f,0,SEEK_SET); char*b=malloc(n+1); fread(b,1,n,f); fclose(f);
+  printf("=== %s\n",argv[i]); int r=md_html(b,n,out,stdout,pf,0); printf("ret=%d\n",r); free(b);} }
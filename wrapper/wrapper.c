@@ -1,42 +1,220 @@
 #include <lean/lean.h>
 #include <md4c-html.h>
+#include <entity.h>
 
 #ifndef __cplusplus
-// To avoid the need for stdlib.h - lean.h does this for malloc() already
-void *realloc(void *ptr, size_t new_size);
+// To avoid the need for string.h
+void *memcpy(void *dest, const void *src, size_t count);
 #endif
 
+// The batch API uses a native thread pool where POSIX threads are available. Under Windows, only
+// the headers in md4c/adhoc_include are available, so the batches are processed sequentially.
+#ifndef _WIN32
+#define MD4LEAN_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// All the native memory of the wrapper goes through md4c's allocator, so that
+// md_set_allocator() reroutes all of it at once. The sizes are checked to fit
+// MD_SIZE; like malloc(), these return 0 on failure.
+static void *native_malloc(size_t size) {
+    return size <= (MD_SIZE)-1 ? md_malloc((MD_SIZE)size) : 0;
+}
+
+static void *native_realloc(void *ptr, size_t size) {
+    return size <= (MD_SIZE)-1 ? md_realloc(ptr, (MD_SIZE)size) : 0;
+}
+
+static void native_free(void *ptr) {
+    md_free(ptr);
+}
+
+// A growable native byte buffer. md4c-html emits its output as many tiny
+// fragments (every tag and every escaped character is a fragment of its own),
+// so they are collected here and turned into a Lean string only once at the end.
+typedef struct output_buffer {
+    char *data;
+    size_t size;
+    size_t capacity;
+} output_buffer;
+
+static void output_buffer_init(output_buffer *buf, size_t capacity) {
+    if (capacity < 64) capacity = 64;
+    buf->data = native_malloc(capacity);
+    if (buf->data == 0) lean_internal_panic_out_of_memory();
+    buf->size = 0;
+    buf->capacity = capacity;
+}
+
+static void output_buffer_append(output_buffer *buf, const char *text, size_t size) {
+    if (size > buf->capacity - buf->size) {
+        size_t newcapacity = buf->capacity * 2;
+        while (newcapacity - buf->size < size) newcapacity *= 2;
+        buf->data = native_realloc(buf->data, newcapacity);
+        if (buf->data == 0) lean_internal_panic_out_of_memory();
+        buf->capacity = newcapacity;
+    }
+    memcpy(buf->data + buf->size, text, size);
+    buf->size += size;
+}
+
+static void output_buffer_free(output_buffer *buf) {
+    native_free(buf->data);
+    buf->data = 0;
+    buf->size = buf->capacity = 0;
+}
+
 static void
 process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
 {
-    lean_object **p_html_string = (lean_object**)userdata;
-    lean_object *new_string = lean_mk_string_from_bytes(text, size);
-    *p_html_string = lean_string_append(*p_html_string, new_string);
-    lean_dec_ref(new_string);
+    output_buffer_append((output_buffer*)userdata, text, size);
 }
 
-lean_obj_res lean_md4c_markdown_to_html(b_lean_obj_arg s, uint32_t p_flags, uint32_t r_flags) {
+// Renders `s`, using the parser state and the reference definitions if they are not NULL
+static lean_obj_res render_html(MD_PARSER_STATE *state, const MD_REF_DEF_TABLE *ref_defs,
+        b_lean_obj_arg s, uint32_t p_flags, uint32_t r_flags) {
     size_t input_size = lean_string_size(s) - 1;
-    lean_object *html_string = lean_mk_string("");
+    output_buffer html;
+    lean_object *html_string;
 
-    int ret = md_html(lean_string_cstr(s), (MD_SIZE)(lean_string_size(s) - 1), process_output,
-        (void*) &html_string, p_flags, r_flags);
+    // The HTML is usually somewhat longer than its Markdown source; reserve
+    // that up front so that most documents never need to grow the buffer.
+    output_buffer_init(&html, input_size + input_size / 4 + 256);
+
+    int ret = md_html_with_ref_defs(state, ref_defs, lean_string_cstr(s), (MD_SIZE)input_size,
+        process_output, (void*) &html, p_flags, r_flags);
 
     if(ret != 0) {
-        /* free the broken string */
-        lean_dec_ref(html_string);
         /* Option.none */
         html_string = lean_box(0);
     } else {
         /* Option.some */
-        lean_object *tmp = lean_alloc_ctor(1, 1, 0);
-        lean_ctor_set(tmp, 0, html_string);
-        html_string = tmp;
+        html_string = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(html_string, 0, lean_mk_string_from_bytes(html.data, html.size));
     }
 
+    output_buffer_free(&html);
     return html_string;
 }
 
+lean_obj_res lean_md4c_markdown_to_html(b_lean_obj_arg s, uint32_t p_flags, uint32_t r_flags) {
+    return render_html(NULL, NULL, s, p_flags, r_flags);
+}
+
+// Makes sure that `bytes` is exclusive and has room for `extra` more bytes, copying it if needed
+static lean_obj_res byte_array_reserve(lean_obj_arg bytes, size_t extra) {
+    size_t size = lean_sarray_size(bytes);
+    size_t capacity = lean_to_sarray(bytes)->m_capacity;
+    if (lean_is_exclusive(bytes) && extra <= capacity - size) return bytes;
+
+    size_t newcapacity = capacity < 64 ? 64 : capacity;
+    while (newcapacity - size < extra) newcapacity *= 2;
+    lean_object *result = lean_alloc_sarray(1, size, newcapacity);
+    memcpy(lean_sarray_cptr(result), lean_sarray_cptr(bytes), size);
+    lean_dec_ref(bytes);
+    return result;
+}
+
+static void
+process_output_bytes(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    lean_object **p_bytes = (lean_object**)userdata;
+    *p_bytes = byte_array_reserve(*p_bytes, size);
+    lean_sarray_object *bytes = lean_to_sarray(*p_bytes);
+    memcpy(bytes->m_data + bytes->m_size, text, size);
+    bytes->m_size += size;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_to_html_into(lean_obj_arg buf, b_lean_obj_arg s,
+        uint32_t p_flags, uint32_t r_flags) {
+    size_t input_size = lean_string_size(s) - 1;
+    size_t old_size = lean_sarray_size(buf);
+
+    // Reserve as much as lean_md4c_markdown_to_html would; this also takes care of copying a
+    // shared buffer exactly once.
+    buf = byte_array_reserve(buf, input_size + input_size / 4 + 256);
+
+    int ret = md_html(lean_string_cstr(s), (MD_SIZE)input_size, process_output_bytes,
+        (void*) &buf, p_flags, r_flags);
+
+    if (ret != 0) {
+        // Drop the partial output
+        lean_to_sarray(buf)->m_size = old_size;
+    }
+
+    return buf;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_clear_buffer(lean_obj_arg buf) {
+    if (lean_is_exclusive(buf)) {
+        lean_to_sarray(buf)->m_size = 0;
+        return buf;
+    }
+    lean_dec_ref(buf);
+    return lean_alloc_sarray(1, 0, 0);
+}
+
+// Size of the chunks handed to the Lean `write` callback by the streaming renderer
+#define HTML_CHUNK_SIZE (64 * 1024)
+
+// State of the streaming renderer. The output is collected into `chunk`, a ByteArray of capacity
+// HTML_CHUNK_SIZE, which is passed to `write` as soon as it is full. Once `write` fails, the
+// error is kept in `error` and the rest of the output is dropped.
+typedef struct output_stream {
+    b_lean_obj_arg write;
+    lean_object *chunk;
+    lean_object *error;
+} output_stream;
+
+static void output_stream_flush(output_stream *out) {
+    lean_object *chunk = out->chunk;
+    out->chunk = 0;
+    if (chunk == 0) return;
+    if (out->error != 0 || lean_sarray_size(chunk) == 0) {
+        lean_dec_ref(chunk);
+        return;
+    }
+    lean_inc(out->write);
+    lean_object *res = lean_apply_2(out->write, chunk, lean_io_mk_world());
+    if (lean_io_result_is_ok(res)) {
+        lean_dec_ref(res);
+    } else {
+        out->error = res;
+    }
+}
+
+static void
+process_output_stream(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    output_stream *out = (output_stream*)userdata;
+    while (size > 0 && out->error == 0) {
+        if (out->chunk == 0) out->chunk = lean_alloc_sarray(1, 0, HTML_CHUNK_SIZE);
+        lean_sarray_object *chunk = lean_to_sarray(out->chunk);
+        size_t n = HTML_CHUNK_SIZE - chunk->m_size;
+        if (n > size) n = size;
+        memcpy(chunk->m_data + chunk->m_size, text, n);
+        chunk->m_size += n;
+        text += n;
+        size -= n;
+        if (chunk->m_size == HTML_CHUNK_SIZE) output_stream_flush(out);
+    }
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_to_html_write(b_lean_obj_arg write, b_lean_obj_arg s,
+        uint32_t p_flags, uint32_t r_flags, lean_obj_arg world) {
+    output_stream out = {write, 0, 0};
+
+    int ret = md_html(lean_string_cstr(s), (MD_SIZE)(lean_string_size(s) - 1), process_output_stream,
+        (void*) &out, p_flags, r_flags);
+
+    // Whatever was rendered before a parse failure has been written already, so write the rest too
+    output_stream_flush(&out);
+
+    if (out.error != 0) return out.error;
+    return lean_io_result_mk_ok(lean_box(ret == 0 ? 1 : 0));
+}
+
 typedef union {
     MD_BLOCKTYPE block;
     MD_SPANTYPE span;
@@ -94,31 +272,77 @@ typedef struct parse_stack {
     lean_object **args;
     details *details;
     tag *tags;
+    // With `parseSlices`, the source string which the texts are sliced from, otherwise NULL
+    lean_object *source;
+    // With `parseSlices`, the shared `Slice` used for synthesized line breaks, or NULL
+    lean_object *newline;
+    // With MD_FLAG_COALESCETEXT, consecutive normal texts are collected here and saved as a
+    // single one. As long as the pieces follow each other in the input, only `pending_text` and
+    // `pending_size` are updated; otherwise they are copied to `pending_buf`.
+    int coalesce;
+    // With MD_FLAG_DECODEENTITIES, known entities are decoded into the surrounding normal text
+    // (which implies `coalesce`), and only unknown ones remain entity nodes
+    int decode_entities;
+    int has_pending;
+    int pending_copied;
+    const MD_CHAR *pending_text;
+    size_t pending_size;
+    output_buffer pending_buf;
+    const MD_CHAR *input;
+    size_t input_size;
+    // With `ParsedDoc`, the `ParsedDoc.Boundary`s found so far, otherwise NULL
+    lean_object *boundaries;
 } parse_stack;
 
+// Handled by the wrapper (see `parse_stack.coalesce` and `parse_stack.decode_entities`), never
+// passed to md4c
+#define MD_FLAG_COALESCETEXT 0x80000000u
+#define MD_FLAG_DECODEENTITIES 0x40000000u
+#define MD4LEAN_WRAPPER_FLAGS (MD_FLAG_COALESCETEXT | MD_FLAG_DECODEENTITIES)
+
 parse_stack *parse_stack_new() {
-    parse_stack *stk = malloc(sizeof(parse_stack));
+    parse_stack *stk = native_malloc(sizeof(parse_stack));
     if (stk == 0) lean_internal_panic_out_of_memory();
     stk->size = 64;
     stk->top = 0;
-    stk->args = malloc(sizeof(lean_object *) * stk->size);
+    stk->args = native_malloc(sizeof(lean_object *) * stk->size);
     if (stk->args == 0) lean_internal_panic_out_of_memory();
-    stk->details = malloc(sizeof(details) * stk->size);
+    stk->details = native_malloc(sizeof(details) * stk->size);
     if (stk->details == 0) lean_internal_panic_out_of_memory();
     stk->args[0] = lean_mk_empty_array();
-    stk->tags = malloc(sizeof(tag) * stk->size);
+    stk->tags = native_malloc(sizeof(tag) * stk->size);
+    stk->source = NULL;
+    stk->newline = NULL;
+    stk->coalesce = 0;
+    stk->decode_entities = 0;
+    stk->has_pending = 0;
+    stk->pending_copied = 0;
+    stk->pending_text = NULL;
+    stk->pending_size = 0;
+    stk->pending_buf.data = NULL;
+    stk->pending_buf.size = stk->pending_buf.capacity = 0;
+    stk->input = NULL;
+    stk->input_size = 0;
+    stk->boundaries = NULL;
 
     return stk;
 }
 
+void parse_stack_set_input(parse_stack *stk, const MD_CHAR *input, size_t input_size, uint32_t p_flags) {
+    stk->input = input;
+    stk->input_size = input_size;
+    stk->decode_entities = (p_flags & MD_FLAG_DECODEENTITIES) != 0;
+    stk->coalesce = (p_flags & MD_FLAG_COALESCETEXT) != 0 || stk->decode_entities;
+}
+
 void parse_stack_push(parse_stack *stk, details details, tag tag) {
     if (stk->top >= stk->size - 1) {
         size_t newsize = stk->size * 2;
-        stk->args = realloc(stk->args, sizeof(lean_object) * newsize);
+        stk->args = native_realloc(stk->args, sizeof(lean_object) * newsize);
         if (stk->args == 0) lean_internal_panic_out_of_memory();
-        stk->details = realloc(stk->details, sizeof(details) * newsize);
+        stk->details = native_realloc(stk->details, sizeof(details) * newsize);
         if (stk->details == 0) lean_internal_panic_out_of_memory();
-        stk->tags = realloc(stk->tags, sizeof(tag) * newsize);
+        stk->tags = native_realloc(stk->tags, sizeof(tag) * newsize);
         if (stk->tags == 0) lean_internal_panic_out_of_memory();
         stk->size = newsize;
     }
@@ -148,32 +372,204 @@ void parse_stack_free(parse_stack *stk) {
         lean_dec_ref(parse_stack_pop(stk));
     }
     lean_dec_ref(stk->args[0]);
-    free(stk->args);
-    free(stk->details);
-    free(stk->tags);
-    free(stk);
+    native_free(stk->args);
+    native_free(stk->details);
+    native_free(stk->tags);
+    if (stk->source != NULL) lean_dec_ref(stk->source);
+    if (stk->newline != NULL) lean_dec_ref(stk->newline);
+    if (stk->boundaries != NULL) lean_dec_ref(stk->boundaries);
+    native_free(stk->pending_buf.data);
+    native_free(stk);
+}
+
+// A `Slice` of `source` (borrowed)
+static lean_obj_res mk_slice(b_lean_obj_arg source, size_t start, size_t stop) {
+    lean_object *slice = lean_alloc_ctor(0, 3, 0);
+    lean_inc(source);
+    lean_ctor_set(slice, 0, source);
+    lean_ctor_set(slice, 1, lean_usize_to_nat(start));
+    lean_ctor_set(slice, 2, lean_usize_to_nat(stop));
+    return slice;
+}
+
+// The string of a text node: a copy of the text, or a `Slice` of the source with `parseSlices`.
+// `stk` may be NULL, meaning a copy.
+static lean_obj_res mk_text(parse_stack *stk, const MD_CHAR *text, MD_SIZE size) {
+    if (stk == NULL || stk->source == NULL) return lean_mk_string_from_bytes(text, size);
+
+    const char *source = lean_string_cstr(stk->source);
+    size_t source_size = lean_string_size(stk->source) - 1;
+    if (text >= source && text + size <= source + source_size) {
+        return mk_slice(stk->source, text - source, text - source + size);
+    }
+
+    // The text has been synthesized by md4c (e.g. a line break in a code block, or an attribute
+    // with its escapes resolved), so it is materialized into a string of its own. Line breaks are
+    // so common that they share one slice.
+    if (size == 1 && text[0] == '\n') {
+        if (stk->newline == NULL) {
+            lean_object *str = lean_mk_string_from_bytes(text, size);
+            stk->newline = mk_slice(str, 0, size);
+            lean_dec_ref(str);
+        }
+        lean_inc_ref(stk->newline);
+        return stk->newline;
+    }
+    lean_object *str = lean_mk_string_from_bytes(text, size);
+    lean_object *slice = mk_slice(str, 0, size);
+    lean_dec_ref(str);
+    return slice;
+}
+
+static int is_in_input(parse_stack *stk, const MD_CHAR *text, MD_SIZE size) {
+    return text >= stk->input && text + size <= stk->input + stk->input_size;
+}
+
+// Adds a normal text to the pending one, see `parse_stack.coalesce`
+static void parse_stack_pend_text(parse_stack *stk, const MD_CHAR *text, MD_SIZE size) {
+    if (!stk->has_pending && is_in_input(stk, text, size)) {
+        stk->has_pending = 1;
+        stk->pending_text = text;
+        stk->pending_size = size;
+        return;
+    }
+    if (stk->has_pending && !stk->pending_copied && text == stk->pending_text + stk->pending_size &&
+        is_in_input(stk, text, size)) {
+        stk->pending_size += size;
+        return;
+    }
+
+    // md4c may reuse the memory of texts which are not in the input, so they have to be copied
+    if (!stk->pending_copied) {
+        if (stk->pending_buf.data == NULL) output_buffer_init(&stk->pending_buf, 256);
+        stk->pending_buf.size = 0;
+        if (stk->has_pending) output_buffer_append(&stk->pending_buf, stk->pending_text, stk->pending_size);
+        stk->pending_copied = 1;
+    }
+    output_buffer_append(&stk->pending_buf, text, size);
+    stk->has_pending = 1;
+}
+
+// Takes the pending normal text, if any, as the string of a text node
+static lean_obj_res parse_stack_take_text(parse_stack *stk) {
+    if (!stk->has_pending) return NULL;
+
+    lean_object *str;
+    if (stk->pending_copied) {
+        str = mk_text(stk, stk->pending_buf.data, stk->pending_buf.size);
+    } else {
+        str = mk_text(stk, stk->pending_text, stk->pending_size);
+    }
+    stk->has_pending = 0;
+    stk->pending_copied = 0;
+    return str;
+}
+
+// Saves the pending normal text, if any. Called first by all the callbacks.
+static void parse_stack_flush_text(parse_stack *stk) {
+    lean_object *str = parse_stack_take_text(stk);
+    if (str == NULL) return;
+
+    lean_object *txt = lean_alloc_ctor(0, 1, 0);
+    lean_ctor_set(txt, 0, str);
+    parse_stack_save(stk, txt);
+}
+
+// Decodes the entity `text` (e.g. `&amp;` or `&#x27;`) into UTF-8, returning the number of bytes
+// written to `utf8`, or 0 if it is an unknown named entity. Invalid numeric references decode
+// to U+FFFD, as in md4c-html.
+static size_t decode_entity(const MD_CHAR *text, MD_SIZE size, char utf8[8]) {
+    if (size <= 3 || text[1] != '#') {
+        const ENTITY *ent = entity_lookup(text, size);
+        if (ent == NULL) return 0;
+        memcpy(utf8, ent->utf8, ent->utf8_size);
+        return ent->utf8_size;
+    }
+
+    // md4c only reports well-formed references of at most 7 digits, so this cannot overflow
+    unsigned codepoint = 0;
+    if (text[2] == 'x' || text[2] == 'X') {
+        for (MD_SIZE i = 3; i < size - 1; i++) {
+            char ch = text[i];
+            unsigned digit = ch <= '9' ? ch - '0' : (ch | 0x20) - 'a' + 10;
+            codepoint = 16 * codepoint + digit;
+        }
+    } else {
+        for (MD_SIZE i = 2; i < size - 1; i++)
+            codepoint = 10 * codepoint + (text[i] - '0');
+    }
+    // Surrogates are replaced as well, as Lean strings must be valid UTF-8
+    if (codepoint == 0 || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint <= 0xdfff))
+        codepoint = 0xfffd;
+
+    if (codepoint <= 0x7f) {
+        utf8[0] = (char)codepoint;
+        return 1;
+    } else if (codepoint <= 0x7ff) {
+        utf8[0] = (char)(0xc0 | (codepoint >> 6));
+        utf8[1] = (char)(0x80 | (codepoint & 0x3f));
+        return 2;
+    } else if (codepoint <= 0xffff) {
+        utf8[0] = (char)(0xe0 | (codepoint >> 12));
+        utf8[1] = (char)(0x80 | ((codepoint >> 6) & 0x3f));
+        utf8[2] = (char)(0x80 | (codepoint & 0x3f));
+        return 3;
+    } else {
+        utf8[0] = (char)(0xf0 | (codepoint >> 18));
+        utf8[1] = (char)(0x80 | ((codepoint >> 12) & 0x3f));
+        utf8[2] = (char)(0x80 | ((codepoint >> 6) & 0x3f));
+        utf8[3] = (char)(0x80 | (codepoint & 0x3f));
+        return 4;
+    }
+}
+
+
+// Pushes the pending normal text, if any, to `dest` as an `AttrText.normal`
+static lean_obj_res attr_push_pending(parse_stack *stk, lean_obj_arg dest) {
+    lean_object *str = parse_stack_take_text(stk);
+    if (str == NULL) return dest;
+
+    lean_object *ctor = lean_alloc_ctor(0, 1, 0);
+    lean_ctor_set(ctor, 0, str);
+    return lean_array_push(dest, ctor);
 }
 
-lean_obj_res get_attr(MD_ATTRIBUTE attr, lean_obj_arg dest) {
+lean_obj_res get_attr(parse_stack *stk, MD_ATTRIBUTE attr, lean_obj_arg dest) {
     assert(lean_is_array(dest));
     if (attr.size == 0)
         return dest;
+    // With MD_FLAG_DECODEENTITIES, the normal texts and the decoded entities are collected as the
+    // pending text (which the callbacks have flushed before) and pushed as a single normal text
+    int decode = stk != NULL && stk->decode_entities;
     for (unsigned i = 0; attr.substr_offsets[i] < attr.size; i++) {
         size_t start = attr.substr_offsets[i];
         size_t end = attr.substr_offsets[i + 1];
+        MD_TEXTTYPE type = attr.substr_types[i];
+        if (decode) {
+            char utf8[8];
+            size_t size = type == MD_TEXT_ENTITY ?
+                decode_entity(attr.text + start, end - start, utf8) : 0;
+            if (size > 0) {
+                parse_stack_pend_text(stk, utf8, size);
+                continue;
+            }
+            if (type == MD_TEXT_NORMAL) {
+                parse_stack_pend_text(stk, attr.text + start, end - start);
+                continue;
+            }
+            dest = attr_push_pending(stk, dest);
+        }
         // The constructor indices below are for type AttrText, not Text
-        switch (attr.substr_types[i]) {
+        switch (type) {
         case MD_TEXT_NORMAL: {
-            lean_object *str =
-                lean_mk_string_from_bytes(attr.text + start, end - start);
+            lean_object *str = mk_text(stk, attr.text + start, end - start);
             lean_object *ctor = lean_alloc_ctor(0, 1, 0);
             lean_ctor_set(ctor, 0, str);
             dest = lean_array_push(dest, ctor);
             break;
         }
         case MD_TEXT_ENTITY: {
-            lean_object *str =
-                lean_mk_string_from_bytes(attr.text + start, end - start);
+            lean_object *str = mk_text(stk, attr.text + start, end - start);
             lean_object *ctor = lean_alloc_ctor(1, 1, 0);
             lean_ctor_set(ctor, 0, str);
             dest = lean_array_push(dest, ctor);
@@ -187,6 +583,7 @@ lean_obj_res get_attr(MD_ATTRIBUTE attr, lean_obj_arg dest) {
             lean_internal_panic_unreachable();
         }
     }
+    if (decode) dest = attr_push_pending(stk, dest);
     return dest;
 }
 
@@ -214,6 +611,8 @@ static unsigned int block_ctor(MD_BLOCKTYPE type) {
 static int enter_block_callback(MD_BLOCKTYPE type, void *detail, void *stack) {
     details block_details = no_detail;
 
+    parse_stack_flush_text((parse_stack *)stack);
+
     // See note on typedef tag
     if (parse_stack_top_tag(stack) == TAG_IMPLICIT_P) {
         lean_object *texts = parse_stack_pop((parse_stack *)stack);
@@ -247,6 +646,8 @@ static int enter_block_callback(MD_BLOCKTYPE type, void *detail, void *stack) {
 static int leave_block_callback(MD_BLOCKTYPE type, void *detail, void *userdata) {
     parse_stack *stack = (parse_stack *)userdata;
 
+    parse_stack_flush_text(stack);
+
     switch (type) {
     case MD_BLOCK_DOC: {
         assert(stack->top == 1);
@@ -350,8 +751,8 @@ static int leave_block_callback(MD_BLOCKTYPE type, void *detail, void *userdata)
     }
     case MD_BLOCK_CODE: {
         MD_BLOCK_CODE_DETAIL *code_detail = (MD_BLOCK_CODE_DETAIL *) detail;
-        lean_object *info = get_attr(code_detail->info, lean_mk_empty_array());
-        lean_object *lang = get_attr(code_detail->lang, lean_mk_empty_array());
+        lean_object *info = get_attr(stack, code_detail->info, lean_mk_empty_array());
+        lean_object *lang = get_attr(stack, code_detail->lang, lean_mk_empty_array());
         lean_object *strings = parse_stack_pop(stack);
         lean_object *code = lean_alloc_ctor(block_ctor(type), 4, 0);
         lean_ctor_set(code, 0, info);
@@ -386,9 +787,11 @@ static int leave_block_callback(MD_BLOCKTYPE type, void *detail, void *userdata)
         // don't need it for anything, so it's ignored
         lean_object *args = parse_stack_pop(stack);
         assert(lean_is_array(args));
-        assert(lean_array_size(args) == 2);
+        // md4c reports no TBODY for a table without any body rows
+        assert(lean_array_size(args) == 1 || lean_array_size(args) == 2);
         lean_object *thead = lean_array_uget(args, 0);
-        lean_object *tbody = lean_array_uget(args, 1);
+        lean_object *tbody =
+            lean_array_size(args) == 2 ? lean_array_uget(args, 1) : lean_mk_empty_array();
         lean_dec_ref(args);
         lean_object *table = lean_alloc_ctor(block_ctor(type), 2, 0);
         lean_ctor_set(table, 0, thead);
@@ -433,6 +836,8 @@ static int leave_block_callback(MD_BLOCKTYPE type, void *detail, void *userdata)
 }
 
 static int enter_span_callback(MD_SPANTYPE type, void *detail, void *stack) {
+    parse_stack_flush_text((parse_stack *)stack);
+
     // If the span is nested right below a LI, push a block as well. See note next to typedef tag.
     if (parse_stack_top_tag((parse_stack *)stack) == TAG_LI) {
         parse_stack_push((parse_stack *)stack, (details)no_detail, TAG_IMPLICIT_P);
@@ -471,6 +876,8 @@ static unsigned span_ctor(MD_SPANTYPE type) {
 
 static int leave_span_callback(MD_SPANTYPE type, void *detail, void *userdata) {
     parse_stack *stack = (parse_stack *)userdata;
+
+    parse_stack_flush_text(stack);
     switch (type) {
     // All these spans take an array of arguments. Even though the arguments
     // aren't the same type for each constructor, it doesn't matter here.
@@ -500,10 +907,10 @@ static int leave_span_callback(MD_SPANTYPE type, void *detail, void *userdata) {
         lean_ctor_set_uint8(a, 3 * sizeof(void *),
                             a_detail->is_autolink ? 1 : 0);
         lean_object *href = lean_mk_empty_array();
-        href = get_attr(a_detail->href, href);
+        href = get_attr(stack, a_detail->href, href);
         lean_ctor_set(a, 0, href);
         lean_object *title = lean_mk_empty_array();
-        title = get_attr(a_detail->title, title);
+        title = get_attr(stack, a_detail->title, title);
         lean_ctor_set(a, 1, title);
         lean_ctor_set(a, 2, txt);
         parse_stack_save(stack, a);
@@ -515,10 +922,10 @@ static int leave_span_callback(MD_SPANTYPE type, void *detail, void *userdata) {
         lean_object *alt = parse_stack_pop(stack);
         lean_object *img = lean_alloc_ctor(span_ctor(type), 3, 0);
         lean_object *src = lean_mk_empty_array();
-        src = get_attr(img_detail->src, src);
+        src = get_attr(stack, img_detail->src, src);
         lean_ctor_set(img, 0, src);
         lean_object *title = lean_mk_empty_array();
-        title = get_attr(img_detail->title, title);
+        title = get_attr(stack, img_detail->title, title);
         lean_ctor_set(img, 1, title);
         lean_ctor_set(img, 2, alt);
         parse_stack_save(stack, img);
@@ -529,7 +936,7 @@ static int leave_span_callback(MD_SPANTYPE type, void *detail, void *userdata) {
         lean_object *txt = parse_stack_pop(stack);
         lean_object *wl = lean_alloc_ctor(span_ctor(type), 2, 1);
         lean_object *target = lean_mk_empty_array();
-        target = get_attr(wl_detail->target, target);
+        target = get_attr(stack, wl_detail->target, target);
         lean_ctor_set(wl, 0, target);
         lean_ctor_set(wl, 1, txt);
         parse_stack_save(stack, wl);
@@ -543,6 +950,21 @@ static int leave_span_callback(MD_SPANTYPE type, void *detail, void *userdata) {
 static int text_callback(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, void *userdata) {
     parse_stack *stack = (parse_stack *)userdata;
 
+    // A known entity is handled as the normal text it stands for
+    char utf8[8];
+    if (type == MD_TEXT_ENTITY && stack->decode_entities) {
+        size_t decoded_size = decode_entity(text, size, utf8);
+        if (decoded_size > 0) {
+            type = MD_TEXT_NORMAL;
+            text = utf8;
+            size = (MD_SIZE)decoded_size;
+        }
+    }
+
+    if (type != MD_TEXT_NORMAL || !stack->coalesce) {
+        parse_stack_flush_text(stack);
+    }
+
     // If the span is nested right below a LI, push a block as well. See note next to typedef tag.
     if (parse_stack_top_tag(stack) == TAG_LI) {
         parse_stack_push(stack, (details)no_detail, TAG_IMPLICIT_P);
@@ -550,8 +972,12 @@ static int text_callback(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, vo
 
     switch (type) {
     case MD_TEXT_NORMAL: {
+        if (stack->coalesce) {
+            parse_stack_pend_text(stack, text, size);
+            break;
+        }
         lean_object *txt = lean_alloc_ctor(0, 1, 0);
-        lean_ctor_set(txt, 0, lean_mk_string_from_bytes(text, size));
+        lean_ctor_set(txt, 0, mk_text(stack, text, size));
         parse_stack_save(stack, txt);
         break;
     }
@@ -561,19 +987,19 @@ static int text_callback(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, vo
     }
     case MD_TEXT_BR: {
         lean_object *txt = lean_alloc_ctor(2, 1, 0);
-        lean_ctor_set(txt, 0, lean_mk_string_from_bytes(text, size));
+        lean_ctor_set(txt, 0, mk_text(stack, text, size));
         parse_stack_save(stack, txt);
         break;
     }
     case MD_TEXT_SOFTBR: {
         lean_object *txt = lean_alloc_ctor(3, 1, 0);
-        lean_ctor_set(txt, 0, lean_mk_string_from_bytes(text, size));
+        lean_ctor_set(txt, 0, mk_text(stack, text, size));
         parse_stack_save(stack, txt);
         break;
     }
     case MD_TEXT_ENTITY: {
         lean_object *txt = lean_alloc_ctor(4, 1, 0);
-        lean_ctor_set(txt, 0, lean_mk_string_from_bytes(text, size));
+        lean_ctor_set(txt, 0, mk_text(stack, text, size));
         parse_stack_save(stack, txt);
         break;
     }
@@ -584,19 +1010,33 @@ static int text_callback(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, vo
     case MD_TEXT_HTML: {
         // Invariant: occurs only in HTML elements, which expect arrays of
         // strings as args
-        parse_stack_save(stack, lean_mk_string_from_bytes(text, size));
+        parse_stack_save(stack, mk_text(stack, text, size));
         break;
     }
     case MD_TEXT_CODE: {
         // Invariant: occurs only and always inside of a code block or a code
         // inline. A given code block may have many of these in a row, however
-        parse_stack_save(stack, lean_mk_string_from_bytes(text, size));
+        parse_stack_save(stack, mk_text(stack, text, size));
         break;
     }
     case MD_TEXT_LATEXMATH: {
         // Invariant: occurs only in math elements, which expect arrays of
         // strings as args
-        parse_stack_save(stack, lean_mk_string_from_bytes(text, size));
+        parse_stack_save(stack, mk_text(stack, text, size));
+        break;
+    }
+    case MD_TEXT_RAW: {
+        // With `parseBlocks`, a line of the `Blocks.Inlines` of the block, which is just the
+        // array of its slices. Otherwise (MD_FLAG_SKIPINLINES passed to e.g. `parse`), the line
+        // is kept as a normal text.
+        if (stack->source != NULL) {
+            size_t start = text - lean_string_cstr(stack->source);
+            parse_stack_save(stack, mk_slice(stack->source, start, start + size));
+        } else {
+            lean_object *txt = lean_alloc_ctor(0, 1, 0);
+            lean_ctor_set(txt, 0, mk_text(stack, text, size));
+            parse_stack_save(stack, txt);
+        }
         break;
     }
 
@@ -607,25 +1047,8 @@ static int text_callback(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, vo
     return 0;
 }
 
-LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse(b_lean_obj_arg str, uint32_t p_flags) {
-    size_t input_size = lean_string_size(str) - 1;
-
-    parse_stack *stack = parse_stack_new();
-
-    MD_PARSER parser = {
-        0,
-        p_flags,
-        enter_block_callback,
-        leave_block_callback,
-        enter_span_callback,
-        leave_span_callback,
-        text_callback,
-        NULL, /* debug log */
-        NULL  /* Reserved field, always NULL*/
-    };
-
-    int ret = md_parse(lean_string_cstr(str), input_size, &parser, stack);
-
+// Turns the result of a parse into an `Option Document`, freeing the stack
+static lean_obj_res parse_stack_finish(parse_stack *stack, int ret) {
     if (ret != 0) {
         // Return none
         parse_stack_free(stack);
@@ -643,3 +1066,1233 @@ LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse(b_lean_obj_arg str, uint32_t p
         return some;
     }
 }
+
+static const MD_PARSER document_parser = {
+    0,
+    0,
+    enter_block_callback,
+    leave_block_callback,
+    enter_span_callback,
+    leave_span_callback,
+    text_callback,
+    NULL, /* debug log */
+    NULL  /* Reserved field, always NULL*/
+};
+
+// Parses `str`, using the parser state and the reference definitions if they are not NULL
+static lean_obj_res parse_document(MD_PARSER_STATE *state, const MD_REF_DEF_TABLE *ref_defs,
+        b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(str), input_size, p_flags);
+
+    MD_PARSER parser = document_parser;
+    parser.flags = p_flags & ~MD4LEAN_WRAPPER_FLAGS;
+
+    int ret = md_parse_with_ref_defs(state, ref_defs, lean_string_cstr(str), input_size, &parser,
+        stack);
+    return parse_stack_finish(stack, ret);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse(b_lean_obj_arg str, uint32_t p_flags) {
+    return parse_document(NULL, NULL, str, p_flags);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse_slices(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(str), input_size, p_flags);
+    lean_inc_ref(str);
+    stack->source = str;
+
+    MD_PARSER parser = document_parser;
+    parser.flags = p_flags & ~MD4LEAN_WRAPPER_FLAGS;
+
+    int ret = md_parse(lean_string_cstr(str), input_size, &parser, stack);
+    return parse_stack_finish(stack, ret);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_slice_to_string(b_lean_obj_arg slice) {
+    lean_object *source = lean_ctor_get(slice, 0);
+    lean_object *start = lean_ctor_get(slice, 1);
+    lean_object *stop = lean_ctor_get(slice, 2);
+    size_t source_size = lean_string_size(source) - 1;
+
+    // Clamp the range to the source; a `Slice` need not come from `parseSlices`
+    size_t stop_pos = lean_is_scalar(stop) ? lean_unbox(stop) : source_size;
+    if (stop_pos > source_size) stop_pos = source_size;
+    size_t start_pos = lean_is_scalar(start) ? lean_unbox(start) : stop_pos;
+    if (start_pos > stop_pos) start_pos = stop_pos;
+
+    return lean_mk_string_from_bytes(lean_string_cstr(source) + start_pos, stop_pos - start_pos);
+}
+
+// Reusable parsers.
+//
+// A `Parser` owns an MD_PARSER_STATE, so that md4c's buffers are allocated once for many
+// documents. A state must not be used by two threads at once; if a `Parser` is shared, the calls
+// which find it busy parse without the state instead.
+
+typedef struct parser_data {
+    MD_PARSER_STATE *state;
+    int busy;
+    // Buffers larger than this are released after each document
+    uint32_t retain_limit;
+} parser_data;
+
+static void parser_finalize(void *ptr) {
+    parser_data *data = (parser_data*)ptr;
+    md_parser_state_free(data->state);
+    native_free(data);
+}
+
+static void parser_foreach(void *ptr, b_lean_obj_arg fn) {
+    // No Lean objects inside
+}
+
+static lean_external_class *parser_class = NULL;
+
+static void parser_class_register(void) {
+    parser_class = lean_register_external_class(parser_finalize, parser_foreach);
+}
+
+#ifdef MD4LEAN_THREADS
+static pthread_once_t parser_class_once = PTHREAD_ONCE_INIT;
+#endif
+
+static lean_external_class *get_parser_class(void) {
+#ifdef MD4LEAN_THREADS
+    pthread_once(&parser_class_once, parser_class_register);
+#else
+    if (parser_class == NULL) parser_class_register();
+#endif
+    return parser_class;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_parser_new(uint32_t retain_limit, lean_obj_arg world) {
+    parser_data *data = native_malloc(sizeof(parser_data));
+    if (data == 0) lean_internal_panic_out_of_memory();
+    data->state = md_parser_state_new();
+    if (data->state == 0) lean_internal_panic_out_of_memory();
+    data->busy = 0;
+    data->retain_limit = retain_limit;
+    return lean_io_result_mk_ok(lean_alloc_external(get_parser_class(), data));
+}
+
+// Takes the state of the parser, or returns NULL if another thread is using it
+static MD_PARSER_STATE *parser_acquire(b_lean_obj_arg parser) {
+    parser_data *data = (parser_data*)lean_get_external_data(parser);
+    if (__atomic_exchange_n(&data->busy, 1, __ATOMIC_ACQUIRE)) return NULL;
+    return data->state;
+}
+
+static void parser_release(b_lean_obj_arg parser, MD_PARSER_STATE *state) {
+    if (state == NULL) return;
+    parser_data *data = (parser_data*)lean_get_external_data(parser);
+    md_parser_state_trim(state, data->retain_limit);
+    __atomic_store_n(&data->busy, 0, __ATOMIC_RELEASE);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_parser_parse(b_lean_obj_arg parser, b_lean_obj_arg str,
+        uint32_t p_flags) {
+    MD_PARSER_STATE *state = parser_acquire(parser);
+    lean_object *result = parse_document(state, NULL, str, p_flags);
+    parser_release(parser, state);
+    return result;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_parser_render_html(b_lean_obj_arg parser, b_lean_obj_arg s,
+        uint32_t p_flags, uint32_t r_flags) {
+    MD_PARSER_STATE *state = parser_acquire(parser);
+    lean_object *result = render_html(state, NULL, s, p_flags, r_flags);
+    parser_release(parser, state);
+    return result;
+}
+
+// Precompiled reference definitions.
+//
+// A `RefDefTable` owns an MD_REF_DEF_TABLE. The table is immutable, so it may be used by any
+// number of parses at once.
+
+static void ref_def_table_finalize(void *ptr) {
+    md_ref_def_table_free((MD_REF_DEF_TABLE*)ptr);
+}
+
+static void ref_def_table_foreach(void *ptr, b_lean_obj_arg fn) {
+    // No Lean objects inside
+}
+
+static lean_external_class *ref_def_table_class = NULL;
+
+static void ref_def_table_class_register(void) {
+    ref_def_table_class = lean_register_external_class(ref_def_table_finalize, ref_def_table_foreach);
+}
+
+#ifdef MD4LEAN_THREADS
+static pthread_once_t ref_def_table_class_once = PTHREAD_ONCE_INIT;
+#endif
+
+static lean_external_class *get_ref_def_table_class(void) {
+#ifdef MD4LEAN_THREADS
+    pthread_once(&ref_def_table_class_once, ref_def_table_class_register);
+#else
+    if (ref_def_table_class == NULL) ref_def_table_class_register();
+#endif
+    return ref_def_table_class;
+}
+
+static const MD_REF_DEF_TABLE *ref_def_table_get(b_lean_obj_arg table) {
+    return (const MD_REF_DEF_TABLE*)lean_get_external_data(table);
+}
+
+// Takes over the table of the reference definitions of a whole document as an
+// `Option RefDefTable`. The table keeps a copy of the document, which is not worth it without any
+// definitions.
+static lean_obj_res ref_def_table_option(MD_REF_DEF_TABLE *table) {
+    if (md_ref_def_table_size(table) == 0) {
+        md_ref_def_table_free(table);
+        return lean_box(0);
+    }
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, lean_alloc_external(get_ref_def_table_class(), table));
+    return some;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_ref_def_table_compile(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+    MD_REF_DEF_TABLE *table = md_ref_def_table_new(lean_string_cstr(str), (MD_SIZE)input_size,
+        p_flags & ~MD4LEAN_WRAPPER_FLAGS);
+    if (table == NULL) return lean_box(0);
+
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, lean_alloc_external(get_ref_def_table_class(), table));
+    return some;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_ref_def_table_size(b_lean_obj_arg table) {
+    return lean_unsigned_to_nat((unsigned)md_ref_def_table_size(ref_def_table_get(table)));
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse_with_ref_defs(b_lean_obj_arg table,
+        b_lean_obj_arg str, uint32_t p_flags) {
+    return parse_document(NULL, ref_def_table_get(table), str, p_flags);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_to_html_with_ref_defs(b_lean_obj_arg table,
+        b_lean_obj_arg s, uint32_t p_flags, uint32_t r_flags) {
+    return render_html(NULL, ref_def_table_get(table), s, p_flags, r_flags);
+}
+
+// Incremental reparse.
+//
+// `ParsedDoc.parseRange` parses a range of the source like `parse`, and also collects the
+// boundaries between its top-level blocks (see md_parse_range()) into `ParsedDoc.Boundary`s.
+
+static int boundary_callback(MD_OFFSET off, MD_SIZE n_ref_defs, void *userdata) {
+    parse_stack *stack = (parse_stack *)userdata;
+
+    // Boundaries are only ever between the top-level blocks
+    assert(stack->top == 1);
+    lean_object *boundary = lean_alloc_ctor(0, 3, 0);
+    lean_ctor_set(boundary, 0, lean_usize_to_nat(off));
+    lean_ctor_set(boundary, 1, lean_usize_to_nat(lean_array_size(stack->args[1])));
+    lean_ctor_set(boundary, 2, lean_usize_to_nat(n_ref_defs));
+    stack->boundaries = lean_array_push(stack->boundaries, boundary);
+    return 0;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_parse_range(b_lean_obj_arg ref_defs, b_lean_obj_arg str,
+        b_lean_obj_arg start, b_lean_obj_arg stop, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+
+    // Clamp the range to the input, as for `Slice`
+    size_t stop_pos = lean_is_scalar(stop) ? lean_unbox(stop) : input_size;
+    if (stop_pos > input_size) stop_pos = input_size;
+    size_t start_pos = lean_is_scalar(start) ? lean_unbox(start) : stop_pos;
+    if (start_pos > stop_pos) start_pos = stop_pos;
+
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(str), input_size, p_flags);
+    stack->boundaries = lean_mk_empty_array();
+
+    MD_PARSER parser = document_parser;
+    parser.flags = p_flags & ~MD4LEAN_WRAPPER_FLAGS;
+
+    const MD_REF_DEF_TABLE *table = NULL;
+    if (!lean_is_scalar(ref_defs)) table = ref_def_table_get(lean_ctor_get(ref_defs, 0));
+
+    MD_SIZE n_ref_defs = 0;
+    int ret = md_parse_range(NULL, table, lean_string_cstr(str), (MD_SIZE)input_size,
+        (MD_OFFSET)start_pos, (MD_OFFSET)stop_pos, &parser, boundary_callback, stack, &n_ref_defs);
+    lean_object *boundaries = stack->boundaries;
+    stack->boundaries = NULL;
+    lean_object *some = parse_stack_finish(stack, ret);
+    if (lean_is_scalar(some)) {
+        lean_dec_ref(boundaries);
+        return some;
+    }
+
+    // Reuse the `some` around the blocks for the `ParsedDoc.RangeResult`
+    lean_object *result = lean_alloc_ctor(0, 3, 0);
+    lean_ctor_set(result, 0, lean_ctor_get(some, 0));
+    lean_ctor_set(result, 1, boundaries);
+    lean_ctor_set(result, 2, lean_usize_to_nat(n_ref_defs));
+    lean_ctor_set(some, 0, result);
+    return some;
+}
+
+// Section indices.
+//
+// `SectionIndex.scan` makes one pass over a document with callbacks which only note the top-level
+// headings and the boundaries (see md_parse_range()), while md_ref_def_table_new_with_parser()
+// collects the reference definitions of the document along the way.
+
+typedef struct section_scan {
+    lean_object *boundaries;    // Array Nat
+    lean_object *headings;      // Array SectionIndex.Heading
+    output_buffer title;        // the text of the heading being scanned
+    unsigned depth;             // the number of blocks entered but not left yet, the DOC included
+    unsigned level;             // the level of the heading being scanned, or 0
+    size_t offset;              // the last boundary so far
+} section_scan;
+
+static int section_scan_enter_block(MD_BLOCKTYPE type, void *detail, void *userdata) {
+    section_scan *scan = (section_scan *)userdata;
+    if (scan->depth == 1 && type == MD_BLOCK_H) {
+        scan->level = ((MD_BLOCK_H_DETAIL *)detail)->level;
+        scan->title.size = 0;
+    }
+    scan->depth++;
+    return 0;
+}
+
+static int section_scan_leave_block(MD_BLOCKTYPE type, void *detail, void *userdata) {
+    section_scan *scan = (section_scan *)userdata;
+    scan->depth--;
+    if (scan->depth == 1 && type == MD_BLOCK_H) {
+        lean_object *heading = lean_alloc_ctor(0, 3, 0);
+        lean_ctor_set(heading, 0, lean_unsigned_to_nat(scan->level));
+        lean_ctor_set(heading, 1, lean_mk_string_from_bytes(scan->title.data, scan->title.size));
+        lean_ctor_set(heading, 2, lean_usize_to_nat(scan->offset));
+        scan->headings = lean_array_push(scan->headings, heading);
+        scan->level = 0;
+    }
+    return 0;
+}
+
+static int section_scan_span(MD_SPANTYPE type, void *detail, void *userdata) {
+    return 0;
+}
+
+static int section_scan_text(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, void *userdata) {
+    section_scan *scan = (section_scan *)userdata;
+    if (scan->level == 0) return 0;
+    switch (type) {
+    case MD_TEXT_NULLCHAR:
+        output_buffer_append(&scan->title, "\xEF\xBF\xBD", 3);
+        break;
+    case MD_TEXT_BR:
+    case MD_TEXT_SOFTBR:
+        output_buffer_append(&scan->title, " ", 1);
+        break;
+    case MD_TEXT_ENTITY: {
+        // Unknown named entities are kept as they are
+        char utf8[8];
+        size_t decoded_size = decode_entity(text, size, utf8);
+        if (decoded_size > 0)
+            output_buffer_append(&scan->title, utf8, decoded_size);
+        else
+            output_buffer_append(&scan->title, text, size);
+        break;
+    }
+    default:
+        output_buffer_append(&scan->title, text, size);
+        break;
+    }
+    return 0;
+}
+
+static int section_scan_boundary(MD_OFFSET off, MD_SIZE n_ref_defs, void *userdata) {
+    section_scan *scan = (section_scan *)userdata;
+    scan->boundaries = lean_array_push(scan->boundaries, lean_usize_to_nat(off));
+    scan->offset = off;
+    return 0;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_section_index_scan(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+    section_scan scan;
+    scan.boundaries = lean_mk_empty_array();
+    scan.headings = lean_mk_empty_array();
+    output_buffer_init(&scan.title, 64);
+    scan.depth = 0;
+    scan.level = 0;
+    scan.offset = 0;
+
+    MD_PARSER parser = {
+        0,
+        p_flags & ~MD4LEAN_WRAPPER_FLAGS,
+        section_scan_enter_block,
+        section_scan_leave_block,
+        section_scan_span,
+        section_scan_span,
+        section_scan_text,
+        NULL, /* debug log */
+        NULL  /* Reserved field, always NULL*/
+    };
+    MD_REF_DEF_TABLE *table = md_ref_def_table_new_with_parser(lean_string_cstr(str),
+        (MD_SIZE)input_size, &parser, section_scan_boundary, &scan);
+    output_buffer_free(&scan.title);
+    if (table == NULL) {
+        lean_dec_ref(scan.boundaries);
+        lean_dec_ref(scan.headings);
+        return lean_box(0);
+    }
+
+    lean_object *result = lean_alloc_ctor(0, 3, 0);
+    lean_ctor_set(result, 0, scan.boundaries);
+    lean_ctor_set(result, 1, scan.headings);
+    lean_ctor_set(result, 2, ref_def_table_option(table));
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, result);
+    return some;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_to_html_range(b_lean_obj_arg ref_defs,
+        b_lean_obj_arg s, b_lean_obj_arg start, b_lean_obj_arg stop, uint32_t p_flags,
+        uint32_t r_flags) {
+    size_t input_size = lean_string_size(s) - 1;
+
+    // Clamp the range to the input, as for `Slice`
+    size_t stop_pos = lean_is_scalar(stop) ? lean_unbox(stop) : input_size;
+    if (stop_pos > input_size) stop_pos = input_size;
+    size_t start_pos = lean_is_scalar(start) ? lean_unbox(start) : stop_pos;
+    if (start_pos > stop_pos) start_pos = stop_pos;
+
+    const MD_REF_DEF_TABLE *table = NULL;
+    if (!lean_is_scalar(ref_defs)) table = ref_def_table_get(lean_ctor_get(ref_defs, 0));
+
+    output_buffer html;
+    size_t range_size = stop_pos - start_pos;
+    output_buffer_init(&html, range_size + range_size / 4 + 256);
+    int ret = md_html_range(NULL, table, lean_string_cstr(s), (MD_SIZE)input_size,
+        (MD_OFFSET)start_pos, (MD_OFFSET)stop_pos, process_output, (void*) &html, p_flags, r_flags);
+
+    lean_object *html_string;
+    if (ret != 0) {
+        html_string = lean_box(0);
+    } else {
+        html_string = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(html_string, 0, lean_mk_string_from_bytes(html.data, html.size));
+    }
+    output_buffer_free(&html);
+    return html_string;
+}
+
+// Block skeletons.
+//
+// `parseBlocks` builds the AST of slices with MD_FLAG_SKIPINLINES, so the contents of paragraphs,
+// headers and table cells are arrays of the slices of their lines (see `text_callback`). The
+// reference definitions are collected along the way by md_ref_def_table_new_with_parser(), for
+// md_parse_inlines() to resolve the links of the contents later on.
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse_blocks(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(str), input_size, p_flags);
+    lean_inc_ref(str);
+    stack->source = str;
+
+    MD_PARSER parser = document_parser;
+    parser.flags = (p_flags & ~MD4LEAN_WRAPPER_FLAGS) | MD_FLAG_SKIPINLINES;
+
+    MD_REF_DEF_TABLE *table = md_ref_def_table_new_with_parser(lean_string_cstr(str),
+        (MD_SIZE)input_size, &parser, NULL, stack);
+    lean_object *some = parse_stack_finish(stack, table == NULL ? -1 : 0);
+    if (lean_is_scalar(some)) return some;
+
+    // Reuse the `some` around the blocks for the `Blocks.Document`
+    lean_object *doc = lean_alloc_ctor(0, 2, sizeof(uint32_t));
+    lean_ctor_set(doc, 0, lean_ctor_get(some, 0));
+    lean_ctor_set(doc, 1, ref_def_table_option(table));
+    lean_ctor_set_uint32(doc, 2 * sizeof(void*), p_flags);
+    lean_ctor_set(some, 0, doc);
+    return some;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_inlines_parse(b_lean_obj_arg lines, b_lean_obj_arg ref_defs,
+        uint32_t p_flags) {
+    size_t n_lines = lean_array_size(lines);
+    if (n_lines == 0) {
+        lean_object *some = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(some, 0, lean_mk_empty_array());
+        return some;
+    }
+
+    // All the lines must be slices of one source. Lines which are not (or which are out of range)
+    // make md_parse_inlines() fail.
+    lean_object *source = lean_ctor_get(lean_array_get_core(lines, 0), 0);
+    size_t input_size = lean_string_size(source) - 1;
+    MD_LINE_RANGE *ranges = native_malloc(n_lines * sizeof(MD_LINE_RANGE));
+    if (ranges == NULL) lean_internal_panic_out_of_memory();
+    for (size_t i = 0; i < n_lines; i++) {
+        lean_object *slice = lean_array_get_core(lines, i);
+        lean_object *start = lean_ctor_get(slice, 1);
+        lean_object *stop = lean_ctor_get(slice, 2);
+        size_t start_pos = lean_is_scalar(start) ? lean_unbox(start) : SIZE_MAX;
+        size_t stop_pos = lean_is_scalar(stop) ? lean_unbox(stop) : SIZE_MAX;
+        if (lean_ctor_get(slice, 0) != source || start_pos > input_size || stop_pos > input_size) {
+            start_pos = 1;
+            stop_pos = 0;
+        }
+        ranges[i].beg = (MD_OFFSET)start_pos;
+        ranges[i].end = (MD_OFFSET)stop_pos;
+    }
+
+    const MD_REF_DEF_TABLE *table = NULL;
+    if (!lean_is_scalar(ref_defs)) table = ref_def_table_get(lean_ctor_get(ref_defs, 0));
+
+    // The texts are collected into an extra level of the stack, as for the contents of a block
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(source), input_size, p_flags);
+    parse_stack_push(stack, no_detail, TAG_BLOCK);
+
+    MD_PARSER parser = document_parser;
+    parser.flags = p_flags & ~MD4LEAN_WRAPPER_FLAGS;
+
+    int ret = md_parse_inlines(NULL, table, lean_string_cstr(source), (MD_SIZE)input_size, ranges,
+        (MD_SIZE)n_lines, &parser, stack);
+    native_free(ranges);
+    if (ret != 0) {
+        parse_stack_free(stack);
+        return lean_box(0);
+    }
+
+    parse_stack_flush_text(stack);
+    lean_object *texts = parse_stack_pop(stack);
+    parse_stack_free(stack);
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, texts);
+    return some;
+}
+
+// Streaming parsers.
+//
+// A `StreamingParser` owns an MD_PARSER_STREAM together with the stack it builds the blocks on.
+// After each piece of input, the blocks completed so far are taken out of the DOC level of the
+// stack, which stays open until the end of the document.
+
+typedef struct streaming_parser_data {
+    MD_PARSER_STREAM *stream;
+    parse_stack *stack;
+    int busy;
+} streaming_parser_data;
+
+static void streaming_parser_finalize(void *ptr) {
+    streaming_parser_data *data = (streaming_parser_data*)ptr;
+    md_parser_stream_free(data->stream);
+    parse_stack_free(data->stack);
+    native_free(data);
+}
+
+static void streaming_parser_foreach(void *ptr, b_lean_obj_arg fn) {
+    // Between the calls, the stack holds nothing but empty arrays
+}
+
+static lean_external_class *streaming_parser_class = NULL;
+
+static void streaming_parser_class_register(void) {
+    streaming_parser_class = lean_register_external_class(streaming_parser_finalize,
+        streaming_parser_foreach);
+}
+
+#ifdef MD4LEAN_THREADS
+static pthread_once_t streaming_parser_class_once = PTHREAD_ONCE_INIT;
+#endif
+
+static lean_external_class *get_streaming_parser_class(void) {
+#ifdef MD4LEAN_THREADS
+    pthread_once(&streaming_parser_class_once, streaming_parser_class_register);
+#else
+    if (streaming_parser_class == NULL) streaming_parser_class_register();
+#endif
+    return streaming_parser_class;
+}
+
+// Drops whatever a failed parse left on the stack
+static void parse_stack_reset(parse_stack *stk) {
+    while (stk->top > 0) {
+        lean_dec_ref(parse_stack_pop(stk));
+    }
+    lean_dec_ref(stk->args[0]);
+    stk->args[0] = lean_mk_empty_array();
+    stk->has_pending = 0;
+    stk->pending_copied = 0;
+}
+
+// Takes the parser, or returns NULL if another thread is using it
+static streaming_parser_data *streaming_parser_acquire(b_lean_obj_arg parser) {
+    streaming_parser_data *data = (streaming_parser_data*)lean_get_external_data(parser);
+    if (__atomic_exchange_n(&data->busy, 1, __ATOMIC_ACQUIRE)) return NULL;
+    return data;
+}
+
+static void streaming_parser_release(streaming_parser_data *data) {
+    __atomic_store_n(&data->busy, 0, __ATOMIC_RELEASE);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_streaming_parser_new(uint32_t p_flags, lean_obj_arg world) {
+    streaming_parser_data *data = native_malloc(sizeof(streaming_parser_data));
+    if (data == 0) lean_internal_panic_out_of_memory();
+    data->stack = parse_stack_new();
+    // The texts are in md4c's buffer rather than in a Lean string, so they are always copied
+    parse_stack_set_input(data->stack, NULL, 0, p_flags);
+
+    MD_PARSER parser = document_parser;
+    parser.flags = p_flags & ~MD4LEAN_WRAPPER_FLAGS;
+    data->stream = md_parser_stream_new(&parser, data->stack);
+    if (data->stream == 0) lean_internal_panic_out_of_memory();
+    data->busy = 0;
+    return lean_io_result_mk_ok(lean_alloc_external(get_streaming_parser_class(), data));
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_streaming_parser_feed(b_lean_obj_arg parser, b_lean_obj_arg str,
+        lean_obj_arg world) {
+    streaming_parser_data *data = streaming_parser_acquire(parser);
+    if (data == NULL) return lean_io_result_mk_ok(lean_box(0));
+
+    parse_stack *stack = data->stack;
+    int ret = md_parser_feed(data->stream, lean_string_cstr(str), lean_string_size(str) - 1);
+    lean_object *blocks;
+    if (ret != 0) {
+        parse_stack_reset(stack);
+        blocks = NULL;
+    } else if (stack->top == 0) {
+        // MD_BLOCK_DOC is entered only with the first block
+        blocks = lean_mk_empty_array();
+    } else {
+        assert(stack->top == 1);
+        blocks = stack->args[1];
+        stack->args[1] = lean_mk_empty_array();
+    }
+    streaming_parser_release(data);
+
+    if (blocks == NULL) return lean_io_result_mk_ok(lean_box(0));
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, blocks);
+    return lean_io_result_mk_ok(some);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_streaming_parser_finish(b_lean_obj_arg parser,
+        lean_obj_arg world) {
+    streaming_parser_data *data = streaming_parser_acquire(parser);
+    if (data == NULL) return lean_io_result_mk_ok(lean_box(0));
+
+    parse_stack *stack = data->stack;
+    int ret = md_parser_finish(data->stream);
+    lean_object *blocks;
+    if (ret != 0) {
+        parse_stack_reset(stack);
+        blocks = NULL;
+    } else {
+        assert(stack->top == 0);
+        assert(lean_array_size(stack->args[0]) == 1);
+        blocks = lean_array_uget(stack->args[0], 0);
+        lean_dec_ref(stack->args[0]);
+        stack->args[0] = lean_mk_empty_array();
+    }
+    streaming_parser_release(data);
+
+    if (blocks == NULL) return lean_io_result_mk_ok(lean_box(0));
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, blocks);
+    return lean_io_result_mk_ok(some);
+}
+
+// Flat documents.
+//
+// A `FlatDocument` stores the nodes of the document in columns, indexed by the node number. The
+// nodes are numbered in the order md4c enters them, so the document itself is node 0. The columns
+// are collected in native buffers and turned into `ByteArray`s once at the end.
+
+// Bit of the kind column marking texts which are stored in `extra` rather than in the source
+#define FLAT_EXTRA 0x80
+
+// The first `NodeKind` of spans and texts; blocks come first, in the order of MD_BLOCKTYPE
+#define FLAT_SPAN_KIND (MD_BLOCK_TD + 1)
+#define FLAT_TEXT_KIND (FLAT_SPAN_KIND + MD_SPAN_U + 1)
+
+typedef struct flat_open {
+    uint32_t node;
+    uint32_t last_child;
+} flat_open;
+
+typedef struct flat_builder {
+    const char *source;
+    size_t source_size;
+    uint32_t n_nodes;
+    output_buffer kinds;
+    output_buffer parents;
+    output_buffer first_children;
+    output_buffer next_siblings;
+    output_buffer args;
+    output_buffer extra;
+    output_buffer open; // flat_open of the nodes entered but not left yet
+    lean_object *attrs;
+} flat_builder;
+
+static uint32_t *flat_u32(output_buffer *column) {
+    return (uint32_t*)column->data;
+}
+
+static uint32_t flat_add(flat_builder *b, uint8_t kind, uint32_t arg0, uint32_t arg1) {
+    uint32_t node = b->n_nodes++;
+    uint32_t parent = 0;
+    uint32_t none = 0;
+    uint32_t args[2] = {arg0, arg1};
+
+    if (b->open.size > 0) {
+        flat_open *top = (flat_open*)(b->open.data + b->open.size) - 1;
+        parent = top->node;
+        // Node 0 is never a child, so it stands for none
+        if (top->last_child != 0) {
+            flat_u32(&b->next_siblings)[top->last_child] = node;
+        } else {
+            flat_u32(&b->first_children)[parent] = node;
+        }
+        top->last_child = node;
+    }
+
+    output_buffer_append(&b->kinds, (const char*)&kind, 1);
+    output_buffer_append(&b->parents, (const char*)&parent, sizeof(uint32_t));
+    output_buffer_append(&b->first_children, (const char*)&none, sizeof(uint32_t));
+    output_buffer_append(&b->next_siblings, (const char*)&none, sizeof(uint32_t));
+    output_buffer_append(&b->args, (const char*)args, sizeof(args));
+    return node;
+}
+
+static void flat_set_args(flat_builder *b, uint32_t node, uint32_t arg0, uint32_t arg1) {
+    flat_u32(&b->args)[2 * node] = arg0;
+    flat_u32(&b->args)[2 * node + 1] = arg1;
+}
+
+// Appends the attributes to `attrs`, returning the index of the first one
+static uint32_t flat_add_attrs(flat_builder *b, const MD_ATTRIBUTE *attr1, const MD_ATTRIBUTE *attr2) {
+    uint32_t index = (uint32_t)lean_array_size(b->attrs);
+    b->attrs = lean_array_push(b->attrs, get_attr(NULL, *attr1, lean_mk_empty_array()));
+    if (attr2 != NULL) {
+        b->attrs = lean_array_push(b->attrs, get_attr(NULL, *attr2, lean_mk_empty_array()));
+    }
+    return index;
+}
+
+static int flat_enter_block(MD_BLOCKTYPE type, void *detail, void *userdata) {
+    flat_builder *b = (flat_builder*)userdata;
+    uint32_t arg0 = 0, arg1 = 0;
+
+    // Details which are only correct in the leave callback are stored by flat_leave_block
+    switch (type) {
+    case MD_BLOCK_UL: {
+        MD_BLOCK_UL_DETAIL *ul = (MD_BLOCK_UL_DETAIL*)detail;
+        arg1 = ul->mark | (ul->is_tight ? 0x80000000 : 0);
+        break;
+    }
+    case MD_BLOCK_OL: {
+        MD_BLOCK_OL_DETAIL *ol = (MD_BLOCK_OL_DETAIL*)detail;
+        arg0 = ol->start;
+        arg1 = ol->mark_delimiter | (ol->is_tight ? 0x80000000 : 0);
+        break;
+    }
+    case MD_BLOCK_H:
+        arg0 = ((MD_BLOCK_H_DETAIL*)detail)->level;
+        break;
+    case MD_BLOCK_TABLE: {
+        MD_BLOCK_TABLE_DETAIL *table = (MD_BLOCK_TABLE_DETAIL*)detail;
+        arg0 = table->col_count;
+        arg1 = table->body_row_count;
+        break;
+    }
+    case MD_BLOCK_TH:
+    case MD_BLOCK_TD:
+        arg0 = ((MD_BLOCK_TD_DETAIL*)detail)->align;
+        break;
+    default:
+        break;
+    }
+
+    flat_open open = {flat_add(b, (uint8_t)type, arg0, arg1), 0};
+    output_buffer_append(&b->open, (const char*)&open, sizeof(open));
+    return 0;
+}
+
+// Pops the innermost open node, returning it
+static uint32_t flat_leave(flat_builder *b) {
+    b->open.size -= sizeof(flat_open);
+    return ((flat_open*)(b->open.data + b->open.size))->node;
+}
+
+static int flat_leave_block(MD_BLOCKTYPE type, void *detail, void *userdata) {
+    flat_builder *b = (flat_builder*)userdata;
+    uint32_t node = flat_leave(b);
+
+    switch (type) {
+    case MD_BLOCK_LI: {
+        MD_BLOCK_LI_DETAIL *li = (MD_BLOCK_LI_DETAIL*)detail;
+        if (li->is_task) flat_set_args(b, node, li->task_mark, li->task_mark_offset);
+        break;
+    }
+    case MD_BLOCK_CODE: {
+        MD_BLOCK_CODE_DETAIL *code = (MD_BLOCK_CODE_DETAIL*)detail;
+        flat_set_args(b, node, code->fence_char, flat_add_attrs(b, &code->info, &code->lang));
+        break;
+    }
+    default:
+        break;
+    }
+    return 0;
+}
+
+static int flat_enter_span(MD_SPANTYPE type, void *detail, void *userdata) {
+    flat_builder *b = (flat_builder*)userdata;
+    flat_open open = {flat_add(b, (uint8_t)(FLAT_SPAN_KIND + type), 0, 0), 0};
+    output_buffer_append(&b->open, (const char*)&open, sizeof(open));
+    return 0;
+}
+
+static int flat_leave_span(MD_SPANTYPE type, void *detail, void *userdata) {
+    flat_builder *b = (flat_builder*)userdata;
+    uint32_t node = flat_leave(b);
+
+    switch (type) {
+    case MD_SPAN_A: {
+        MD_SPAN_A_DETAIL *a = (MD_SPAN_A_DETAIL*)detail;
+        flat_set_args(b, node, a->is_autolink ? 1 : 0, flat_add_attrs(b, &a->href, &a->title));
+        break;
+    }
+    case MD_SPAN_IMG: {
+        MD_SPAN_IMG_DETAIL *img = (MD_SPAN_IMG_DETAIL*)detail;
+        flat_set_args(b, node, 0, flat_add_attrs(b, &img->src, &img->title));
+        break;
+    }
+    case MD_SPAN_WIKILINK: {
+        MD_SPAN_WIKILINK_DETAIL *wl = (MD_SPAN_WIKILINK_DETAIL*)detail;
+        flat_set_args(b, node, 0, flat_add_attrs(b, &wl->target, NULL));
+        break;
+    }
+    default:
+        break;
+    }
+    return 0;
+}
+
+static int flat_text(MD_TEXTTYPE type, const MD_CHAR *text, MD_SIZE size, void *userdata) {
+    flat_builder *b = (flat_builder*)userdata;
+    uint8_t kind = (uint8_t)(FLAT_TEXT_KIND + type);
+
+    if (text >= b->source && text + size <= b->source + b->source_size) {
+        uint32_t start = (uint32_t)(text - b->source);
+        flat_add(b, kind, start, start + size);
+    } else {
+        // Synthesized by md4c, see mk_text
+        uint32_t start = (uint32_t)b->extra.size;
+        output_buffer_append(&b->extra, text, size);
+        flat_add(b, kind | FLAT_EXTRA, start, start + size);
+    }
+    return 0;
+}
+
+static lean_obj_res flat_column(output_buffer *column) {
+    lean_object *bytes = lean_alloc_sarray(1, column->size, column->size);
+    memcpy(lean_sarray_cptr(bytes), column->data, column->size);
+    output_buffer_free(column);
+    return bytes;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse_flat(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+    flat_builder b;
+
+    // Roughly one node per 8 bytes of input
+    size_t estimate = input_size / 8 + 16;
+    b.source = lean_string_cstr(str);
+    b.source_size = input_size;
+    b.n_nodes = 0;
+    output_buffer_init(&b.kinds, estimate);
+    output_buffer_init(&b.parents, estimate * sizeof(uint32_t));
+    output_buffer_init(&b.first_children, estimate * sizeof(uint32_t));
+    output_buffer_init(&b.next_siblings, estimate * sizeof(uint32_t));
+    output_buffer_init(&b.args, estimate * 2 * sizeof(uint32_t));
+    output_buffer_init(&b.extra, 256);
+    output_buffer_init(&b.open, 64 * sizeof(flat_open));
+    b.attrs = lean_mk_empty_array();
+
+    // A flat document has no node kind for the lines of MD_FLAG_SKIPINLINES, so the contents of
+    // the blocks are always parsed
+    MD_PARSER parser = {
+        0,
+        p_flags & ~(MD4LEAN_WRAPPER_FLAGS | MD_FLAG_SKIPINLINES),
+        flat_enter_block,
+        flat_leave_block,
+        flat_enter_span,
+        flat_leave_span,
+        flat_text,
+        NULL, /* debug log */
+        NULL  /* Reserved field, always NULL*/
+    };
+
+    int ret = md_parse(b.source, (MD_SIZE)input_size, &parser, &b);
+    output_buffer_free(&b.open);
+
+    if (ret != 0) {
+        output_buffer_free(&b.kinds);
+        output_buffer_free(&b.parents);
+        output_buffer_free(&b.first_children);
+        output_buffer_free(&b.next_siblings);
+        output_buffer_free(&b.args);
+        output_buffer_free(&b.extra);
+        lean_dec_ref(b.attrs);
+        return lean_box(0);
+    }
+
+    lean_object *doc = lean_alloc_ctor(0, 8, 0);
+    lean_inc_ref(str);
+    lean_ctor_set(doc, 0, str);
+    lean_ctor_set(doc, 1, flat_column(&b.kinds));
+    lean_ctor_set(doc, 2, flat_column(&b.parents));
+    lean_ctor_set(doc, 3, flat_column(&b.first_children));
+    lean_ctor_set(doc, 4, flat_column(&b.next_siblings));
+    lean_ctor_set(doc, 5, flat_column(&b.args));
+    lean_ctor_set(doc, 6, lean_mk_string_from_bytes(b.extra.data, b.extra.size));
+    output_buffer_free(&b.extra);
+    lean_ctor_set(doc, 7, b.attrs);
+
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, doc);
+    return some;
+}
+
+// Reads entry `node` of a column of 32-bit numbers of a `FlatDocument`, or 0 if out of range
+static uint32_t flat_get(b_lean_obj_arg doc, unsigned field, uint32_t node, unsigned width,
+        unsigned index) {
+    lean_object *column = lean_ctor_get(doc, field);
+    size_t pos = ((size_t)node * width + index) * sizeof(uint32_t);
+    if (pos + sizeof(uint32_t) > lean_sarray_size(column)) return 0;
+    uint32_t value;
+    memcpy(&value, lean_sarray_cptr(column) + pos, sizeof(uint32_t));
+    return value;
+}
+
+LEAN_EXPORT uint8_t lean_md4c_flat_kind(b_lean_obj_arg doc, uint32_t node) {
+    lean_object *kinds = lean_ctor_get(doc, 1);
+    if (node >= lean_sarray_size(kinds)) return 0;
+    uint8_t kind = lean_sarray_cptr(kinds)[node] & ~FLAT_EXTRA;
+    // Guard against columns not made by parseFlat; the result must be a valid `NodeKind`
+    return kind < FLAT_TEXT_KIND + MD_TEXT_LATEXMATH + 1 ? kind : 0;
+}
+
+LEAN_EXPORT uint8_t lean_md4c_flat_is_extra(b_lean_obj_arg doc, uint32_t node) {
+    lean_object *kinds = lean_ctor_get(doc, 1);
+    if (node >= lean_sarray_size(kinds)) return 0;
+    return (lean_sarray_cptr(kinds)[node] & FLAT_EXTRA) != 0;
+}
+
+LEAN_EXPORT uint32_t lean_md4c_flat_parent(b_lean_obj_arg doc, uint32_t node) {
+    return flat_get(doc, 2, node, 1, 0);
+}
+
+LEAN_EXPORT uint32_t lean_md4c_flat_first_child(b_lean_obj_arg doc, uint32_t node) {
+    return flat_get(doc, 3, node, 1, 0);
+}
+
+LEAN_EXPORT uint32_t lean_md4c_flat_next_sibling(b_lean_obj_arg doc, uint32_t node) {
+    return flat_get(doc, 4, node, 1, 0);
+}
+
+LEAN_EXPORT uint32_t lean_md4c_flat_arg0(b_lean_obj_arg doc, uint32_t node) {
+    return flat_get(doc, 5, node, 2, 0);
+}
+
+LEAN_EXPORT uint32_t lean_md4c_flat_arg1(b_lean_obj_arg doc, uint32_t node) {
+    return flat_get(doc, 5, node, 2, 1);
+}
+
+// Event tapes.
+//
+// A `Tape` owns the recorded MD_TAPE together with a reference to the source string, as the tape
+// refers to the texts of the document by their offsets.
+
+typedef struct tape_data {
+    MD_TAPE *tape;
+    lean_object *source;
+    uint32_t p_flags;
+} tape_data;
+
+static void tape_finalize(void *ptr) {
+    tape_data *data = (tape_data*)ptr;
+    md_free_tape(data->tape);
+    lean_dec(data->source);
+    native_free(data);
+}
+
+static void tape_foreach(void *ptr, b_lean_obj_arg fn) {
+    tape_data *data = (tape_data*)ptr;
+    lean_inc(fn);
+    lean_inc(data->source);
+    lean_dec(lean_apply_1(fn, data->source));
+}
+
+static lean_external_class *tape_class = NULL;
+
+static void tape_class_register(void) {
+    tape_class = lean_register_external_class(tape_finalize, tape_foreach);
+}
+
+#ifdef MD4LEAN_THREADS
+static pthread_once_t tape_class_once = PTHREAD_ONCE_INIT;
+#endif
+
+static lean_external_class *get_tape_class(void) {
+#ifdef MD4LEAN_THREADS
+    pthread_once(&tape_class_once, tape_class_register);
+#else
+    if (tape_class == NULL) tape_class_register();
+#endif
+    return tape_class;
+}
+
+static tape_data *tape_get(b_lean_obj_arg tape) {
+    return (tape_data*)lean_get_external_data(tape);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_record_tape(b_lean_obj_arg str, uint32_t p_flags) {
+    size_t input_size = lean_string_size(str) - 1;
+    MD_TAPE *tape;
+
+    if (md_parse_to_tape(lean_string_cstr(str), (MD_SIZE)input_size,
+            p_flags & ~MD4LEAN_WRAPPER_FLAGS, &tape) != 0) {
+        return lean_box(0);
+    }
+
+    tape_data *data = native_malloc(sizeof(tape_data));
+    if (data == 0) lean_internal_panic_out_of_memory();
+    data->tape = tape;
+    data->source = str;
+    data->p_flags = p_flags;
+    lean_inc(str);
+
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, lean_alloc_external(get_tape_class(), data));
+    return some;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_tape_to_html(b_lean_obj_arg tape, uint32_t r_flags) {
+    tape_data *data = tape_get(tape);
+    size_t input_size = lean_string_size(data->source) - 1;
+    output_buffer html;
+    lean_object *html_string;
+
+    output_buffer_init(&html, input_size + input_size / 4 + 256);
+
+    int ret = md_html_replay(data->tape, lean_string_cstr(data->source), (MD_SIZE)input_size,
+        process_output, (void*) &html, r_flags);
+
+    if (ret != 0) {
+        html_string = lean_box(0);
+    } else {
+        html_string = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(html_string, 0, lean_mk_string_from_bytes(html.data, html.size));
+    }
+
+    output_buffer_free(&html);
+    return html_string;
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_tape_to_document(b_lean_obj_arg tape) {
+    tape_data *data = tape_get(tape);
+    size_t input_size = lean_string_size(data->source) - 1;
+
+    parse_stack *stack = parse_stack_new();
+    parse_stack_set_input(stack, lean_string_cstr(data->source), input_size, data->p_flags);
+
+    int ret = md_replay_tape(data->tape, lean_string_cstr(data->source), (MD_SIZE)input_size,
+        &document_parser, stack);
+    return parse_stack_finish(stack, ret);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_tape_source(b_lean_obj_arg tape) {
+    lean_object *source = tape_get(tape)->source;
+    lean_inc(source);
+    return source;
+}
+
+// Batch processing.
+//
+// The documents of a batch are distributed over a pool of native threads. Each worker owns a
+// range of document indices and takes documents from its front; a worker whose range is empty
+// steals the back half of the largest remaining range. Since md_parse keeps all of its state on
+// the stack, the documents can be processed fully independently.
+
+typedef lean_obj_res (*batch_fn)(b_lean_obj_arg input, uint32_t p_flags, uint32_t r_flags);
+
+// The range [lo, hi) of document indices owned by a worker, packed as lo | hi << 32 so that it can
+// be updated with a single compare-and-swap. Padded to a cache line to avoid false sharing.
+typedef struct batch_range {
+    uint64_t packed;
+    char padding[64 - sizeof(uint64_t)];
+} batch_range;
+
+typedef struct batch_job {
+    batch_fn fn;
+    uint32_t p_flags;
+    uint32_t r_flags;
+    b_lean_obj_arg inputs;
+    lean_object *results;
+    unsigned n_workers;
+    batch_range *ranges;
+} batch_job;
+
+typedef struct batch_worker {
+    batch_job *job;
+    unsigned index;
+} batch_worker;
+
+#define BATCH_RANGE(lo, hi) ((uint64_t)(lo) | ((uint64_t)(hi) << 32))
+#define BATCH_LO(packed) ((uint32_t)(packed))
+#define BATCH_HI(packed) ((uint32_t)((packed) >> 32))
+
+// Takes the next document from the worker's own range. Returns 0 if the range is empty.
+static int batch_pop(batch_range *range, uint32_t *index) {
+    uint64_t old = __atomic_load_n(&range->packed, __ATOMIC_ACQUIRE);
+    while (BATCH_LO(old) < BATCH_HI(old)) {
+        uint64_t new = BATCH_RANGE(BATCH_LO(old) + 1, BATCH_HI(old));
+        if (__atomic_compare_exchange_n(&range->packed, &old, new, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *index = BATCH_LO(old);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Moves the back half of the largest range of another worker into the (empty) range of worker
+// `self`. Returns 0 if there is nothing left to steal, which means that the batch is done.
+static int batch_steal(batch_job *job, unsigned self) {
+    while (1) {
+        unsigned victim = self;
+        uint32_t best = 0;
+        uint64_t old = 0;
+        for (unsigned i = 0; i < job->n_workers; i++) {
+            uint64_t packed = __atomic_load_n(&job->ranges[i].packed, __ATOMIC_ACQUIRE);
+            if (i != self && BATCH_HI(packed) > BATCH_LO(packed) && BATCH_HI(packed) - BATCH_LO(packed) > best) {
+                victim = i;
+                best = BATCH_HI(packed) - BATCH_LO(packed);
+                old = packed;
+            }
+        }
+        if (victim == self) return 0;
+
+        uint32_t mid = BATCH_LO(old) + best / 2;
+        uint64_t new = BATCH_RANGE(BATCH_LO(old), mid);
+        if (__atomic_compare_exchange_n(&job->ranges[victim].packed, &old, new, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(&job->ranges[self].packed, BATCH_RANGE(mid, BATCH_HI(old)), __ATOMIC_RELEASE);
+            return 1;
+        }
+        // Someone else changed the victim's range in the meantime; look again.
+    }
+}
+
+static void batch_work(batch_job *job, unsigned self) {
+    uint32_t i;
+    do {
+        while (batch_pop(&job->ranges[self], &i)) {
+            lean_object *result = job->fn(lean_array_get_core(job->inputs, i), job->p_flags, job->r_flags);
+            lean_array_set_core(job->results, i, result);
+        }
+    } while (batch_steal(job, self));
+}
+
+#ifdef MD4LEAN_THREADS
+static void *batch_thread(void *arg) {
+    batch_worker *worker = (batch_worker *)arg;
+    // The results are Lean objects, so the thread needs Lean's thread-local allocator state
+    lean_initialize_thread();
+    batch_work(worker->job, worker->index);
+    lean_finalize_thread();
+    return 0;
+}
+#endif
+
+static unsigned batch_default_threads(void) {
+#ifdef MD4LEAN_THREADS
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n >= 1) return (unsigned)n;
+#endif
+    return 1;
+}
+
+static lean_obj_res batch_run(batch_fn fn, b_lean_obj_arg inputs, uint32_t p_flags, uint32_t r_flags,
+                              uint32_t n_threads) {
+    size_t n = lean_array_size(inputs);
+    if (n > UINT32_MAX) lean_internal_panic("md4lean: batch is too large");
+
+    lean_object *results = lean_alloc_array(n, n);
+    if (n_threads == 0) n_threads = batch_default_threads();
+    if (n_threads > n) n_threads = (uint32_t)n;
+#ifndef MD4LEAN_THREADS
+    n_threads = 1;
+#endif
+    if (n_threads <= 1) {
+        for (size_t i = 0; i < n; i++)
+            lean_array_set_core(results, i, fn(lean_array_get_core(inputs, i), p_flags, r_flags));
+        return results;
+    }
+
+    batch_job job = {fn, p_flags, r_flags, inputs, results, n_threads, 0};
+    job.ranges = native_malloc(sizeof(batch_range) * n_threads);
+    batch_worker *workers = native_malloc(sizeof(batch_worker) * n_threads);
+    if (job.ranges == 0 || workers == 0) lean_internal_panic_out_of_memory();
+    for (uint32_t w = 0; w < n_threads; w++) {
+        job.ranges[w].packed = BATCH_RANGE(n * w / n_threads, n * (w + 1) / n_threads);
+        workers[w].job = &job;
+        workers[w].index = w;
+    }
+
+#ifdef MD4LEAN_THREADS
+    // The calling thread is worker 0. If a thread can't be started, its range is simply stolen by
+    // the others.
+    pthread_t *threads = native_malloc(sizeof(pthread_t) * n_threads);
+    char *started = native_malloc(n_threads);
+    if (threads == 0 || started == 0) lean_internal_panic_out_of_memory();
+    for (uint32_t w = 1; w < n_threads; w++)
+        started[w] = pthread_create(&threads[w], 0, batch_thread, &workers[w]) == 0;
+    batch_work(&job, 0);
+    for (uint32_t w = 1; w < n_threads; w++)
+        if (started[w]) pthread_join(threads[w], 0);
+    native_free(threads);
+    native_free(started);
+#endif
+
+    native_free(workers);
+    native_free(job.ranges);
+    return results;
+}
+
+static lean_obj_res batch_render(b_lean_obj_arg input, uint32_t p_flags, uint32_t r_flags) {
+    return lean_md4c_markdown_to_html(input, p_flags, r_flags);
+}
+
+static lean_obj_res batch_parse(b_lean_obj_arg input, uint32_t p_flags, uint32_t r_flags) {
+    return lean_md4c_markdown_parse(input, p_flags);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_to_html_batch(b_lean_obj_arg inputs, uint32_t p_flags,
+        uint32_t r_flags, uint32_t n_threads) {
+    return batch_run(batch_render, inputs, p_flags, r_flags, n_threads);
+}
+
+LEAN_EXPORT lean_obj_res lean_md4c_markdown_parse_batch(b_lean_obj_arg inputs, uint32_t p_flags,
+        uint32_t n_threads) {
+    return batch_run(batch_parse, inputs, p_flags, 0, n_threads);
+}